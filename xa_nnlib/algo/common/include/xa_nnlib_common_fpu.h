@@ -71,6 +71,97 @@
 #include <xtensa/tie/xt_FP.h>
 #endif
 
+//-------------------------------------------------------------------------
+// IEEE-754 half precision storage format (f16 kernels)
+// Without half precision ALU, f16 data is widened to f32 for arithmetic
+// and rounded back (round to nearest even) when stored.
+//-------------------------------------------------------------------------
+typedef union
+{
+  float32_t f;
+  uint32_t u;
+} xa_nn_f32_bits_t;
+
+inline_ float32_t xa_nn_f16_to_f32(int16_t h)
+{
+  xa_nn_f32_bits_t v;
+  uint32_t x = (uint16_t)h;
+  uint32_t sign = (x & 0x8000) << 16;
+  uint32_t e = (x >> 10) & 0x1f;
+  uint32_t m = x & 0x3ff;
+
+  if(e == 0x1f)
+  {
+    /* Inf / NaN */
+    v.u = sign | 0x7f800000 | (m << 13);
+  }
+  else if(e != 0)
+  {
+    v.u = sign | ((e + 112) << 23) | (m << 13);
+  }
+  else if(m == 0)
+  {
+    v.u = sign;
+  }
+  else
+  {
+    /* Subnormal half, normalize */
+    e = 113;
+    while(!(m & 0x400))
+    {
+      m <<= 1;
+      e--;
+    }
+    v.u = sign | (e << 23) | ((m & 0x3ff) << 13);
+  }
+  return v.f;
+}
+
+inline_ int16_t xa_nn_f32_to_f16(float32_t f)
+{
+  xa_nn_f32_bits_t v;
+  uint32_t sign, absx, m, r, rem, shift, half;
+
+  v.f = f;
+  sign = (v.u >> 16) & 0x8000;
+  absx = v.u & 0x7fffffff;
+
+  if(absx >= 0x7f800000)
+  {
+    /* Inf / NaN, keep NaN quiet */
+    return (int16_t)(sign | 0x7c00 | ((absx > 0x7f800000) ? 0x200 : 0));
+  }
+  if(absx >= 0x477ff000)
+  {
+    /* Rounds beyond 65504 */
+    return (int16_t)(sign | 0x7c00);
+  }
+  if(absx < 0x38800000)
+  {
+    /* Subnormal or zero half */
+    if(absx < 0x33000000)
+    {
+      return (int16_t)sign;
+    }
+    shift = 126 - (absx >> 23);
+    m = (absx & 0x7fffff) | 0x800000;
+    r = m >> shift;
+    rem = m & ((1u << shift) - 1);
+    half = 1u << (shift - 1);
+  }
+  else
+  {
+    r = (absx - 0x38000000) >> 13;
+    rem = absx & 0x1fff;
+    half = 0x1000;
+  }
+  if(rem > half || (rem == half && (r & 1)))
+  {
+    r++;
+  }
+  return (int16_t)(sign | r);
+}
+
 //-------------------------------------------------------------------------
 // emulation of some ISA capabilities on SFPU
 //-------------------------------------------------------------------------
@@ -42,4 +42,12 @@ void *xa_nn_memcpy(void * dest,const void *src, size_t n);
 #endif
 #endif
 
+/* Specialised / generic path counters, see xa_nn_get_path_counters */
+#ifdef NNLIB_PATH_COUNTERS
+void xa_nn_path_count(WORD32 kernel, WORD32 specialised);
+#define XA_NNLIB_PATH_COUNT(kernel, specialised) xa_nn_path_count((kernel), (specialised))
+#else
+#define XA_NNLIB_PATH_COUNT(kernel, specialised)
+#endif
+
 #endif /* XA_NNLIB_COMMON_INTERNAL_H */
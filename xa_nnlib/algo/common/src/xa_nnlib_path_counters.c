@@ -0,0 +1,76 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xa_nnlib_common.h"
+
+#ifdef NNLIB_PATH_COUNTERS
+/* Plain counters, callers running kernels from several threads get
+ * approximate numbers */
+static xa_nn_path_counters_t path_counters[XA_NN_PATH_KERNELS] =
+{
+  {"matXvec_sym8sxasym8s", 0, 0},
+  {"elm_add_asym8s", 0, 0},
+  {"elm_sub_asym8s", 0, 0},
+  {"conv2d_depthwise_sym8sxasym8s", 0, 0},
+  {"conv2d_depthwise_sym8sxsym16s", 0, 0},
+};
+
+void xa_nn_path_count(WORD32 kernel, WORD32 specialised)
+{
+  if(specialised)
+    path_counters[kernel].specialised++;
+  else
+    path_counters[kernel].generic++;
+}
+
+WORD32 xa_nn_get_path_counters(xa_nn_path_counters_t *p_counters,
+    WORD32 kernel)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_counters, -1);
+  XA_NNLIB_ARG_CHK_COND(((kernel < 0) || (kernel >= XA_NN_PATH_KERNELS)), -1);
+
+  *p_counters = path_counters[kernel];
+  return 0;
+}
+
+void xa_nn_reset_path_counters(void)
+{
+  int i;
+  for(i = 0; i < XA_NN_PATH_KERNELS; i++)
+  {
+    path_counters[i].specialised = 0;
+    path_counters[i].generic = 0;
+  }
+}
+#else
+WORD32 xa_nn_get_path_counters(xa_nn_path_counters_t *p_counters,
+    WORD32 kernel)
+{
+  (void)p_counters;
+  (void)kernel;
+  return -1;
+}
+
+void xa_nn_reset_path_counters(void)
+{
+}
+#endif /* NNLIB_PATH_COUNTERS */
@@ -0,0 +1,112 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/* Common helper macros. */
+#include "xa_nnlib_common_fpu.h"
+#include "xa_type_def.h"
+#include "../../../ndsp/hifi4/include/NatureDSP_Signal_math.h"
+#include "xa_nnlib_err_chk.h"
+
+/* Half precision activations widen a block of inputs to single precision,
+ * run the vectorized single precision routine on it and round back. Blocks
+ * are kept on stack, 8 byte aligned for the NatureDSP routines. */
+#define F16_ACT_BLOCK 64
+
+typedef void (*xa_nn_act_f32_fn_t)(float32_t *y, const float32_t *x, int N);
+
+#if HAVE_VFPU
+static void vec_activation_f16_f16(
+    xa_nn_act_f32_fn_t act_fn,
+    WORD16       * __restrict__ p_out,
+    const WORD16 * __restrict__ p_vec,
+    WORD32        vec_length)
+{
+  FLOAT32 ALIGN(8) inp_f32[F16_ACT_BLOCK];
+  FLOAT32 ALIGN(8) out_f32[F16_ACT_BLOCK];
+  int i, j, block;
+
+  for(i = 0; i < vec_length; i += F16_ACT_BLOCK)
+  {
+    block = vec_length - i;
+    block = block < F16_ACT_BLOCK ? block : F16_ACT_BLOCK;
+
+    for(j = 0; j < block; j++)
+    {
+      inp_f32[j] = xa_nn_f16_to_f32(p_vec[i + j]);
+    }
+    act_fn(out_f32, inp_f32, block);
+    for(j = 0; j < block; j++)
+    {
+      p_out[i + j] = xa_nn_f32_to_f16(out_f32[j]);
+    }
+  }
+}
+#endif /* HAVE_VFPU */
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_vec_sigmoid_f16_f16,(
+    WORD16       *  p_out,
+    const WORD16 *  p_vec,
+    WORD32        vec_length)                  )
+#else
+WORD32 xa_nn_vec_sigmoid_f16_f16(
+    WORD16       * __restrict__ p_out,        /* result, floating point */
+    const WORD16 * __restrict__ p_vec,        /* input data, floating point */
+    WORD32        vec_length)                  /* length of vectors */
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+
+  vec_activation_f16_f16(xa_nnlib_vec_sigmoidf, p_out, p_vec, vec_length);
+  return 0;
+}
+#endif /* !HAVE_VFPU */
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_vec_tanh_f16_f16,(
+    WORD16       *  p_out,
+    const WORD16 *  p_vec,
+    WORD32        vec_length)                  )
+#else
+WORD32 xa_nn_vec_tanh_f16_f16(
+    WORD16       * __restrict__ p_out,        /* result, floating point */
+    const WORD16 * __restrict__ p_vec,        /* input data, floating point */
+    WORD32        vec_length)                  /* length of vectors */
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+
+  vec_activation_f16_f16(xa_nnlib_vec_tanhf, p_out, p_vec, vec_length);
+  return 0;
+}
+#endif /* !HAVE_VFPU */
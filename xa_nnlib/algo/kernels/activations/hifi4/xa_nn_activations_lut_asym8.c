@@ -0,0 +1,159 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common_fpu.h"
+#include "xa_type_def.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_kernels_api.h"
+#include "../../../ndsp/hifi4/include/NatureDSP_Signal_math.h"
+
+/* Lookup-table activations for asym8s data.
+ * An asym8s tensor can take only 256 distinct values, so any pointwise
+ * nonlinearity with fixed quantization parameters is fully described by a
+ * 256 entry table. xa_nn_vec_act_lut_init_asym8s builds the table once from
+ * the float scales (the way TFLite's PopulateLookupTable does) and
+ * xa_nn_vec_lut_asym8s_asym8s applies it. The table is indexed by the
+ * input value + 128. */
+
+WORD32 xa_nn_vec_lut_asym8s_asym8s(WORD8 * __restrict__ p_out,
+    const WORD8 * __restrict__ p_vec,
+    const WORD8 * __restrict__ p_lut,
+    WORD32 vec_length)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_lut, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((vec_length <= 0), -1);
+
+  /* No gather on HiFi4: four independent loads in flight per iteration
+   * keep the load slot busy */
+  const WORD8 *p_tbl = p_lut + 128;
+  int i;
+  for(i = 0; i < (vec_length >> 2); i++)
+  {
+    WORD32 i0 = p_vec[4*i + 0];
+    WORD32 i1 = p_vec[4*i + 1];
+    WORD32 i2 = p_vec[4*i + 2];
+    WORD32 i3 = p_vec[4*i + 3];
+    WORD8 o0 = p_tbl[i0];
+    WORD8 o1 = p_tbl[i1];
+    WORD8 o2 = p_tbl[i2];
+    WORD8 o3 = p_tbl[i3];
+    p_out[4*i + 0] = o0;
+    p_out[4*i + 1] = o1;
+    p_out[4*i + 2] = o2;
+    p_out[4*i + 3] = o3;
+  }
+  for(i = (vec_length & ~3); i < vec_length; i++)
+  {
+    p_out[i] = p_tbl[p_vec[i]];
+  }
+
+  return 0;
+}
+
+#if !HAVE_VFPU && !HAVE_FPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_vec_act_lut_init_asym8s,(
+    WORD8 *p_lut,
+    WORD32 act_type,
+    WORD32 inp_zero_bias,
+    FLOAT32 inp_scale,
+    WORD32 out_zero_bias,
+    FLOAT32 out_scale,
+    FLOAT32 alpha))
+#else
+/* 2*sqrt(2/pi), GELU tanh approximation written as x*sigmoid(.) */
+#define GELU_SIG_SCALE 1.5957691216f
+#define GELU_CUBIC     0.044715f
+
+static FLOAT32 act_lut_eval(WORD32 act_type, FLOAT32 x, FLOAT32 alpha)
+{
+  FLOAT32 y, t;
+  switch(act_type)
+  {
+    case XA_NN_ACT_LUT_SIGMOID:
+      y = xa_nnlib_scl_sigmoidf(x);
+      break;
+    case XA_NN_ACT_LUT_TANH:
+      y = xa_nnlib_scl_tanhf(x);
+      break;
+    case XA_NN_ACT_LUT_HARD_SWISH:
+      t = x + 3.0f;
+      t = t < 0.0f ? 0.0f : (t > 6.0f ? 6.0f : t);
+      y = x * t * (1.0f / 6.0f);
+      break;
+    case XA_NN_ACT_LUT_LEAKY_RELU:
+      y = x >= 0.0f ? x : alpha * x;
+      break;
+    case XA_NN_ACT_LUT_ELU:
+      /* e^x - 1 = 2*tanh(x/2) / (1 - tanh(x/2)), accurate near 0 */
+      t = xa_nnlib_scl_tanhf(0.5f * x);
+      y = x >= 0.0f ? x : alpha * (2.0f * t / (1.0f - t));
+      break;
+    case XA_NN_ACT_LUT_GELU:
+      y = x * xa_nnlib_scl_sigmoidf(GELU_SIG_SCALE * (x + GELU_CUBIC * x * x * x));
+      break;
+    case XA_NN_ACT_LUT_SWISH:
+    default:
+      y = x * xa_nnlib_scl_sigmoidf(x);
+      break;
+  }
+  return y;
+}
+
+WORD32 xa_nn_vec_act_lut_init_asym8s(WORD8 * __restrict__ p_lut,
+    WORD32 act_type,
+    WORD32 inp_zero_bias,
+    FLOAT32 inp_scale,
+    WORD32 out_zero_bias,
+    FLOAT32 out_scale,
+    FLOAT32 alpha)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_lut, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND(((act_type < XA_NN_ACT_LUT_SIGMOID) || (act_type > XA_NN_ACT_LUT_SWISH)), -1);
+  XA_NNLIB_ARG_CHK_COND(((inp_zero_bias < -128) || (inp_zero_bias > 127)), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_zero_bias < -128) || (out_zero_bias > 127)), -1);
+  XA_NNLIB_ARG_CHK_COND((!(inp_scale > 0.0f) || !(out_scale > 0.0f)), -1);
+
+  FLOAT32 inv_out_scale = 1.0f / out_scale;
+  int i;
+  for(i = -128; i < 128; i++)
+  {
+    FLOAT32 x = inp_scale * (FLOAT32)(i - inp_zero_bias);
+    FLOAT32 r = act_lut_eval(act_type, x, alpha) * inv_out_scale;
+    WORD32 q;
+
+    /* Clamp before the conversion so that large values can't overflow */
+    r = r < -512.0f ? -512.0f : (r > 512.0f ? 512.0f : r);
+    /* Round half away from zero */
+    q = r >= 0.0f ? (WORD32)(r + 0.5f) : -(WORD32)(0.5f - r);
+    q += out_zero_bias;
+    q = q < -128 ? -128 : (q > 127 ? 127 : q);
+    p_lut[i + 128] = (WORD8)q;
+  }
+
+  return 0;
+}
+#endif /* !HAVE_VFPU && !HAVE_FPU */
@@ -982,6 +982,313 @@ WORD32 xa_nn_vec_softmax_asym8s_16( WORD16 * __restrict__ p_out,
 
     return 0;
 }
+
+/* Softmax over outer_size rows of depth elements.
+ * exp(beta*(x - max)) of an asym8s row only depends on max - x, which is in
+ * [0, 255]. The exponentials (and their accumulation form) are evaluated once
+ * per call into tables in scratch and shared by all rows, each row is then
+ * a max search, a table lookup for the sum and one for the outputs. */
+#define SOFTMAX_ROWS_TBL_LEN 256
+
+/* ln(1 + i/16), Q5.26 */
+static const WORD32 ln_1_plus_x_q26[17] = {
+           0,  4068450,  7904286, 11532676, 14974910, 18249163, 21371068, 24354175,
+    27210303, 29949820, 32581878, 35114589, 37555180, 39910118, 42185213, 44385701,
+    46516320
+};
+static const WORD32 LN2_Q26 = 46516320;
+
+static void softmax_rows_init_tables(WORD32 *p_exp_tbl,
+                                     WORD32 *p_sum_tbl,
+                                     WORD32 *p_diff_tbl,
+                                     WORD32 diffmin,
+                                     WORD32 input_beta_left_shift,
+                                     WORD32 input_beta_multiplier)
+{
+    int k;
+    xtbool2 f;
+    ae_int32x2 *p_exp = (ae_int32x2 *)p_exp_tbl;
+    ae_int32x2 *p_sum = (ae_int32x2 *)p_sum_tbl;
+    ae_int32x2 *p_diff = (ae_int32x2 *)p_diff_tbl;
+    ae_int32x2 y, dequantized_y, exp_y, diff_min;
+    ae_int32x2 z = AE_ZERO32();
+    ae_int32x2 ONE = AE_MOVDA32(1);
+    ae_int32x2 CT = AE_MOVDA32(CONSTANT_TERM);
+    ae_int32x2 CT_1_BY_3 = AE_MOVDA32(CONSTANT_1_OVER_3);
+    ae_int32x2 CT_1_BY_8 = AE_MOVDA32(CONSTANT_1_OVER_8);
+    ae_int32x2 mask_6fs = AE_MOVDA32(MASK);
+    ae_int32x2 q_1_by_4 = AE_MOVDA32(ONE_QUATER_Q26);
+
+    diff_min = AE_MOVDA32(diffmin);
+    for(k = 0; k < SOFTMAX_ROWS_TBL_LEN; k += 2)
+    {
+        y = AE_MOVDA32X2(-k, -k - 1);
+        f = AE_LE32(diff_min, y);
+
+        MPY_BY_QUANT_MULT_GT_ONE_X2_OUT32(dequantized_y, y, input_beta_multiplier, input_beta_left_shift)
+        EXP_Q26(exp_y, dequantized_y);
+        AE_MOVF32X2(exp_y, z, f);
+        AE_S32X2_IP(exp_y, p_exp, sizeof(ae_int32x2));
+        AE_S32X2_IP(AE_SRAA32RS(exp_y, (int)12), p_sum, sizeof(ae_int32x2));
+
+        if(p_diff_tbl != NULL)
+        {
+            /* Below diffmin the log-softmax output saturates to -128 */
+            AE_MOVF32X2(dequantized_y, AE_MOVDA32(0x80000000), f);
+            AE_S32X2_IP(dequantized_y, p_diff, sizeof(ae_int32x2));
+        }
+    }
+}
+
+static inline WORD32 softmax_rows_max_asym8s(const WORD8 *p_in, WORD32 depth)
+{
+    int i;
+    WORD32 max_in_row = p_in[0];
+    for(i = 1; i < depth; i++)
+    {
+        max_in_row = p_in[i] > max_in_row ? p_in[i] : max_in_row;
+    }
+    return max_in_row;
+}
+
+/* Sum of exponentials in Q12.19, saturated as in the single vector kernels */
+static inline ae_int32x2 softmax_rows_sum_exp(const WORD32 *p_sum_tbl,
+                                              const WORD8 *p_in,
+                                              WORD32 max_in_row,
+                                              WORD32 depth)
+{
+    int i;
+    ae_int32x2 sum_exp = AE_ZERO32();
+    for(i = 0; i < depth - 1; i += 2)
+    {
+        ae_int32x2 e = AE_MOVDA32X2(p_sum_tbl[max_in_row - p_in[i]], p_sum_tbl[max_in_row - p_in[i + 1]]);
+        sum_exp = AE_ADD32S(sum_exp, e);
+    }
+    if(depth & 1)
+    {
+        sum_exp = AE_ADD32S(sum_exp, AE_MOVDA32X2(p_sum_tbl[max_in_row - p_in[depth - 1]], 0));
+    }
+    return AE_ADD32S_HL_LH(sum_exp, sum_exp);
+}
+
+/* ln of a Q12.19 sum of exponentials (>= 1.0) in Q5.26, linear
+ * interpolation between 16 points per octave */
+static WORD32 softmax_rows_log_sum_exp(ae_int32x2 sum_exp)
+{
+    int nsa, idx;
+    WORD32 norm, frac, delta, ln_sum;
+
+    nsa = AE_NSAZ32_L(sum_exp);
+    norm = AE_MOVAD32_L(AE_SLAA32(sum_exp, nsa)) - (1 << 30);
+    idx = norm >> 26;
+    frac = (norm & ((1 << 26) - 1)) << 5;
+    delta = ln_1_plus_x_q26[idx + 1] - ln_1_plus_x_q26[idx];
+    delta = AE_MOVAD32_L(AE_MULFP32X2RAS(AE_MOVDA32(delta), AE_MOVDA32(frac)));
+
+    ln_sum = (11 - nsa) * LN2_Q26 + ln_1_plus_x_q26[idx] + delta;
+    return ln_sum;
+}
+
+#define SOFTMAX_ROWS_ARG_CHK(out_type) \
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+    XA_NNLIB_ARG_CHK_PTR(p_vec, -1); \
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1); \
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(out_type), -1); \
+    XA_NNLIB_ARG_CHK_COND((outer_size <= 0), -1); \
+    XA_NNLIB_ARG_CHK_COND((depth <= 0), -1); \
+    XA_NNLIB_ARG_CHK_COND(((input_beta_left_shift < 0) || (input_beta_left_shift > 31)), -1); \
+    XA_NNLIB_ARG_CHK_COND((input_beta_multiplier < 0), -1);
+
+WORD32 xa_nn_softmax_rows_asym8s_asym8s( WORD8 * __restrict__ p_out,
+                    const   WORD8 * __restrict__ p_vec,
+                            WORD32  diffmin,
+                            WORD32  input_beta_left_shift,
+                            WORD32  input_beta_multiplier,
+                            WORD32  outer_size,
+                            WORD32  depth,
+                            pVOID   p_scratch)
+{
+    SOFTMAX_ROWS_ARG_CHK(WORD8)
+
+    int row, i;
+    int shift_bits_reciprocal;
+    WORD32 *p_exp_tbl, *p_sum_tbl;
+    ae_int32x2 sum_exp, recip_sum_exp, exp_y, unsat_out, out, a_min, a_max;
+    /* Second operand for XOR instruction used in SUB_128 */
+    ae_int64 offset_xor = AE_MOVINT64_FROMINT32X2(AE_MOVDA32(128));
+
+    /* Too few elements to pay for the tables */
+    if(outer_size * depth < SOFTMAX_ROWS_TBL_LEN)
+    {
+        for(row = 0; row < outer_size; row++)
+        {
+            xa_nn_vec_softmax_asym8s_asym8s(p_out + row * depth, p_vec + row * depth,
+                diffmin, input_beta_left_shift, input_beta_multiplier, depth, p_scratch);
+        }
+        return 0;
+    }
+
+    p_exp_tbl = (WORD32 *)ALIGN_PTR(p_scratch, ALIGNMENT);
+    p_sum_tbl = p_exp_tbl + SOFTMAX_ROWS_TBL_LEN;
+    softmax_rows_init_tables(p_exp_tbl, p_sum_tbl, NULL, diffmin, input_beta_left_shift, input_beta_multiplier);
+
+    a_min = AE_ZERO32();
+    a_max = AE_MOVDA32(255);
+    for(row = 0; row < outer_size; row++)
+    {
+        const WORD8 *p_in = p_vec + row * depth;
+        WORD8 *p_o = p_out + row * depth;
+        WORD32 max_in_row = softmax_rows_max_asym8s(p_in, depth);
+
+        sum_exp = softmax_rows_sum_exp(p_sum_tbl, p_in, max_in_row, depth);
+        recip_sum_exp = GetReciprocal(AE_SRAI64(AE_MOVINT64_FROMINT32X2(sum_exp), 32), 12, &shift_bits_reciprocal);
+
+        for(i = 0; i < depth - 1; i += 2)
+        {
+            exp_y = AE_MOVDA32X2(p_exp_tbl[max_in_row - p_in[i]], p_exp_tbl[max_in_row - p_in[i + 1]]);
+            unsat_out = AE_MULFP32X2RAS(exp_y, recip_sum_exp);
+            unsat_out = AE_SRAA32RS(unsat_out, shift_bits_reciprocal + 31 - 8);
+            CLAMP_VAL(out, unsat_out, a_min, a_max);
+            SUB_128(out)
+            p_o[i] = (WORD8)AE_MOVAD32_H(out);
+            p_o[i + 1] = (WORD8)AE_MOVAD32_L(out);
+        }
+        if(depth & 1)
+        {
+            exp_y = AE_MOVDA32(p_exp_tbl[max_in_row - p_in[depth - 1]]);
+            unsat_out = AE_MULFP32X2RAS(exp_y, recip_sum_exp);
+            unsat_out = AE_SRAA32RS(unsat_out, shift_bits_reciprocal + 31 - 8);
+            CLAMP_VAL(out, unsat_out, a_min, a_max);
+            SUB_128(out)
+            p_o[depth - 1] = (WORD8)AE_MOVAD32_H(out);
+        }
+    }
+
+    return 0;
+}
+
+WORD32 xa_nn_softmax_rows_asym8s_16( WORD16 * __restrict__ p_out,
+                    const   WORD8 * __restrict__ p_vec,
+                            WORD32  diffmin,
+                            WORD32  input_beta_left_shift,
+                            WORD32  input_beta_multiplier,
+                            WORD32  outer_size,
+                            WORD32  depth,
+                            pVOID   p_scratch)
+{
+    SOFTMAX_ROWS_ARG_CHK(WORD16)
+
+    int row, i;
+    int shift_bits_reciprocal;
+    WORD32 *p_exp_tbl, *p_sum_tbl;
+    ae_int32x2 sum_exp, recip_sum_exp, exp_y, unsat_out, out, a_min, a_max, offset;
+
+    if(outer_size * depth < SOFTMAX_ROWS_TBL_LEN)
+    {
+        for(row = 0; row < outer_size; row++)
+        {
+            xa_nn_vec_softmax_asym8s_16(p_out + row * depth, p_vec + row * depth,
+                diffmin, input_beta_left_shift, input_beta_multiplier, depth, p_scratch);
+        }
+        return 0;
+    }
+
+    p_exp_tbl = (WORD32 *)ALIGN_PTR(p_scratch, ALIGNMENT);
+    p_sum_tbl = p_exp_tbl + SOFTMAX_ROWS_TBL_LEN;
+    softmax_rows_init_tables(p_exp_tbl, p_sum_tbl, NULL, diffmin, input_beta_left_shift, input_beta_multiplier);
+
+    a_min = AE_ZERO32();
+    a_max = AE_MOVDA32(65535);
+    offset = AE_MOVDA32(32768);
+    for(row = 0; row < outer_size; row++)
+    {
+        const WORD8 *p_in = p_vec + row * depth;
+        WORD16 *p_o = p_out + row * depth;
+        WORD32 max_in_row = softmax_rows_max_asym8s(p_in, depth);
+
+        sum_exp = softmax_rows_sum_exp(p_sum_tbl, p_in, max_in_row, depth);
+        recip_sum_exp = GetReciprocal(AE_SRAI64(AE_MOVINT64_FROMINT32X2(sum_exp), 32), 12, &shift_bits_reciprocal);
+
+        for(i = 0; i < depth - 1; i += 2)
+        {
+            exp_y = AE_MOVDA32X2(p_exp_tbl[max_in_row - p_in[i]], p_exp_tbl[max_in_row - p_in[i + 1]]);
+            unsat_out = AE_MULFP32X2RAS(exp_y, recip_sum_exp);
+            unsat_out = AE_SRAA32RS(unsat_out, shift_bits_reciprocal + 31 - 16);
+            CLAMP_VAL(out, unsat_out, a_min, a_max);
+            out = AE_SUB32(out, offset);
+            p_o[i] = (WORD16)AE_MOVAD32_H(out);
+            p_o[i + 1] = (WORD16)AE_MOVAD32_L(out);
+        }
+        if(depth & 1)
+        {
+            exp_y = AE_MOVDA32(p_exp_tbl[max_in_row - p_in[depth - 1]]);
+            unsat_out = AE_MULFP32X2RAS(exp_y, recip_sum_exp);
+            unsat_out = AE_SRAA32RS(unsat_out, shift_bits_reciprocal + 31 - 16);
+            CLAMP_VAL(out, unsat_out, a_min, a_max);
+            out = AE_SUB32(out, offset);
+            p_o[depth - 1] = (WORD16)AE_MOVAD32_H(out);
+        }
+    }
+
+    return 0;
+}
+
+/* Output is quantized with TFLite's fixed log-softmax parameters, scale
+ * 16/256 and zero point 127 */
+WORD32 xa_nn_log_softmax_rows_asym8s_asym8s( WORD8 * __restrict__ p_out,
+                    const   WORD8 * __restrict__ p_vec,
+                            WORD32  diffmin,
+                            WORD32  input_beta_left_shift,
+                            WORD32  input_beta_multiplier,
+                            WORD32  outer_size,
+                            WORD32  depth,
+                            pVOID   p_scratch)
+{
+    SOFTMAX_ROWS_ARG_CHK(WORD8)
+
+    int row, i;
+    WORD32 *p_exp_tbl, *p_sum_tbl, *p_diff_tbl;
+    ae_int32x2 sum_exp, log_sum_exp, diff, out, a_min, a_max, zero_bias;
+
+    p_exp_tbl = (WORD32 *)ALIGN_PTR(p_scratch, ALIGNMENT);
+    p_sum_tbl = p_exp_tbl + SOFTMAX_ROWS_TBL_LEN;
+    p_diff_tbl = p_sum_tbl + SOFTMAX_ROWS_TBL_LEN;
+    softmax_rows_init_tables(p_exp_tbl, p_sum_tbl, p_diff_tbl, diffmin, input_beta_left_shift, input_beta_multiplier);
+
+    a_min = AE_MOVDA32(-128);
+    a_max = AE_MOVDA32(127);
+    zero_bias = AE_MOVDA32(127);
+    for(row = 0; row < outer_size; row++)
+    {
+        const WORD8 *p_in = p_vec + row * depth;
+        WORD8 *p_o = p_out + row * depth;
+        WORD32 max_in_row = softmax_rows_max_asym8s(p_in, depth);
+
+        sum_exp = softmax_rows_sum_exp(p_sum_tbl, p_in, max_in_row, depth);
+        log_sum_exp = AE_MOVDA32(softmax_rows_log_sum_exp(sum_exp));
+
+        /* Q5.26 to the Q3.4 output grid */
+        for(i = 0; i < depth - 1; i += 2)
+        {
+            diff = AE_MOVDA32X2(p_diff_tbl[max_in_row - p_in[i]], p_diff_tbl[max_in_row - p_in[i + 1]]);
+            diff = AE_SUB32S(diff, log_sum_exp);
+            diff = AE_ADD32(AE_SRAA32RS(diff, 22), zero_bias);
+            CLAMP_VAL(out, diff, a_min, a_max);
+            p_o[i] = (WORD8)AE_MOVAD32_H(out);
+            p_o[i + 1] = (WORD8)AE_MOVAD32_L(out);
+        }
+        if(depth & 1)
+        {
+            diff = AE_MOVDA32(p_diff_tbl[max_in_row - p_in[depth - 1]]);
+            diff = AE_SUB32S(diff, log_sum_exp);
+            diff = AE_ADD32(AE_SRAA32RS(diff, 22), zero_bias);
+            CLAMP_VAL(out, diff, a_min, a_max);
+            p_o[depth - 1] = (WORD8)AE_MOVAD32_H(out);
+        }
+    }
+
+    return 0;
+}
 #endif // #ifndef ENABLE_SCRATCH_SIZE_API_ONLY
 
 int get_softmax_scratch_size(int inp_precision, int out_precision, int length)
@@ -1023,3 +1330,25 @@ int get_softmax_scratch_size(int inp_precision, int out_precision, int length)
     return total_bytes;
 }
 
+int get_softmax_rows_scratch_size(int inp_precision, int out_precision, int depth)
+{
+    XA_NNLIB_ARG_CHK_COND((depth <= 0), -1);
+    int total_bytes, vec_bytes;
+
+    /* The exp tables, or the scratch of the single vector kernels used for
+       inputs too short to pay for the tables */
+    switch(inp_precision)
+    {
+        case -4:
+            total_bytes = 3 * 256 * sizeof(WORD32);
+            break;
+        default:
+            return -1;
+    }
+    vec_bytes = get_softmax_scratch_size(inp_precision, out_precision, depth);
+    total_bytes = vec_bytes > total_bytes ? vec_bytes : total_bytes;
+
+    total_bytes = ALIGNED_SIZE(total_bytes, ALIGNMENT);
+
+    return total_bytes + ALIGNMENT;
+}
@@ -395,3 +395,28 @@ WORD32 xa_nn_vec_softmax_sym16s_16( WORD16 * __restrict__ p_out,
 
   return 0;
 }
+
+/* The exp and reciprocal tables are static here, so there is no per call
+ * setup to share between rows */
+WORD32 xa_nn_softmax_rows_sym16s_16( WORD16 * __restrict__ p_out,
+                    const   WORD16 * __restrict__ p_vec,
+                            WORD32  input_beta_left_shift,
+                            WORD32  input_beta_multiplier,
+                            WORD32  outer_size,
+                            WORD32  depth)
+{
+  XA_NNLIB_ARG_CHK_COND((outer_size <= 0), -1);
+
+  int row;
+  for(row = 0; row < outer_size; row++)
+  {
+    WORD32 ret = xa_nn_vec_softmax_sym16s_16(p_out + row * depth, p_vec + row * depth,
+        input_beta_left_shift, input_beta_multiplier, depth);
+    if(ret != 0)
+    {
+      return ret;
+    }
+  }
+
+  return 0;
+}
@@ -49,5 +49,26 @@
     *out_ptr++ = (UWORD8)o4;\
 }
 
+/* Row kernel for internal_elm_broadcast_4D, computes num_elm outputs from
+ * two contiguous inputs. p_params carries the op specific arguments. */
+typedef WORD32 (*internal_elm_binary_fn_t)(void *p_out,
+                                           const void *p_inp1,
+                                           const void *p_inp2,
+                                           WORD32 num_elm,
+                                           const void *p_params);
+
+/* 4D broadcast driver shared by the xa_nn_elm_*_broadcast_4D kernels, see
+ * xa_nn_elm_broadcast_4D.c */
+WORD32 internal_elm_broadcast_4D(void *p_out,
+                                 const WORD32 *const p_out_shape,
+                                 const void *p_inp1,
+                                 const WORD32 *const p_inp1_shape,
+                                 const void *p_inp2,
+                                 const WORD32 *const p_inp2_shape,
+                                 WORD32 inp_bytes,
+                                 WORD32 out_bytes,
+                                 internal_elm_binary_fn_t row_fn,
+                                 const void *p_params);
+
 #endif /* #ifndef __XA_NN_BASIC_STATE_H__ */
 
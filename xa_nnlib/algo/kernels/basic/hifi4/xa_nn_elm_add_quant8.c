@@ -1138,9 +1138,10 @@ WORD32 xa_nn_elm_add_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
     const ae_int16x4  zb = -inp2_zero_bias;
     const ae_int32x2 zc = AE_MOVDA32( out_zero_bias);
     
-    xtbool io_pointers_aligned =    ((uintptr_t)p_a%8 == 0) &&
-                                    ((uintptr_t)p_b%8 == 0) &&
-                                    ((uintptr_t)p_c%8 == 0);
+    /* AE_L8X4F_IP needs word aligned inputs, the output is stored bytewise */
+    xtbool io_pointers_aligned =    ((uintptr_t)p_a%4 == 0) &&
+                                    ((uintptr_t)p_b%4 == 0);
+    XA_NNLIB_PATH_COUNT(XA_NN_PATH_ELM_ADD_ASYM8S, io_pointers_aligned);
 
 
     // intermediate results and scratch registers
@@ -2020,3 +2021,61 @@ WORD32 xa_nn_elm_add_broadcast_4D_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_ou
   }
   return 0;
 }
+
+/* Adds [num_rows][row_len] inputs into rows of p_out that are out_stride
+ * elements apart, e.g. the channel slice of a concat destination */
+WORD32 xa_nn_elm_add_out_stride_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
+                            WORD32  out_stride,
+                            WORD32  out_zero_bias,
+                            WORD32  out_left_shift,
+                            WORD32  out_multiplier,
+                            WORD32  out_activation_min,
+                            WORD32  out_activation_max,
+                    const    WORD8 * __restrict__ p_inp1,
+                            WORD32  inp1_zero_bias,
+                            WORD32  inp1_left_shift,
+                            WORD32  inp1_multiplier,
+                    const    WORD8 * __restrict__ p_inp2,
+                            WORD32  inp2_zero_bias,
+                            WORD32  inp2_left_shift,
+                            WORD32  inp2_multiplier,
+                            WORD32  left_shift,
+                            WORD32  num_rows,
+                            WORD32  row_len)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp2, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_len <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride < row_len), -1);
+
+  WORD32 ret;
+  int itr;
+
+  if(out_stride == row_len)
+  {
+    return xa_nn_elm_add_asym8sxasym8s_asym8s(p_out, out_zero_bias, out_left_shift, out_multiplier,
+        out_activation_min, out_activation_max,
+        p_inp1, inp1_zero_bias, inp1_left_shift, inp1_multiplier,
+        p_inp2, inp2_zero_bias, inp2_left_shift, inp2_multiplier,
+        left_shift, num_rows * row_len);
+  }
+
+  for(itr = 0; itr < num_rows; itr++)
+  {
+    ret = xa_nn_elm_add_asym8sxasym8s_asym8s(p_out, out_zero_bias, out_left_shift, out_multiplier,
+        out_activation_min, out_activation_max,
+        p_inp1, inp1_zero_bias, inp1_left_shift, inp1_multiplier,
+        p_inp2, inp2_zero_bias, inp2_left_shift, inp2_multiplier,
+        left_shift, row_len);
+    if(ret != 0)
+      return ret;
+    p_out += out_stride;
+    p_inp1 += row_len;
+    p_inp2 += row_len;
+  }
+  return 0;
+}
@@ -0,0 +1,227 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include <string.h>
+#include "xa_nn_basic_state.h"
+
+/*
+ * Generic 4D broadcast for binary elementwise ops.
+ *
+ * Unit output dims are dropped and neighbouring dims are merged whenever
+ * both inputs are contiguous (or both broadcast) across them, so most
+ * shapes end up as a few long rows. Each row is handed to the flat kernel
+ * of the op. When one input is broadcast along the row (a scalar per row),
+ * or repeats a short row over the next dim (per-channel operands), it is
+ * replicated into a small tile first so the flat kernel still sees two
+ * contiguous inputs and runs its vector loop over long spans.
+ */
+
+#define BCAST_TILE_BYTES  512
+
+static void internal_bcast_fill_tile(WORD8 *__restrict__ p_tile
+                                     ,const WORD8 *__restrict__ p_src
+                                     ,WORD32 src_bytes
+                                     ,WORD32 tile_bytes)
+{
+  WORD32 filled = src_bytes;
+  memcpy(p_tile, p_src, src_bytes);
+  while(filled < tile_bytes)
+  {
+    WORD32 copy = XT_MIN(filled, tile_bytes - filled);
+    memcpy(p_tile + filled, p_tile, copy);
+    filled += copy;
+  }
+}
+
+WORD32 internal_elm_broadcast_4D(void *p_out,
+                                 const WORD32 *const p_out_shape,
+                                 const void *p_inp1,
+                                 const WORD32 *const p_inp1_shape,
+                                 const void *p_inp2,
+                                 const WORD32 *const p_inp2_shape,
+                                 WORD32 inp_bytes,
+                                 WORD32 out_bytes,
+                                 internal_elm_binary_fn_t row_fn,
+                                 const void *p_params)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp2, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shape, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp1_shape, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp2_shape, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, out_bytes, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp1, inp_bytes, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp2, inp_bytes, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shape, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp1_shape, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp2_shape, sizeof(WORD32), -1);
+
+  int i;
+  /* Check shapes */
+  for(i = 0; i < 4; i++)
+  {
+    if((p_inp1_shape[i] <= 0 || p_inp2_shape[i] <= 0) ||
+       (p_inp1_shape[i] != p_inp2_shape[i] && p_inp1_shape[i] != 1 && p_inp2_shape[i] != 1) ||
+       (p_out_shape[i] != (p_inp1_shape[i] > p_inp2_shape[i] ? p_inp1_shape[i] : p_inp2_shape[i])))
+    {
+      return -1;
+    }
+  }
+
+  /* Element strides, 0 along broadcast dims */
+  WORD32 inp1_strides[4], inp2_strides[4];
+  WORD32 inp1_size = 1, inp2_size = 1;
+  for(i = 3; i >= 0; i--)
+  {
+    inp1_strides[i] = (p_inp1_shape[i] == 1) ? 0 : inp1_size;
+    inp2_strides[i] = (p_inp2_shape[i] == 1) ? 0 : inp2_size;
+    inp1_size *= p_inp1_shape[i];
+    inp2_size *= p_inp2_shape[i];
+  }
+
+  /* Collapse dims, result is right aligned in shape/str1/str2 */
+  WORD32 shape[4], str1[4], str2[4];
+  int num_dims = 0;
+  for(i = 0; i < 4; i++)
+  {
+    if(p_out_shape[i] == 1)
+      continue;
+    if(num_dims > 0 &&
+       str1[num_dims - 1] == inp1_strides[i] * p_out_shape[i] &&
+       str2[num_dims - 1] == inp2_strides[i] * p_out_shape[i])
+    {
+      shape[num_dims - 1] *= p_out_shape[i];
+      str1[num_dims - 1] = inp1_strides[i];
+      str2[num_dims - 1] = inp2_strides[i];
+    }
+    else
+    {
+      shape[num_dims] = p_out_shape[i];
+      str1[num_dims] = inp1_strides[i];
+      str2[num_dims] = inp2_strides[i];
+      num_dims++;
+    }
+  }
+  for(i = 3; i >= 0; i--)
+  {
+    int src = i - (4 - num_dims);
+    if(src >= 0)
+    {
+      shape[i] = shape[src];
+      str1[i] = str1[src];
+      str2[i] = str2[src];
+    }
+    else
+    {
+      shape[i] = 1;
+      str1[i] = 0;
+      str2[i] = 0;
+    }
+  }
+
+  /* Pick the inner loop: 0 - both inputs contiguous, 1/2 - that input is
+   * read from the tile which holds tile_blk-element blocks back to back */
+  ae_int64 tile_buf[BCAST_TILE_BYTES / sizeof(ae_int64)];
+  WORD8 *p_tile = (WORD8 *)tile_buf;
+  WORD32 tile_elms = BCAST_TILE_BYTES / inp_bytes;
+  WORD32 row_len = shape[3];
+  WORD32 rows_per_call = 1;
+  WORD32 tile_blk = 0;
+  int tiled = 0;
+
+  if(row_len > 1 && str1[3] == 0)
+  {
+    tiled = 1;
+    tile_blk = 1;
+  }
+  else if(row_len > 1 && str2[3] == 0)
+  {
+    tiled = 2;
+    tile_blk = 1;
+  }
+  else if(shape[2] > 1 && 2 * row_len <= tile_elms && str1[2] == 0 && str2[2] == row_len)
+  {
+    tiled = 1;
+    tile_blk = row_len;
+    rows_per_call = XT_MIN(shape[2], tile_elms / row_len);
+  }
+  else if(shape[2] > 1 && 2 * row_len <= tile_elms && str2[2] == 0 && str1[2] == row_len)
+  {
+    tiled = 2;
+    tile_blk = row_len;
+    rows_per_call = XT_MIN(shape[2], tile_elms / row_len);
+  }
+  /* Elements per kernel call when reading from the tile */
+  WORD32 tile_span = (tile_blk == 1) ? tile_elms : rows_per_call * row_len;
+
+  const WORD8 *p_tile_src = NULL;
+  WORD8 *p_out_row = (WORD8 *)p_out;
+  int itr0, itr1, itr2;
+  for(itr0 = 0; itr0 < shape[0]; itr0++)
+  {
+    for(itr1 = 0; itr1 < shape[1]; itr1++)
+    {
+      for(itr2 = 0; itr2 < shape[2]; itr2 += rows_per_call)
+      {
+        const WORD8 *p_in1 = (const WORD8 *)p_inp1 +
+          (itr0 * str1[0] + itr1 * str1[1] + itr2 * str1[2]) * inp_bytes;
+        const WORD8 *p_in2 = (const WORD8 *)p_inp2 +
+          (itr0 * str2[0] + itr1 * str2[1] + itr2 * str2[2]) * inp_bytes;
+        WORD32 num_elm = XT_MIN(rows_per_call, shape[2] - itr2) * row_len;
+
+        if(tiled == 0)
+        {
+          if(row_fn(p_out_row, p_in1, p_in2, num_elm, p_params) != 0)
+            return -1;
+        }
+        else
+        {
+          const WORD8 *p_src = (tiled == 1) ? p_in1 : p_in2;
+          const WORD8 *p_vec = (tiled == 1) ? p_in2 : p_in1;
+          WORD32 done, cur;
+          if(p_src != p_tile_src)
+          {
+            internal_bcast_fill_tile(p_tile, p_src, tile_blk * inp_bytes, tile_span * inp_bytes);
+            p_tile_src = p_src;
+          }
+          for(done = 0; done < num_elm; done += cur)
+          {
+            WORD32 err;
+            cur = XT_MIN(tile_span, num_elm - done);
+            if(tiled == 1)
+              err = row_fn(p_out_row + done * out_bytes, p_tile, p_vec + done * inp_bytes, cur, p_params);
+            else
+              err = row_fn(p_out_row + done * out_bytes, p_vec + done * inp_bytes, p_tile, cur, p_params);
+            if(err != 0)
+              return -1;
+          }
+        }
+        p_out_row += num_elm * out_bytes;
+      }
+    }
+  }
+
+  return 0;
+}
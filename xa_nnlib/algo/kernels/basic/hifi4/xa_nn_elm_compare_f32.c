@@ -0,0 +1,140 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xa_nnlib_common_fpu.h"
+#include "xa_nn_common.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nn_basic_state.h"
+#include "xa_nnlib_kernels_api.h"
+
+/*
+ * Float compare kernels write 0/1 bytes, same as the asym8s compares.
+ * Only OLT and OEQ are used: each lane starts at INIT and is overwritten
+ * with SET when either condition holds, so NaN inputs compare false for
+ * all ops except notequal.
+ */
+#define ELM_COMPARE_F32(op, INIT, SET, COND0, COND1, SCL_CMP) \
+WORD32 xa_nn_elm_##op##_f32xf32(WORD8 * __restrict__ p_out, \
+                    const   FLOAT32 * __restrict__ p_inp1, \
+                    const   FLOAT32 * __restrict__ p_inp2, \
+                            WORD32  num_elm) \
+{ \
+  /* NULL pointer checks */ \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp1, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp2, -1); \
+  /* Pointer alignment checks */ \
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp1, sizeof(FLOAT32), -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp2, sizeof(FLOAT32), -1); \
+  /* Basic Parameter checks */ \
+  XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1); \
+ \
+  int i; \
+  xtfloatx2 *inp1 = (xtfloatx2 *)p_inp1; \
+  xtfloatx2 *inp2 = (xtfloatx2 *)p_inp2; \
+  WORD8 *p_o = p_out; \
+  xtfloatx2 x1, x2; \
+  ae_int32x2 y; \
+  ae_int32x2 init_32x2 = AE_MOVDA32(INIT); \
+  ae_int32x2 set_32x2 = AE_MOVDA32(SET); \
+  ae_valign inp1_a, inp2_a; \
+ \
+  inp1_a = XT_LASX2PP(inp1); \
+  inp2_a = XT_LASX2PP(inp2); \
+  for(i = 0; i < (num_elm >> 1); i++) \
+  { \
+    XT_LASX2IP(x1, inp1_a, inp1); \
+    XT_LASX2IP(x2, inp2_a, inp2); \
+    y = init_32x2; \
+    AE_MOVT32X2(y, set_32x2, COND0); \
+    AE_MOVT32X2(y, set_32x2, COND1); \
+    *p_o++ = (WORD8)AE_MOVAD32_H(y); \
+    *p_o++ = (WORD8)AE_MOVAD32_L(y); \
+  } \
+  /* Remainder Loop */ \
+  if(num_elm & 1) \
+  { \
+    FLOAT32 a = p_inp1[num_elm - 1]; \
+    FLOAT32 b = p_inp2[num_elm - 1]; \
+    *p_o = (WORD8)(SCL_CMP); \
+  } \
+  return 0; \
+} \
+ \
+static WORD32 internal_elm_##op##_f32xf32(void *p_out, \
+                                     const void *p_inp1, \
+                                     const void *p_inp2, \
+                                     WORD32 num_elm, \
+                                     const void *p_params) \
+{ \
+  (void)p_params; \
+  return xa_nn_elm_##op##_f32xf32((WORD8 *)p_out, (const FLOAT32 *)p_inp1, (const FLOAT32 *)p_inp2, num_elm); \
+} \
+ \
+WORD32 xa_nn_elm_##op##_broadcast_4D_f32xf32(WORD8 * __restrict__ p_out, \
+                      const WORD32 *const p_out_shape, \
+                      const FLOAT32 * __restrict__ p_inp1, \
+                      const WORD32 *const p_inp1_shape, \
+                      const FLOAT32 * __restrict__ p_inp2, \
+                      const WORD32 *const p_inp2_shape) \
+{ \
+  return internal_elm_broadcast_4D(p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape, \
+                                   sizeof(FLOAT32), sizeof(WORD8), internal_elm_##op##_f32xf32, NULL); \
+}
+
+#define DISCARD_ELM_COMPARE_F32(op) \
+DISCARD_FUN_FOR_NONVOID_RETURN( \
+             WORD32, xa_nn_elm_##op##_f32xf32, \
+             ( \
+                WORD8 *p_out, \
+                const FLOAT32 *p_inp1, \
+                const FLOAT32 *p_inp2, \
+                WORD32 num_elm \
+              ) \
+           ) \
+DISCARD_FUN_FOR_NONVOID_RETURN( \
+             WORD32, xa_nn_elm_##op##_broadcast_4D_f32xf32, \
+             ( \
+                WORD8 * p_out, \
+                const WORD32 *const p_out_shape, \
+                const FLOAT32 * p_inp1, \
+                const WORD32 *const p_inp1_shape, \
+                const FLOAT32 * p_inp2, \
+                const WORD32 *const p_inp2_shape \
+              ) \
+           )
+
+#if !HAVE_VFPU
+DISCARD_ELM_COMPARE_F32(equal)
+DISCARD_ELM_COMPARE_F32(notequal)
+DISCARD_ELM_COMPARE_F32(greater)
+DISCARD_ELM_COMPARE_F32(greaterequal)
+DISCARD_ELM_COMPARE_F32(less)
+DISCARD_ELM_COMPARE_F32(lessequal)
+#else
+ELM_COMPARE_F32(equal,        0, 1, XT_OEQ_SX2(x1, x2), XT_OEQ_SX2(x1, x2), a == b)
+ELM_COMPARE_F32(notequal,     1, 0, XT_OEQ_SX2(x1, x2), XT_OEQ_SX2(x1, x2), a != b)
+ELM_COMPARE_F32(greater,      0, 1, XT_OLT_SX2(x2, x1), XT_OLT_SX2(x2, x1), a >  b)
+ELM_COMPARE_F32(greaterequal, 0, 1, XT_OLT_SX2(x2, x1), XT_OEQ_SX2(x1, x2), a >= b)
+ELM_COMPARE_F32(less,         0, 1, XT_OLT_SX2(x1, x2), XT_OLT_SX2(x1, x2), a <  b)
+ELM_COMPARE_F32(lessequal,    0, 1, XT_OLT_SX2(x1, x2), XT_OEQ_SX2(x1, x2), a <= b)
+#endif
@@ -0,0 +1,188 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nn_basic_state.h"
+#include "xa_nnlib_common_macros.h"
+
+/*
+ * asym16s compares, same parameters and 0/1 byte output as the asym8s
+ * compares. Inputs are widened to 32 bit before the zero bias is added,
+ * as (inp + zero_bias) needs 17 bits.
+ */
+#define DEQUANTIZE_ASYM16S_X2(out, inp, z_b, l_shift, multiplier, shift) \
+  out = AE_ADD32S(inp, z_b); \
+  out = AE_SLAA32S(out, l_shift); \
+  MPY_BY_QUANT_MULT_ST_ONE_EXP_X2_OUT32(out, out, multiplier, shift)
+
+#define ELM_COMPARE_ASYM16S(op, INIT, SET, CMP) \
+WORD32 xa_nn_elm_##op##_asym16sxasym16s(WORD8 * __restrict__ p_out, \
+                    const   WORD16 * __restrict__ p_inp1, \
+                            WORD32  inp1_zero_bias, \
+                            WORD32  inp1_shift, \
+                            WORD32  inp1_multiplier, \
+                    const   WORD16 * __restrict__ p_inp2, \
+                            WORD32  inp2_zero_bias, \
+                            WORD32  inp2_shift, \
+                            WORD32  inp2_multiplier, \
+                            WORD32  left_shift, \
+                            WORD32  num_elm) \
+{ \
+  /* NULL pointer checks */ \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp1, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp2, -1); \
+  /* Pointer alignment checks */ \
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp1, sizeof(WORD16), -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp2, sizeof(WORD16), -1); \
+  /* Basic Parameter checks */ \
+  XA_NNLIB_ARG_CHK_COND((num_elm <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND(((inp1_zero_bias < -32767) || (inp1_zero_bias > 32768)), -1); \
+  XA_NNLIB_ARG_CHK_COND(((inp2_zero_bias < -32767) || (inp2_zero_bias > 32768)), -1); \
+  XA_NNLIB_ARG_CHK_COND(((inp1_shift < -31) || (inp1_shift > 31)), -1); \
+  XA_NNLIB_ARG_CHK_COND(((inp2_shift < -31) || (inp2_shift > 31)), -1); \
+  XA_NNLIB_ARG_CHK_COND((inp1_multiplier < 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((inp2_multiplier < 0), -1); \
+  XA_NNLIB_ARG_CHK_COND(((left_shift < 0) || (left_shift > 31)), -1); \
+ \
+  int i; \
+  ae_int16x4 m1, m2; \
+  ae_int32x2 x32, x10, y32, y10, out_32, out_10; \
+  xtbool2 b32, b10; \
+  ae_int16x4 ONE_16X4 = AE_MOVDA16(1); \
+  ae_int32x2 inp1_z_b = AE_MOVDA32(inp1_zero_bias); \
+  ae_int32x2 inp2_z_b = AE_MOVDA32(inp2_zero_bias); \
+  ae_int32x2 init_32x2 = AE_MOVDA32(INIT); \
+  ae_int32x2 set_32x2 = AE_MOVDA32(SET); \
+ \
+  ae_int16x4 *p_in1 = (ae_int16x4 *)p_inp1; \
+  ae_int16x4 *p_in2 = (ae_int16x4 *)p_inp2; \
+  WORD8 *p_o = p_out; \
+  ae_valign in1_a = AE_LA64_PP(p_in1); \
+  ae_valign in2_a = AE_LA64_PP(p_in2); \
+ \
+  for(i = 0; i < (num_elm >> 2); i++) \
+  { \
+    AE_LA16X4_IP(m1, in1_a, p_in1); \
+    AE_LA16X4_IP(m2, in2_a, p_in2); \
+ \
+    AE_MUL16X4(x32, x10, m1, ONE_16X4); \
+    AE_MUL16X4(y32, y10, m2, ONE_16X4); \
+ \
+    DEQUANTIZE_ASYM16S_X2(x32, x32, inp1_z_b, left_shift, inp1_multiplier, inp1_shift) \
+    DEQUANTIZE_ASYM16S_X2(x10, x10, inp1_z_b, left_shift, inp1_multiplier, inp1_shift) \
+    DEQUANTIZE_ASYM16S_X2(y32, y32, inp2_z_b, left_shift, inp2_multiplier, inp2_shift) \
+    DEQUANTIZE_ASYM16S_X2(y10, y10, inp2_z_b, left_shift, inp2_multiplier, inp2_shift) \
+ \
+    b32 = CMP(x32, y32); \
+    b10 = CMP(x10, y10); \
+    out_32 = init_32x2; \
+    out_10 = init_32x2; \
+    AE_MOVT32X2(out_32, set_32x2, b32); \
+    AE_MOVT32X2(out_10, set_32x2, b10); \
+ \
+    STORE_8X4_FROM_32X4(p_o, out_32, out_10) \
+  } \
+ \
+  /* Remainder Loop */ \
+  for(i = 0; i < (num_elm & 3); i++) \
+  { \
+    m1 = AE_MOVDA16(((WORD16 *)p_in1)[i]); \
+    m2 = AE_MOVDA16(((WORD16 *)p_in2)[i]); \
+ \
+    AE_MUL16X4(x32, x10, m1, ONE_16X4); \
+    AE_MUL16X4(y32, y10, m2, ONE_16X4); \
+ \
+    DEQUANTIZE_ASYM16S_X2(x32, x32, inp1_z_b, left_shift, inp1_multiplier, inp1_shift) \
+    DEQUANTIZE_ASYM16S_X2(y32, y32, inp2_z_b, left_shift, inp2_multiplier, inp2_shift) \
+ \
+    b32 = CMP(x32, y32); \
+    out_32 = init_32x2; \
+    AE_MOVT32X2(out_32, set_32x2, b32); \
+    *p_o++ = (WORD8)AE_MOVAD32_H(out_32); \
+  } \
+  return 0; \
+} \
+ \
+static WORD32 internal_elm_##op##_asym16sxasym16s(void *p_out, \
+                                             const void *p_inp1, \
+                                             const void *p_inp2, \
+                                             WORD32 num_elm, \
+                                             const void *p_params) \
+{ \
+  const compare_asym16s_params_t *p_prm = (const compare_asym16s_params_t *)p_params; \
+  return xa_nn_elm_##op##_asym16sxasym16s((WORD8 *)p_out, \
+      (const WORD16 *)p_inp1, p_prm->inp1_zero_bias, p_prm->inp1_shift, p_prm->inp1_multiplier, \
+      (const WORD16 *)p_inp2, p_prm->inp2_zero_bias, p_prm->inp2_shift, p_prm->inp2_multiplier, \
+      p_prm->left_shift, num_elm); \
+} \
+ \
+WORD32 xa_nn_elm_##op##_broadcast_4D_asym16sxasym16s(WORD8 * __restrict__ p_out, \
+                      const WORD32 *const p_out_shape, \
+                      const WORD16 * __restrict__ p_inp1, \
+                      const WORD32 *const p_inp1_shape, \
+                            WORD32  inp1_zero_bias, \
+                            WORD32  inp1_shift, \
+                            WORD32  inp1_multiplier, \
+                      const WORD16 * __restrict__ p_inp2, \
+                      const WORD32 *const p_inp2_shape, \
+                            WORD32  inp2_zero_bias, \
+                            WORD32  inp2_shift, \
+                            WORD32  inp2_multiplier, \
+                            WORD32  left_shift) \
+{ \
+  compare_asym16s_params_t params; \
+  params.inp1_zero_bias = inp1_zero_bias; \
+  params.inp1_shift = inp1_shift; \
+  params.inp1_multiplier = inp1_multiplier; \
+  params.inp2_zero_bias = inp2_zero_bias; \
+  params.inp2_shift = inp2_shift; \
+  params.inp2_multiplier = inp2_multiplier; \
+  params.left_shift = left_shift; \
+  return internal_elm_broadcast_4D(p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape, \
+                                   sizeof(WORD16), sizeof(WORD8), internal_elm_##op##_asym16sxasym16s, &params); \
+}
+
+typedef struct
+{
+  WORD32 inp1_zero_bias;
+  WORD32 inp1_shift;
+  WORD32 inp1_multiplier;
+  WORD32 inp2_zero_bias;
+  WORD32 inp2_shift;
+  WORD32 inp2_multiplier;
+  WORD32 left_shift;
+} compare_asym16s_params_t;
+
+#define CMP_EQ(x, y) AE_EQ32(x, y)
+#define CMP_GT(x, y) AE_LT32(y, x)
+#define CMP_GE(x, y) AE_LE32(y, x)
+#define CMP_LT(x, y) AE_LT32(x, y)
+#define CMP_LE(x, y) AE_LE32(x, y)
+
+/* The quantization parameters of the broadcast versions are validated by
+ * the flat kernels on the first row */
+ELM_COMPARE_ASYM16S(equal,        0, 1, CMP_EQ)
+ELM_COMPARE_ASYM16S(notequal,     1, 0, CMP_EQ)
+ELM_COMPARE_ASYM16S(greater,      0, 1, CMP_GT)
+ELM_COMPARE_ASYM16S(greaterequal, 0, 1, CMP_GE)
+ELM_COMPARE_ASYM16S(less,         0, 1, CMP_LT)
+ELM_COMPARE_ASYM16S(lessequal,    0, 1, CMP_LE)
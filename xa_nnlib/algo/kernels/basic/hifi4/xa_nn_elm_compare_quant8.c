@@ -2115,3 +2115,62 @@ WORD32 xa_nn_elm_lessequal_asym8sxasym8s(WORD8 * __restrict__ p_out,
   return 0;
 }
 #endif
+
+typedef struct
+{
+  WORD32 inp1_zero_bias;
+  WORD32 inp1_shift;
+  WORD32 inp1_multiplier;
+  WORD32 inp2_zero_bias;
+  WORD32 inp2_shift;
+  WORD32 inp2_multiplier;
+  WORD32 left_shift;
+} compare_asym8s_params_t;
+
+#define ELM_COMPARE_BROADCAST_4D_ASYM8S(op) \
+static WORD32 internal_elm_##op##_asym8sxasym8s(void *p_out, \
+                                           const void *p_inp1, \
+                                           const void *p_inp2, \
+                                           WORD32 num_elm, \
+                                           const void *p_params) \
+{ \
+  const compare_asym8s_params_t *p_prm = (const compare_asym8s_params_t *)p_params; \
+  return xa_nn_elm_##op##_asym8sxasym8s((WORD8 *)p_out, \
+      (const WORD8 *)p_inp1, p_prm->inp1_zero_bias, p_prm->inp1_shift, p_prm->inp1_multiplier, \
+      (const WORD8 *)p_inp2, p_prm->inp2_zero_bias, p_prm->inp2_shift, p_prm->inp2_multiplier, \
+      p_prm->left_shift, num_elm); \
+} \
+ \
+WORD32 xa_nn_elm_##op##_broadcast_4D_asym8sxasym8s(WORD8 * __restrict__ p_out, \
+                      const WORD32 *const p_out_shape, \
+                      const WORD8 * __restrict__ p_inp1, \
+                      const WORD32 *const p_inp1_shape, \
+                            WORD32  inp1_zero_bias, \
+                            WORD32  inp1_shift, \
+                            WORD32  inp1_multiplier, \
+                      const WORD8 * __restrict__ p_inp2, \
+                      const WORD32 *const p_inp2_shape, \
+                            WORD32  inp2_zero_bias, \
+                            WORD32  inp2_shift, \
+                            WORD32  inp2_multiplier, \
+                            WORD32  left_shift) \
+{ \
+  compare_asym8s_params_t params; \
+  params.inp1_zero_bias = inp1_zero_bias; \
+  params.inp1_shift = inp1_shift; \
+  params.inp1_multiplier = inp1_multiplier; \
+  params.inp2_zero_bias = inp2_zero_bias; \
+  params.inp2_shift = inp2_shift; \
+  params.inp2_multiplier = inp2_multiplier; \
+  params.left_shift = left_shift; \
+  return internal_elm_broadcast_4D(p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape, \
+                                   sizeof(WORD8), sizeof(WORD8), internal_elm_##op##_asym8sxasym8s, &params); \
+}
+
+/* The quantization parameters are validated by the flat kernels on the first row */
+ELM_COMPARE_BROADCAST_4D_ASYM8S(equal)
+ELM_COMPARE_BROADCAST_4D_ASYM8S(notequal)
+ELM_COMPARE_BROADCAST_4D_ASYM8S(greater)
+ELM_COMPARE_BROADCAST_4D_ASYM8S(greaterequal)
+ELM_COMPARE_BROADCAST_4D_ASYM8S(less)
+ELM_COMPARE_BROADCAST_4D_ASYM8S(lessequal)
@@ -89,3 +89,38 @@ WORD32 xa_nn_elm_div_f32xf32_f32(FLOAT32 * __restrict__ p_out,
 }
 #endif
 
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_elm_div_broadcast_4D_f32xf32_f32,
+             (
+                      FLOAT32 * p_out,
+                      const WORD32 *const p_out_shape,
+                      const FLOAT32 * p_inp1,
+                      const WORD32 *const p_inp1_shape,
+                      const FLOAT32 * p_inp2,
+                      const WORD32 *const p_inp2_shape
+              )
+           )
+#else
+static WORD32 internal_elm_div_f32xf32_f32(void *p_out,
+                                        const void *p_inp1,
+                                        const void *p_inp2,
+                                        WORD32 num_elm,
+                                        const void *p_params)
+{
+  (void)p_params;
+  return xa_nn_elm_div_f32xf32_f32((FLOAT32 *)p_out, (const FLOAT32 *)p_inp1, (const FLOAT32 *)p_inp2, num_elm);
+}
+
+WORD32 xa_nn_elm_div_broadcast_4D_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+                      const WORD32 *const p_out_shape,
+                      const FLOAT32 * __restrict__ p_inp1,
+                      const WORD32 *const p_inp1_shape,
+                      const FLOAT32 * __restrict__ p_inp2,
+                      const WORD32 *const p_inp2_shape)
+{
+  return internal_elm_broadcast_4D(p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape,
+                                   sizeof(FLOAT32), sizeof(FLOAT32), internal_elm_div_f32xf32_f32, NULL);
+}
+#endif
@@ -0,0 +1,170 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nn_basic_state.h"
+
+/*
+ * Epilogue of the *_epilogue_* conv and fully connected kernels, also
+ * usable on its own. The kernels call it once per block of output right
+ * after the block is written (an output column of conv2d std and
+ * depthwise, a block of pointwise pixels or a group of fully connected
+ * rows).
+ * Residual add, clamp and table lookup are done in a single pass: each
+ * value is loaded once, goes through the add, clamp and table in
+ * registers and is stored once. The add uses the arithmetic of
+ * xa_nn_elm_add_asym8sxasym8s_asym8s, so results are identical to running
+ * the add and the table separately.
+ */
+
+/* Applies the epilogue in place to row_len values of p_row, p_row is
+ * both read and written so it is not restrict qualified */
+static void internal_epilogue_row_asym8s(WORD8 *p_row
+                                         ,const WORD8 *p_res
+                                         ,WORD32 row_len
+                                         ,WORD32 inp1_zero_bias
+                                         ,const xa_nn_epilogue_asym8s_t *p_epilogue)
+{
+  const WORD8 *p_tbl = p_epilogue->p_lut != NULL ? p_epilogue->p_lut + 128 : NULL;
+  WORD32 act_min = p_epilogue->out_activation_min;
+  WORD32 act_max = p_epilogue->out_activation_max;
+  WORD32 o0, o1;
+  int i;
+
+  if(p_res == NULL)
+  {
+    for(i = 0; i < row_len; i++)
+    {
+      o0 = p_row[i];
+      o0 = XT_MAX(o0, act_min);
+      o0 = XT_MIN(o0, act_max);
+      p_row[i] = p_tbl != NULL ? p_tbl[o0] : (WORD8)o0;
+    }
+    return;
+  }
+
+  const ae_int32x2 za = AE_MOVDA32(inp1_zero_bias);
+  const ae_int32x2 zb = AE_MOVDA32(p_epilogue->residual_zero_bias);
+  const ae_int32x2 zc = AE_MOVDA32(p_epilogue->out_zero_bias);
+  const ae_int32x2 activation_min = AE_MOVDA32(act_min);
+  const ae_int32x2 activation_max = AE_MOVDA32(act_max);
+  WORD32 left_shift = p_epilogue->left_shift;
+  WORD32 inp1_left_shift = p_epilogue->inp1_left_shift;
+  WORD32 inp1_multiplier = p_epilogue->inp1_multiplier;
+  WORD32 inp2_left_shift = p_epilogue->residual_left_shift;
+  WORD32 inp2_multiplier = p_epilogue->residual_multiplier;
+  WORD32 out_left_shift = p_epilogue->out_left_shift;
+  WORD32 out_multiplier = p_epilogue->out_multiplier;
+
+  ae_int32x2 a0_1, b0_1, scaled_a0_1, scaled_b0_1, raw_sum0_1, out0_1;
+
+  /* Two values per iteration, the odd one goes through the second half */
+  for(i = 0; i < row_len; i += 2)
+  {
+    WORD32 i1 = (i + 1 < row_len) ? i + 1 : i;
+    a0_1 = AE_MOVDA32X2(p_row[i], p_row[i1]);
+    b0_1 = AE_MOVDA32X2(p_res[i], p_res[i1]);
+
+    a0_1 = AE_ADD32S(a0_1, za);
+    b0_1 = AE_ADD32S(b0_1, zb);
+    a0_1 = AE_SLAA32S(a0_1, left_shift);
+    b0_1 = AE_SLAA32S(b0_1, left_shift);
+
+    MPY_BY_QUANT_MULT_ST_ONE_EXP_X2_OUT32(scaled_a0_1, a0_1, inp1_multiplier, inp1_left_shift);
+    MPY_BY_QUANT_MULT_ST_ONE_EXP_X2_OUT32(scaled_b0_1, b0_1, inp2_multiplier, inp2_left_shift);
+
+    // Raw sum
+    raw_sum0_1 = AE_ADD32S(scaled_a0_1, scaled_b0_1);
+
+    // Raw Output
+    MPY_BY_QUANT_MULT_ST_ONE_EXP_X2_OUT32(out0_1, raw_sum0_1, out_multiplier, out_left_shift);
+    out0_1 = AE_ADD32S(out0_1, zc);
+
+    /* Clamped out */
+    out0_1 = AE_MAX32(out0_1, activation_min);
+    out0_1 = AE_MIN32(out0_1, activation_max);
+
+    o0 = AE_MOVAD32_H(out0_1);
+    o1 = AE_MOVAD32_L(out0_1);
+    if(p_tbl != NULL)
+    {
+      o0 = p_tbl[o0];
+      o1 = p_tbl[o1];
+    }
+    p_row[i1] = (WORD8)o1;
+    p_row[i] = (WORD8)o0;
+  }
+}
+
+WORD32 xa_nn_elm_epilogue_asym8s(WORD8 * __restrict__ p_out,
+                                 WORD32  out_row_stride,
+                                 const WORD8 * __restrict__ p_residual,
+                                 WORD32  residual_row_stride,
+                                 WORD32  out_zero_bias,
+                                 WORD32  num_rows,
+                                 WORD32  row_len,
+                                 const xa_nn_epilogue_asym8s_t *p_epilogue)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_epilogue, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((num_rows <= 0 || row_len <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_row_stride < row_len), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((p_epilogue->out_activation_min < -128 || p_epilogue->out_activation_min > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((p_epilogue->out_activation_max < p_epilogue->out_activation_min || p_epilogue->out_activation_max > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((p_residual != NULL && residual_row_stride < row_len), -1);
+  if(p_residual != NULL)
+  {
+    /* Same ranges as xa_nn_elm_add_asym8sxasym8s_asym8s */
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->out_zero_bias < -128 || p_epilogue->out_zero_bias > 127), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->out_left_shift < -31 || p_epilogue->out_left_shift > 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->inp1_left_shift < -31 || p_epilogue->inp1_left_shift > 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->residual_zero_bias < -127 || p_epilogue->residual_zero_bias > 128), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->residual_left_shift < -31 || p_epilogue->residual_left_shift > 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->left_shift < 0 || p_epilogue->left_shift > 31), -1);
+  }
+
+  int need_clamp = (p_epilogue->out_activation_min > -128) || (p_epilogue->out_activation_max < 127);
+  int itr;
+
+  if(p_residual == NULL && !need_clamp && p_epilogue->p_lut == NULL)
+    return 0;
+
+  /* Contiguous rows are handled as one long row */
+  if(num_rows > 1 && out_row_stride == row_len &&
+     (p_residual == NULL || residual_row_stride == row_len))
+  {
+    row_len *= num_rows;
+    num_rows = 1;
+  }
+
+  for(itr = 0; itr < num_rows; itr++)
+  {
+    internal_epilogue_row_asym8s(p_out + itr * out_row_stride
+        ,p_residual != NULL ? p_residual + itr * residual_row_stride : NULL
+        ,row_len
+        ,-out_zero_bias
+        ,p_epilogue);
+  }
+  return 0;
+}
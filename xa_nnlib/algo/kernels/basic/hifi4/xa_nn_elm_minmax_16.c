@@ -0,0 +1,107 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nn_basic_state.h"
+
+#define ELM_MINMAX_16(op, VEC_OP, SCL_CMP) \
+WORD32 xa_nn_elm_##op##_16x16_16(WORD16 * __restrict__ p_out, \
+                      const WORD16 * __restrict__ p_in1, \
+                      const WORD16 * __restrict__ p_in2, \
+                            WORD32               num_element) \
+{ \
+    /* NULL pointer checks */ \
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+    XA_NNLIB_ARG_CHK_PTR(p_in1, -1); \
+    XA_NNLIB_ARG_CHK_PTR(p_in2, -1); \
+ \
+    /* Invalid input checks */ \
+    XA_NNLIB_ARG_CHK_COND((num_element <= 0), -1); \
+ \
+    /* Pointer alignment checks */ \
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1); \
+    XA_NNLIB_ARG_CHK_ALIGN(p_in1, sizeof(WORD16), -1); \
+    XA_NNLIB_ARG_CHK_ALIGN(p_in2, sizeof(WORD16), -1); \
+ \
+    ae_int16x4 *p_a = (ae_int16x4 *)p_in1; \
+    ae_int16x4 *p_b = (ae_int16x4 *)p_in2; \
+    ae_int16x4 *p_c = (ae_int16x4 *)p_out; \
+    ae_int16x4 a0_3, b0_3; \
+    WORD32 i; \
+ \
+    if(((((unsigned)p_out)&7) == 0) && ((((unsigned)p_in1)&7) == 0) && ((((unsigned)p_in2)&7) == 0)) \
+    { \
+        for(i = 0; i < (num_element >> 2); i++) \
+        { \
+            AE_L16X4_IP(a0_3, p_a, 4*sizeof(WORD16)); \
+            AE_L16X4_IP(b0_3, p_b, 4*sizeof(WORD16)); \
+            a0_3 = VEC_OP(a0_3, b0_3); \
+            AE_S16X4_IP(a0_3, p_c, 4*sizeof(WORD16)); \
+        } \
+    } \
+    else \
+    { \
+        ae_valign va_a, va_b, va_c; \
+        va_a = AE_LA64_PP(p_a); \
+        va_b = AE_LA64_PP(p_b); \
+        va_c = AE_ZALIGN64(); \
+        for(i = 0; i < (num_element >> 2); i++) \
+        { \
+            AE_LA16X4_IP(a0_3, va_a, p_a); \
+            AE_LA16X4_IP(b0_3, va_b, p_b); \
+            a0_3 = VEC_OP(a0_3, b0_3); \
+            AE_SA16X4_IP(a0_3, va_c, p_c); \
+        } \
+        AE_SA64POS_FP(va_c, p_c); \
+    } \
+ \
+    /* process remaining scalar elements */ \
+    for(i = num_element & ~3; i < num_element; i++) \
+    { \
+        p_out[i] = (p_in1[i] SCL_CMP p_in2[i]) ? p_in1[i] : p_in2[i]; \
+    } \
+ \
+    return 0; \
+} \
+ \
+static WORD32 internal_elm_##op##_16x16_16(void *p_out, \
+                                      const void *p_inp1, \
+                                      const void *p_inp2, \
+                                      WORD32 num_elm, \
+                                      const void *p_params) \
+{ \
+    (void)p_params; \
+    return xa_nn_elm_##op##_16x16_16((WORD16 *)p_out, (const WORD16 *)p_inp1, (const WORD16 *)p_inp2, num_elm); \
+} \
+ \
+WORD32 xa_nn_elm_##op##_broadcast_4D_16x16_16(WORD16 * __restrict__ p_out, \
+                      const WORD32 *const p_out_shape, \
+                      const WORD16 * __restrict__ p_inp1, \
+                      const WORD32 *const p_inp1_shape, \
+                      const WORD16 * __restrict__ p_inp2, \
+                      const WORD32 *const p_inp2_shape) \
+{ \
+    return internal_elm_broadcast_4D(p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape, \
+                                     sizeof(WORD16), sizeof(WORD16), internal_elm_##op##_16x16_16, NULL); \
+}
+
+ELM_MINMAX_16(min, AE_MIN16, <)
+ELM_MINMAX_16(max, AE_MAX16, >)
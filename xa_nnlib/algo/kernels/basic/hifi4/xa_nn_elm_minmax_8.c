@@ -796,3 +796,50 @@ WORD32 xa_nn_elm_max_8D_Bcast_8x8_8(
 } /* xa_nn_elm_max_8D_Bcast_8x8_8 */
 
 
+
+static WORD32 internal_elm_min_8x8_8(void *p_out,
+                                     const void *p_inp1,
+                                     const void *p_inp2,
+                                     WORD32 num_elm,
+                                     const void *p_params)
+{
+    (void)p_params;
+    return xa_nn_elm_min_8x8_8((WORD8 *)p_out, (const WORD8 *)p_inp1, (const WORD8 *)p_inp2, num_elm);
+}
+
+static WORD32 internal_elm_max_8x8_8(void *p_out,
+                                     const void *p_inp1,
+                                     const void *p_inp2,
+                                     WORD32 num_elm,
+                                     const void *p_params)
+{
+    (void)p_params;
+    return xa_nn_elm_max_8x8_8((WORD8 *)p_out, (const WORD8 *)p_inp1, (const WORD8 *)p_inp2, num_elm);
+}
+
+/*
+ * Shape based 4D broadcast, same interface as the other *_broadcast_4D_*
+ * kernels. Unlike the stride based *_4D_Bcast_* versions above, the rows
+ * go through the SIMD min/max kernels.
+ */
+WORD32 xa_nn_elm_min_broadcast_4D_8x8_8(WORD8 * __restrict__ p_out,
+                      const WORD32 *const p_out_shape,
+                      const WORD8 * __restrict__ p_inp1,
+                      const WORD32 *const p_inp1_shape,
+                      const WORD8 * __restrict__ p_inp2,
+                      const WORD32 *const p_inp2_shape)
+{
+    return internal_elm_broadcast_4D(p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape,
+                                     sizeof(WORD8), sizeof(WORD8), internal_elm_min_8x8_8, NULL);
+}
+
+WORD32 xa_nn_elm_max_broadcast_4D_8x8_8(WORD8 * __restrict__ p_out,
+                      const WORD32 *const p_out_shape,
+                      const WORD8 * __restrict__ p_inp1,
+                      const WORD32 *const p_inp1_shape,
+                      const WORD8 * __restrict__ p_inp2,
+                      const WORD32 *const p_inp2_shape)
+{
+    return internal_elm_broadcast_4D(p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape,
+                                     sizeof(WORD8), sizeof(WORD8), internal_elm_max_8x8_8, NULL);
+}
@@ -526,6 +526,127 @@ WORD32 xa_nn_elm_mul_broadcast_4D_sym16sxsym16s_sym16s(WORD16 * __restrict__ p_o
   return 0;
 }
 
+typedef struct
+{
+  WORD32 out_zero_bias;
+  WORD32 out_shift;
+  WORD32 out_multiplier;
+  WORD32 out_activation_min;
+  WORD32 out_activation_max;
+} mul_sym16sxsym16s_asym16s_params_t;
+
+static WORD32 internal_elm_mul_sym16sxsym16s_asym16s(void *p_out,
+                                                     const void *p_inp1,
+                                                     const void *p_inp2,
+                                                     WORD32 num_elm,
+                                                     const void *p_params)
+{
+  const mul_sym16sxsym16s_asym16s_params_t *p_prm = (const mul_sym16sxsym16s_asym16s_params_t *)p_params;
+  WORD32 out_multiplier = p_prm->out_multiplier;
+
+#if TFLITE_SINGLE_ROUNDING
+  int l_shift = p_prm->out_shift;
+  int r_shift = p_prm->out_shift;
+#if XCHAL_HAVE_HIFI1S
+  l_shift = 31 - l_shift;
+  l_shift = l_shift << 16 | l_shift;
+#endif
+  /* Single rounding doesn't need two shifts */
+  (void)r_shift;
+#else /* #if TFLITE_SINGLE_ROUNDING */
+  int l_shift = p_prm->out_shift >= 0 ?   p_prm->out_shift : 0;
+  int r_shift = p_prm->out_shift <  0 ?  -p_prm->out_shift : 0;
+#endif /* #if TFLITE_SINGLE_ROUNDING */
+
+  int i;
+  WORD16 * __restrict__ p_a = (WORD16 *)p_inp1;
+  WORD16 * __restrict__ p_b = (WORD16 *)p_inp2;
+  WORD16 *__restrict__ p_c = (WORD16 *)p_out;
+
+  ae_int16x4 a0_3, b0_3;
+  ae_int32x2 raw_mul0_1, raw_mul2_3;
+  ae_int32x2 out_mul0_1, out_mul2_3;
+  ae_int32x2 z_b = AE_MOVDA32(p_prm->out_zero_bias);
+  ae_int32x2 act_min = AE_MOVDA32(p_prm->out_activation_min);
+  ae_int32x2 act_max = AE_MOVDA32(p_prm->out_activation_max);
+
+  ae_valign va_a, va_b, va_c;
+  va_a = AE_LA64_PP((ae_int16x4 *)p_a);
+  va_b = AE_LA64_PP((ae_int16x4 *)p_b);
+  va_c = AE_ZALIGN64();
+
+  for(i = 0; i < (num_elm >> 2); i++)
+  {
+    AE_LA16X4_IP(a0_3, va_a, (ae_int16x4 *)p_a);
+    AE_LA16X4_IP(b0_3, va_b, (ae_int16x4 *)p_b);
+
+    AE_MUL16X4(raw_mul0_1, raw_mul2_3, a0_3, b0_3);
+#if (XCHAL_HAVE_HIFI1S && TFLITE_SINGLE_ROUNDING)
+    MPY_BY_QUANT_MULT_X2_OUT32_HIFI1S(out_mul0_1, raw_mul0_1, AE_MOVDA32(out_multiplier), l_shift, r_shift);
+    MPY_BY_QUANT_MULT_X2_OUT32_HIFI1S(out_mul2_3, raw_mul2_3, AE_MOVDA32(out_multiplier), l_shift, r_shift);
+#else
+    MPY_BY_QUANT_MULT_SLS_X2_OUT32(out_mul0_1, raw_mul0_1, AE_MOVDA32(out_multiplier), l_shift, r_shift);
+    MPY_BY_QUANT_MULT_SLS_X2_OUT32(out_mul2_3, raw_mul2_3, AE_MOVDA32(out_multiplier), l_shift, r_shift);
+#endif
+    out_mul0_1 = AE_ADD32S(out_mul0_1, z_b);
+    out_mul2_3 = AE_ADD32S(out_mul2_3, z_b);
+    CLAMP_VAL(out_mul0_1, out_mul0_1, act_min, act_max);
+    CLAMP_VAL(out_mul2_3, out_mul2_3, act_min, act_max);
+    ae_int16x4 outval = AE_SEL16_6420(AE_MOVINT16X4_FROMINT32X2(out_mul0_1), AE_MOVINT16X4_FROMINT32X2(out_mul2_3));
+    AE_SA16X4_IP(outval, va_c, (ae_int16x4 *)p_c);
+  }
+  AE_SA64POS_FP(va_c, (ae_int16x4 *)p_c);
+
+  for(i = 0; i < (num_elm & 3); i++)
+  {
+    a0_3 = AE_MOVDA16(p_a[i]);
+    b0_3 = AE_MOVDA16(p_b[i]);
+    AE_MUL16X4(raw_mul0_1, raw_mul2_3, a0_3, b0_3);
+#if (XCHAL_HAVE_HIFI1S && TFLITE_SINGLE_ROUNDING)
+    MPY_BY_QUANT_MULT_X2_OUT32_HIFI1S(out_mul0_1, raw_mul0_1, AE_MOVDA32(out_multiplier), l_shift, r_shift);
+#else
+    MPY_BY_QUANT_MULT_SLS_X2_OUT32(out_mul0_1, raw_mul0_1, AE_MOVDA32(out_multiplier), l_shift, r_shift);
+#endif
+    out_mul0_1 = AE_ADD32S(out_mul0_1, z_b);
+    CLAMP_VAL(out_mul0_1, out_mul0_1, act_min, act_max);
+    *p_c++ = (WORD16)AE_MOVAD32_L(out_mul0_1);
+  }
+  return 0;
+}
+
+/* Any broadcast pattern goes through the shared 4D broadcast engine, which
+ * feeds this flat kernel with contiguous rows */
+WORD32 xa_nn_elm_mul_broadcast_4D_sym16sxsym16s_asym16s(WORD16 * __restrict__ p_out,
+                      const WORD32 *const p_out_shape,
+                            WORD32  out_zero_bias,
+                            WORD32  out_shift,
+                            WORD32  out_multiplier,
+                            WORD32  out_activation_min,
+                            WORD32  out_activation_max,
+                      const WORD16 * __restrict__ p_inp1,
+                      const WORD32 *const p_inp1_shape,
+                      const WORD16 * __restrict__ p_inp2,
+                      const WORD32 *const p_inp2_shape)
+{
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND(((out_zero_bias < -32768) || (out_zero_bias > 32767)), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_shift < -31) || (out_shift > 31)), -1);
+  XA_NNLIB_ARG_CHK_COND((out_multiplier < 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_activation_min < -32768) || (out_activation_min > 32767)), -1);
+  XA_NNLIB_ARG_CHK_COND(((out_activation_max < -32768) || (out_activation_max > 32767)), -1);
+  XA_NNLIB_ARG_CHK_COND((out_activation_max < out_activation_min), -1);
+
+  mul_sym16sxsym16s_asym16s_params_t params;
+  params.out_zero_bias = out_zero_bias;
+  params.out_shift = out_shift;
+  params.out_multiplier = out_multiplier;
+  params.out_activation_min = out_activation_min;
+  params.out_activation_max = out_activation_max;
+
+  return internal_elm_broadcast_4D(p_out, p_out_shape, p_inp1, p_inp1_shape, p_inp2, p_inp2_shape,
+                                   sizeof(WORD16), sizeof(WORD16), internal_elm_mul_sym16sxsym16s_asym16s, &params);
+}
+
 WORD32 xa_nn_elm_mul_sym16sxsym16s_asym8s(WORD8 * __restrict__ p_out,
                             WORD32  out_zero_bias,
                             WORD32  out_shift,
@@ -946,9 +946,10 @@ WORD32 xa_nn_elm_sub_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
     const ae_int16x4  zb = -inp2_zero_bias;
     const ae_int32x2 zc = AE_MOVDA32( out_zero_bias);
     
-    xtbool io_pointers_aligned =    ((uintptr_t)p_a%8 == 0) &&
-                                    ((uintptr_t)p_b%8 == 0) &&
-                                    ((uintptr_t)p_c%8 == 0);
+    /* AE_L8X4F_IP needs word aligned inputs, the output is stored bytewise */
+    xtbool io_pointers_aligned =    ((uintptr_t)p_a%4 == 0) &&
+                                    ((uintptr_t)p_b%4 == 0);
+    XA_NNLIB_PATH_COUNT(XA_NN_PATH_ELM_SUB_ASYM8S, io_pointers_aligned);
 
 
     // intermediate results and scratch registers
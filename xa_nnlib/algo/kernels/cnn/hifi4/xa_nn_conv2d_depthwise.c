@@ -399,6 +399,11 @@ static WORD32 xa_nn_dilated_conv2d_depthwise_getsize_generic
             circ_buf_bytewidth = 4; /* bytewidth for f32 */
             break;
 
+        case -2: /* For f16, computed in f32 */
+            scratch_bytewidth = 4; /* f32 scratch */
+            circ_buf_bytewidth = 4; /* f16 widened to f32 */
+            break;
+
         case -3: /* For asym8 */
         case -4: /* For asym8s */
         case -5: /* For sym8s */
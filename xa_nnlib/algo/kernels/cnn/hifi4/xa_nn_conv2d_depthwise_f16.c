@@ -0,0 +1,260 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common_fpu.h"
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+
+#include "xa_nnlib_common.h"
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_depthwise_f16,(
+            WORD16* __restrict__ p_out,
+            const WORD16* __restrict__ p_kernel,
+            const WORD16* __restrict__ p_inp,
+            const WORD16* __restrict__ p_bias,
+            WORD32  input_height,
+            WORD32  input_width,
+            WORD32  input_channels,
+            WORD32  kernel_height,
+            WORD32  kernel_width,
+            WORD32  channels_multiplier,
+            WORD32  x_stride,
+            WORD32  y_stride,
+            WORD32  x_padding,
+            WORD32  y_padding,
+            WORD32  out_height,
+            WORD32  out_width,
+            WORD32  inp_data_format,
+            WORD32  out_data_format,
+            pVOID p_scratch))
+#else /* #if !HAVE_VFPU */
+
+/* Input, kernel and bias are widened to single precision, each output is
+ * rounded to half precision once. Output is always in NHWC format. */
+
+/* Input [input_height][input_width][input_channels],
+ * kernel [kernel_height][kernel_width][input_channels*channels_multiplier] */
+static void xa_nn_conv2d_depthwise_nhwc_f16(
+        WORD16 *__restrict__ p_out,
+        const WORD16 *__restrict__ p_kernel,
+        const WORD16 *__restrict__ p_inp,
+        const WORD16 *__restrict__ p_bias,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  channels_multiplier,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width)
+{
+    WORD32 out_channels = input_channels*channels_multiplier;
+    int itr_oh, itr_ow, itr_kh, itr_kw, itr_ic, itr_cm;
+
+    for(itr_oh = 0; itr_oh < out_height; itr_oh++)
+    {
+        WORD32 y_start = itr_oh*y_stride - y_padding;
+        for(itr_ow = 0; itr_ow < out_width; itr_ow++)
+        {
+            WORD32 x_start = itr_ow*x_stride - x_padding;
+            WORD16 *p_dst = &p_out[(itr_oh*out_width + itr_ow)*out_channels];
+
+            for(itr_ic = 0; itr_ic < input_channels; itr_ic++)
+            {
+                for(itr_cm = 0; itr_cm < channels_multiplier; itr_cm++)
+                {
+                    WORD32 itr_oc = itr_ic*channels_multiplier + itr_cm;
+                    FLOAT32 acc = xa_nn_f16_to_f32(p_bias[itr_oc]);
+
+                    for(itr_kh = 0; itr_kh < kernel_height; itr_kh++)
+                    {
+                        WORD32 y = y_start + itr_kh;
+                        if(y < 0 || y >= input_height)
+                            continue;
+                        for(itr_kw = 0; itr_kw < kernel_width; itr_kw++)
+                        {
+                            WORD32 x = x_start + itr_kw;
+                            if(x < 0 || x >= input_width)
+                                continue;
+                            acc += xa_nn_f16_to_f32(p_inp[(y*input_width + x)*input_channels + itr_ic]) *
+                                   xa_nn_f16_to_f32(p_kernel[(itr_kh*kernel_width + itr_kw)*out_channels + itr_oc]);
+                        }
+                    }
+                    p_dst[itr_oc] = xa_nn_f32_to_f16(acc);
+                }
+            }
+        }
+    }
+}
+
+/* Input [input_channels][input_height][input_width],
+ * kernel [input_channels*channels_multiplier][kernel_height][kernel_width] */
+static void xa_nn_conv2d_depthwise_nchw_f16(
+        WORD16 *__restrict__ p_out,
+        const WORD16 *__restrict__ p_kernel,
+        const WORD16 *__restrict__ p_inp,
+        const WORD16 *__restrict__ p_bias,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  channels_multiplier,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width)
+{
+    WORD32 out_channels = input_channels*channels_multiplier;
+    int itr_oh, itr_ow, itr_kh, itr_kw, itr_ic, itr_cm;
+
+    for(itr_ic = 0; itr_ic < input_channels; itr_ic++)
+    {
+        const WORD16 *pt_inp = &p_inp[itr_ic*input_height*input_width];
+        for(itr_cm = 0; itr_cm < channels_multiplier; itr_cm++)
+        {
+            WORD32 itr_oc = itr_ic*channels_multiplier + itr_cm;
+            const WORD16 *pt_ker = &p_kernel[itr_oc*kernel_height*kernel_width];
+            FLOAT32 bias = xa_nn_f16_to_f32(p_bias[itr_oc]);
+
+            for(itr_oh = 0; itr_oh < out_height; itr_oh++)
+            {
+                WORD32 y_start = itr_oh*y_stride - y_padding;
+                for(itr_ow = 0; itr_ow < out_width; itr_ow++)
+                {
+                    WORD32 x_start = itr_ow*x_stride - x_padding;
+                    FLOAT32 acc = bias;
+
+                    for(itr_kh = 0; itr_kh < kernel_height; itr_kh++)
+                    {
+                        WORD32 y = y_start + itr_kh;
+                        if(y < 0 || y >= input_height)
+                            continue;
+                        for(itr_kw = 0; itr_kw < kernel_width; itr_kw++)
+                        {
+                            WORD32 x = x_start + itr_kw;
+                            if(x < 0 || x >= input_width)
+                                continue;
+                            acc += xa_nn_f16_to_f32(pt_inp[y*input_width + x]) *
+                                   xa_nn_f16_to_f32(pt_ker[itr_kh*kernel_width + itr_kw]);
+                        }
+                    }
+                    p_out[(itr_oh*out_width + itr_ow)*out_channels + itr_oc] = xa_nn_f32_to_f16(acc);
+                }
+            }
+        }
+    }
+}
+
+WORD32 xa_nn_conv2d_depthwise_f16(
+        WORD16* __restrict__ p_out,
+        const WORD16* __restrict__ p_kernel,
+        const WORD16* __restrict__ p_inp,
+        const WORD16* __restrict__ p_bias,
+        WORD32  input_height,
+        WORD32  input_width,
+        WORD32  input_channels,
+        WORD32  kernel_height,
+        WORD32  kernel_width,
+        WORD32  channels_multiplier,
+        WORD32  x_stride,
+        WORD32  y_stride,
+        WORD32  x_padding,
+        WORD32  y_padding,
+        WORD32  out_height,
+        WORD32  out_width,
+        WORD32  inp_data_format,
+        WORD32  out_data_format,
+        pVOID p_scratch)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_kernel, sizeof(WORD16), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((channels_multiplier <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0 && inp_data_format != 1), -1);
+    XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
+
+    if(inp_data_format == 0)
+    {
+        xa_nn_conv2d_depthwise_nhwc_f16(
+                p_out,
+                p_kernel,
+                p_inp,
+                p_bias,
+                input_height,
+                input_width,
+                input_channels,
+                kernel_height,
+                kernel_width,
+                channels_multiplier,
+                x_stride,
+                y_stride,
+                x_padding,
+                y_padding,
+                out_height,
+                out_width);
+    }
+    else if(inp_data_format == 1)
+    {
+        xa_nn_conv2d_depthwise_nchw_f16(
+                p_out,
+                p_kernel,
+                p_inp,
+                p_bias,
+                input_height,
+                input_width,
+                input_channels,
+                kernel_height,
+                kernel_width,
+                channels_multiplier,
+                x_stride,
+                y_stride,
+                x_padding,
+                y_padding,
+                out_height,
+                out_width);
+    }
+    return 0;
+}
+#endif /* #if !HAVE_VFPU */
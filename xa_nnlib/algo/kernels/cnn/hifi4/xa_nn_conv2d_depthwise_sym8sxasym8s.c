@@ -28,7 +28,7 @@
 
 #include "xa_nnlib_common.h"
 
-#if 0 /* By default special case for 3x3 kernel is enabled */
+#if 0 /* By default special cases for 3x3, 5x5, 7x7, 1x9 and 9x1 kernels are enabled */
   #define DISABLE_DEPTHWISE_CONV2D_K3X3_SPECIAL_CASE
 #endif
 
@@ -628,6 +628,7 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s
  ,int out_height
  ,int out_width
  ,int out_channels
+ ,int out_stride
  ,int y_stride
  ,WORD32  input_zero_bias
  ,const WORD32 *p_out_multiplier
@@ -692,8 +693,8 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s
 
         for(itr_oh = 0; itr_oh < (out_height); itr_oh+=2)        
         {
-            out_ptr0 = (WORD8 *)(&p_out[itr_oh*out_channels*out_width]);
-            out_ptr1 = (WORD8 *)(&p_out[(itr_oh+1)*out_channels*out_width]);
+            out_ptr0 = (WORD8 *)(&p_out[itr_oh*out_stride*out_width]);
+            out_ptr1 = (WORD8 *)(&p_out[(itr_oh+1)*out_stride*out_width]);
 
             pt_inp0 = (WORD8 *)p_inp;
             pt_inp1 = (WORD8 *)p_inp;
@@ -776,17 +777,23 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s
 }
 
 #ifndef DISABLE_DEPTHWISE_CONV2D_K3X3_SPECIAL_CASE
-/* Special case for kernel dimension 3x3 */
+/* Special case for fixed kernel dimensions with channels_multiplier 1. The
+ * kernel_height*kernel_width taps of one output row are contiguous in the
+ * circular buffer, so the tap loop does not depend on the kernel shape.
+ * Callers go through the dispatch table below, which passes constant
+ * kernel dimensions. */
 #if XCHAL_HAVE_HIFI1
-static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
+static inline void conv2d_per_chan_nhwc_sym8sxasym8s_fixed_taps
 (pWORD8 __restrict__ p_out
  ,const WORD8 *__restrict__ p_ker
  ,const WORD8 *__restrict__ p_inp
  ,const WORD32 *p_bias
+ ,int kernel_height
  ,int kernel_width
  ,int out_height
  ,int out_width
  ,int out_channels
+ ,int out_stride
  ,int y_stride
  ,WORD32  input_zero_bias
  ,const WORD32 *p_out_multiplier
@@ -795,6 +802,7 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
  )
 {
     WORD32 itr_oh, itr_ch, itr_kw;
+    WORD32 n_taps = kernel_height * kernel_width;
     pWORD8 pt_inp0, pt_inp1;
     WORD8 *pt_ker;
     pWORD8 out_ptr0, out_ptr1;
@@ -823,7 +831,7 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
         ae_int32x2 temp_acc0, temp_acc1;
         temp_acc0 = d_bias0;
         temp_acc1 = d_bias1;
-        for(i=0; i<9; i++)
+        for(i=0; i<n_taps; i++)
         {
             d_ker = AE_L8X4S_I(pt_ker, 0);
             AE_MULA16X4(temp_acc0, temp_acc1, d_ker, AE_MOVDA16(input_zero_bias));
@@ -857,8 +865,8 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
 
         for(itr_oh = 0; itr_oh < (out_height); itr_oh+=2)        
         {
-            out_ptr0 = (WORD8 *)(&p_out[itr_oh*out_channels*out_width]);
-            out_ptr1 = (WORD8 *)(&p_out[(itr_oh+1)*out_channels*out_width]);
+            out_ptr0 = (WORD8 *)(&p_out[itr_oh*out_stride*out_width]);
+            out_ptr1 = (WORD8 *)(&p_out[(itr_oh+1)*out_stride*out_width]);
 
             pt_inp0 = (WORD8 *)p_inp;
             pt_inp1 = (WORD8 *)p_inp;
@@ -871,7 +879,7 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
             d_acc3 = temp_acc1;
 #pragma no_unroll
 #pragma loop_count min=9
-            for(itr_kw = 0; itr_kw < 9; itr_kw++)
+            for(itr_kw = 0; itr_kw < n_taps; itr_kw++)
             {
 #if XCHAL_HAVE_HIFI1S
                 AE_L8X4S_XC(d_inp0, pt_inp0, out_channels);
@@ -941,15 +949,17 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
     }
 }
 #else
-static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
+static inline void conv2d_per_chan_nhwc_sym8sxasym8s_fixed_taps
 (pWORD8 __restrict__ p_out
  ,const WORD8 *__restrict__ p_ker
  ,const WORD8 *__restrict__ p_inp
  ,const WORD32 *p_bias
+ ,int kernel_height
  ,int kernel_width
  ,int out_height
  ,int out_width
  ,int out_channels
+ ,int out_stride
  ,int y_stride
  ,WORD32  input_zero_bias
  ,const WORD32 *p_out_multiplier
@@ -958,6 +968,7 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
  )
 {
     WORD32 itr_oh, itr_ch, itr_kw;
+    WORD32 n_taps = kernel_height * kernel_width;
     pWORD8 pt_inp0, pt_inp1;
     WORD8 *pt_ker;
     pWORD8 out_ptr0, out_ptr1;
@@ -986,7 +997,7 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
         int i = 0;
         ae_int32x2 temp_acc0, temp_acc1;
         temp_acc0 = temp_acc1 = AE_ZERO32();
-        for(i=0; i<9; i++)
+        for(i=0; i<n_taps; i++)
         {
             d_ker = AE_L8X4F_I(pt_ker, 0);
             AE_MULA16X4(temp_acc0, temp_acc1, d_ker, AE_MOVDA16(input_zero_bias));
@@ -1016,8 +1027,8 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
 
         for(itr_oh = 0; itr_oh < (out_height); itr_oh+=2)        
         {
-            out_ptr0 = (WORD8 *)(&p_out[itr_oh*out_channels*out_width]);
-            out_ptr1 = (WORD8 *)(&p_out[(itr_oh+1)*out_channels*out_width]);
+            out_ptr0 = (WORD8 *)(&p_out[itr_oh*out_stride*out_width]);
+            out_ptr1 = (WORD8 *)(&p_out[(itr_oh+1)*out_stride*out_width]);
 
             pt_inp0 = (WORD8 *)p_inp;
             pt_inp1 = (WORD8 *)p_inp;
@@ -1030,7 +1041,7 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
             d_acc3 = temp_acc1;
 #pragma no_unroll
 #pragma loop_count min=9
-            for(itr_kw = 0; itr_kw < 9; itr_kw++)
+            for(itr_kw = 0; itr_kw < n_taps; itr_kw++)
             {
                 d_inp0 = AE_L8X4F_I(pt_inp0, 0);
                 d_inp1 = AE_L8X4F_I(pt_inp1, 0);
@@ -1084,9 +1095,112 @@ static inline void conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
     }
 }
 #endif
+
+typedef void (*conv2d_dw_nhwc_sym8sxasym8s_kernel_t)
+(pWORD8 __restrict__ p_out
+ ,const WORD8 *__restrict__ p_ker
+ ,const WORD8 *__restrict__ p_inp
+ ,const WORD32 *p_bias
+ ,int out_height
+ ,int out_width
+ ,int out_channels
+ ,int out_stride
+ ,int y_stride
+ ,WORD32  input_zero_bias
+ ,const WORD32 *p_out_multiplier
+ ,const WORD32 *p_out_shift
+ ,WORD32  out_zero_bias
+ );
+
+/* One instance of the fixed taps kernel per supported kernel shape, stride
+ * is handled by the circular buffer (x) and y_stride (y) */
+#define CONV2D_DW_NHWC_SYM8SXASYM8S_KERNEL(kh, kw) \
+static void conv2d_per_chan_nhwc_sym8sxasym8s_k##kh##x##kw \
+(pWORD8 __restrict__ p_out \
+ ,const WORD8 *__restrict__ p_ker \
+ ,const WORD8 *__restrict__ p_inp \
+ ,const WORD32 *p_bias \
+ ,int out_height \
+ ,int out_width \
+ ,int out_channels \
+ ,int out_stride \
+ ,int y_stride \
+ ,WORD32  input_zero_bias \
+ ,const WORD32 *p_out_multiplier \
+ ,const WORD32 *p_out_shift \
+ ,WORD32  out_zero_bias \
+ ) \
+{ \
+    conv2d_per_chan_nhwc_sym8sxasym8s_fixed_taps(p_out, p_ker, p_inp, p_bias, kh, kw, \
+        out_height, out_width, out_channels, out_stride, y_stride, input_zero_bias, \
+        p_out_multiplier, p_out_shift, out_zero_bias); \
+}
+
+CONV2D_DW_NHWC_SYM8SXASYM8S_KERNEL(3, 3)
+CONV2D_DW_NHWC_SYM8SXASYM8S_KERNEL(5, 5)
+CONV2D_DW_NHWC_SYM8SXASYM8S_KERNEL(7, 7)
+CONV2D_DW_NHWC_SYM8SXASYM8S_KERNEL(1, 9)
+CONV2D_DW_NHWC_SYM8SXASYM8S_KERNEL(9, 1)
+
+/* All entries have at least 9 taps (loop_count pragma) and at most 49, which
+ * keeps the zero bias folded accumulators of the non HiFi1 kernel in 32 bits */
+static const struct
+{
+    WORD32 kernel_height;
+    WORD32 kernel_width;
+    conv2d_dw_nhwc_sym8sxasym8s_kernel_t kernel;
+} conv2d_dw_nhwc_sym8sxasym8s_kernels[] =
+{
+    {3, 3, conv2d_per_chan_nhwc_sym8sxasym8s_k3x3},
+    {5, 5, conv2d_per_chan_nhwc_sym8sxasym8s_k5x5},
+    {7, 7, conv2d_per_chan_nhwc_sym8sxasym8s_k7x7},
+    {1, 9, conv2d_per_chan_nhwc_sym8sxasym8s_k1x9},
+    {9, 1, conv2d_per_chan_nhwc_sym8sxasym8s_k9x1},
+};
+
+static conv2d_dw_nhwc_sym8sxasym8s_kernel_t conv2d_dw_nhwc_sym8sxasym8s_get_kernel
+(WORD32 kernel_height
+ ,WORD32 kernel_width
+ )
+{
+    int i;
+    for(i = 0; i < (int)(sizeof(conv2d_dw_nhwc_sym8sxasym8s_kernels)/sizeof(conv2d_dw_nhwc_sym8sxasym8s_kernels[0])); i++)
+    {
+        if(conv2d_dw_nhwc_sym8sxasym8s_kernels[i].kernel_height == kernel_height &&
+           conv2d_dw_nhwc_sym8sxasym8s_kernels[i].kernel_width == kernel_width)
+            return conv2d_dw_nhwc_sym8sxasym8s_kernels[i].kernel;
+    }
+    return NULL;
+}
 #endif
 
-static void xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxasym8s
+/* Epilogue over output column itr_ow, out_height pixels out_width *
+ * out_stride apart. Called right after the column is written, while it is
+ * still in cache. */
+static WORD32 conv2d_dw_nhwc_epilogue_col
+(pWORD8 p_out
+ ,const WORD8 *p_residual
+ ,WORD32  residual_stride
+ ,WORD32  itr_ow
+ ,WORD32  out_height
+ ,WORD32  out_width
+ ,WORD32  out_channels
+ ,WORD32  out_stride
+ ,WORD32  out_zero_bias
+ ,const xa_nn_epilogue_asym8s_t *p_epilogue
+)
+{
+    return xa_nn_elm_epilogue_asym8s(&p_out[itr_ow*out_stride]
+            ,out_width*out_stride
+            ,p_residual != NULL ? &p_residual[itr_ow*residual_stride] : NULL
+            ,out_width*residual_stride
+            ,out_zero_bias
+            ,out_height
+            ,out_channels
+            ,p_epilogue);
+}
+
+static WORD32 xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxasym8s
 (pWORD8 __restrict__ p_out
  ,const WORD8 *__restrict__ p_kernel
  ,const WORD8 *__restrict__ p_inp
@@ -1107,6 +1221,10 @@ static void xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxasym8s
  ,const WORD32  *p_out_multiplier
  ,const WORD32  *p_out_shift
  ,WORD32  out_zero_bias
+ ,WORD32  out_stride
+ ,const WORD8 *p_residual
+ ,WORD32  residual_stride
+ ,const xa_nn_epilogue_asym8s_t *p_epilogue
 ,pVOID p_scratch
 )
 {
@@ -1165,15 +1283,23 @@ static void xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxasym8s
             );
 
 #ifndef DISABLE_DEPTHWISE_CONV2D_K3X3_SPECIAL_CASE
+    conv2d_dw_nhwc_sym8sxasym8s_kernel_t p_fixed_kernel = NULL;
+    /* Word aligned loads and stores at every pixel */
+    WORD32 io_aligned = ((((unsigned)p_inp) & 3) == 0) &&
+                        ((((unsigned)p_kernel) & 3) == 0) &&
+                        ((((unsigned)p_out) & 3) == 0) &&
+                        ((input_channels & 0x3) == 0) &&
+                        ((out_stride & 0x3) == 0);
     if((channels_multiplier == 1) &&
-       (kernel_height == 3) &&
-       (kernel_width == 3) &&
-       ((((unsigned)p_inp) & 3) == 0) &&
-       ((((unsigned)p_kernel) & 3) == 0) &&
-       ((((unsigned)p_out) & 3) == 0) &&
-       ((input_channels & 0x3) == 0) &&
+       io_aligned &&
        ((out_height & 0x1) == 0)
       )
+    {
+      p_fixed_kernel = conv2d_dw_nhwc_sym8sxasym8s_get_kernel(kernel_height, kernel_width);
+    }
+    XA_NNLIB_PATH_COUNT(XA_NN_PATH_CONV2D_DEPTHWISE_SYM8SXASYM8S, p_fixed_kernel != NULL);
+
+    if(p_fixed_kernel != NULL)
     {
       for(itr_ow = 0; itr_ow < out_width; itr_ow++)
       {
@@ -1199,21 +1325,26 @@ static void xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxasym8s
 
           p_inp_circ = (WORD8 *)p_circ_buf->p_curr;
 
-          conv2d_per_chan_nhwc_sym8sxasym8s_k3x3
-              ((pWORD8)(&p_out[itr_ow*input_channels*channels_multiplier])
+          (*p_fixed_kernel)
+              ((pWORD8)(&p_out[itr_ow*out_stride])
                ,p_kernel
                ,p_inp_circ
                ,p_bias
-               ,kernel_width
                ,out_height
                ,out_width
                ,(input_channels * channels_multiplier)
+               ,out_stride
                ,y_stride
                ,input_zero_bias
                ,p_out_multiplier
                ,p_out_shift
                ,out_zero_bias
               );
+          if(p_epilogue != NULL)
+          {
+              XA_NNLIB_CHK_COND(conv2d_dw_nhwc_epilogue_col(p_out, p_residual, residual_stride, itr_ow,
+                    out_height, out_width, (input_channels * channels_multiplier), out_stride, out_zero_bias, p_epilogue), -1);
+          }
       }
     }
     else
@@ -1244,7 +1375,7 @@ static void xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxasym8s
           p_inp_circ = (WORD8 *)p_circ_buf->p_curr;
 
           conv2d_per_chan_nhwc_sym8sxasym8s
-              ((pWORD8)(&p_out[itr_ow*input_channels*channels_multiplier])
+              ((pWORD8)(&p_out[itr_ow*out_stride])
                ,p_kernel
                ,p_inp_circ
                ,p_bias
@@ -1253,6 +1384,7 @@ static void xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxasym8s
                ,out_height
                ,out_width
                ,(input_channels * channels_multiplier)
+               ,out_stride
                ,y_stride
                ,input_zero_bias
                ,p_out_multiplier
@@ -1260,11 +1392,17 @@ static void xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxasym8s
                ,out_zero_bias
                ,p_state->p_scratch
               );
+          if(p_epilogue != NULL)
+          {
+              XA_NNLIB_CHK_COND(conv2d_dw_nhwc_epilogue_col(p_out, p_residual, residual_stride, itr_ow,
+                    out_height, out_width, (input_channels * channels_multiplier), out_stride, out_zero_bias, p_epilogue), -1);
+          }
       }
     }
+    return 0;
 }
 
-WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
+static WORD32 conv2d_depthwise_per_chan_sym8sxasym8s_impl
   (pWORD8 __restrict__ p_out
   ,const WORD8 *__restrict__ p_kernel
   ,const WORD8 *__restrict__ p_inp
@@ -1287,6 +1425,10 @@ WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
   ,WORD32  out_zero_bias
   ,WORD32  inp_data_format
   ,WORD32  out_data_format
+  ,WORD32  out_stride
+  ,const WORD8 *p_residual
+  ,WORD32  residual_stride
+  ,const xa_nn_epilogue_asym8s_t *p_epilogue
   ,pVOID p_scratch
   )
 {
@@ -1314,10 +1456,19 @@ WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
     XA_NNLIB_ARG_CHK_COND((out_zero_bias > 127 || out_zero_bias < -128), -1);
     XA_NNLIB_ARG_CHK_COND((inp_data_format != 0 && inp_data_format != 1), -1);
     XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_stride < input_channels*channels_multiplier), -1);
+    XA_NNLIB_ARG_CHK_COND((inp_data_format != 0 && out_stride != input_channels*channels_multiplier), -1);
+    if(p_epilogue != NULL)
+    {
+      XA_NNLIB_ARG_CHK_COND((inp_data_format != 0), -1);
+      XA_NNLIB_ARG_CHK_COND((p_epilogue->out_activation_min < -128 || p_epilogue->out_activation_min > 127), -1);
+      XA_NNLIB_ARG_CHK_COND((p_epilogue->out_activation_max < p_epilogue->out_activation_min || p_epilogue->out_activation_max > 127), -1);
+      XA_NNLIB_ARG_CHK_COND((p_residual != NULL && residual_stride < input_channels*channels_multiplier), -1);
+    }
 
     if(inp_data_format == 0)
     {
-        xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxasym8s
+        return xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxasym8s
             (p_out
              ,p_kernel
              ,p_inp
@@ -1338,6 +1489,10 @@ WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
              ,p_out_multiplier
              ,p_out_shift
              ,out_zero_bias
+             ,out_stride
+             ,p_residual
+             ,residual_stride
+             ,p_epilogue
              ,p_scratch);
     }
     else if(inp_data_format == 1)
@@ -1368,6 +1523,179 @@ WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
     return 0;
 }
 
+WORD32 xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32 *p_out_multiplier
+  ,const WORD32 *p_out_shift
+  ,WORD32  out_zero_bias
+  ,WORD32  inp_data_format
+  ,WORD32  out_data_format
+  ,pVOID p_scratch
+  )
+{
+  return conv2d_depthwise_per_chan_sym8sxasym8s_impl
+    (p_out
+    ,p_kernel
+    ,p_inp
+    ,p_bias
+    ,input_height
+    ,input_width
+    ,input_channels
+    ,kernel_height
+    ,kernel_width
+    ,channels_multiplier
+    ,x_stride
+    ,y_stride
+    ,x_padding
+    ,y_padding
+    ,out_height
+    ,out_width
+    ,input_zero_bias
+    ,p_out_multiplier
+    ,p_out_shift
+    ,out_zero_bias
+    ,inp_data_format
+    ,out_data_format
+    ,input_channels*channels_multiplier
+    ,NULL
+    ,0
+    ,NULL
+    ,p_scratch);
+}
+
+/* NHWC input and output, out_stride elements between output pixels */
+WORD32 xa_nn_conv2d_depthwise_out_stride_per_chan_sym8sxasym8s
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32 *p_out_multiplier
+  ,const WORD32 *p_out_shift
+  ,WORD32  out_zero_bias
+  ,WORD32  out_stride
+  ,pVOID p_scratch
+  )
+{
+  return conv2d_depthwise_per_chan_sym8sxasym8s_impl
+    (p_out
+    ,p_kernel
+    ,p_inp
+    ,p_bias
+    ,input_height
+    ,input_width
+    ,input_channels
+    ,kernel_height
+    ,kernel_width
+    ,channels_multiplier
+    ,x_stride
+    ,y_stride
+    ,x_padding
+    ,y_padding
+    ,out_height
+    ,out_width
+    ,input_zero_bias
+    ,p_out_multiplier
+    ,p_out_shift
+    ,out_zero_bias
+    ,0
+    ,0
+    ,out_stride
+    ,NULL
+    ,0
+    ,NULL
+    ,p_scratch);
+}
+
+/* out_stride variant with the epilogue applied to each output column */
+WORD32 xa_nn_conv2d_depthwise_epilogue_per_chan_sym8sxasym8s
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_kernel
+  ,const WORD8 *__restrict__ p_inp
+  ,const WORD32 *__restrict__ p_bias
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  kernel_height
+  ,WORD32  kernel_width
+  ,WORD32  channels_multiplier
+  ,WORD32  x_stride
+  ,WORD32  y_stride
+  ,WORD32  x_padding
+  ,WORD32  y_padding
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  input_zero_bias
+  ,const WORD32 *p_out_multiplier
+  ,const WORD32 *p_out_shift
+  ,WORD32  out_zero_bias
+  ,WORD32  out_stride
+  ,const WORD8 *p_residual
+  ,WORD32  residual_stride
+  ,const xa_nn_epilogue_asym8s_t *p_epilogue
+  ,pVOID p_scratch
+  )
+{
+  XA_NNLIB_ARG_CHK_PTR(p_epilogue, -1);
+
+  return conv2d_depthwise_per_chan_sym8sxasym8s_impl
+    (p_out
+    ,p_kernel
+    ,p_inp
+    ,p_bias
+    ,input_height
+    ,input_width
+    ,input_channels
+    ,kernel_height
+    ,kernel_width
+    ,channels_multiplier
+    ,x_stride
+    ,y_stride
+    ,x_padding
+    ,y_padding
+    ,out_height
+    ,out_width
+    ,input_zero_bias
+    ,p_out_multiplier
+    ,p_out_shift
+    ,out_zero_bias
+    ,0
+    ,0
+    ,out_stride
+    ,p_residual
+    ,residual_stride
+    ,p_epilogue
+    ,p_scratch);
+}
+
 /* 2D Convolution with dilation implementation */
 static inline void dilated_conv2d_nchw_sym8sxasym8s_hf4_convmul
 (pWORD8 __restrict__ p_out  /* Output:  [Stream] [(out_stride): (actual_out_height): (actual_out_width)] */
@@ -2150,6 +2478,7 @@ static void xa_nn_dilated_conv2d_depthwise_nhwc_per_chan_sym8sxasym8s(
                         ,out_height_dh_cur
                         ,out_width * dh_count
                         ,(input_channels * channels_multiplier)
+                        ,(input_channels * channels_multiplier)
                         ,y_stride_circ_buf
                         ,input_zero_bias
                         ,p_out_multiplier
@@ -28,6 +28,10 @@
 
 #include "xa_nnlib_common.h"
 
+#if 0 /* By default special cases for 3x3, 5x5, 7x7, 1x9 and 9x1 kernels are enabled */
+  #define DISABLE_DEPTHWISE_CONV2D_NHWC_SPECIAL_CASE
+#endif
+
 #if XCHAL_HAVE_HIFI1S
 static inline ae_int32x2 MultiplyByQuantizedMultiplier_ref(ae_int64 d_x,
                                              int32_t quantized_multiplier,
@@ -591,6 +595,185 @@ static inline void conv2d_per_chan_nhwc_sym8sxsym16s
 }
 
 
+#ifndef DISABLE_DEPTHWISE_CONV2D_NHWC_SPECIAL_CASE
+/* Special case for fixed kernel dimensions with channels_multiplier 1,
+ * out_channels multiple of 4 and even out_height. The kernel is read in
+ * place instead of being copied to scratch, and at most 64 taps are taken
+ * so the 32-bit accumulators need no intermediate offload. */
+static inline void conv2d_per_chan_nhwc_sym8sxsym16s_fixed_taps
+(pWORD16 __restrict__ p_out
+ ,const WORD8 *__restrict__ p_ker
+ ,const WORD16 *__restrict__ p_inp
+ ,const WORD64 *p_bias
+ ,int kernel_height
+ ,int kernel_width
+ ,int out_height
+ ,int out_width
+ ,int out_channels
+ ,int y_stride
+ ,const WORD32 *p_out_multiplier
+ ,const WORD32 *p_out_shift
+ )
+{
+    WORD32 itr_oh, itr_ch, itr_kw;
+    WORD32 n_taps = kernel_height * kernel_width;
+    ae_int16x4 *pt_inp0, *pt_inp1;
+    WORD8 *pt_ker;
+    ae_int16x4 *out_ptr0, *out_ptr1;
+    ae_int16x4 d_inp0, d_inp1, d_ker;
+    const ae_int64 *pt_bias;
+    ae_int64 d_acc0, d_acc1, d_acc2, d_acc3, d_acc4, d_acc5, d_acc6, d_acc7;
+    ae_int64 d_bias0, d_bias1, d_bias2, d_bias3;
+    ae_int32x2 d_acc32_0, d_acc32_1, d_acc32_2, d_acc32_3;
+    ae_int32x2 ONE32X2 = AE_MOVDA32(1);
+    ae_int16x4 d_acc16x4;
+
+    pt_bias = (const ae_int64 *)p_bias;
+    for(itr_ch = 0; itr_ch < out_channels; itr_ch+=4)
+    {
+        d_bias0 = *pt_bias++;
+        d_bias1 = *pt_bias++;
+        d_bias2 = *pt_bias++;
+        d_bias3 = *pt_bias++;
+
+        WORD32 out_mult0 = p_out_multiplier[itr_ch + 0];
+        WORD32 out_mult1 = p_out_multiplier[itr_ch + 1];
+        WORD32 out_mult2 = p_out_multiplier[itr_ch + 2];
+        WORD32 out_mult3 = p_out_multiplier[itr_ch + 3];
+        int r_shift[4];
+        r_shift[0] = p_out_shift[itr_ch+0];
+        r_shift[1] = p_out_shift[itr_ch+1];
+        r_shift[2] = p_out_shift[itr_ch+2];
+        r_shift[3] = p_out_shift[itr_ch+3];
+
+        for(itr_oh = 0; itr_oh < (out_height); itr_oh+=2)
+        {
+            out_ptr0 = (ae_int16x4 *)(&p_out[itr_oh*out_channels*out_width + itr_ch]);
+            out_ptr1 = (ae_int16x4 *)(&p_out[(itr_oh+1)*out_channels*out_width + itr_ch]);
+
+            pt_inp0 = (ae_int16x4 *)p_inp;
+            pt_inp1 = (ae_int16x4 *)p_inp;
+            AE_ADDCIRC16X4_XC(pt_inp0, 2*(itr_ch + itr_oh*y_stride*kernel_width*out_channels));
+            AE_ADDCIRC16X4_XC(pt_inp1, 2*(itr_ch + (itr_oh+1)*y_stride*kernel_width*out_channels));
+            pt_ker = (WORD8 *)(&p_ker[itr_ch]);
+            d_acc32_0 = d_acc32_1 = d_acc32_2 = d_acc32_3 = AE_ZERO32();
+#pragma loop_count min=9
+            for(itr_kw = 0; itr_kw < n_taps; itr_kw++)
+            {
+                AE_L16X4_XC(d_inp0, pt_inp0, out_channels*2);
+                AE_L16X4_XC(d_inp1, pt_inp1, out_channels*2);
+#if XCHAL_HAVE_HIFI1
+                d_ker = AE_L8X4S_I(pt_ker, 0);
+#else
+                d_ker = AE_L8X4F_I(pt_ker, 0);
+                d_ker = AE_SRAI16(d_ker, 8);
+#endif
+                pt_ker += out_channels;
+                AE_MULA16X4(d_acc32_0, d_acc32_1, d_inp0, d_ker);
+                AE_MULA16X4(d_acc32_2, d_acc32_3, d_inp1, d_ker);
+            }
+            d_acc0 = d_bias0;
+            d_acc1 = d_bias1;
+            d_acc2 = d_bias2;
+            d_acc3 = d_bias3;
+            d_acc4 = d_bias0;
+            d_acc5 = d_bias1;
+            d_acc6 = d_bias2;
+            d_acc7 = d_bias3;
+            AE_MULA32_HL(d_acc0, d_acc32_0, ONE32X2);
+            AE_MULA32_LL(d_acc1, d_acc32_0, ONE32X2);
+            AE_MULA32_HL(d_acc2, d_acc32_1, ONE32X2);
+            AE_MULA32_LL(d_acc3, d_acc32_1, ONE32X2);
+            AE_MULA32_HL(d_acc4, d_acc32_2, ONE32X2);
+            AE_MULA32_LL(d_acc5, d_acc32_2, ONE32X2);
+            AE_MULA32_HL(d_acc6, d_acc32_3, ONE32X2);
+            AE_MULA32_LL(d_acc7, d_acc32_3, ONE32X2);
+
+            ae_int32x2 tmp32_0 = MultiplyByQuantizedMultiplier_ref(d_acc0, out_mult0, r_shift[0]);
+            ae_int32x2 tmp32_1 = MultiplyByQuantizedMultiplier_ref(d_acc1, out_mult1, r_shift[1]);
+            ae_int32x2 tmp32_2 = MultiplyByQuantizedMultiplier_ref(d_acc2, out_mult2, r_shift[2]);
+            ae_int32x2 tmp32_3 = MultiplyByQuantizedMultiplier_ref(d_acc3, out_mult3, r_shift[3]);
+            d_acc16x4 = AE_SAT16X4(AE_SEL32_LL(tmp32_0, tmp32_1), AE_SEL32_LL(tmp32_2, tmp32_3));
+            AE_S16X4_IP(d_acc16x4, out_ptr0, 8);
+
+            tmp32_0 = MultiplyByQuantizedMultiplier_ref(d_acc4, out_mult0, r_shift[0]);
+            tmp32_1 = MultiplyByQuantizedMultiplier_ref(d_acc5, out_mult1, r_shift[1]);
+            tmp32_2 = MultiplyByQuantizedMultiplier_ref(d_acc6, out_mult2, r_shift[2]);
+            tmp32_3 = MultiplyByQuantizedMultiplier_ref(d_acc7, out_mult3, r_shift[3]);
+            d_acc16x4 = AE_SAT16X4(AE_SEL32_LL(tmp32_0, tmp32_1), AE_SEL32_LL(tmp32_2, tmp32_3));
+            AE_S16X4_IP(d_acc16x4, out_ptr1, 8);
+        }
+    }
+}
+
+typedef void (*conv2d_dw_nhwc_sym8sxsym16s_kernel_t)
+(pWORD16 __restrict__ p_out
+ ,const WORD8 *__restrict__ p_ker
+ ,const WORD16 *__restrict__ p_inp
+ ,const WORD64 *p_bias
+ ,int out_height
+ ,int out_width
+ ,int out_channels
+ ,int y_stride
+ ,const WORD32 *p_out_multiplier
+ ,const WORD32 *p_out_shift
+ );
+
+#define CONV2D_DW_NHWC_SYM8SXSYM16S_KERNEL(kh, kw) \
+static void conv2d_per_chan_nhwc_sym8sxsym16s_k##kh##x##kw \
+(pWORD16 __restrict__ p_out \
+ ,const WORD8 *__restrict__ p_ker \
+ ,const WORD16 *__restrict__ p_inp \
+ ,const WORD64 *p_bias \
+ ,int out_height \
+ ,int out_width \
+ ,int out_channels \
+ ,int y_stride \
+ ,const WORD32 *p_out_multiplier \
+ ,const WORD32 *p_out_shift \
+ ) \
+{ \
+    conv2d_per_chan_nhwc_sym8sxsym16s_fixed_taps(p_out, p_ker, p_inp, p_bias, kh, kw, \
+        out_height, out_width, out_channels, y_stride, p_out_multiplier, p_out_shift); \
+}
+
+CONV2D_DW_NHWC_SYM8SXSYM16S_KERNEL(3, 3)
+CONV2D_DW_NHWC_SYM8SXSYM16S_KERNEL(5, 5)
+CONV2D_DW_NHWC_SYM8SXSYM16S_KERNEL(7, 7)
+CONV2D_DW_NHWC_SYM8SXSYM16S_KERNEL(1, 9)
+CONV2D_DW_NHWC_SYM8SXSYM16S_KERNEL(9, 1)
+
+static const struct
+{
+    WORD32 kernel_height;
+    WORD32 kernel_width;
+    conv2d_dw_nhwc_sym8sxsym16s_kernel_t kernel;
+} conv2d_dw_nhwc_sym8sxsym16s_kernels[] =
+{
+    {3, 3, conv2d_per_chan_nhwc_sym8sxsym16s_k3x3},
+    {5, 5, conv2d_per_chan_nhwc_sym8sxsym16s_k5x5},
+    {7, 7, conv2d_per_chan_nhwc_sym8sxsym16s_k7x7},
+    {1, 9, conv2d_per_chan_nhwc_sym8sxsym16s_k1x9},
+    {9, 1, conv2d_per_chan_nhwc_sym8sxsym16s_k9x1},
+};
+
+static conv2d_dw_nhwc_sym8sxsym16s_kernel_t conv2d_dw_nhwc_sym8sxsym16s_get_kernel
+(WORD32 kernel_height
+ ,WORD32 kernel_width
+ )
+{
+    int i;
+    for(i = 0; i < (int)(sizeof(conv2d_dw_nhwc_sym8sxsym16s_kernels)/sizeof(conv2d_dw_nhwc_sym8sxsym16s_kernels[0])); i++)
+    {
+        if(conv2d_dw_nhwc_sym8sxsym16s_kernels[i].kernel_height == kernel_height &&
+           conv2d_dw_nhwc_sym8sxsym16s_kernels[i].kernel_width == kernel_width)
+            return conv2d_dw_nhwc_sym8sxsym16s_kernels[i].kernel;
+    }
+    return NULL;
+}
+#endif /* #ifndef DISABLE_DEPTHWISE_CONV2D_NHWC_SPECIAL_CASE */
+
+
 static void xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxsym16s
 (pWORD16 __restrict__ p_out
  ,const WORD8 *__restrict__ p_kernel
@@ -664,6 +847,63 @@ static void xa_nn_conv2d_depthwise_per_chan_nhwc_sym8sxsym16s
             ,p_circ_buf
             ,pt_inp
             );
+
+#ifndef DISABLE_DEPTHWISE_CONV2D_NHWC_SPECIAL_CASE
+    conv2d_dw_nhwc_sym8sxsym16s_kernel_t p_fixed_kernel = NULL;
+    /* Word aligned kernel loads and 64-bit output stores at every pixel */
+    WORD32 io_aligned = ((((unsigned)p_kernel) & 3) == 0) &&
+                        ((((unsigned)p_out) & 7) == 0) &&
+                        ((input_channels & 0x3) == 0);
+    if((channels_multiplier == 1) &&
+       io_aligned &&
+       ((out_height & 0x1) == 0)
+      )
+    {
+      p_fixed_kernel = conv2d_dw_nhwc_sym8sxsym16s_get_kernel(kernel_height, kernel_width);
+    }
+    XA_NNLIB_PATH_COUNT(XA_NN_PATH_CONV2D_DEPTHWISE_SYM8SXSYM16S, p_fixed_kernel != NULL);
+
+    if(p_fixed_kernel != NULL)
+    {
+      for(itr_ow = 0; itr_ow < out_width; itr_ow++)
+      {
+          CIRC_BUF_ADD_COLS(cols_added
+                  ,cols_to_add
+                  ,left_pad
+                  ,right_pad
+                  ,input_col
+                  ,input_height
+                  ,input_width
+                  ,input_channels
+                  ,kernel_height
+                  ,kernel_width
+                  ,channels_multiplier
+                  ,x_stride
+                  ,x_padding
+                  ,y_padding
+                  ,out_height
+                  ,p_circ_buf
+                  ,pt_inp
+                  );
+
+          p_inp_circ = (WORD16 *)p_circ_buf->p_curr;
+
+          (*p_fixed_kernel)
+              ((pWORD16)(&p_out[itr_ow*input_channels])
+               ,p_kernel
+               ,p_inp_circ
+               ,p_bias
+               ,out_height
+               ,out_width
+               ,input_channels
+               ,y_stride
+               ,p_out_multiplier
+               ,p_out_shift
+              );
+      }
+    }
+    else
+#endif
     {
       for(itr_ow = 0; itr_ow < out_width; itr_ow++)
       {
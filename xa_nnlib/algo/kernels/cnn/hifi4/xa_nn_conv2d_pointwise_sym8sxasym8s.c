@@ -23,6 +23,10 @@
 #include "xa_nnlib_common.h"
 #include "xa_nnlib_common_macros.h"
 
+/* With an epilogue the pixels are processed in blocks of about this many
+ * output bytes, so the epilogue reads them back from cache */
+#define POINTWISE_EPILOGUE_BLOCK_BYTES 2048
+
 static WORD32 xa_nn_conv2d_pointwise_nhwc_per_chan_sym8sxasym8s(
     WORD8* __restrict__ p_out,
     WORD8* __restrict__ p_kernel,
@@ -35,34 +39,63 @@ static WORD32 xa_nn_conv2d_pointwise_nhwc_per_chan_sym8sxasym8s(
     WORD32  input_zero_bias,
     WORD32*  __restrict__ p_out_multiplier,
     WORD32*  __restrict__ p_out_shift,
-    WORD32  out_zero_bias)
+    WORD32  out_zero_bias,
+    WORD32  out_stride,
+    const WORD8 *p_residual,
+    WORD32  residual_stride,
+    const xa_nn_epilogue_asym8s_t *p_epilogue)
 {
     int ret, out_plane_size;
     out_plane_size = input_height*input_width;
     int vec_offset, out_offset;
+    int pix, blk, num_pix;
 
     vec_offset = input_channels;
-    out_offset = out_channels;
+    out_offset = out_stride;
 
+    blk = out_plane_size;
+    if(p_epilogue != NULL)
+    {
+        blk = (POINTWISE_EPILOGUE_BLOCK_BYTES / out_channels) & ~3;
+        blk = blk < 4 ? 4 : blk;
+    }
 
-    ret = xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(p_out,
-                                         p_kernel,
-                                         p_inp,
-                                         p_bias,
-                                         out_channels,
-                                         input_channels,
-                                         input_channels,
-                                         out_plane_size,
-                                         vec_offset,
-                                         out_offset,
-                                         1,
-                                         input_zero_bias,
-                                         p_out_multiplier,
-                                         p_out_shift,
-                                         out_zero_bias
-                                         );
-    if(ret<0)
-        return ret;
+    for(pix = 0; pix < out_plane_size; pix += blk)
+    {
+        num_pix = (out_plane_size - pix) < blk ? (out_plane_size - pix) : blk;
+        ret = xa_nn_matmul_per_chan_sym8sxasym8s_asym8s(&p_out[pix * out_stride],
+                                             p_kernel,
+                                             &p_inp[pix * input_channels],
+                                             p_bias,
+                                             out_channels,
+                                             input_channels,
+                                             input_channels,
+                                             num_pix,
+                                             vec_offset,
+                                             out_offset,
+                                             1,
+                                             input_zero_bias,
+                                             p_out_multiplier,
+                                             p_out_shift,
+                                             out_zero_bias
+                                             );
+        if(ret<0)
+            return ret;
+
+        if(p_epilogue != NULL)
+        {
+            ret = xa_nn_elm_epilogue_asym8s(&p_out[pix * out_stride],
+                                            out_stride,
+                                            p_residual ? &p_residual[pix * residual_stride] : NULL,
+                                            residual_stride,
+                                            out_zero_bias,
+                                            num_pix,
+                                            out_channels,
+                                            p_epilogue);
+            if(ret<0)
+                return ret;
+        }
+    }
     return 0;
 }
 
@@ -109,7 +142,7 @@ static WORD32 xa_nn_conv2d_pointwise_nchw_per_chan_sym8sxasym8s(
     return 0;
 }
 
-WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
+static WORD32 conv2d_pointwise_per_chan_sym8sxasym8s_impl(
     WORD8* __restrict__ p_out,
     WORD8* __restrict__ p_kernel,
     WORD8* __restrict__ p_inp,
@@ -122,7 +155,11 @@ WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
     WORD32* __restrict__ p_out_multiplier,
     WORD32* __restrict__ p_out_shift,
     WORD32  out_zero_bias,
-    WORD32  out_data_format)
+    WORD32  out_data_format,
+    WORD32  out_stride,
+    const WORD8 *p_residual,
+    WORD32  residual_stride,
+    const xa_nn_epilogue_asym8s_t *p_epilogue)
 {
   /* NULL pointer checks */
   XA_NNLIB_ARG_CHK_PTR(p_out, -1);
@@ -147,7 +184,14 @@ WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
   XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
   XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
   XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
-
+  XA_NNLIB_ARG_CHK_COND((out_data_format == 0 && out_stride < out_channels), -1);
+  if(p_epilogue != NULL)
+  {
+    XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->out_activation_min < -128 || p_epilogue->out_activation_min > 127), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->out_activation_max < p_epilogue->out_activation_min || p_epilogue->out_activation_max > 127), -1);
+    XA_NNLIB_ARG_CHK_COND((p_residual != NULL && residual_stride < out_channels), -1);
+  }
 
   int i = 0;
   for(i=0; i<out_channels; i++)
@@ -169,7 +213,11 @@ WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
               input_zero_bias,
               p_out_multiplier,
               p_out_shift,
-              out_zero_bias);
+              out_zero_bias,
+              out_stride,
+              p_residual,
+              residual_stride,
+              p_epilogue);
   }
   else if(out_data_format == 1){
       ret = xa_nn_conv2d_pointwise_nchw_per_chan_sym8sxasym8s(
@@ -188,3 +236,69 @@ WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
   }
   return ret;
 }
+
+WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_data_format)
+{
+  return conv2d_pointwise_per_chan_sym8sxasym8s_impl(p_out, p_kernel, p_inp, p_bias,
+      input_height, input_width, input_channels, out_channels, input_zero_bias,
+      p_out_multiplier, p_out_shift, out_zero_bias, out_data_format, out_channels, NULL, 0, NULL);
+}
+
+/* NHWC output with out_stride elements between output pixels */
+WORD32 xa_nn_conv2d_pointwise_out_stride_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_stride)
+{
+  return conv2d_pointwise_per_chan_sym8sxasym8s_impl(p_out, p_kernel, p_inp, p_bias,
+      input_height, input_width, input_channels, out_channels, input_zero_bias,
+      p_out_multiplier, p_out_shift, out_zero_bias, 0, out_stride, NULL, 0, NULL);
+}
+
+/* out_stride variant followed by the epilogue on each block of pixels */
+WORD32 xa_nn_conv2d_pointwise_epilogue_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    WORD8* __restrict__ p_kernel,
+    WORD8* __restrict__ p_inp,
+    WORD32* __restrict__ p_bias,
+    WORD32  input_height,
+    WORD32  input_width,
+    WORD32  input_channels,
+    WORD32  out_channels,
+    WORD32  input_zero_bias,
+    WORD32* __restrict__ p_out_multiplier,
+    WORD32* __restrict__ p_out_shift,
+    WORD32  out_zero_bias,
+    WORD32  out_stride,
+    const WORD8 *p_residual,
+    WORD32  residual_stride,
+    const xa_nn_epilogue_asym8s_t *p_epilogue)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_epilogue, -1);
+  return conv2d_pointwise_per_chan_sym8sxasym8s_impl(p_out, p_kernel, p_inp, p_bias,
+      input_height, input_width, input_channels, out_channels, input_zero_bias,
+      p_out_multiplier, p_out_shift, out_zero_bias, 0, out_stride, p_residual, residual_stride, p_epilogue);
+}
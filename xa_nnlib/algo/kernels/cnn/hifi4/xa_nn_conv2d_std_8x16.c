@@ -122,7 +122,7 @@ static WORD32 conv_x_right_pad(
 }
 
 
-WORD32 xa_nn_conv2d_std_8x16(
+static WORD32 conv2d_std_8x16_impl(
     WORD16* __restrict__ p_out,
     WORD16* __restrict__ p_inp,
     WORD8*  __restrict__ p_kernel,
@@ -142,7 +142,8 @@ WORD32 xa_nn_conv2d_std_8x16(
     WORD32 bias_shift,
     WORD32 acc_shift,
     WORD32 out_data_format,
-    VOID *p_scratch)
+    VOID *p_scratch,
+    WORD32 kernel_prepacked)
 {
   /* NULL pointer checks */
   XA_NNLIB_ARG_CHK_PTR(p_out, -1);
@@ -177,19 +178,36 @@ WORD32 xa_nn_conv2d_std_8x16(
   p_scratch = ALIGNED_ADDR(p_scratch, ALIGNMENT);
   xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
 
-  xa_nn_conv2d_std_init_state((void*)p_state
-      ,(void*)p_kernel
-      ,input_height
-      ,input_channels
-      ,kernel_height
-      ,kernel_width
-      ,y_stride
-      ,y_padding
-      ,out_height
-      ,out_channels
-      ,PREC_16
-      ,PREC_8
-      );
+  if(kernel_prepacked)
+  {
+    xa_nn_conv2d_std_prepacked_init_state((void*)p_state
+        ,(void*)p_kernel
+        ,input_height
+        ,input_channels
+        ,kernel_height
+        ,kernel_width
+        ,y_stride
+        ,y_padding
+        ,out_height
+        ,out_channels
+        ,PREC_16
+        ,PREC_8);
+  }
+  else
+  {
+    xa_nn_conv2d_std_init_state((void*)p_state
+        ,(void*)p_kernel
+        ,input_height
+        ,input_channels
+        ,kernel_height
+        ,kernel_width
+        ,y_stride
+        ,y_padding
+        ,out_height
+        ,out_channels
+        ,PREC_16
+        ,PREC_8);
+  }
 
   WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1;
   WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels;
@@ -273,3 +291,104 @@ WORD32 xa_nn_conv2d_std_8x16(
   return 0;
 }
 
+WORD32 xa_nn_conv2d_std_8x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    WORD8*  __restrict__ p_kernel,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return conv2d_std_8x16_impl(p_out
+      ,p_inp
+      ,p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,bias_shift
+      ,acc_shift
+      ,out_data_format
+      ,p_scratch
+      ,0);
+}
+
+WORD32 xa_nn_conv2d_std_prepacked_8x16(
+    WORD16* __restrict__ p_out,
+    WORD16* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_prepacked,
+    WORD16* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 bias_shift,
+    WORD32 acc_shift,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_kernel_prepacked, -1);
+
+  const VOID *p_kernel = xa_nn_conv2d_std_prepacked_get_kernel(p_kernel_prepacked
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,PREC_16
+      ,PREC_8);
+  XA_NNLIB_CHK_PTR(p_kernel, -1);
+
+  return conv2d_std_8x16_impl(p_out
+      ,p_inp
+      ,(WORD8*)p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,bias_shift
+      ,acc_shift
+      ,out_data_format
+      ,p_scratch
+      ,1);
+}
+
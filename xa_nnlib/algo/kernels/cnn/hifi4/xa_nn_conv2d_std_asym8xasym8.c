@@ -140,7 +140,7 @@ static WORD32 conv_x_right_pad(
   return out_width_over_x_r_pad;
 }
 
-WORD32 xa_nn_conv2d_std_asym8xasym8(
+static WORD32 conv2d_std_asym8xasym8_impl(
     UWORD8* __restrict__ p_out,
     const UWORD8* __restrict__ p_inp,
     const UWORD8* __restrict__ p_kernel,
@@ -163,7 +163,8 @@ WORD32 xa_nn_conv2d_std_asym8xasym8(
     WORD32 out_shift,
     WORD32 out_zero_bias,
     WORD32 out_data_format,
-    VOID *p_scratch)
+    VOID *p_scratch,
+    WORD32 kernel_prepacked)
 {
    /* NULL pointer checks */
   XA_NNLIB_ARG_CHK_PTR(p_out, -1);
@@ -199,18 +200,36 @@ WORD32 xa_nn_conv2d_std_asym8xasym8(
 
   p_scratch = ALIGNED_ADDR(p_scratch, ALIGNMENT);
   xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
-  xa_nn_conv2d_std_init_state((void*)p_state
-      ,(void*)p_kernel
-      ,input_height
-      ,input_channels
-      ,kernel_height
-      ,kernel_width
-      ,y_stride
-      ,y_padding
-      ,out_height
-      ,out_channels
-      ,PREC_ASYM8U
-      ,PREC_ASYM8U);
+  if(kernel_prepacked)
+  {
+    xa_nn_conv2d_std_prepacked_init_state((void*)p_state
+        ,(void*)p_kernel
+        ,input_height
+        ,input_channels
+        ,kernel_height
+        ,kernel_width
+        ,y_stride
+        ,y_padding
+        ,out_height
+        ,out_channels
+        ,PREC_ASYM8U
+        ,PREC_ASYM8U);
+  }
+  else
+  {
+    xa_nn_conv2d_std_init_state((void*)p_state
+        ,(void*)p_kernel
+        ,input_height
+        ,input_channels
+        ,kernel_height
+        ,kernel_width
+        ,y_stride
+        ,y_padding
+        ,out_height
+        ,out_channels
+        ,PREC_ASYM8U
+        ,PREC_ASYM8U);
+  }
 
   WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1;
   WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels;
@@ -288,3 +307,116 @@ WORD32 xa_nn_conv2d_std_asym8xasym8(
   return 0;
 }
 
+WORD32 xa_nn_conv2d_std_asym8xasym8(
+    UWORD8* __restrict__ p_out,
+    const UWORD8* __restrict__ p_inp,
+    const UWORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 kernel_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return conv2d_std_asym8xasym8_impl(p_out
+      ,p_inp
+      ,p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,kernel_zero_bias
+      ,out_multiplier
+      ,out_shift
+      ,out_zero_bias
+      ,out_data_format
+      ,p_scratch
+      ,0);
+}
+
+WORD32 xa_nn_conv2d_std_prepacked_asym8uxasym8u(
+    UWORD8* __restrict__ p_out,
+    const UWORD8* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_prepacked,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 kernel_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_kernel_prepacked, -1);
+
+  const VOID *p_kernel = xa_nn_conv2d_std_prepacked_get_kernel(p_kernel_prepacked
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,PREC_ASYM8U
+      ,PREC_ASYM8U);
+  XA_NNLIB_CHK_PTR(p_kernel, -1);
+
+  return conv2d_std_asym8xasym8_impl(p_out
+      ,p_inp
+      ,(const UWORD8*)p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,kernel_zero_bias
+      ,out_multiplier
+      ,out_shift
+      ,out_zero_bias
+      ,out_data_format
+      ,p_scratch
+      ,1);
+}
+
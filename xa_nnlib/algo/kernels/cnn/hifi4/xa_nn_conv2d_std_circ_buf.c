@@ -24,7 +24,7 @@
 #include "xa_nn_conv2d_std_state.h"
 #include <string.h>
 
-WORD32 xa_nn_conv2d_std_getsize(
+static WORD32 conv2d_std_getsize_impl(
     WORD32 input_height,
     WORD32 input_width,
     WORD32 input_channels,
@@ -42,7 +42,8 @@ WORD32 xa_nn_conv2d_std_getsize(
     WORD32 kernel_precision,
     WORD32 dilation_height,
     WORD32 dilation_width,
-    WORD32 out_data_format)
+    WORD32 out_data_format,
+    WORD32 kernel_prepacked)
 {
   XA_NNLIB_CHK_COND((input_height <= 0), -1);
   XA_NNLIB_CHK_COND((input_channels <= 0), -1);
@@ -64,6 +65,24 @@ WORD32 xa_nn_conv2d_std_getsize(
   const int filters_per_group = output_channels / groups;
   XA_NNLIB_ARG_CHK_COND((filters_per_group<=0),-1);
 
+  /* f16 runs on the f32 path: f32 bias, a block of widened kernel rows and
+   * one f32 output column in front of the f32 scratch, see
+   * xa_nn_conv2d_std_f16 */
+  if(input_precision == PREC_F16)
+  {
+    WORD32 f32_size = conv2d_std_getsize_impl(input_height, input_width,
+        input_channels, kernel_height, kernel_width, kernel_channels,
+        y_stride, y_padding, x_stride, x_padding, out_height, out_width,
+        output_channels, PREC_F32, PREC_F32, dilation_height, dilation_width,
+        out_data_format, kernel_prepacked);
+    XA_NNLIB_CHK_COND((f32_size < 0), -1);
+    WORD32 vec_len = kernel_height * kernel_width * PADDED_SIZE(input_channels, (ALIGNMENT>>2));
+    WORD32 mem_req_f16 = ALIGNMENT;
+    mem_req_f16 += ALIGNED_SIZE(output_channels * sizeof(FLOAT32), ALIGNMENT);
+    mem_req_f16 += ALIGNED_SIZE(CONV2D_STD_F16_VEC_BLOCK * vec_len * sizeof(FLOAT32), ALIGNMENT);
+    mem_req_f16 += ALIGNED_SIZE(out_height * output_channels * sizeof(FLOAT32), ALIGNMENT);
+    return mem_req_f16 + f32_size;
+  }
 
   /* Unused variables kept for future use */
   (void)kernel_precision;
@@ -172,6 +191,7 @@ WORD32 xa_nn_conv2d_std_getsize(
 
 #if !ENABLE_PADDING_CONV2D_STD
   if(
+      (!kernel_prepacked) &&
       (input_precision != PREC_ASYM8S) &&
       (input_precision != PREC_F32) &&
       (input_precision != PREC_16) &&
@@ -179,6 +199,7 @@ WORD32 xa_nn_conv2d_std_getsize(
     )
 #else
   if(
+      (!kernel_prepacked) &&
       (input_precision != PREC_16) &&
       (kernel_channels_pad != kernel_channels)
     )
@@ -191,6 +212,217 @@ WORD32 xa_nn_conv2d_std_getsize(
   return mem_req;
 }
 
+WORD32 xa_nn_conv2d_std_getsize(
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 kernel_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 x_stride,
+    WORD32 x_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 output_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision,
+    WORD32 dilation_height,
+    WORD32 dilation_width,
+    WORD32 out_data_format)
+{
+  return conv2d_std_getsize_impl(input_height, input_width, input_channels,
+      kernel_height, kernel_width, kernel_channels, y_stride, y_padding,
+      x_stride, x_padding, out_height, out_width, output_channels,
+      input_precision, kernel_precision, dilation_height, dilation_width,
+      out_data_format, 0);
+}
+
+/* Scratch for the prepacked variants holds only the state and the circular
+ * buffer, the padded kernel lives in the caller's persistent buffer */
+WORD32 xa_nn_conv2d_std_prepacked_getsize(
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 kernel_channels,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 x_stride,
+    WORD32 x_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 output_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision,
+    WORD32 dilation_height,
+    WORD32 dilation_width,
+    WORD32 out_data_format)
+{
+  return conv2d_std_getsize_impl(input_height, input_width, input_channels,
+      kernel_height, kernel_width, kernel_channels, y_stride, y_padding,
+      x_stride, x_padding, out_height, out_width, output_channels,
+      input_precision, kernel_precision, dilation_height, dilation_width,
+      out_data_format, 1);
+}
+
+WORD32 conv2d_std_get_input_channels_pad(
+    WORD32 input_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision)
+{
+  WORD32 align_size;
+
+  switch(input_precision)
+  {
+    case 8:
+    case -7:
+    case -8:
+    case 16:
+    case -3:
+    case -4:
+      align_size = ALIGNMENT>>1;
+      break;
+    case -1:
+      align_size = ALIGNMENT>>2;
+      break;
+    default:
+      return -1;
+      break;
+  }
+
+#if !ENABLE_PADDING_CONV2D_STD
+  if(input_precision == PREC_ASYM8S)
+  {
+    return input_channels;
+  }
+#endif
+#if HW_AE_ADDCIRC16X4_XC
+  /* Same exception as xa_nn_conv2d_std_init_state: no padding for ic=1 */
+  if(input_channels == 1 && (kernel_precision == PREC_SYM8S || kernel_precision == PREC_SYM4S) && input_precision == PREC_ASYM8S)
+  {
+    return 1;
+  }
+#else
+  (void)kernel_precision;
+#endif
+  return PADDED_SIZE(input_channels, align_size);
+}
+
+/* Input precisions for which the non-prepacked kernels take the kernel
+ * already padded to input_channels_pad by the caller, the rest pad it
+ * internally from an unpadded kernel (see the init_state padding checks) */
+static WORD32 conv2d_std_kernel_caller_padded(WORD32 input_precision)
+{
+#if !ENABLE_PADDING_CONV2D_STD
+  return (input_precision == PREC_ASYM8S ||
+          input_precision == PREC_F32 ||
+          input_precision == PREC_16);
+#else
+  return (input_precision == PREC_16);
+#endif
+}
+
+WORD32 xa_nn_conv2d_std_prepack_getsize(
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision)
+{
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+
+  WORD32 kernel_size;
+  switch(kernel_precision)
+  {
+    case 8:
+    case -3:
+    case -4:
+    case -5:
+    case -12: /* sym4s kernels are unpacked to 8 bits */
+      kernel_size = sizeof(WORD8);
+      break;
+    case 16:
+      kernel_size = sizeof(WORD16);
+      break;
+    case -1:
+      kernel_size = sizeof(FLOAT32);
+      break;
+    default:
+      return -1;
+      break;
+  }
+
+  WORD32 input_channels_pad = conv2d_std_get_input_channels_pad(input_channels, input_precision, kernel_precision);
+  XA_NNLIB_CHK_COND((input_channels_pad <= 0), -1);
+
+  WORD32 mem_req = 0;
+  mem_req += XA_NN_CONV2D_STD_PREPACK_HDR_SIZE;
+  mem_req += ALIGNED_SIZE(out_channels * kernel_height * kernel_width * input_channels_pad * kernel_size, ALIGNMENT);
+  return mem_req;
+}
+
+/* Grouped conv2d is run as depthwise for one input channel per group, NHWC
+ * output and a bias, otherwise group-blocked. Used both for the dispatch in
+ * xa_nn_conv2d_per_chan_sym8sxasym8s and for the prepacked kernel layout. */
+WORD32 conv2d_group_get_layout(
+    WORD32 input_channels,
+    WORD32 kernel_channels,
+    WORD32 out_channels,
+    WORD32 out_data_format,
+    WORD32 bias_present)
+{
+  if((kernel_channels == 1) && (out_channels >= input_channels) &&
+     (out_data_format == 0) && bias_present)
+    return XA_NN_CONV2D_GROUP_LAYOUT_DEPTHWISE;
+  return XA_NN_CONV2D_GROUP_LAYOUT_BLOCKED;
+}
+
+WORD32 xa_nn_conv2d_group_prepack_getsize(
+    WORD32 input_channels,
+    WORD32 kernel_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision,
+    WORD32 out_data_format,
+    WORD32 bias_present)
+{
+  XA_NNLIB_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_height <= 0), -1);
+  XA_NNLIB_CHK_COND((kernel_width <= 0), -1);
+  XA_NNLIB_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_CHK_COND((input_channels % kernel_channels != 0), -1);
+  XA_NNLIB_CHK_COND((out_channels % (input_channels / kernel_channels) != 0), -1);
+  /* Only the sym8sxasym8s grouped kernel consumes this layout */
+  XA_NNLIB_CHK_COND((input_precision != PREC_ASYM8S), -1);
+  XA_NNLIB_CHK_COND((kernel_precision != PREC_SYM8S), -1);
+  XA_NNLIB_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+  WORD32 kernel_channels_pad;
+  if(conv2d_group_get_layout(input_channels, kernel_channels, out_channels, out_data_format, bias_present) == XA_NN_CONV2D_GROUP_LAYOUT_DEPTHWISE)
+  {
+    kernel_channels_pad = 1;
+  }
+  else
+  {
+    kernel_channels_pad = conv2d_std_get_input_channels_pad(kernel_channels, input_precision, kernel_precision);
+  }
+
+  WORD32 mem_req = 0;
+  mem_req += XA_NN_CONV2D_GROUP_PREPACK_HDR_SIZE;
+  mem_req += ALIGNED_SIZE(out_channels * kernel_height * kernel_width * kernel_channels_pad * sizeof(WORD8), ALIGNMENT);
+  return mem_req;
+}
+
 
 WORD32 xa_nn_conv2d_getsize(
     WORD32 input_height,
@@ -239,6 +471,7 @@ WORD32 xa_nn_conv2d_getsize(
   (void)dilation_width;
 
   WORD32 mem_req = 0;
+  WORD32 depthwise_mem_req = 0;
   WORD32 input_size;
   WORD32 align_size;
   WORD32 inp_h, inp_w, ker_h, ker_w, x_str, y_str, x_pad, y_pad, out_h, out_w;
@@ -270,12 +503,16 @@ WORD32 xa_nn_conv2d_getsize(
     out_w = out_width;
   }
 
-  if((groups==input_channels) && (output_channels >=input_channels) && (input_precision==-4) && (out_data_format==0))
+  /* Depthwise-like layers run depthwise only when a bias is given (see
+   * conv2d_group_get_layout), without one they run group-blocked, so the
+   * larger of the two sizes is reserved */
+  if((input_precision == PREC_ASYM8S) &&
+     (conv2d_group_get_layout(input_channels, kernel_channels, output_channels, out_data_format, 1) == XA_NN_CONV2D_GROUP_LAYOUT_DEPTHWISE))
   {   
     WORD32 channel_multiplier=output_channels/input_channels;
-    mem_req += ALIGNMENT;
-    mem_req += PADDED_SIZE(output_channels*kernel_height*kernel_width, ALIGNMENT);
-    mem_req += xa_nn_conv2d_depthwise_getsize(inp_h
+    depthwise_mem_req += ALIGNMENT;
+    depthwise_mem_req += PADDED_SIZE(output_channels*kernel_height*kernel_width, ALIGNMENT);
+    depthwise_mem_req += xa_nn_conv2d_depthwise_getsize(inp_h
                                               ,inp_w
                                               ,input_channels
                                               ,ker_h
@@ -290,10 +527,7 @@ WORD32 xa_nn_conv2d_getsize(
                                               ,input_precision
                                               ,0
                                               );
-
   }
-  else
-  {
 
   mem_req += ALIGNMENT;
   mem_req += ALIGNED_SIZE(sizeof(xa_nn_conv_state_t), ALIGNMENT);
@@ -355,6 +589,12 @@ WORD32 xa_nn_conv2d_getsize(
     cir_buf_size_bytes+= ker_w*kernel_channels_pad*input_size;
   }
 
+  /* Grouped asym8s convolution keeps one circular buffer per group */
+  if(input_precision == PREC_ASYM8S)
+  {
+    cir_buf_size_bytes *= groups;
+  }
+
   /* scratch memory for convolution using matrix multiplication */
   mem_req += ALIGNED_SIZE(cir_buf_size_bytes, ALIGNMENT);
   mem_req += BUS_WIDTH;
@@ -377,8 +617,7 @@ WORD32 xa_nn_conv2d_getsize(
     mem_req += ALIGNED_SIZE(padded_kernel_size, ALIGNMENT);
   }
 
-  }
-  return mem_req;
+  return (mem_req > depthwise_mem_req) ? mem_req : depthwise_mem_req;
 }
 
 WORD32 xa_nn_conv2d_std_getsize_sym4s(
@@ -502,7 +741,7 @@ WORD32 xa_nn_dilated_conv2d_std_getsize(
 }
 
 #ifndef ENABLE_SCRATCH_SIZE_API_ONLY
-VOID xa_nn_conv2d_std_init_state(
+static VOID conv2d_std_init_state_impl(
     VOID *p_scratch,
     VOID *p_kernel,
     WORD32 input_height,
@@ -514,7 +753,9 @@ VOID xa_nn_conv2d_std_init_state(
     WORD32 out_height,
     WORD32 output_channels,
     WORD32 input_precision,
-    WORD32 kernel_precision)
+    WORD32 kernel_precision,
+    WORD32 groups,
+    WORD32 kernel_prepacked)
 {
   WORD8 *p_mem = (WORD8 *)p_scratch;
   xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_mem;
@@ -602,12 +843,15 @@ VOID xa_nn_conv2d_std_init_state(
   AE_SETCBEGIN0(p_state->cir_buf.p_begin);
   AE_SETCEND0(p_state->cir_buf.p_end);
 
+  /* Circular buffers of groups 1..groups-1 follow the one of group 0 */
+  p_mem += (groups - 1) * cir_buf_size_bytes;
   p_mem = ALIGNED_ADDR(p_mem, ALIGNMENT);
 
   p_state->p_kernel_padded = (void *)p_kernel;
 
 #if !ENABLE_PADDING_CONV2D_STD
   if(
+      (!kernel_prepacked) &&
       (input_precision != PREC_ASYM8S) &&
       (input_precision != PREC_F32) &&
       (input_precision != PREC_16) &&
@@ -615,6 +859,7 @@ VOID xa_nn_conv2d_std_init_state(
     )
 #else
   if(
+      (!kernel_prepacked) &&
       (input_precision != PREC_16) &&
       (input_channels_pad != input_channels)
     )
@@ -667,6 +912,335 @@ VOID xa_nn_conv2d_std_init_state(
 
 }
 
+VOID xa_nn_conv2d_std_init_state(
+    VOID *p_scratch,
+    VOID *p_kernel,
+    WORD32 input_height,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 output_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision)
+{
+  conv2d_std_init_state_impl(p_scratch
+      ,p_kernel
+      ,input_height
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,y_stride
+      ,y_padding
+      ,out_height
+      ,output_channels
+      ,input_precision
+      ,kernel_precision
+      ,1
+      ,0);
+}
+
+/* Same as xa_nn_conv2d_std_init_state, but p_kernel_prepacked already is in
+ * the padded layout, so it is used in place instead of copied to scratch */
+VOID xa_nn_conv2d_std_prepacked_init_state(
+    VOID *p_scratch,
+    VOID *p_kernel_prepacked,
+    WORD32 input_height,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 output_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision)
+{
+  conv2d_std_init_state_impl(p_scratch
+      ,p_kernel_prepacked
+      ,input_height
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,y_stride
+      ,y_padding
+      ,out_height
+      ,output_channels
+      ,input_precision
+      ,kernel_precision
+      ,1
+      ,1);
+}
+
+/* Grouped convolution: input_channels is kernel_channels, the circular buffer
+ * is repeated per group (group-blocked) and p_end marks the end of the group 0
+ * buffer, so p_end - p_begin is the stride between the group buffers */
+VOID xa_nn_conv2d_group_blocked_init_state(
+    VOID *p_scratch,
+    VOID *p_kernel,
+    WORD32 input_height,
+    WORD32 kernel_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 output_channels,
+    WORD32 groups,
+    WORD32 input_precision,
+    WORD32 kernel_precision,
+    WORD32 kernel_prepacked)
+{
+  conv2d_std_init_state_impl(p_scratch
+      ,p_kernel
+      ,input_height
+      ,kernel_channels
+      ,kernel_height
+      ,kernel_width
+      ,y_stride
+      ,y_padding
+      ,out_height
+      ,output_channels
+      ,input_precision
+      ,kernel_precision
+      ,groups
+      ,kernel_prepacked);
+}
+
+WORD32 xa_nn_conv2d_std_prepack_kernel(
+    VOID *p_prepacked,
+    const VOID *p_kernel,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_prepacked, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_prepacked, ALIGNMENT, -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+
+  WORD32 mem_req = xa_nn_conv2d_std_prepack_getsize(input_channels, kernel_height, kernel_width, out_channels, input_precision, kernel_precision);
+  XA_NNLIB_CHK_COND((mem_req <= 0), -1);
+
+  xa_nn_conv2d_std_prepack_hdr_t *p_hdr = (xa_nn_conv2d_std_prepack_hdr_t *)p_prepacked;
+  WORD8 *p_dst = (WORD8 *)p_prepacked + XA_NN_CONV2D_STD_PREPACK_HDR_SIZE;
+  WORD32 input_channels_pad = conv2d_std_get_input_channels_pad(input_channels, input_precision, kernel_precision);
+  WORD32 data_size = mem_req - XA_NN_CONV2D_STD_PREPACK_HDR_SIZE;
+  WORD32 kernel_size = (kernel_precision == PREC_16) ? sizeof(WORD16) :
+                       (kernel_precision == PREC_F32) ? sizeof(FLOAT32) : sizeof(WORD8);
+  WORD32 row_bytes = kernel_size * input_channels;
+  WORD32 row_bytes_pad = kernel_size * input_channels_pad;
+  /* Source rows are strided the same way the non-prepacked API reads them */
+  WORD32 src_row_bytes = conv2d_std_kernel_caller_padded(input_precision) ? row_bytes_pad : row_bytes;
+  WORD32 oc, kh, kw, ii;
+
+  memset(p_dst, 0, data_size);
+
+  if(kernel_precision == PREC_SYM4S)
+  {
+    /* Two 4-bit weights per byte, lower nibble first, no padding between
+     * rows. Unpack to sign extended 8-bit weights. */
+    const UWORD8 *p_src = (const UWORD8 *)p_kernel;
+    WORD32 idx = 0;
+    for(oc = 0; oc < out_channels; oc++)
+    for(kh = 0; kh < kernel_height; kh++)
+    for(kw = 0; kw < kernel_width; kw++)
+    {
+      for(ii = 0; ii < input_channels; ii++, idx++)
+      {
+        WORD32 nibble = (idx & 1) ? (p_src[idx >> 1] >> 4) : (p_src[idx >> 1] & 0xf);
+        p_dst[ii] = (WORD8)((nibble ^ 0x8) - 0x8);
+      }
+      p_dst += row_bytes_pad;
+    }
+  }
+  else
+  {
+    const WORD8 *p_src = (const WORD8 *)p_kernel;
+    for(oc = 0; oc < out_channels; oc++)
+    for(kh = 0; kh < kernel_height; kh++)
+    for(kw = 0; kw < kernel_width; kw++)
+    {
+      memcpy(p_dst, p_src, row_bytes);
+      p_dst += row_bytes_pad;
+      p_src += src_row_bytes;
+    }
+  }
+
+  p_hdr->magic = XA_NN_CONV2D_STD_PREPACK_MAGIC;
+  p_hdr->version = XA_NN_CONV2D_STD_PREPACK_VERSION;
+  p_hdr->input_precision = input_precision;
+  p_hdr->kernel_precision = kernel_precision;
+  p_hdr->input_channels = input_channels;
+  p_hdr->input_channels_pad = input_channels_pad;
+  p_hdr->kernel_height = kernel_height;
+  p_hdr->kernel_width = kernel_width;
+  p_hdr->out_channels = out_channels;
+  p_hdr->data_size = data_size;
+
+  return 0;
+}
+
+/* Validates the header against the call parameters and returns the padded
+ * kernel, NULL if the buffer was not prepacked for this layer */
+const VOID* xa_nn_conv2d_std_prepacked_get_kernel(
+    const VOID *p_prepacked,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision)
+{
+  const xa_nn_conv2d_std_prepack_hdr_t *p_hdr = (const xa_nn_conv2d_std_prepack_hdr_t *)p_prepacked;
+
+  if(p_prepacked == NULL || ((UWORD32)p_prepacked & (ALIGNMENT - 1)))
+    return NULL;
+  if(p_hdr->magic != XA_NN_CONV2D_STD_PREPACK_MAGIC ||
+     p_hdr->version != XA_NN_CONV2D_STD_PREPACK_VERSION)
+    return NULL;
+  if(p_hdr->input_precision != input_precision ||
+     p_hdr->kernel_precision != kernel_precision ||
+     p_hdr->input_channels != input_channels ||
+     p_hdr->out_channels != out_channels)
+    return NULL;
+  /* 1D convolutions are run with height and width swapped */
+  if(!((p_hdr->kernel_height == kernel_height && p_hdr->kernel_width == kernel_width) ||
+       (p_hdr->kernel_height == kernel_width && p_hdr->kernel_width == kernel_height && (kernel_height == 1 || kernel_width == 1))))
+    return NULL;
+  if(p_hdr->input_channels_pad != conv2d_std_get_input_channels_pad(input_channels, input_precision, kernel_precision))
+    return NULL;
+
+  return (const VOID *)((const WORD8 *)p_prepacked + XA_NN_CONV2D_STD_PREPACK_HDR_SIZE);
+}
+
+WORD32 xa_nn_conv2d_group_prepack_kernel(
+    VOID *p_prepacked,
+    const VOID *p_kernel,
+    WORD32 input_channels,
+    WORD32 kernel_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision,
+    WORD32 out_data_format,
+    WORD32 bias_present)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_prepacked, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_prepacked, ALIGNMENT, -1);
+
+  WORD32 mem_req = xa_nn_conv2d_group_prepack_getsize(input_channels, kernel_channels, kernel_height, kernel_width, out_channels, input_precision, kernel_precision, out_data_format, bias_present);
+  XA_NNLIB_ARG_CHK_COND((mem_req <= 0), -1);
+
+  xa_nn_conv2d_group_prepack_hdr_t *p_hdr = (xa_nn_conv2d_group_prepack_hdr_t *)p_prepacked;
+  WORD8 *p_dst = (WORD8 *)p_prepacked + XA_NN_CONV2D_GROUP_PREPACK_HDR_SIZE;
+  const WORD8 *p_src = (const WORD8 *)p_kernel;
+  WORD32 layout = conv2d_group_get_layout(input_channels, kernel_channels, out_channels, out_data_format, bias_present);
+  WORD32 data_size = mem_req - XA_NN_CONV2D_GROUP_PREPACK_HDR_SIZE;
+  WORD32 kernel_channels_pad;
+  WORD32 oc, kh, kw;
+
+  memset(p_dst, 0, data_size);
+
+  if(layout == XA_NN_CONV2D_GROUP_LAYOUT_DEPTHWISE)
+  {
+    /* [out_channels][kernel_height][kernel_width] to [kernel_height][kernel_width][out_channels] */
+    kernel_channels_pad = 1;
+    for(oc = 0; oc < out_channels; oc++)
+    for(kh = 0; kh < kernel_height; kh++)
+    for(kw = 0; kw < kernel_width; kw++)
+    {
+      p_dst[(kh * kernel_width + kw) * out_channels + oc] = *p_src++;
+    }
+  }
+  else
+  {
+    /* Output channels are already group major, only the kernel channels are padded */
+    kernel_channels_pad = conv2d_std_get_input_channels_pad(kernel_channels, input_precision, kernel_precision);
+    for(oc = 0; oc < out_channels; oc++)
+    for(kh = 0; kh < kernel_height; kh++)
+    for(kw = 0; kw < kernel_width; kw++)
+    {
+      memcpy(p_dst, p_src, kernel_channels);
+      p_dst += kernel_channels_pad;
+      p_src += kernel_channels;
+    }
+  }
+
+  p_hdr->magic = XA_NN_CONV2D_GROUP_PREPACK_MAGIC;
+  p_hdr->version = XA_NN_CONV2D_GROUP_PREPACK_VERSION;
+  p_hdr->input_precision = input_precision;
+  p_hdr->kernel_precision = kernel_precision;
+  p_hdr->input_channels = input_channels;
+  p_hdr->kernel_channels = kernel_channels;
+  p_hdr->kernel_channels_pad = kernel_channels_pad;
+  p_hdr->kernel_height = kernel_height;
+  p_hdr->kernel_width = kernel_width;
+  p_hdr->out_channels = out_channels;
+  p_hdr->layout = layout;
+  p_hdr->data_size = data_size;
+
+  return 0;
+}
+
+/* Validates the header against the call parameters and returns the
+ * pre-arranged kernel and its layout, NULL if the buffer was not prepacked
+ * for this layer */
+const VOID* xa_nn_conv2d_group_prepacked_get_kernel(
+    const VOID *p_prepacked,
+    WORD32 input_channels,
+    WORD32 kernel_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision,
+    WORD32 out_data_format,
+    WORD32 bias_present,
+    WORD32 *p_layout)
+{
+  const xa_nn_conv2d_group_prepack_hdr_t *p_hdr = (const xa_nn_conv2d_group_prepack_hdr_t *)p_prepacked;
+
+  if(p_prepacked == NULL || ((UWORD32)p_prepacked & (ALIGNMENT - 1)))
+    return NULL;
+  if(p_hdr->magic != XA_NN_CONV2D_GROUP_PREPACK_MAGIC ||
+     p_hdr->version != XA_NN_CONV2D_GROUP_PREPACK_VERSION)
+    return NULL;
+  if(p_hdr->input_precision != input_precision ||
+     p_hdr->kernel_precision != kernel_precision ||
+     p_hdr->input_channels != input_channels ||
+     p_hdr->kernel_channels != kernel_channels ||
+     p_hdr->out_channels != out_channels)
+    return NULL;
+  /* 1D convolutions are run with height and width swapped */
+  if(!((p_hdr->kernel_height == kernel_height && p_hdr->kernel_width == kernel_width) ||
+       (p_hdr->kernel_height == kernel_width && p_hdr->kernel_width == kernel_height && (kernel_height == 1 || kernel_width == 1))))
+    return NULL;
+  /* The layout was chosen for the out_data_format and bias given at prepack time */
+  if(p_hdr->layout != conv2d_group_get_layout(input_channels, kernel_channels, out_channels, out_data_format, bias_present))
+    return NULL;
+  if(p_hdr->layout == XA_NN_CONV2D_GROUP_LAYOUT_BLOCKED &&
+     p_hdr->kernel_channels_pad != conv2d_std_get_input_channels_pad(kernel_channels, input_precision, kernel_precision))
+    return NULL;
+
+  *p_layout = p_hdr->layout;
+  return (const VOID *)((const WORD8 *)p_prepacked + XA_NN_CONV2D_GROUP_PREPACK_HDR_SIZE);
+}
+
 VOID xa_nn_conv2d_group_init_state(
     VOID *p_scratch,
     VOID *p_kernel,
@@ -1566,6 +2140,249 @@ VOID conv2d_group_update_cir_buf(
 
 }
 
+// Group-blocked circular buffer: group g keeps its kernel_channels_pad wide
+// planes in its own circular buffer at g * grp_stride from the group 0 one.
+// All buffers advance together, so one pass over the input fills all groups.
+static inline void conv2d_group_blocked_copy_plane(
+    WORD8 *p_dst,
+    const WORD8 *p_inp,
+    WORD32 kernel_channels,
+    WORD32 kernel_channels_pad,
+    WORD32 groups,
+    WORD32 grp_stride,
+    WORD32 input_bytewidth,
+    UWORD8 pad_val)
+{
+  WORD32 g;
+  const int size1 = kernel_channels * input_bytewidth;
+  const int size2 = (kernel_channels_pad - kernel_channels) * input_bytewidth;
+  for(g = 0; g < groups; g++)
+  {
+    memcpy(p_dst, p_inp, size1);
+    memset(&p_dst[size1], pad_val, size2);
+    p_dst += grp_stride;
+    p_inp += size1;
+  }
+}
+
+static inline void conv2d_group_blocked_pad_plane(
+    WORD8 *p_dst,
+    WORD32 kernel_channels_pad,
+    WORD32 groups,
+    WORD32 grp_stride,
+    WORD32 input_bytewidth,
+    UWORD8 pad_val)
+{
+  WORD32 g;
+  for(g = 0; g < groups; g++)
+  {
+    memset(p_dst, pad_val, kernel_channels_pad * input_bytewidth);
+    p_dst += grp_stride;
+  }
+}
+
+VOID conv2d_group_blocked_init_cir_buf(
+    WORD32 input_channels,
+    WORD32 kernel_channels_pad,
+    WORD32 kernel_channels,
+    WORD32 groups,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val)
+{
+  WORD32 i,k;
+  WORD8 *p_inp = (WORD8 *)*pp_inp;
+  WORD32 planes_to_add = x_stride > kernel_width ? 0 : kernel_width - x_stride;
+  WORD32 planes_to_keep = kernel_width - planes_to_add;
+  WORD32 plane_size = kernel_channels_pad * input_bytewidth;
+  WORD32 grp_stride = (WORD8 *)p_state->cir_buf.p_end - (WORD8 *)p_state->cir_buf.p_begin;
+  WORD8 *p_dst = (WORD8 *)p_state->cir_buf.p_curr;
+  UWORD8 pad_val_u8 = (UWORD8)pad_val;
+
+  AE_SETCBEGIN0(p_state->cir_buf.p_begin);
+  AE_SETCEND0(p_state->cir_buf.p_end);
+  AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_size);
+
+  // Initialize circular buffer
+  // Set first 'y_padding' rows of cir_buf to zero
+  for(i=0;i<y_padding;i++)
+  {
+    for(k=0;k<planes_to_add;k++)
+    {
+      conv2d_group_blocked_pad_plane(p_dst, kernel_channels_pad, groups, grp_stride, input_bytewidth, pad_val_u8);
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_size);
+    }
+    AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_size);
+  }
+
+  // Set next 'input_height' rows of cir_buf with zero and/or input data
+  WORD32 copy_x_pad_width = x_padding;
+  WORD32 copy_inp_width = 0;
+  WORD32 rem_copy_width = 0;
+  if(planes_to_add <= x_padding)
+  {
+    copy_x_pad_width = planes_to_add;
+  }
+  else
+  {
+    copy_inp_width = planes_to_add - x_padding;
+    rem_copy_width = XT_MAX(0, copy_inp_width - input_width);
+    copy_inp_width = XT_MIN(copy_inp_width, input_width);
+  }
+  for(i=0;i<input_height;i++)
+  {
+    for(k=0;k<copy_x_pad_width;k++)
+    {
+      conv2d_group_blocked_pad_plane(p_dst, kernel_channels_pad, groups, grp_stride, input_bytewidth, pad_val_u8);
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_size);
+    }
+    for(k=0;k<copy_inp_width;k++)
+    {
+      conv2d_group_blocked_copy_plane(p_dst, p_inp, kernel_channels, kernel_channels_pad, groups, grp_stride, input_bytewidth, pad_val_u8);
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_size);
+      p_inp += input_channels * input_bytewidth;
+    }
+    for(k=0;k<rem_copy_width;k++)
+    {
+      conv2d_group_blocked_pad_plane(p_dst, kernel_channels_pad, groups, grp_stride, input_bytewidth, pad_val_u8);
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_size);
+    }
+    AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_size);
+    p_inp += (input_width - copy_inp_width) * input_channels * input_bytewidth;
+  }
+
+  // Set last 'y_b_pad' rows of cir_buf to zero
+  for(i=0;i<y_b_pad;i++)
+  {
+    for(k=0;k<planes_to_add;k++)
+    {
+      conv2d_group_blocked_pad_plane(p_dst, kernel_channels_pad, groups, grp_stride, input_bytewidth, pad_val_u8);
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_size);
+    }
+    AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_size);
+  }
+  p_inp += (-input_height * input_width + copy_inp_width) * input_channels * input_bytewidth;
+  *pp_inp = (VOID *)p_inp;
+}
+
+// Add x_stride (but not more than kernel_width) x (input_height x input_channels) new planes to the group circular buffers
+VOID conv2d_group_blocked_update_cir_buf(
+    WORD32 input_channels,
+    WORD32 kernel_channels_pad,
+    WORD32 kernel_channels,
+    WORD32 groups,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    WORD32 idx_beg_inp_width_pad,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val)
+{
+  WORD32 i,k;
+  WORD8 *p_inp = (WORD8 *)*pp_inp;
+  UWORD8 pad_val_u8 = (UWORD8)pad_val;
+  WORD32 planes_to_add = x_stride > kernel_width ? kernel_width : x_stride;
+  WORD32 planes_to_keep = kernel_width - planes_to_add;
+  WORD32 plane_size = kernel_channels_pad * input_bytewidth;
+  WORD32 grp_stride = (WORD8 *)p_state->cir_buf.p_end - (WORD8 *)p_state->cir_buf.p_begin;
+
+  // Group loop of the previous column leaves the last group buffer selected
+  AE_SETCBEGIN0(p_state->cir_buf.p_begin);
+  AE_SETCEND0(p_state->cir_buf.p_end);
+
+  // Copy 'planes_to_add' planes of data to circular buffer
+  AE_ADDCIRC16X4_XC((ae_int16x4 *)p_state->cir_buf.p_curr, planes_to_add * plane_size);
+  WORD8 *p_dst = (WORD8 *)p_state->cir_buf.p_curr;
+  AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_size);
+
+  // Set first 'y_padding' rows of cir_buf to zero
+  for(i=0;i<y_padding;i++)
+  {
+    for(k=0;k<planes_to_add;k++)
+    {
+      conv2d_group_blocked_pad_plane(p_dst, kernel_channels_pad, groups, grp_stride, input_bytewidth, pad_val_u8);
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_size);
+    }
+    AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_size);
+  }
+
+  // Set next 'input_height' rows of cir_buf with zero (from x_padding) and/or input data and/or zero (from x-right padding)
+  WORD32 idx_end_inp_width_pad = idx_beg_inp_width_pad + planes_to_add;
+  WORD32 copy_x_pad_width = 0;
+  WORD32 copy_inp_width = 0;
+  WORD32 to_skip_inp_width = x_stride - planes_to_add;     // Non-zero for x_stride > kernel_width
+  WORD32 copy_x_r_pad_width = 0;
+  if(idx_beg_inp_width_pad < x_padding)
+  {
+    copy_x_pad_width = x_padding - idx_beg_inp_width_pad;
+    copy_inp_width = idx_end_inp_width_pad - x_padding;
+    copy_x_r_pad_width = XT_MAX(0, copy_inp_width - input_width);
+    copy_inp_width = XT_MIN(copy_inp_width, input_width);
+  }
+  else if(idx_end_inp_width_pad <= x_padding + input_width)
+  {
+    copy_inp_width = planes_to_add;
+  }
+  else if(idx_beg_inp_width_pad < x_padding + input_width)
+  {
+    copy_inp_width = x_padding + input_width - idx_beg_inp_width_pad;
+    copy_x_r_pad_width = idx_end_inp_width_pad - (x_padding + input_width);
+  }
+  else
+  {
+    copy_x_r_pad_width = planes_to_add;
+  }
+
+  for(i=0;i<input_height;i++)
+  {
+    for(k=0;k<copy_x_pad_width;k++)
+    {
+      conv2d_group_blocked_pad_plane(p_dst, kernel_channels_pad, groups, grp_stride, input_bytewidth, pad_val_u8);
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_size);
+    }
+    for(k=0;k<copy_inp_width;k++)
+    {
+      conv2d_group_blocked_copy_plane(p_dst, p_inp, kernel_channels, kernel_channels_pad, groups, grp_stride, input_bytewidth, pad_val_u8);
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_size);
+      p_inp += input_channels * input_bytewidth;
+    }
+    for(k=0;k<copy_x_r_pad_width;k++)
+    {
+      conv2d_group_blocked_pad_plane(p_dst, kernel_channels_pad, groups, grp_stride, input_bytewidth, pad_val_u8);
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_size);
+    }
+    AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_size);
+    p_inp += (input_width - copy_inp_width) * input_channels * input_bytewidth;
+  }
+  p_inp += (-input_height * input_width + copy_inp_width + to_skip_inp_width) * input_channels * input_bytewidth;
+
+  // Set last 'y_b_pad' rows of cir_buf to zero
+  for(i=0;i<y_b_pad;i++)
+  {
+    for(k=0;k<planes_to_add;k++)
+    {
+      conv2d_group_blocked_pad_plane(p_dst, kernel_channels_pad, groups, grp_stride, input_bytewidth, pad_val_u8);
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_size);
+    }
+    AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_size);
+  }
+  *pp_inp = (VOID *)p_inp;
+}
+
 VOID xa_nn_dilated_conv2d_std_load_cir_buf_asym8(
     WORD32 input_channels,
     WORD32 input_channels_pad,
@@ -0,0 +1,321 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include <string.h>
+#include "xa_nnlib_common_fpu.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros.h"
+#include "xa_nn_conv2d_std_state.h"
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_std_f16,(
+    WORD16 *p_out,
+    const WORD16 *p_inp,
+    const WORD16 *p_kernel,
+    const WORD16 *p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch))
+#else /* #if !HAVE_VFPU */
+
+/* Widens count f16 values to f32 and zeroes the pad_count values after them */
+static void conv2d_std_f16_widen(
+    FLOAT32 *p_dst,
+    const WORD16 *p_src,
+    WORD32 count,
+    WORD32 pad_count)
+{
+  int i;
+  for(i = 0; i < count; i++)
+  {
+    p_dst[i] = xa_nn_f16_to_f32(p_src[i]);
+  }
+  for(i = 0; i < pad_count; i++)
+  {
+    p_dst[count + i] = 0.0f;
+  }
+}
+
+/* Sets out_cols output columns starting at out_col_beg to the bias, for the
+ * columns where the kernel covers x padding only */
+static void conv2d_std_f16_bias_cols(
+    WORD16 *p_out,
+    const FLOAT32 *p_bias_f32,
+    WORD32 out_col_beg,
+    WORD32 out_cols,
+    WORD32 out_height,
+    WORD32 out_channels,
+    WORD32 out_channels_offset,
+    WORD32 out_width_offset,
+    WORD32 out_height_offset)
+{
+  int i, j, k;
+  for(i = 0; i < out_height; i++)
+  {
+    for(j = out_col_beg; j < out_col_beg + out_cols; j++)
+    {
+      for(k = 0; k < out_channels; k++)
+      {
+        p_out[i*out_height_offset + j*out_width_offset + k*out_channels_offset] = xa_nn_f32_to_f16(p_bias_f32[k]);
+      }
+    }
+  }
+}
+
+/* Writes planes_to_add planes of every row of the f32 circular buffer,
+ * padded input columns idx_beg_inp_width_pad onwards, widening the f16 input
+ * as it is copied. Same layout as conv2d_std_update_cir_buf for f32. */
+static void conv2d_std_f16_add_cir_buf_planes(
+    const WORD16 *p_inp,
+    WORD32 input_channels,
+    WORD32 input_channels_pad,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 idx_beg_inp_width_pad,
+    WORD32 planes_to_add,
+    xa_nn_conv_state_t *p_state)
+{
+  WORD32 i, k;
+  WORD32 planes_to_keep = kernel_width - planes_to_add;
+  WORD32 plane_bytes = input_channels_pad * sizeof(FLOAT32);
+  WORD8 *p_dst = (WORD8 *)p_state->cir_buf.p_curr;
+  AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_bytes);
+
+  for(i = 0; i < y_padding + input_height + y_b_pad; i++)
+  {
+    WORD32 inp_h = i - y_padding;
+    for(k = 0; k < planes_to_add; k++)
+    {
+      WORD32 inp_w = idx_beg_inp_width_pad + k - x_padding;
+      if(inp_h >= 0 && inp_h < input_height && inp_w >= 0 && inp_w < input_width)
+      {
+        conv2d_std_f16_widen((FLOAT32 *)p_dst, &p_inp[(inp_h * input_width + inp_w) * input_channels],
+            input_channels, input_channels_pad - input_channels);
+      }
+      else
+      {
+        memset(p_dst, 0, plane_bytes);
+      }
+      AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, plane_bytes);
+    }
+    AE_ADDCIRC16X4_XC((ae_int16x4 *)p_dst, planes_to_keep * plane_bytes);
+  }
+}
+
+/* f16 is a storage format on HiFi4, the layer runs on the f32 circular
+ * buffer matXvec. The input is widened as its columns enter the circular
+ * buffer and the kernel stays in f16: per output column, blocks of
+ * CONV2D_STD_F16_VEC_BLOCK kernel rows are widened and multiplied into an
+ * f32 output column, which is narrowed with one rounding per value.
+ * Scratch layout, each part ALIGNMENT aligned: f32 bias, f32 kernel block
+ * (rows padded to the f32 kernel's 2 channels), f32 output column,
+ * xa_nn_conv2d_std_f32 scratch */
+WORD32 xa_nn_conv2d_std_f16(
+    WORD16 *p_out,
+    const WORD16 *p_inp,
+    const WORD16 *p_kernel,
+    const WORD16 *p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_kernel, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height <= 0 || kernel_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_height > input_height), -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_width > input_width), -1);
+  XA_NNLIB_ARG_CHK_COND((out_channels <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_stride <= 0 || x_stride <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((y_padding < 0 || x_padding < 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+
+  /* Kernel rows are padded to 4 channels as for the other 16-bit kernels */
+  WORD32 input_channels_pad = PADDED_SIZE(input_channels, (ALIGNMENT>>1));
+  WORD32 input_channels_pad_f32 = PADDED_SIZE(input_channels, (ALIGNMENT>>2));
+  WORD32 kernel_taps = kernel_height * kernel_width;
+  WORD32 vec_len = kernel_taps * input_channels_pad_f32;
+  WORD32 i, j, oc, oc_blk, tap;
+
+  WORD8 *p_mem = (WORD8 *)ALIGNED_ADDR(p_scratch, ALIGNMENT);
+  FLOAT32 *p_bias_f32 = (FLOAT32 *)p_mem;
+  p_mem += ALIGNED_SIZE(out_channels * sizeof(FLOAT32), ALIGNMENT);
+  FLOAT32 *p_kernel_blk = (FLOAT32 *)ALIGNED_ADDR(p_mem, ALIGNMENT);
+  p_mem = (WORD8 *)p_kernel_blk + ALIGNED_SIZE(CONV2D_STD_F16_VEC_BLOCK * vec_len * sizeof(FLOAT32), ALIGNMENT);
+  FLOAT32 *p_out_col = (FLOAT32 *)ALIGNED_ADDR(p_mem, ALIGNMENT);
+  p_mem = (WORD8 *)p_out_col + ALIGNED_SIZE(out_height * out_channels * sizeof(FLOAT32), ALIGNMENT);
+
+  if(p_bias != NULL)
+  {
+    conv2d_std_f16_widen(p_bias_f32, p_bias, out_channels, 0);
+  }
+  else
+  {
+    memset(p_bias_f32, 0, out_channels * sizeof(FLOAT32));
+  }
+
+  xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)ALIGNED_ADDR(p_mem, ALIGNMENT);
+  xa_nn_conv2d_std_init_state((void*)p_state
+      ,(void*)p_kernel_blk
+      ,input_height
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,y_stride
+      ,y_padding
+      ,out_height
+      ,out_channels
+      ,PREC_F32
+      ,PREC_F32);
+
+  WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1;
+  WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels;
+  WORD32 out_width_offset = out_data_format ? 1 : out_channels;
+
+  WORD32 x_padding_var = x_padding;
+
+  /* When kernel convolves over x-left pad region only */
+  WORD32 out_width_over_x_pad = 0;
+  if(x_padding_var >= kernel_width)
+  {
+    out_width_over_x_pad = (x_padding - kernel_width)/x_stride + 1;
+    out_width_over_x_pad = out_width_over_x_pad > out_width ? out_width : out_width_over_x_pad;
+    conv2d_std_f16_bias_cols(p_out, p_bias_f32, 0, out_width_over_x_pad, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset);
+    x_padding_var -= out_width_over_x_pad * x_stride;
+  }
+
+  /* When kernel convolves over x-right pad region only */
+  WORD32 out_width_over_x_r_pad = 0;
+  // Determine x-right padding
+  WORD32 x_r_pad = kernel_width + (out_width - 1) * x_stride - (x_padding + input_width);
+  x_r_pad = x_r_pad < 0 ? 0 : x_r_pad;
+  if(x_r_pad >= kernel_width)
+  {
+    WORD32 idx_out_width_over_x_r_pad = (x_padding + input_width + x_stride - 1)/x_stride + 1;
+    out_width_over_x_r_pad = out_width - idx_out_width_over_x_r_pad;
+    conv2d_std_f16_bias_cols(p_out, p_bias_f32, idx_out_width_over_x_r_pad, out_width_over_x_r_pad, out_height, out_channels, out_channels_offset, out_width_offset, out_height_offset);
+  }
+
+  /* When kernel convolves over input region */
+  p_out += out_width_over_x_pad * out_width_offset;
+
+  // Initialize circular buffer
+  // Determine y-bottom padding
+  WORD32 y_b_pad = kernel_height + (out_height - 1) * y_stride - (y_padding + input_height);
+  y_b_pad = y_b_pad < 0 ? 0 : y_b_pad;
+
+  conv2d_std_f16_add_cir_buf_planes(p_inp, input_channels, input_channels_pad_f32, input_width, input_height,
+      y_padding, y_b_pad, x_padding_var, kernel_width, 0,
+      x_stride > kernel_width ? 0 : kernel_width - x_stride, p_state);
+
+  // Index to padded input width
+  WORD32 idx_beg_inp_width_pad = kernel_width - x_stride;
+  idx_beg_inp_width_pad = idx_beg_inp_width_pad < 0 ? 0 : idx_beg_inp_width_pad;
+  WORD32 planes_to_add = x_stride > kernel_width ? kernel_width : x_stride;
+
+  // Process Loop to compute one output plane [out_height x out_channels] per iteration
+  for(j = 0; j < out_width - out_width_over_x_pad - out_width_over_x_r_pad; j++)
+  {
+    // Add x_stride x (input_height x input_channels) new planes to circular buffer
+    AE_ADDCIRC16X4_XC((ae_int16x4 *)p_state->cir_buf.p_curr, planes_to_add * input_channels_pad_f32 * sizeof(FLOAT32));
+    conv2d_std_f16_add_cir_buf_planes(p_inp, input_channels, input_channels_pad_f32, input_width, input_height,
+        y_padding, y_b_pad, x_padding_var, kernel_width, idx_beg_inp_width_pad, planes_to_add, p_state);
+    // Update index to input width padded
+    idx_beg_inp_width_pad += x_stride;
+
+    for(oc = 0; oc < out_channels; oc += CONV2D_STD_F16_VEC_BLOCK)
+    {
+      oc_blk = XT_MIN(CONV2D_STD_F16_VEC_BLOCK, out_channels - oc);
+      for(i = 0; i < oc_blk; i++)
+      {
+        for(tap = 0; tap < kernel_taps; tap++)
+        {
+          conv2d_std_f16_widen(&p_kernel_blk[i * vec_len + tap * input_channels_pad_f32],
+              &p_kernel[((oc + i) * kernel_taps + tap) * input_channels_pad],
+              input_channels, input_channels_pad_f32 - input_channels);
+        }
+      }
+      // Convolution using matXvec with matrix as circular buffer
+      xa_nn_matXvec_f32_circ
+        (&p_out_col[oc] /* output */
+         ,p_state->cir_buf.p_curr/* matrix: rows x cols */
+         ,p_kernel_blk /* vec: cols */
+         ,&p_bias_f32[oc] /* bias */
+         ,out_height /* rows */
+         ,vec_len /* cols */
+         ,input_channels_pad_f32 * kernel_width * y_stride/* row_offset */
+         ,oc_blk /* vec_count */
+         ,vec_len /* vec_offset */
+         ,1 /* out_col_offset */
+         ,out_channels /* out_row_offset */
+        );
+    }
+
+    for(i = 0; i < out_height; i++)
+    {
+      for(oc = 0; oc < out_channels; oc++)
+      {
+        p_out[i * out_height_offset + oc * out_channels_offset] = xa_nn_f32_to_f16(p_out_col[i * out_channels + oc]);
+      }
+    }
+    p_out += out_width_offset;
+  }
+
+  return 0;
+}
+#endif /* #if !HAVE_VFPU */
@@ -45,6 +45,25 @@ DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_std_f32,(
     WORD32 out_width,
     WORD32 out_data_format,
     VOID *p_handle))
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_conv2d_std_prepacked_f32,(
+    FLOAT32 *p_out,
+    const FLOAT32 *p_inp,
+    const VOID *p_kernel_prepacked,
+    const FLOAT32 *p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_handle))
 #else /* #if !HAVE_VFPU */
 
 static WORD32 conv_x_left_pad(
@@ -137,7 +156,7 @@ static WORD32 conv_x_right_pad(
   return out_width_over_x_r_pad;
 }
 
-WORD32 xa_nn_conv2d_std_f32(
+static WORD32 conv2d_std_f32_impl(
     FLOAT32* __restrict__ p_out,
     const FLOAT32* __restrict__ p_inp,
     const FLOAT32* __restrict__ p_kernel,
@@ -155,7 +174,8 @@ WORD32 xa_nn_conv2d_std_f32(
     WORD32 out_height,
     WORD32 out_width,
     WORD32 out_data_format,
-    VOID *p_scratch)
+    VOID *p_scratch,
+    WORD32 kernel_prepacked)
 {
   /* NULL pointer checks */
   XA_NNLIB_ARG_CHK_PTR(p_out, -1);
@@ -186,18 +206,36 @@ WORD32 xa_nn_conv2d_std_f32(
 
   p_scratch = ALIGNED_ADDR(p_scratch, ALIGNMENT);
   xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
-  xa_nn_conv2d_std_init_state((void*)p_state
-      ,(void*)p_kernel
-      ,input_height
-      ,input_channels
-      ,kernel_height
-      ,kernel_width
-      ,y_stride
-      ,y_padding
-      ,out_height
-      ,out_channels
-      ,PREC_F32
-      ,PREC_F32);
+  if(kernel_prepacked)
+  {
+    xa_nn_conv2d_std_prepacked_init_state((void*)p_state
+        ,(void*)p_kernel
+        ,input_height
+        ,input_channels
+        ,kernel_height
+        ,kernel_width
+        ,y_stride
+        ,y_padding
+        ,out_height
+        ,out_channels
+        ,PREC_F32
+        ,PREC_F32);
+  }
+  else
+  {
+    xa_nn_conv2d_std_init_state((void*)p_state
+        ,(void*)p_kernel
+        ,input_height
+        ,input_channels
+        ,kernel_height
+        ,kernel_width
+        ,y_stride
+        ,y_padding
+        ,out_height
+        ,out_channels
+        ,PREC_F32
+        ,PREC_F32);
+  }
 
   WORD32 out_channels_offset = out_data_format ? out_height * out_width : 1;
   WORD32 out_height_offset = out_data_format ? out_width : out_width * out_channels;
@@ -269,5 +307,98 @@ WORD32 xa_nn_conv2d_std_f32(
 
   return 0;
 }
+
+WORD32 xa_nn_conv2d_std_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const FLOAT32* __restrict__ p_kernel,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return conv2d_std_f32_impl(p_out
+      ,p_inp
+      ,p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,out_data_format
+      ,p_scratch
+      ,0);
+}
+
+WORD32 xa_nn_conv2d_std_prepacked_f32(
+    FLOAT32* __restrict__ p_out,
+    const FLOAT32* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_prepacked,
+    const FLOAT32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_kernel_prepacked, -1);
+
+  const VOID *p_kernel = xa_nn_conv2d_std_prepacked_get_kernel(p_kernel_prepacked
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,PREC_F32
+      ,PREC_F32);
+  XA_NNLIB_CHK_PTR(p_kernel, -1);
+
+  return conv2d_std_f32_impl(p_out
+      ,p_inp
+      ,(const FLOAT32*)p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,out_data_format
+      ,p_scratch
+      ,1);
+}
 #endif /* #if !HAVE_VFPU */
 
@@ -36,6 +36,10 @@
 #define BUS_WIDTH (8)
 #define BUS_WIDTH_MASK (0xf)
 
+/* Output channels whose f16 kernel rows are widened per matXvec call in
+ * xa_nn_conv2d_std_f16 */
+#define CONV2D_STD_F16_VEC_BLOCK (8)
+
 typedef enum xa_nn_conv_datafmt_t{
   HWC=0
 } xa_nn_conv_datafmt_t;
@@ -53,6 +57,97 @@ typedef struct _xa_nn_conv_state_t{
   VOID* p_inp_base;
 } xa_nn_conv_state_t;
 
+/* Persistent pre-packed kernel for conv2d_std, filled once by
+ * xa_nn_conv2d_std_prepack_kernel. The header is followed (at
+ * XA_NN_CONV2D_STD_PREPACK_HDR_SIZE) by the kernel in the layout used by
+ * the circular buffer matXvec: [out_channels][kernel_height][kernel_width]
+ * [input_channels_pad], zero padded along the input channels. */
+#define XA_NN_CONV2D_STD_PREPACK_MAGIC   (0x58504B43) /* 'CKPX' */
+#define XA_NN_CONV2D_STD_PREPACK_VERSION (1)
+
+typedef struct _xa_nn_conv2d_std_prepack_hdr_t{
+  UWORD32 magic;
+  UWORD32 version;
+  WORD32 input_precision;
+  WORD32 kernel_precision;
+  WORD32 input_channels;
+  WORD32 input_channels_pad;
+  WORD32 kernel_height;
+  WORD32 kernel_width;
+  WORD32 out_channels;
+  WORD32 data_size;
+} xa_nn_conv2d_std_prepack_hdr_t;
+
+#define XA_NN_CONV2D_STD_PREPACK_HDR_SIZE \
+  PADDED_SIZE(sizeof(xa_nn_conv2d_std_prepack_hdr_t), ALIGNMENT)
+
+/* Persistent pre-packed kernel for grouped conv2d, filled once by
+ * xa_nn_conv2d_group_prepack_kernel. Layers run as depthwise (one input
+ * channel per group, out_channels >= input_channels, NHWC output and a bias,
+ * see conv2d_group_get_layout) are stored in the depthwise layout [kernel_height][kernel_width][out_channels]. All other group counts
+ * are stored group-blocked as [groups][kernels_per_group][kernel_height]
+ * [kernel_width][kernel_channels_pad], so that the kernels of one group are
+ * contiguous vectors for the circular buffer matXvec. */
+#define XA_NN_CONV2D_GROUP_PREPACK_MAGIC   (0x58504B47) /* 'GKPX' */
+#define XA_NN_CONV2D_GROUP_PREPACK_VERSION (1)
+
+typedef enum xa_nn_conv2d_group_layout_t{
+  XA_NN_CONV2D_GROUP_LAYOUT_BLOCKED = 0,
+  XA_NN_CONV2D_GROUP_LAYOUT_DEPTHWISE = 1
+} xa_nn_conv2d_group_layout_t;
+
+typedef struct _xa_nn_conv2d_group_prepack_hdr_t{
+  UWORD32 magic;
+  UWORD32 version;
+  WORD32 input_precision;
+  WORD32 kernel_precision;
+  WORD32 input_channels;
+  WORD32 kernel_channels;
+  WORD32 kernel_channels_pad;
+  WORD32 kernel_height;
+  WORD32 kernel_width;
+  WORD32 out_channels;
+  WORD32 layout;
+  WORD32 data_size;
+} xa_nn_conv2d_group_prepack_hdr_t;
+
+#define XA_NN_CONV2D_GROUP_PREPACK_HDR_SIZE \
+  PADDED_SIZE(sizeof(xa_nn_conv2d_group_prepack_hdr_t), ALIGNMENT)
+
+WORD32 conv2d_std_get_input_channels_pad(
+    WORD32 input_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision);
+
+WORD32 conv2d_group_get_layout(
+    WORD32 input_channels,
+    WORD32 kernel_channels,
+    WORD32 out_channels,
+    WORD32 out_data_format,
+    WORD32 bias_present);
+
+const VOID* xa_nn_conv2d_std_prepacked_get_kernel(
+    const VOID *p_prepacked,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision);
+
+const VOID* xa_nn_conv2d_group_prepacked_get_kernel(
+    const VOID *p_prepacked,
+    WORD32 input_channels,
+    WORD32 kernel_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision,
+    WORD32 out_data_format,
+    WORD32 bias_present,
+    WORD32 *p_layout);
+
 VOID xa_nn_conv2d_dilation_init_state(
     VOID *p_scratch,
     VOID *p_kernel,
@@ -72,6 +167,20 @@ VOID xa_nn_conv2d_std_init_state(
     WORD32 input_precision,
     WORD32 kernel_precision);
 
+VOID xa_nn_conv2d_std_prepacked_init_state(
+    VOID *p_handle,
+    VOID *p_kernel_prepacked,
+    WORD32 input_height,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_channels,
+    WORD32 input_precision,
+    WORD32 kernel_precision);
+
 VOID xa_nn_conv2d_group_init_state(
     VOID *p_scratch,
     VOID *p_kernel,
@@ -86,6 +195,22 @@ VOID xa_nn_conv2d_group_init_state(
     WORD32 input_precision,
     WORD32 kernel_precision);    
 
+VOID xa_nn_conv2d_group_blocked_init_state(
+    VOID *p_scratch,
+    VOID *p_kernel,
+    WORD32 input_height,
+    WORD32 kernel_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 y_stride,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 output_channels,
+    WORD32 groups,
+    WORD32 input_precision,
+    WORD32 kernel_precision,
+    WORD32 kernel_prepacked);
+
 VOID xa_nn_dilated_conv2d_std_init_circ_buf(
     VOID *p_handle,
     VOID *p_kernel,
@@ -240,6 +365,23 @@ VOID conv2d_group_init_cir_buf(
     xa_nn_conv_state_t *p_state,
     WORD32 pad_val);
 
+VOID conv2d_group_blocked_init_cir_buf(
+    WORD32 input_channels,
+    WORD32 kernel_channels_pad,
+    WORD32 kernel_channels,
+    WORD32 groups,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val);
+
 VOID conv2d_std_update_cir_buf_slow(
     WORD32 input_channels,
     WORD32 input_channels_pad,
@@ -304,6 +446,24 @@ VOID conv2d_group_update_cir_buf(
     xa_nn_conv_state_t *p_state,
     WORD32 pad_val);
 
+VOID conv2d_group_blocked_update_cir_buf(
+    WORD32 input_channels,
+    WORD32 kernel_channels_pad,
+    WORD32 kernel_channels,
+    WORD32 groups,
+    WORD32 input_bytewidth,
+    WORD32 input_width,
+    WORD32 input_height,
+    WORD32 y_padding,
+    WORD32 y_b_pad,
+    WORD32 x_padding,
+    WORD32 kernel_width,
+    WORD32 x_stride,
+    VOID **pp_inp,
+    WORD32 idx_beg_inp_width_pad,
+    xa_nn_conv_state_t *p_state,
+    WORD32 pad_val);
+
 VOID conv2d_std_init_cir_buf_asym8(
     WORD32 input_channels,
     WORD32 input_channels_pad,
@@ -557,7 +557,38 @@ WORD32 xa_nn_dilated_conv2d_std_per_chan_sym8sxasym8s(
   return 0;
 }
 
-WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
+/* Epilogue over the NHWC output columns [col, col + num_cols), each column
+ * is out_h pixels out_w * out_stride apart. Called right after a column is
+ * written, while it is still in cache. */
+static WORD32 conv2d_std_epilogue_cols(
+    WORD8 *p_out_base,
+    const WORD8 *p_residual,
+    WORD32 residual_stride,
+    WORD32 col,
+    WORD32 num_cols,
+    WORD32 out_h,
+    WORD32 out_w,
+    WORD32 out_channels,
+    WORD32 out_stride,
+    WORD32 out_zero_bias,
+    const xa_nn_epilogue_asym8s_t *p_epilogue)
+{
+  WORD32 ret = 0;
+  for(; num_cols > 0 && ret == 0; num_cols--, col++)
+  {
+    ret = xa_nn_elm_epilogue_asym8s(p_out_base + col * out_stride
+        ,out_w * out_stride
+        ,p_residual != NULL ? p_residual + col * residual_stride : NULL
+        ,out_w * residual_stride
+        ,out_zero_bias
+        ,out_h
+        ,out_channels
+        ,p_epilogue);
+  }
+  return ret;
+}
+
+static WORD32 conv2d_std_per_chan_sym8sxasym8s_impl(
     WORD8* __restrict__ p_out,
     const WORD8* __restrict__ p_inp,
     const WORD8* __restrict__ p_kernel,
@@ -579,7 +610,12 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
     WORD32 * p_out_shift,
     WORD32 out_zero_bias,
     WORD32 out_data_format,
-    VOID *p_scratch)
+    VOID *p_scratch,
+    WORD32 kernel_prepacked,
+    WORD32 out_stride,
+    const WORD8 *p_residual,
+    WORD32 residual_stride,
+    const xa_nn_epilogue_asym8s_t *p_epilogue)
 {
    /* NULL pointer checks */
   XA_NNLIB_ARG_CHK_PTR(p_out, -1);
@@ -603,6 +639,14 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
   XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
   XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
   XA_NNLIB_ARG_CHK_COND((out_data_format != 0 && out_data_format != 1), -1);
+  XA_NNLIB_ARG_CHK_COND((out_data_format == 0 && out_stride < out_channels), -1);
+  if(p_epilogue != NULL)
+  {
+    XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->out_activation_min < -128 || p_epilogue->out_activation_min > 127), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->out_activation_max < p_epilogue->out_activation_min || p_epilogue->out_activation_max > 127), -1);
+    XA_NNLIB_ARG_CHK_COND((p_residual != NULL && residual_stride < out_channels), -1);
+  }
 
   int itr;
   for(itr=0;itr<out_channels;itr++){
@@ -612,6 +656,7 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
   WORD32 j;
   WORD32 input_bytewidth = 1;
   VOID *pp_inp = (VOID *)p_inp;
+  WORD8 *p_out_base = p_out;
 
   p_scratch = ALIGNED_ADDR(p_scratch, ALIGNMENT);
   xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
@@ -644,22 +689,42 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
     out_w = out_width;
   }
 
-  xa_nn_conv2d_std_init_state((void*)p_state
-      ,(void*)p_kernel
-      ,inp_h
-      ,input_channels
-      ,ker_h
-      ,ker_w
-      ,y_str
-      ,y_pad
-      ,out_h
-      ,out_channels
-      ,PREC_ASYM8S
-      ,PREC_SYM8S);
+  if(kernel_prepacked)
+  {
+    xa_nn_conv2d_std_prepacked_init_state((void*)p_state
+        ,(void*)p_kernel
+        ,inp_h
+        ,input_channels
+        ,ker_h
+        ,ker_w
+        ,y_str
+        ,y_pad
+        ,out_h
+        ,out_channels
+        ,PREC_ASYM8S
+        ,PREC_SYM8S);
+  }
+  else
+  {
+    xa_nn_conv2d_std_init_state((void*)p_state
+        ,(void*)p_kernel
+        ,inp_h
+        ,input_channels
+        ,ker_h
+        ,ker_w
+        ,y_str
+        ,y_pad
+        ,out_h
+        ,out_channels
+        ,PREC_ASYM8S
+        ,PREC_SYM8S);
+  }
 
+  /* NHWC output pixels are out_stride apart, out_stride > out_channels
+   * writes into a channel slice of a wider tensor */
   WORD32 out_channels_offset = out_data_format ? out_h * out_w : 1;
-  WORD32 out_height_offset = out_data_format ? out_w : out_w * out_channels;
-  WORD32 out_width_offset = out_data_format ? 1 : out_channels;
+  WORD32 out_height_offset = out_data_format ? out_w : out_w * out_stride;
+  WORD32 out_width_offset = out_data_format ? 1 : out_stride;
 
   WORD32 x_padding_var = x_pad;
   WORD32 input_channels_pad;
@@ -684,6 +749,11 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
   {
     out_width_over_x_pad = conv_x_left_pad(x_pad, ker_w, x_str, out_w, out_h, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias);
     x_padding_var -= out_width_over_x_pad * x_str;
+    if(p_epilogue != NULL)
+    {
+      XA_NNLIB_CHK_COND(conv2d_std_epilogue_cols(p_out_base, p_residual, residual_stride, 0, out_width_over_x_pad,
+            out_h, out_w, out_channels, out_stride, out_zero_bias, p_epilogue), -1);
+    }
   }
 
   /* When kernel convolves over x-right pad region only */
@@ -694,6 +764,11 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
   if(x_r_pad >= ker_w)
   {
     out_width_over_x_r_pad = conv_x_right_pad(x_pad, inp_w, x_str, out_w, out_h, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias);
+    if(p_epilogue != NULL)
+    {
+      XA_NNLIB_CHK_COND(conv2d_std_epilogue_cols(p_out_base, p_residual, residual_stride, out_w - out_width_over_x_r_pad, out_width_over_x_r_pad,
+            out_h, out_w, out_channels, out_stride, out_zero_bias, p_epilogue), -1);
+    }
   }
 
   /* When kernel convolves over input region */
@@ -738,9 +813,309 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
        ,out_zero_bias
       );
 
+    if(p_epilogue != NULL)
+    {
+      XA_NNLIB_CHK_COND(conv2d_std_epilogue_cols(p_out_base, p_residual, residual_stride, out_width_over_x_pad + j, 1,
+            out_h, out_w, out_channels, out_stride, out_zero_bias, p_epilogue), -1);
+    }
+
     p_out += out_width_offset;
   }
 
   return 0;
 }
 
+WORD32 xa_nn_conv2d_std_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return conv2d_std_per_chan_sym8sxasym8s_impl(p_out
+      ,p_inp
+      ,p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,out_data_format
+      ,p_scratch
+      ,0
+      ,out_channels
+      ,NULL
+      ,0
+      ,NULL);
+}
+
+WORD32 xa_nn_conv2d_std_out_stride_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_stride,
+    VOID *p_scratch)
+{
+  return conv2d_std_per_chan_sym8sxasym8s_impl(p_out
+      ,p_inp
+      ,p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,0
+      ,p_scratch
+      ,0
+      ,out_stride
+      ,NULL
+      ,0
+      ,NULL);
+}
+
+WORD32 xa_nn_conv2d_std_epilogue_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_stride,
+    const WORD8 *p_residual,
+    WORD32 residual_stride,
+    const xa_nn_epilogue_asym8s_t *p_epilogue,
+    VOID *p_scratch)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_epilogue, -1);
+
+  return conv2d_std_per_chan_sym8sxasym8s_impl(p_out
+      ,p_inp
+      ,p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,0
+      ,p_scratch
+      ,0
+      ,out_stride
+      ,p_residual
+      ,residual_stride
+      ,p_epilogue);
+}
+
+WORD32 xa_nn_conv2d_std_prepacked_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_prepacked,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_kernel_prepacked, -1);
+
+  const VOID *p_kernel = xa_nn_conv2d_std_prepacked_get_kernel(p_kernel_prepacked
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,PREC_ASYM8S
+      ,PREC_SYM8S);
+  XA_NNLIB_CHK_PTR(p_kernel, -1);
+
+  return conv2d_std_per_chan_sym8sxasym8s_impl(p_out
+      ,p_inp
+      ,(const WORD8*)p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,out_data_format
+      ,p_scratch
+      ,1
+      ,out_channels
+      ,NULL
+      ,0
+      ,NULL);
+}
+
+/* xa_nn_conv2d_std_prepack_kernel unpacks sym4s kernels to 8 bits, so the
+ * prepacked sym4s variant runs on the sym8s circular buffer path */
+WORD32 xa_nn_conv2d_std_prepacked_per_chan_sym4sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_prepacked,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_kernel_prepacked, -1);
+
+  const VOID *p_kernel = xa_nn_conv2d_std_prepacked_get_kernel(p_kernel_prepacked
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,PREC_ASYM8S
+      ,PREC_SYM4S);
+  XA_NNLIB_CHK_PTR(p_kernel, -1);
+
+  return conv2d_std_per_chan_sym8sxasym8s_impl(p_out
+      ,p_inp
+      ,(const WORD8*)p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,out_data_format
+      ,p_scratch
+      ,1
+      ,out_channels
+      ,NULL
+      ,0
+      ,NULL);
+}
+
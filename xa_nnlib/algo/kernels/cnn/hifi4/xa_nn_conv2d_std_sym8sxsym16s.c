@@ -643,7 +643,7 @@ static WORD32 xa_nn_conv2d_std_per_chan_sym8sxsym16s_no_circ_buf_vec_unaligned(
   return 0;
 }
 
-WORD32 xa_nn_conv2d_std_per_chan_sym8sxsym16s(
+static WORD32 conv2d_std_per_chan_sym8sxsym16s_impl(
     WORD16* __restrict__ p_out,
     const WORD16* __restrict__ p_inp,
     const WORD8* __restrict__ p_kernel,
@@ -665,7 +665,8 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxsym16s(
     WORD32 * p_out_shift,
     WORD32 out_zero_bias,
     WORD32 out_data_format,
-    VOID *p_scratch)
+    VOID *p_scratch,
+    WORD32 kernel_prepacked)
 {
    /* NULL pointer checks */
   XA_NNLIB_ARG_CHK_PTR(p_out, -1);
@@ -722,7 +723,9 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxsym16s(
     return ret_val;
   }
 
-  if ( !(x_padding) && (input_channels == 2) && !(out_channels & 0x3) && !(out_width & 0x1) && (out_data_format == 0) && ((out_width-1)*x_stride <=(input_width-kernel_width) ) && p_bias)
+  /* Prepacked kernels are laid out for the circular buffer path, the row
+   * aligned layout used below is not available for them */
+  if ( !kernel_prepacked && !(x_padding) && (input_channels == 2) && !(out_channels & 0x3) && !(out_width & 0x1) && (out_data_format == 0) && ((out_width-1)*x_stride <=(input_width-kernel_width) ) && p_bias)
   {
     int ret_val=0;
     VOID *p_kernel_padded = align_weightbuffer_rows(p_scratch /*dest*/, p_kernel /*src*/, out_channels, kernel_height, kernel_width, input_channels);
@@ -787,18 +790,36 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxsym16s(
     out_w = out_width;
   }
 
-  xa_nn_conv2d_std_init_state((void*)p_state
-    ,(void*)p_kernel
-    ,inp_h
-    ,input_channels
-    ,ker_h
-    ,ker_w
-    ,y_str
-    ,y_pad
-    ,out_h
-    ,out_channels
-    ,PREC_SYM16S
-    ,PREC_SYM8S);
+  if(kernel_prepacked)
+  {
+    xa_nn_conv2d_std_prepacked_init_state((void*)p_state
+        ,(void*)p_kernel
+        ,inp_h
+        ,input_channels
+        ,ker_h
+        ,ker_w
+        ,y_str
+        ,y_pad
+        ,out_h
+        ,out_channels
+        ,PREC_SYM16S
+        ,PREC_SYM8S);
+  }
+  else
+  {
+    xa_nn_conv2d_std_init_state((void*)p_state
+        ,(void*)p_kernel
+        ,inp_h
+        ,input_channels
+        ,ker_h
+        ,ker_w
+        ,y_str
+        ,y_pad
+        ,out_h
+        ,out_channels
+        ,PREC_SYM16S
+        ,PREC_SYM8S);
+  }
 
   WORD32 out_channels_offset = out_data_format ? out_h * out_w : 1;
   WORD32 out_height_offset = out_data_format ? out_w : out_w * out_channels;
@@ -875,3 +896,112 @@ WORD32 xa_nn_conv2d_std_per_chan_sym8sxsym16s(
 
   return 0;
 }
+
+WORD32 xa_nn_conv2d_std_per_chan_sym8sxsym16s(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD64* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return conv2d_std_per_chan_sym8sxsym16s_impl(p_out
+      ,p_inp
+      ,p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,out_data_format
+      ,p_scratch
+      ,0);
+}
+
+WORD32 xa_nn_conv2d_std_prepacked_per_chan_sym8sxsym16s(
+    WORD16* __restrict__ p_out,
+    const WORD16* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_prepacked,
+    const WORD64* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_kernel_prepacked, -1);
+
+  const VOID *p_kernel = xa_nn_conv2d_std_prepacked_get_kernel(p_kernel_prepacked
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,PREC_SYM16S
+      ,PREC_SYM8S);
+  XA_NNLIB_CHK_PTR(p_kernel, -1);
+
+  return conv2d_std_per_chan_sym8sxsym16s_impl(p_out
+      ,p_inp
+      ,(const WORD8*)p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,out_data_format
+      ,p_scratch
+      ,1);
+}
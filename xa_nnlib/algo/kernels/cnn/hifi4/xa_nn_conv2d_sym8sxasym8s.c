@@ -610,7 +610,148 @@ static void xa_nn_rearrange_chw_to_hwc
 
 
 
-WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s(
+/* Grouped convolution over a group-blocked circular buffer: each output
+ * column is added to the circular buffers of all groups in one pass over the
+ * input, then every group is run through the circular buffer matXvec with its
+ * own buffer selected. p_kernel is [out_channels][ker_h][ker_w]
+ * [kernel_channels], already padded to kernel_channels_pad when prepacked. */
+static WORD32 conv2d_group_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 inp_h,
+    WORD32 inp_w,
+    WORD32 input_channels,
+    WORD32 ker_h,
+    WORD32 ker_w,
+    WORD32 kernel_channels,
+    WORD32 out_channels,
+    WORD32 x_str,
+    WORD32 y_str,
+    WORD32 x_pad,
+    WORD32 y_pad,
+    WORD32 out_h,
+    WORD32 out_w,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch,
+    WORD32 kernel_prepacked)
+{
+  const int groups = input_channels/kernel_channels;
+  const int kernels_per_group = out_channels / groups;
+  WORD32 j, grp_i;
+  WORD32 input_bytewidth = 1;
+  VOID *pp_inp = (VOID *)p_inp;
+
+  xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
+
+  xa_nn_conv2d_group_blocked_init_state((void*)p_state
+      ,(void*)p_kernel
+      ,inp_h
+      ,kernel_channels
+      ,ker_h
+      ,ker_w
+      ,y_str
+      ,y_pad
+      ,out_h
+      ,out_channels
+      ,groups
+      ,PREC_ASYM8S
+      ,PREC_SYM8S
+      ,kernel_prepacked);
+
+  WORD32 out_channels_offset = out_data_format ? out_h * out_w : 1;
+  WORD32 out_height_offset = out_data_format ? out_w : out_w * out_channels;
+  WORD32 out_width_offset = out_data_format ? 1 : out_channels;
+
+  WORD32 x_padding_var = x_pad;
+  WORD32 kernel_channels_pad = conv2d_std_get_input_channels_pad(kernel_channels, PREC_ASYM8S, PREC_SYM8S);
+  WORD32 vec_len = kernel_channels_pad * ker_w * ker_h;
+
+  /* When kernel convolves over x-left pad region only */
+  WORD32 out_width_over_x_pad = 0;
+  if(x_padding_var >= ker_w)
+  {
+    out_width_over_x_pad = conv_x_left_pad(x_pad, ker_w, x_str, out_w, out_h, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias);
+    x_padding_var -= out_width_over_x_pad * x_str;
+  }
+
+  /* When kernel convolves over x-right pad region only */
+  WORD32 out_width_over_x_r_pad = 0;
+  // Determine x-right padding
+  WORD32 x_r_pad = ker_w + (out_w - 1) * x_str - (x_pad + inp_w);
+  x_r_pad = x_r_pad < 0 ? 0 : x_r_pad;
+  if(x_r_pad >= ker_w)
+  {
+    out_width_over_x_r_pad = conv_x_right_pad(x_pad, inp_w, x_str, out_w, out_h, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias);
+  }
+
+  /* When kernel convolves over input region */
+  p_out += out_width_over_x_pad * out_width_offset;
+  // Initialize circular buffer
+  // Determine y-bottom padding
+  WORD32 y_b_pad = ker_h + (out_h - 1) * y_str - (y_pad + inp_h);
+  y_b_pad = y_b_pad < 0 ? 0 : y_b_pad;
+
+  conv2d_group_blocked_init_cir_buf(input_channels, kernel_channels_pad, kernel_channels, groups, input_bytewidth, inp_w, inp_h, y_pad, y_b_pad, x_padding_var, ker_w, x_str, (VOID**)&pp_inp, p_state, -input_zero_bias);
+
+  WORD32 grp_stride = (WORD8 *)p_state->cir_buf.p_end - (WORD8 *)p_state->cir_buf.p_begin;
+
+  // Index to padded input width
+  WORD32 idx_beg_inp_width_pad = ker_w - x_str;
+  idx_beg_inp_width_pad = idx_beg_inp_width_pad < 0 ? 0 : idx_beg_inp_width_pad;
+
+  // Process Loop to compute one output plane [out_h x out_channels] per iteration
+  for(j=0;j<out_w-out_width_over_x_pad-out_width_over_x_r_pad;j++)
+  {
+    // Add x_str x (inp_h x input_channels) new planes to the circular buffers of all groups
+    conv2d_group_blocked_update_cir_buf(input_channels, kernel_channels_pad, kernel_channels, groups, input_bytewidth, inp_w, inp_h, y_pad, y_b_pad, x_padding_var, ker_w, x_str, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state, -input_zero_bias);
+
+    // Update index to input width padded
+    idx_beg_inp_width_pad += x_str;
+
+    for(grp_i = 0; grp_i < groups; grp_i++)
+    {
+      WORD8 *p_grp_begin = (WORD8 *)p_state->cir_buf.p_begin + grp_i * grp_stride;
+      const WORD32 *p_bias_grp = NULL;
+      if(p_bias != NULL){
+        p_bias_grp = p_bias + grp_i * kernels_per_group;
+      }
+
+      AE_SETCBEGIN0(p_grp_begin);
+      AE_SETCEND0(p_grp_begin + grp_stride);
+
+      // Convolution using matXvec with matrix as circular buffer
+      xa_nn_matXvec_sym8sxasym8s_asym8s_circ
+        (p_out + grp_i * kernels_per_group * out_channels_offset /* output */
+        ,(WORD8 *)p_state->cir_buf.p_curr + grp_i * grp_stride /* matrix: rows x cols */
+        ,(WORD8 *)p_state->p_kernel_padded + grp_i * kernels_per_group * vec_len /* vec: cols */
+        ,p_bias_grp /* bias */
+        ,out_h /* rows */
+        ,vec_len /* cols */
+        ,kernel_channels_pad * ker_w * y_str/* row_offset */
+        ,kernels_per_group /* vec_count */
+        ,vec_len /* vec_stride */
+        ,out_channels_offset /* out_col_offset */
+        ,out_height_offset /* out_row_offset */
+        ,input_zero_bias
+        ,(p_out_multiplier + grp_i * kernels_per_group)
+        ,(p_out_shift + grp_i * kernels_per_group)
+        ,out_zero_bias
+        );
+    }
+
+    p_out += out_width_offset;
+  }
+
+  return 0;
+}
+
+static WORD32 conv2d_per_chan_sym8sxasym8s_impl(
     WORD8* __restrict__ p_out,
     const WORD8* __restrict__ p_inp,
     const WORD8* __restrict__ p_kernel,
@@ -635,7 +776,9 @@ WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s(
     WORD32 * p_out_shift,
     WORD32 out_zero_bias,
     WORD32 out_data_format,
-    VOID *p_scratch)
+    VOID *p_scratch,
+    WORD32 kernel_prepacked,
+    WORD32 kernel_layout)
 {
    /* NULL pointer checks */
   XA_NNLIB_ARG_CHK_PTR(p_out, -1);
@@ -676,13 +819,7 @@ WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s(
   XA_NNLIB_ARG_CHK_COND((kernels_per_group<=0),-1);
   int ret = 0;
 
-  WORD32 j;
-  WORD32 input_bytewidth = 1;
-  VOID *pp_inp = (VOID *)p_inp;
-  WORD8* __restrict__ tmp_out;
-
   p_scratch = ALIGNED_ADDR(p_scratch, ALIGNMENT);
-  xa_nn_conv_state_t *p_state = (xa_nn_conv_state_t *)p_scratch;
   WORD32 inp_h, inp_w, ker_h, ker_w, x_str, y_str, x_pad, y_pad, out_h, out_w;
     
   if ((input_height == 1) && (kernel_height == 1) && (out_height == 1))
@@ -712,14 +849,24 @@ WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s(
     out_w = out_width;
   }
 
-if((groups==input_channels) && (out_channels>=input_channels) && (out_data_format==0) && (p_bias != NULL))
+if(conv2d_group_get_layout(input_channels, kernel_channels, out_channels, out_data_format, (p_bias != NULL)) == XA_NN_CONV2D_GROUP_LAYOUT_DEPTHWISE)
 {
     WORD32 channel_multiplier=out_channels/input_channels;
-    pWORD8 p_kernel_nhwc;
-    p_scratch = (void *)ALIGNED_ADDR(p_scratch, ALIGNMENT);
-    p_kernel_nhwc = (pWORD8)p_scratch;
-    p_scratch += PADDED_SIZE(out_channels * kernel_height * kernel_width, ALIGNMENT);
-    xa_nn_rearrange_chw_to_hwc(p_kernel_nhwc,p_kernel,kernel_width,kernel_height,out_channels);
+    const WORD8 *p_kernel_nhwc;
+    if(kernel_prepacked)
+    {
+      /* Already in the depthwise layout */
+      p_kernel_nhwc = p_kernel;
+    }
+    else
+    {
+      pWORD8 p_kernel_tmp;
+      p_scratch = (void *)ALIGNED_ADDR(p_scratch, ALIGNMENT);
+      p_kernel_tmp = (pWORD8)p_scratch;
+      p_scratch += PADDED_SIZE(out_channels * kernel_height * kernel_width, ALIGNMENT);
+      xa_nn_rearrange_chw_to_hwc(p_kernel_tmp,p_kernel,kernel_width,kernel_height,out_channels);
+      p_kernel_nhwc = p_kernel_tmp;
+    }
     
     ret |= xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s
                 (p_out
@@ -751,124 +898,162 @@ if((groups==input_channels) && (out_channels>=input_channels) && (out_data_forma
 
   }
 
+  /* The depthwise layout of a prepacked kernel needs the depthwise kernel */
+  XA_NNLIB_ARG_CHK_COND((kernel_prepacked && kernel_layout != XA_NN_CONV2D_GROUP_LAYOUT_BLOCKED), -1);
 
-  WORD32 out_channels_offset = out_data_format ? out_h * out_w : 1;
-  WORD32 out_height_offset = out_data_format ? out_w : out_w * out_channels;
-  WORD32 out_width_offset = out_data_format ? 1 : out_channels;
-
-  WORD32 x_padding_var = x_pad;
-  WORD32 kernel_channels_pad;
-
-#if !ENABLE_PADDING_CONV2D_STD
-  kernel_channels_pad = kernel_channels;
-#else
-#if HW_AE_ADDCIRC16X4_XC
-  if(kernel_channels == 1){
-    kernel_channels_pad = 1;
-  }
-  else
-#endif
-  {
-    kernel_channels_pad = PADDED_SIZE(kernel_channels, (ALIGNMENT>>1));
-  }
-#endif
-
-  /* When kernel convolves over x-left pad region only */
-  WORD32 out_width_over_x_pad = 0;
-  if(x_padding_var >= ker_w)
-  {
-    out_width_over_x_pad = conv_x_left_pad(x_pad, ker_w, x_str, out_w, out_h, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias);
-    x_padding_var -= out_width_over_x_pad * x_str;
-  }
-
-  /* When kernel convolves over x-right pad region only */
-  WORD32 out_width_over_x_r_pad = 0;
-  // Determine x-right padding
-  WORD32 x_r_pad = ker_w + (out_w - 1) * x_str - (x_pad + inp_w);
-  x_r_pad = x_r_pad < 0 ? 0 : x_r_pad;
-  if(x_r_pad >= ker_w)
-  {
-    out_width_over_x_r_pad = conv_x_right_pad(x_pad, inp_w, x_str, out_w, out_h, out_channels, out_channels_offset, out_width_offset, out_height_offset, p_bias, p_out, p_out_multiplier, p_out_shift, out_zero_bias);
-  }
-
-  /* When kernel convolves over input region */
-  p_out += out_width_over_x_pad * out_width_offset;
-  // Initialize circular buffer
-  // Determine y-bottom padding
-  WORD32 y_b_pad = ker_h + (out_h - 1) * y_str - (y_pad + inp_h);
-  y_b_pad = y_b_pad < 0 ? 0 : y_b_pad;
-
-  xa_nn_conv2d_std_init_state((void*)p_state
-      ,(void*)p_kernel
+  return conv2d_group_per_chan_sym8sxasym8s(p_out
+      ,p_inp
+      ,p_kernel
+      ,p_bias
       ,inp_h
-      ,kernel_channels
+      ,inp_w
+      ,input_channels
       ,ker_h
       ,ker_w
+      ,kernel_channels
+      ,out_channels
+      ,x_str
       ,y_str
+      ,x_pad
       ,y_pad
       ,out_h
+      ,out_w
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,out_data_format
+      ,p_scratch
+      ,kernel_prepacked);
+}
+
+WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const WORD8* __restrict__ p_kernel,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 kernel_channels,
+    WORD32 dilation_height,
+    WORD32 dilation_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  return conv2d_per_chan_sym8sxasym8s_impl(p_out
+      ,p_inp
+      ,p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,kernel_channels
+      ,dilation_height
+      ,dilation_width
       ,out_channels
-      ,PREC_ASYM8S
-      ,PREC_SYM8S);
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,out_data_format
+      ,p_scratch
+      ,0
+      ,XA_NN_CONV2D_GROUP_LAYOUT_BLOCKED);
+}
 
-  for (int grp_i = 0; grp_i < groups; ++grp_i)
-  {
-    tmp_out=p_out+grp_i*kernels_per_group*out_channels_offset;
-    xa_nn_conv2d_group_init_state((void*)p_state
-        ,(void*)p_kernel
-        ,inp_h
-        ,kernel_channels
-        ,ker_h
-        ,ker_w
-        ,y_str
-        ,y_pad
-        ,out_h
-        ,out_channels
-        ,PREC_ASYM8S
-        ,PREC_SYM8S);
-
-    pp_inp = (VOID *)(p_inp+grp_i*kernel_channels);
-    conv2d_group_init_cir_buf(input_channels, kernel_channels_pad,kernel_channels,input_bytewidth, inp_w, inp_h, y_pad, y_b_pad, x_padding_var, ker_w, x_str, (VOID**)&pp_inp, p_state, -input_zero_bias);
-    
-      // Index to padded input width
-    WORD32 idx_beg_inp_width_pad = ker_w - x_str;
-    idx_beg_inp_width_pad = idx_beg_inp_width_pad < 0 ? 0 : idx_beg_inp_width_pad;
-    // Process Loop to compute one output plane [out_h x out_channels] per iteration
-    for(j=0;j<out_w-out_width_over_x_pad-out_width_over_x_r_pad;j++)
-    {
-      // Add x_str x (inp_h x input_channels) new planes to circular buffer
-      conv2d_group_update_cir_buf(input_channels, kernel_channels_pad,kernel_channels,input_bytewidth, inp_w, inp_h, y_pad, y_b_pad, x_padding_var, ker_w, x_str, (VOID**)&pp_inp, idx_beg_inp_width_pad, p_state, -input_zero_bias);
-      // Update index to input width padded
-      idx_beg_inp_width_pad += x_str;
+WORD32 xa_nn_conv2d_group_prepacked_per_chan_sym8sxasym8s(
+    WORD8* __restrict__ p_out,
+    const WORD8* __restrict__ p_inp,
+    const VOID* __restrict__ p_kernel_prepacked,
+    const WORD32* __restrict__ p_bias,
+    WORD32 input_height,
+    WORD32 input_width,
+    WORD32 input_channels,
+    WORD32 kernel_height,
+    WORD32 kernel_width,
+    WORD32 kernel_channels,
+    WORD32 dilation_height,
+    WORD32 dilation_width,
+    WORD32 out_channels,
+    WORD32 x_stride,
+    WORD32 y_stride,
+    WORD32 x_padding,
+    WORD32 y_padding,
+    WORD32 out_height,
+    WORD32 out_width,
+    WORD32 input_zero_bias,
+    WORD32 * p_out_multiplier,
+    WORD32 * p_out_shift,
+    WORD32 out_zero_bias,
+    WORD32 out_data_format,
+    VOID *p_scratch)
+{
+  WORD32 kernel_layout = XA_NN_CONV2D_GROUP_LAYOUT_BLOCKED;
+  const VOID *p_kernel;
 
-      // Convolution using matXvec with matrix as circular buffer
-      const WORD32 *p_bias_grp = NULL;
-      if(p_bias != NULL){
-        p_bias_grp = p_bias+grp_i*kernels_per_group;
-      }
-      xa_nn_matXvec_sym8sxasym8s_asym8s_circ
-        (tmp_out /* output */
-        ,p_state->cir_buf.p_curr/* matrix: rows x cols */
-        ,(p_state->p_kernel_padded+grp_i*kernels_per_group*kernel_channels_pad*ker_w*ker_h) /* vec: cols */
-        ,p_bias_grp /* bias */
-        ,out_h /* rows */
-        ,kernel_channels_pad * ker_w * ker_h /* cols */
-        ,kernel_channels_pad * ker_w * y_str/* row_offset */
-        ,kernels_per_group /* vec_count */
-        ,kernel_channels_pad * ker_w * ker_h /* vec_stride */
-        ,out_channels_offset /* out_col_offset */
-        ,out_height_offset /* out_row_offset */
-        ,input_zero_bias
-        ,(p_out_multiplier+grp_i*kernels_per_group)
-        ,(p_out_shift+grp_i*kernels_per_group)
-        ,out_zero_bias
-        );
+  XA_NNLIB_ARG_CHK_PTR(p_kernel_prepacked, -1);
+  XA_NNLIB_ARG_CHK_COND((kernel_channels <= 0), -1);
 
-      tmp_out += out_width_offset;
-    }
-  
-  }
+  p_kernel = xa_nn_conv2d_group_prepacked_get_kernel(p_kernel_prepacked
+      ,input_channels
+      ,kernel_channels
+      ,kernel_height
+      ,kernel_width
+      ,out_channels
+      ,PREC_ASYM8S
+      ,PREC_SYM8S
+      ,out_data_format
+      ,(p_bias != NULL)
+      ,&kernel_layout);
+  XA_NNLIB_ARG_CHK_PTR(p_kernel, -1);
 
-  return 0;
+  return conv2d_per_chan_sym8sxasym8s_impl(p_out
+      ,p_inp
+      ,(const WORD8 *)p_kernel
+      ,p_bias
+      ,input_height
+      ,input_width
+      ,input_channels
+      ,kernel_height
+      ,kernel_width
+      ,kernel_channels
+      ,dilation_height
+      ,dilation_width
+      ,out_channels
+      ,x_stride
+      ,y_stride
+      ,x_padding
+      ,y_padding
+      ,out_height
+      ,out_width
+      ,input_zero_bias
+      ,p_out_multiplier
+      ,p_out_shift
+      ,out_zero_bias
+      ,out_data_format
+      ,p_scratch
+      ,1
+      ,kernel_layout);
 }
-
@@ -63,13 +63,8 @@ WORD32 xa_nn_transpose_conv_getsize
             scratch_bytewidth = 8; /* 64b scratch */
             align_size = ALIGNMENT >> 1;
             break;
-        case -4: /* For asym8s */
+        case -4: /* For asym8s, no accumulator scratch */
             input_size = sizeof(WORD8);
-#if XCHAL_HAVE_HIFI1S
-            scratch_bytewidth = 4; /* 32b scratch for HiFi1s*/
-#else            
-            scratch_bytewidth = 8; /* 64b scratch */
-#endif            
             align_size = ALIGNMENT >> 1;
             break;            
         case -1: /* For float32 */
@@ -97,7 +92,8 @@ WORD32 xa_nn_transpose_conv_getsize
 
     int ker_grt_inp = (kernel_width > input_width || kernel_height > input_height);
     int str_leq_ker = (x_stride <= kernel_width && y_stride <= kernel_height);
-    if(!ker_grt_inp && str_leq_ker)
+    /* asym8s output always uses the stride decomposed convolution */
+    if((output_precision == -4) || (!ker_grt_inp && str_leq_ker))
     {
       total_size += ALIGNED_SIZE(sizeof(xa_nn_conv_state_t), 8);
       int subkerX_max = (kernel_width + x_stride - 1) / x_stride;
@@ -111,6 +107,11 @@ WORD32 xa_nn_transpose_conv_getsize
           cir_buf_size_bytes+= subkerX_max*input_channels_pad*input_size;
       }
       total_size += kernel_bytes + cir_buf_size_bytes; 
+      if(output_precision == -4)
+      {
+        /* Requantized bias row used for the outputs outside the valid region */
+        total_size += PADDED_SIZE(output_channels, 8);
+      }
       total_size += BUS_WIDTH;
       total_size = PADDED_SIZE(total_size, align_size);
     }
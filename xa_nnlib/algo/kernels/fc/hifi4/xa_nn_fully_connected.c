@@ -76,18 +76,7 @@ WORD32 xa_nn_fully_connected_f32
 }
 #endif /* #if !HAVE_VFPU */
 
-#if !HAVE_HP_VFPU
-DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_fully_connected_f16,
-    (WORD16 *__restrict__ p_out
-     ,const WORD16 *__restrict__ p_weight
-     ,const WORD16 *__restrict__ p_inp
-     ,const WORD16 *__restrict__ p_bias
-     ,WORD32  weight_depth
-     ,WORD32  out_depth
-    )
-    )
-#else /* #if !HAVE_HP_VFPU */
-#ifndef hifi5
+#if !HAVE_VFPU
 DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_fully_connected_f16,
     (WORD16 *__restrict__ p_out
      ,const WORD16 *__restrict__ p_weight
@@ -97,7 +86,7 @@ DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_fully_connected_f16,
      ,WORD32  out_depth
     )
     )
-#else    
+#else /* #if !HAVE_VFPU */
 WORD32 xa_nn_fully_connected_f16
   (WORD16 *__restrict__ p_out
    ,const WORD16 *__restrict__ p_weight
@@ -135,8 +124,7 @@ WORD32 xa_nn_fully_connected_f16
     );
   return ret;
 }
-#endif
-#endif /* #if !HAVE_HP_VFPU */
+#endif /* #if !HAVE_VFPU */
 
 WORD32 xa_nn_fully_connected_16x16_16
   (pWORD16 __restrict__ p_out
@@ -491,6 +479,280 @@ WORD32 xa_nn_fully_connected_asym8sxasym8s_asym8s
   return ret;
 }
 
+/* Number of input vectors per xa_nn_matXvec_batch_* call, i.e. that share
+ * the cache resident weight row blocks */
+#define FC_BATCH_VECS 8
+
+static WORD32 fully_connected_batch_sym8sxasym8s_asym8s_impl
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  batch
+   ,WORD32  input_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_stride
+   ,const WORD8 *__restrict__ p_residual
+   ,WORD32  residual_stride
+   ,const xa_nn_epilogue_asym8s_t *p_epilogue
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_weight, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD8), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_weight, sizeof(WORD8), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD8), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((weight_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((batch <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  XA_NNLIB_ARG_CHK_COND((out_stride < out_depth), -1);
+  if(p_epilogue != NULL)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->out_activation_min < -128 || p_epilogue->out_activation_min > 127), -1);
+    XA_NNLIB_ARG_CHK_COND((p_epilogue->out_activation_max < p_epilogue->out_activation_min || p_epilogue->out_activation_max > 127), -1);
+    XA_NNLIB_ARG_CHK_COND((p_residual != NULL && residual_stride < out_depth), -1);
+  }
+
+  WORD32 ret = 0;
+  int b, i, vec_count;
+
+  /* Batched kernel needs 4 byte aligned weight rows and inputs, otherwise
+   * run the inputs one at a time */
+  if(((((unsigned)p_weight) & 3) != 0) || ((((unsigned)p_inp) & 3) != 0) || ((weight_depth & 3) != 0))
+  {
+    for(b = 0; b < batch; b++)
+    {
+      ret = xa_nn_fully_connected_sym8sxasym8s_asym8s
+        (p_out + b * out_stride
+         ,p_weight
+         ,p_inp + b * weight_depth
+         ,p_bias
+         ,weight_depth
+         ,out_depth
+         ,input_zero_bias
+         ,out_multiplier
+         ,out_shift
+         ,out_zero_bias
+        );
+      if(ret != 0)
+        return ret;
+      if(p_epilogue != NULL)
+      {
+        ret = xa_nn_elm_epilogue_asym8s(p_out + b * out_stride, out_stride
+            ,p_residual ? p_residual + b * residual_stride : NULL
+            ,residual_stride, out_zero_bias, 1, out_depth, p_epilogue);
+        if(ret != 0)
+          return ret;
+      }
+    }
+    return 0;
+  }
+
+  const WORD8 *pp_inp[FC_BATCH_VECS];
+  WORD8 *pp_out[FC_BATCH_VECS];
+
+  for(b = 0; b < batch; b += FC_BATCH_VECS)
+  {
+    vec_count = (batch - b) < FC_BATCH_VECS ? (batch - b) : FC_BATCH_VECS;
+    for(i = 0; i < vec_count; i++)
+    {
+      pp_inp[i] = p_inp + (b + i) * weight_depth;
+      pp_out[i] = p_out + (b + i) * out_stride;
+    }
+    ret = xa_nn_matXvec_batch_sym8sxasym8s_asym8s
+      (pp_out
+       ,p_weight
+       ,pp_inp
+       ,p_bias
+       ,out_depth
+       ,weight_depth
+       ,weight_depth
+       ,vec_count
+       ,input_zero_bias
+       ,out_multiplier
+       ,out_shift
+       ,out_zero_bias
+      );
+    if(ret != 0)
+      return ret;
+    /* Rows of this group are still in cache */
+    if(p_epilogue != NULL)
+    {
+      ret = xa_nn_elm_epilogue_asym8s(p_out + b * out_stride, out_stride
+          ,p_residual ? p_residual + b * residual_stride : NULL
+          ,residual_stride, out_zero_bias, vec_count, out_depth, p_epilogue);
+      if(ret != 0)
+        return ret;
+    }
+  }
+  return 0;
+}
+
+WORD32 xa_nn_fully_connected_batch_sym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  batch
+   ,WORD32  input_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+  )
+{
+  return fully_connected_batch_sym8sxasym8s_asym8s_impl(p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, batch,
+      input_zero_bias, out_multiplier, out_shift, out_zero_bias, out_depth, NULL, 0, NULL);
+}
+
+/* Output rows out_stride elements apart */
+WORD32 xa_nn_fully_connected_batch_out_stride_sym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  batch
+   ,WORD32  input_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_stride
+  )
+{
+  return fully_connected_batch_sym8sxasym8s_asym8s_impl(p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, batch,
+      input_zero_bias, out_multiplier, out_shift, out_zero_bias, out_stride, NULL, 0, NULL);
+}
+
+/* out_stride variant followed by the epilogue on each group of rows */
+WORD32 xa_nn_fully_connected_batch_epilogue_sym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  batch
+   ,WORD32  input_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+   ,WORD32  out_stride
+   ,const WORD8 *__restrict__ p_residual
+   ,WORD32  residual_stride
+   ,const xa_nn_epilogue_asym8s_t *p_epilogue
+  )
+{
+  XA_NNLIB_ARG_CHK_PTR(p_epilogue, -1);
+  return fully_connected_batch_sym8sxasym8s_asym8s_impl(p_out, p_weight, p_inp, p_bias, weight_depth, out_depth, batch,
+      input_zero_bias, out_multiplier, out_shift, out_zero_bias, out_stride, p_residual, residual_stride, p_epilogue);
+}
+
+WORD32 xa_nn_fully_connected_batch_asym8sxasym8s_asym8s
+  (WORD8 *__restrict__ p_out
+   ,const WORD8 *__restrict__ p_weight
+   ,const WORD8 *__restrict__ p_inp
+   ,const WORD32 *__restrict__ p_bias
+   ,WORD32  weight_depth
+   ,WORD32  out_depth
+   ,WORD32  batch
+   ,WORD32  input_zero_bias
+   ,WORD32  weight_zero_bias
+   ,WORD32  out_multiplier
+   ,WORD32  out_shift
+   ,WORD32  out_zero_bias
+  )
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_weight, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD8), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_weight, sizeof(WORD8), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD8), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((out_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((weight_depth <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((batch <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((input_zero_bias < -127 || input_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((weight_zero_bias < -127 || weight_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+
+  WORD32 ret = 0;
+  int b, i, vec_count;
+
+  if(((((unsigned)p_weight) & 3) != 0) || ((((unsigned)p_inp) & 3) != 0) || ((weight_depth & 3) != 0))
+  {
+    for(b = 0; b < batch; b++)
+    {
+      ret = xa_nn_fully_connected_asym8sxasym8s_asym8s
+        (p_out + b * out_depth
+         ,p_weight
+         ,p_inp + b * weight_depth
+         ,p_bias
+         ,weight_depth
+         ,out_depth
+         ,input_zero_bias
+         ,weight_zero_bias
+         ,out_multiplier
+         ,out_shift
+         ,out_zero_bias
+        );
+      if(ret != 0)
+        return ret;
+    }
+    return 0;
+  }
+
+  const WORD8 *pp_inp[FC_BATCH_VECS];
+  WORD8 *pp_out[FC_BATCH_VECS];
+
+  for(b = 0; b < batch; b += FC_BATCH_VECS)
+  {
+    vec_count = (batch - b) < FC_BATCH_VECS ? (batch - b) : FC_BATCH_VECS;
+    for(i = 0; i < vec_count; i++)
+    {
+      pp_inp[i] = p_inp + (b + i) * weight_depth;
+      pp_out[i] = p_out + (b + i) * out_depth;
+    }
+    ret = xa_nn_matXvec_batch_asym8sxasym8s_asym8s
+      (pp_out
+       ,p_weight
+       ,pp_inp
+       ,p_bias
+       ,out_depth
+       ,weight_depth
+       ,weight_depth
+       ,vec_count
+       ,weight_zero_bias
+       ,input_zero_bias
+       ,out_multiplier
+       ,out_shift
+       ,out_zero_bias
+      );
+    if(ret != 0)
+      return ret;
+  }
+  return 0;
+}
+
 WORD32 xa_nn_fully_connected_asym4sxasym8s_asym8s
   (WORD8 *__restrict__ p_out
    ,const WORD8 *__restrict__ p_weight
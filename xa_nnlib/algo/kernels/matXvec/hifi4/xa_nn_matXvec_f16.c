@@ -0,0 +1,166 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common_fpu.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros.h"
+
+/*-------------------------------------------------------------------------
+  xa_nn_matXvec_f16xf16_f16
+  Dual matrix vector multiplication with added bias for IEEE half precision
+  data. Matrix and vector elements are widened to single precision, products
+  are accumulated in single precision and each output is rounded once.
+  Four rows are processed together so that every vector element is widened
+  once per four rows.
+
+  Restriction:
+  p_out, p_mat1, p_vec1 (p_mat2, p_vec2 when p_mat2 is not NULL) should hold
+  valid addresses and be 2 byte aligned, p_bias may be NULL.
+-------------------------------------------------------------------------*/
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_matXvec_f16xf16_f16,(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_vec2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2))
+#else
+static void mtx_vecmpyf16_acc(
+    FLOAT32 *acc,
+    const WORD16 * __restrict__ p_mat,
+    const WORD16 * __restrict__ p_vec,
+    WORD32 rows,
+    WORD32 cols,
+    WORD32 row_stride)
+{
+  int m_itr, c_itr;
+
+  for(m_itr = 0; m_itr < (rows & ~3); m_itr += 4)
+  {
+    const WORD16 *p_mat_0 = p_mat + (m_itr + 0) * row_stride;
+    const WORD16 *p_mat_1 = p_mat + (m_itr + 1) * row_stride;
+    const WORD16 *p_mat_2 = p_mat + (m_itr + 2) * row_stride;
+    const WORD16 *p_mat_3 = p_mat + (m_itr + 3) * row_stride;
+    FLOAT32 acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+
+    for(c_itr = 0; c_itr < cols; c_itr++)
+    {
+      FLOAT32 vec = xa_nn_f16_to_f32(p_vec[c_itr]);
+      acc0 += xa_nn_f16_to_f32(p_mat_0[c_itr]) * vec;
+      acc1 += xa_nn_f16_to_f32(p_mat_1[c_itr]) * vec;
+      acc2 += xa_nn_f16_to_f32(p_mat_2[c_itr]) * vec;
+      acc3 += xa_nn_f16_to_f32(p_mat_3[c_itr]) * vec;
+    }
+    acc[m_itr + 0] += acc0;
+    acc[m_itr + 1] += acc1;
+    acc[m_itr + 2] += acc2;
+    acc[m_itr + 3] += acc3;
+  }
+
+  for(; m_itr < rows; m_itr++)
+  {
+    const WORD16 *p_mat_0 = p_mat + m_itr * row_stride;
+    FLOAT32 acc0 = 0.0f;
+
+    for(c_itr = 0; c_itr < cols; c_itr++)
+    {
+      acc0 += xa_nn_f16_to_f32(p_mat_0[c_itr]) * xa_nn_f16_to_f32(p_vec[c_itr]);
+    }
+    acc[m_itr] += acc0;
+  }
+}
+
+#define MATXVEC_F16_ROW_BLOCK 32
+
+WORD32 xa_nn_matXvec_f16xf16_f16(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_mat2,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_vec2,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,
+    WORD32 row_stride2)
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+
+  if(p_mat2 != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_vec2, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat2, sizeof(WORD16), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec2, sizeof(WORD16), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
+  }
+
+  /* Accumulate a block of rows in single precision, so outputs of both
+   * matrices are summed before the single rounding to half precision */
+  FLOAT32 acc[MATXVEC_F16_ROW_BLOCK];
+  int m_itr, i, block_rows;
+
+  for(m_itr = 0; m_itr < rows; m_itr += MATXVEC_F16_ROW_BLOCK)
+  {
+    block_rows = rows - m_itr;
+    block_rows = block_rows < MATXVEC_F16_ROW_BLOCK ? block_rows : MATXVEC_F16_ROW_BLOCK;
+
+    for(i = 0; i < block_rows; i++)
+    {
+      acc[i] = (p_bias != NULL) ? xa_nn_f16_to_f32(p_bias[m_itr + i]) : 0.0f;
+    }
+
+    mtx_vecmpyf16_acc(acc, p_mat1 + m_itr * row_stride1, p_vec1, block_rows, cols1, row_stride1);
+    if(p_mat2 != NULL)
+    {
+      mtx_vecmpyf16_acc(acc, p_mat2 + m_itr * row_stride2, p_vec2, block_rows, cols2, row_stride2);
+    }
+
+    for(i = 0; i < block_rows; i++)
+    {
+      p_out[m_itr + i] = xa_nn_f32_to_f16(acc[i]);
+    }
+  }
+
+  return 0;
+}
+#endif /* !HAVE_VFPU */
@@ -0,0 +1,336 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros.h"
+#include "xa_nn_matXvec_rnn_act.h"
+
+/*
+ * Fused GRU cell kernels.
+ *
+ * p_mat*1 are the input weights (rows x cols1) and p_mat*2 the recurrent
+ * weights (rows x rows) of the z, r and h gates. The new hidden state is
+ * written to p_out and also to p_prev_h, like xa_nn_vec_interpolation_q15()
+ * does for the per-gate path.
+ *
+ * With p_bias_sz/sr/sh NULL the single biases are used and the candidate is
+ *   h' = tanh(W_h x + U_h (r * prev_h) + b_h)
+ * r * prev_h needs the whole r vector before any candidate row can start,
+ * so z and r go first in one sweep over [W_z; W_r] and [U_z; U_r] (z is
+ * parked in p_out, r * prev_h in p_scratch) and the candidate rows follow in
+ * a second sweep that ends with the interpolation.
+ *
+ * With the split biases the candidate is
+ *   h' = tanh(W_h x + bs_h + r * (U_h prev_h + b_h))
+ * which only needs r of the same row, so all three gates are done in one
+ * sweep and p_scratch is not used.
+ */
+
+/* Row lists: M(acc, matrix, row offset from m_row, row stride) */
+#define GRU_ROWS_ZR_X4(M, p_z, p_r, p_h, stride) \
+  M(z0, p_z, 0, stride) M(z1, p_z, 1, stride) M(z2, p_z, 2, stride) M(z3, p_z, 3, stride) \
+  M(r0, p_r, 0, stride) M(r1, p_r, 1, stride) M(r2, p_r, 2, stride) M(r3, p_r, 3, stride)
+
+#define GRU_ROWS_H_X4(M, p_z, p_r, p_h, stride) \
+  M(h0, p_h, 0, stride) M(h1, p_h, 1, stride) M(h2, p_h, 2, stride) M(h3, p_h, 3, stride)
+
+#define GRU_ROWS_ZRH_X2(M, p_z, p_r, p_h, stride) \
+  M(z0, p_z, 0, stride) M(z1, p_z, 1, stride) \
+  M(r0, p_r, 0, stride) M(r1, p_r, 1, stride) \
+  M(h0, p_h, 0, stride) M(h1, p_h, 1, stride)
+
+#define GRU_ZERO_ACC(acc, p_mat, idx, stride) \
+  _ae_int64_acc_ ## acc = ZERO64;
+
+#define GRU_SETUP_ROW(acc, p_mat, idx, stride) \
+  GRU_MAT_T *_p_mat_ ## acc = (GRU_MAT_T *)&(p_mat)[(m_row + idx) * (stride)];
+
+#define GRU_KERNEL_ROW(acc, p_mat, idx, stride) \
+  GRU_LOAD_ROW(_ae_int16x4_mat, _p_mat_ ## acc); \
+  AE_MULAAAAQ16(_ae_int64_acc_ ## acc, _ae_int16x4_vec, _ae_int16x4_mat);
+
+/* Here the matrix argument of the row list carries the bias */
+#define GRU_ADD_BIAS_ROW(acc, p_bias, idx, stride) \
+  _ae_int64_acc_ ## acc = AE_ADD64S(GRU_ACC_SCALE(_ae_int64_acc_ ## acc), \
+      AE_SLAA64S(((ae_int64) ((ae_int16 *)(p_bias))[m_row + idx]), bias_shift));
+
+/* Accumulates the rows of ROWS against p_vec, cols wide */
+#define GRU_SWEEP(ROWS, p_z, p_r, p_h, stride, p_vec, cols) \
+{ \
+  ae_int16x4 _ae_int16x4_vec, _ae_int16x4_mat; \
+  ae_int16x4 *_ae_int16x4_p_vec = (ae_int16x4 *)(p_vec); \
+  ROWS(GRU_SETUP_ROW, p_z, p_r, p_h, stride) \
+  for(c_itr = 0; c_itr < ((cols) >> 2); c_itr++) \
+  { \
+    AE_L16X4_IP(_ae_int16x4_vec, _ae_int16x4_p_vec, INCREMENT_IN_BYTES_FOR_INT16X4); \
+    ROWS(GRU_KERNEL_ROW, p_z, p_r, p_h, stride) \
+  } \
+}
+
+/* Q6.25 pre-activations of two rows */
+#define GRU_ACC_PAIR(acc0, acc1) \
+  AE_ROUND32X2F64SSYM(AE_SLAA64S(_ae_int64_acc_ ## acc0, acc_shift), \
+                      AE_SLAA64S(_ae_int64_acc_ ## acc1, acc_shift))
+
+/* z, r: sigmoid; r * prev_h goes to p_scratch and z is parked in p_out */
+#define GRU_ZR_EPILOGUE_X4 \
+{ \
+  ae_int16x4 _z, _r, _h_prev; \
+  _z = AE_SAT16X4(rnn_act_sigmoid_32x2_q15(GRU_ACC_PAIR(z0, z1)), \
+                  rnn_act_sigmoid_32x2_q15(GRU_ACC_PAIR(z2, z3))); \
+  _r = AE_SAT16X4(rnn_act_sigmoid_32x2_q15(GRU_ACC_PAIR(r0, r1)), \
+                  rnn_act_sigmoid_32x2_q15(GRU_ACC_PAIR(r2, r3))); \
+  _h_prev = *(ae_int16x4 *)&p_prev_h[m_row]; \
+  *(ae_int16x4 *)&p_scratch[m_row] = AE_MULFP16X4S(_r, _h_prev); \
+  *(ae_int16x4 *)&p_out[m_row] = _z; \
+}
+
+/* z * prev_h + (1 - z) * h', as in xa_nn_vec_interpolation_q15() */
+#define GRU_INTERPOLATE(y, z, h, h_prev) \
+  h = AE_SLAA16S(h, tanh_lsh); \
+  y = AE_ADD16S(AE_MULFP16X4S(z, h_prev), AE_MULFP16X4S(AE_SUB16S(AE_MOVDA16(0x7fff), z), h));
+
+#define GRU_H_EPILOGUE_X4 \
+{ \
+  ae_int16x4 _z, _h, _h_prev, _y; \
+  _h = AE_ROUND16X4F32SASYM(rnn_act_tanh_32x2_q31(GRU_ACC_PAIR(h0, h1)), \
+                            rnn_act_tanh_32x2_q31(GRU_ACC_PAIR(h2, h3))); \
+  _z = *(ae_int16x4 *)&p_out[m_row]; \
+  _h_prev = *(ae_int16x4 *)&p_prev_h[m_row]; \
+  GRU_INTERPOLATE(_y, _z, _h, _h_prev); \
+  *(ae_int16x4 *)&p_out[m_row] = _y; \
+  *(ae_int16x4 *)&p_prev_h[m_row] = _y; \
+}
+
+/* All three gates of rows m_row, m_row + 1 with split biases; z_q15 gets
+ * the Q0.15 update gate and h_q31 the Q0.31 candidate of the two rows */
+#define GRU_SPLIT_X2(z_q15, h_q31) \
+{ \
+  ae_int32x2 _x_z, _x_r, _x_h, _r; \
+  GRU_ROWS_ZRH_X2(GRU_ZERO_ACC, 0, 0, 0, 0) \
+  GRU_SWEEP(GRU_ROWS_ZRH_X2, p_mat_z1, p_mat_r1, p_mat_h1, row_stride1, p_vec, cols1) \
+  GRU_ROWS_ZRH_X2(GRU_ADD_BIAS_ROW, p_bias_sz, p_bias_sr, p_bias_sh, 0) \
+  _x_z = GRU_ACC_PAIR(z0, z1); \
+  _x_r = GRU_ACC_PAIR(r0, r1); \
+  _x_h = GRU_ACC_PAIR(h0, h1); \
+  GRU_ROWS_ZRH_X2(GRU_ZERO_ACC, 0, 0, 0, 0) \
+  GRU_SWEEP(GRU_ROWS_ZRH_X2, p_mat_z2, p_mat_r2, p_mat_h2, row_stride2, p_prev_h, rows) \
+  GRU_ROWS_ZRH_X2(GRU_ADD_BIAS_ROW, p_bias_z, p_bias_r, p_bias_h, 0) \
+  _r = rnn_act_sigmoid_32x2_q15(AE_ADD32S(_x_r, GRU_ACC_PAIR(r0, r1))); \
+  _x_h = AE_ADD32S(_x_h, AE_MULFP32X16X2RS_H(GRU_ACC_PAIR(h0, h1), AE_SAT16X4(_r, _r))); \
+  z_q15 = rnn_act_sigmoid_32x2_q15(AE_ADD32S(_x_z, GRU_ACC_PAIR(z0, z1))); \
+  h_q31 = rnn_act_tanh_32x2_q31(_x_h); \
+}
+
+#define GRU_CELL_ARG_CHK(mat_align) \
+  /* NULL pointer checks */ \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_prev_h, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_mat_z1, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_mat_r1, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_mat_h1, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_mat_z2, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_mat_r2, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_mat_h2, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_vec, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_bias_z, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_bias_r, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_bias_h, -1); \
+  /* Pointer alignment checks */ \
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_prev_h, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat_z1, mat_align, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat_r1, mat_align, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat_h1, mat_align, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat_z2, mat_align, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat_r2, mat_align, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat_h2, mat_align, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias_z, sizeof(WORD16), -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias_r, sizeof(WORD16), -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias_h, sizeof(WORD16), -1); \
+  /* Basic Parameter checks */ \
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1); \
+  XA_NNLIB_ARG_CHK_COND((row_stride2 < rows), -1); \
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1); \
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1); \
+  XA_NNLIB_ARG_CHK_COND((tanh_lsh < -15 || tanh_lsh > 15), -1); \
+  /* Implementation dependent checks */ \
+  XA_NNLIB_ARG_CHK_COND(((rows&3) != 0), -1); \
+  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1); \
+  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1); \
+  XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1); \
+  if(p_bias_sz != NULL) \
+  { \
+    XA_NNLIB_ARG_CHK_PTR(p_bias_sr, -1); \
+    XA_NNLIB_ARG_CHK_PTR(p_bias_sh, -1); \
+    XA_NNLIB_ARG_CHK_ALIGN(p_bias_sz, sizeof(WORD16), -1); \
+    XA_NNLIB_ARG_CHK_ALIGN(p_bias_sr, sizeof(WORD16), -1); \
+    XA_NNLIB_ARG_CHK_ALIGN(p_bias_sh, sizeof(WORD16), -1); \
+  } \
+  else \
+  { \
+    XA_NNLIB_ARG_CHK_PTR(p_scratch, -1); \
+    XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1); \
+  }
+
+#define GRU_CELL_BODY \
+  if(p_bias_sz == NULL) \
+  { \
+    for(m_itr = 0; m_itr < rows; m_itr += 4) \
+    { \
+      m_row = m_itr; \
+      GRU_ROWS_ZR_X4(GRU_ZERO_ACC, 0, 0, 0, 0) \
+      GRU_SWEEP(GRU_ROWS_ZR_X4, p_mat_z1, p_mat_r1, 0, row_stride1, p_vec, cols1) \
+      GRU_SWEEP(GRU_ROWS_ZR_X4, p_mat_z2, p_mat_r2, 0, row_stride2, p_prev_h, rows) \
+      GRU_ROWS_ZR_X4(GRU_ADD_BIAS_ROW, p_bias_z, p_bias_r, 0, 0) \
+      GRU_ZR_EPILOGUE_X4 \
+    } \
+    for(m_itr = 0; m_itr < rows; m_itr += 4) \
+    { \
+      m_row = m_itr; \
+      GRU_ROWS_H_X4(GRU_ZERO_ACC, 0, 0, 0, 0) \
+      GRU_SWEEP(GRU_ROWS_H_X4, 0, 0, p_mat_h1, row_stride1, p_vec, cols1) \
+      GRU_SWEEP(GRU_ROWS_H_X4, 0, 0, p_mat_h2, row_stride2, p_scratch, rows) \
+      GRU_ROWS_H_X4(GRU_ADD_BIAS_ROW, 0, 0, p_bias_h, 0) \
+      GRU_H_EPILOGUE_X4 \
+    } \
+  } \
+  else \
+  { \
+    ae_int32x2 _z_0, _z_1, _h_0, _h_1; \
+    ae_int16x4 _z, _h, _h_prev, _y; \
+    for(m_itr = 0; m_itr < rows; m_itr += 4) \
+    { \
+      m_row = m_itr; \
+      GRU_SPLIT_X2(_z_0, _h_0) \
+      m_row = m_itr + 2; \
+      GRU_SPLIT_X2(_z_1, _h_1) \
+      _z = AE_SAT16X4(_z_0, _z_1); \
+      _h = AE_ROUND16X4F32SASYM(_h_0, _h_1); \
+      _h_prev = *(ae_int16x4 *)&p_prev_h[m_itr]; \
+      GRU_INTERPOLATE(_y, _z, _h, _h_prev); \
+      *(ae_int16x4 *)&p_out[m_itr] = _y; \
+    } \
+    /* prev_h is read by every row above, update it only at the end */ \
+    for(m_itr = 0; m_itr < rows; m_itr += 4) \
+    { \
+      *(ae_int16x4 *)&p_prev_h[m_itr] = *(ae_int16x4 *)&p_out[m_itr]; \
+    } \
+  }
+
+WORD32 xa_nn_matXvec_16x16_16_gru_cell(
+    WORD16 * __restrict__ p_out,           /* output: new hidden state, rows x 1 */
+    WORD16 * __restrict__ p_prev_h,        /* previous hidden state, updated with p_out */
+    WORD16 * __restrict__ p_mat_z1,        /* input weights of z, r, h: rows x cols1 */
+    WORD16 * __restrict__ p_mat_r1,
+    WORD16 * __restrict__ p_mat_h1,
+    WORD16 * __restrict__ p_mat_z2,        /* recurrent weights of z, r, h: rows x rows */
+    WORD16 * __restrict__ p_mat_r2,
+    WORD16 * __restrict__ p_mat_h2,
+    WORD16 * __restrict__ p_vec,           /* input: cols1 x 1 */
+    WORD16 * __restrict__ p_bias_z,        /* biases of z, r, h (recurrent side if split) */
+    WORD16 * __restrict__ p_bias_r,
+    WORD16 * __restrict__ p_bias_h,
+    WORD16 * __restrict__ p_bias_sz,       /* input side biases of z, r, h, NULL if not split */
+    WORD16 * __restrict__ p_bias_sr,
+    WORD16 * __restrict__ p_bias_sh,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,                    /* row stride for input weights */
+    WORD32 row_stride2,                    /* row stride for recurrent weights */
+    WORD32 acc_shift,                        /* out accumulator shift amount */
+    WORD32 bias_shift,                       /* bias shift amount */
+    WORD32 tanh_lsh,                         /* Q15 to output Q format shift of h' */
+    WORD16 * __restrict__ p_scratch)       /* rows x 1, unused with split biases */
+{
+  GRU_CELL_ARG_CHK(ALIGNMENT);
+
+  /* Iterators used in for loops */
+  int m_itr, m_row, c_itr;
+  ae_int64 _ae_int64_acc_z0, _ae_int64_acc_z1, _ae_int64_acc_z2, _ae_int64_acc_z3;
+  ae_int64 _ae_int64_acc_r0, _ae_int64_acc_r1, _ae_int64_acc_r2, _ae_int64_acc_r3;
+  ae_int64 _ae_int64_acc_h0, _ae_int64_acc_h1, _ae_int64_acc_h2, _ae_int64_acc_h3;
+
+#define GRU_MAT_T                 ae_int16x4
+#define GRU_LOAD_ROW(m, p)        AE_L16X4_IP(m, p, INCREMENT_IN_BYTES_FOR_INT16X4)
+#define GRU_ACC_SCALE(acc)        (acc)
+
+  ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD16, WORD16, WORD32);
+
+  GRU_CELL_BODY
+
+#undef GRU_MAT_T
+#undef GRU_LOAD_ROW
+#undef GRU_ACC_SCALE
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_8x16_16_gru_cell(
+    WORD16 * __restrict__ p_out,     /* output: new hidden state, rows x 1 */
+    WORD16 * __restrict__ p_prev_h,  /* previous hidden state, updated with p_out */
+    WORD8  * __restrict__ p_mat_z1,  /* input weights of z, r, h: rows x cols1 */
+    WORD8  * __restrict__ p_mat_r1,
+    WORD8  * __restrict__ p_mat_h1,
+    WORD8  * __restrict__ p_mat_z2,  /* recurrent weights of z, r, h: rows x rows */
+    WORD8  * __restrict__ p_mat_r2,
+    WORD8  * __restrict__ p_mat_h2,
+    WORD16 * __restrict__ p_vec,     /* input: cols1 x 1 */
+    WORD16 * __restrict__ p_bias_z,  /* biases of z, r, h (recurrent side if split) */
+    WORD16 * __restrict__ p_bias_r,
+    WORD16 * __restrict__ p_bias_h,
+    WORD16 * __restrict__ p_bias_sz, /* input side biases of z, r, h, NULL if not split */
+    WORD16 * __restrict__ p_bias_sr,
+    WORD16 * __restrict__ p_bias_sh,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,              /* row stride for input weights */
+    WORD32 row_stride2,              /* row stride for recurrent weights */
+    WORD32 acc_shift,                  /* out accumulator shift amount */
+    WORD32 bias_shift,                 /* bias shift amount */
+    WORD32 tanh_lsh,                   /* Q15 to output Q format shift of h' */
+    WORD16 * __restrict__ p_scratch) /* rows x 1, unused with split biases */
+{
+  GRU_CELL_ARG_CHK((ALIGNMENT>>1));
+
+  /* Iterators used in for loops */
+  int m_itr, m_row, c_itr;
+  ae_int64 _ae_int64_acc_z0, _ae_int64_acc_z1, _ae_int64_acc_z2, _ae_int64_acc_z3;
+  ae_int64 _ae_int64_acc_r0, _ae_int64_acc_r1, _ae_int64_acc_r2, _ae_int64_acc_r3;
+  ae_int64 _ae_int64_acc_h0, _ae_int64_acc_h1, _ae_int64_acc_h2, _ae_int64_acc_h3;
+
+#define GRU_MAT_T                 WORD8
+#define GRU_LOAD_ROW(m, p)        AE_L8X4F_IP(m, p, INCREMENT_IN_BYTES_FOR_WORD8X4)
+#define GRU_ACC_SCALE(acc)        AE_SRAI64(acc, 8)
+
+  ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD16, WORD32);
+
+  GRU_CELL_BODY
+
+#undef GRU_MAT_T
+#undef GRU_LOAD_ROW
+#undef GRU_ACC_SCALE
+
+  return 0;
+}
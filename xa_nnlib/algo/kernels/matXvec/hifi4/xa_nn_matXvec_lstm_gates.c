@@ -0,0 +1,331 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros.h"
+#include "xa_nn_matXvec_rnn_act.h"
+
+/*
+ * Fused LSTM gate kernels.
+ *
+ * Weights and biases are gate-interleaved: row (4*r + g) of p_mat1/p_mat2
+ * and element (4*r + g) of p_bias belong to output row r of gate g, with
+ * gates ordered f, i, c, o. The two output rows of all four gates are
+ * accumulated in one sweep over p_vec1/p_vec2, and sigmoid (f, i, o) or
+ * tanh (c) is applied on the accumulators before they are stored.
+ *
+ * p_out holds four planes of 'rows' elements each, in order f, i, c, o.
+ */
+
+#define LSTM_GATE_F 0
+#define LSTM_GATE_I 1
+#define LSTM_GATE_C 2
+#define LSTM_GATE_O 3
+#define LSTM_NUM_GATES 4
+
+/* Two output rows are processed together, i.e. 8 interleaved weight rows */
+#define LSTM_GATES_X2(M) M(0) M(1) M(2) M(3) M(4) M(5) M(6) M(7)
+#define LSTM_GATES_X1(M) M(0) M(1) M(2) M(3)
+
+#define LSTM_GATES_ADD_BIAS_16b(idx) \
+  _ae_int64_acc_ ## idx = AE_ADD64S(_ae_int64_acc_ ## idx, \
+      AE_SLAA64S(((ae_int64) ((ae_int16 *)p_bias)[m_itr + idx]), bias_shift)); \
+
+#define LSTM_GATES_ADD_BIAS_16b_FOR_8bx16b(idx) \
+  _ae_int64_acc_ ## idx = AE_SRAI64(_ae_int64_acc_ ## idx, 8); \
+  LSTM_GATES_ADD_BIAS_16b(idx) \
+
+/* Q6.25 pre-activations of two rows for one gate */
+#define LSTM_GATES_ACC_PAIR(idx0, idx1) \
+  AE_ROUND32X2F64SSYM(AE_SLAA64S(_ae_int64_acc_ ## idx0, acc_shift), \
+                      AE_SLAA64S(_ae_int64_acc_ ## idx1, acc_shift))
+
+#define LSTM_GATES_STORE_PAIR(gate, y) \
+{ \
+  ae_int16 *_p_out = (ae_int16 *)&p_out[(gate) * rows + (m_itr >> 2)]; \
+  *_p_out++ = AE_SEL16_6543(y, y); \
+  *_p_out   = y; \
+}
+
+#define LSTM_GATES_STORE_ONE(gate, y) \
+  *(ae_int16 *)&p_out[(gate) * rows + (m_itr >> 2)] = y;
+
+/* Activations for two rows; accumulators 0-3 are row 0 and 4-7 are row 1 */
+#define LSTM_GATES_ACTIVATE_AND_STORE_X2 \
+{ \
+  ae_int16x4 _y; \
+  _y = rnn_act_sigmoid_32x2(LSTM_GATES_ACC_PAIR(0, 4)); \
+  LSTM_GATES_STORE_PAIR(LSTM_GATE_F, _y); \
+  _y = rnn_act_sigmoid_32x2(LSTM_GATES_ACC_PAIR(1, 5)); \
+  LSTM_GATES_STORE_PAIR(LSTM_GATE_I, _y); \
+  _y = rnn_act_tanh_32x2(LSTM_GATES_ACC_PAIR(2, 6)); \
+  LSTM_GATES_STORE_PAIR(LSTM_GATE_C, _y); \
+  _y = rnn_act_sigmoid_32x2(LSTM_GATES_ACC_PAIR(3, 7)); \
+  LSTM_GATES_STORE_PAIR(LSTM_GATE_O, _y); \
+}
+
+/* Activations for the last row; f and i, c and o share a register pair */
+#define LSTM_GATES_ACTIVATE_AND_STORE_X1 \
+{ \
+  ae_int16x4 _y; \
+  _y = rnn_act_sigmoid_32x2(LSTM_GATES_ACC_PAIR(0, 1)); \
+  LSTM_GATES_STORE_ONE(LSTM_GATE_I, _y); \
+  _y = AE_SEL16_6543(_y, _y); \
+  LSTM_GATES_STORE_ONE(LSTM_GATE_F, _y); \
+  _y = rnn_act_tanh_32x2(LSTM_GATES_ACC_PAIR(2, 2)); \
+  LSTM_GATES_STORE_ONE(LSTM_GATE_C, _y); \
+  _y = rnn_act_sigmoid_32x2(LSTM_GATES_ACC_PAIR(3, 3)); \
+  LSTM_GATES_STORE_ONE(LSTM_GATE_O, _y); \
+}
+
+WORD32 xa_nn_matXvec_16x16_16_lstm_gates(
+    WORD16 * __restrict__ p_out,           /* output: 4 planes of rows (f, i, c, o) */
+    WORD16 * __restrict__ p_mat1,          /* matrix1: (4 * rows) x cols1, gate-interleaved */
+    WORD16 * __restrict__ p_mat2,          /* matrix2: (4 * rows) x cols2, gate-interleaved */
+    WORD16 * __restrict__ p_vec1,          /* vec1: cols1 x 1 */
+    WORD16 * __restrict__ p_vec2,          /* vec2: cols2 x 1 */
+    WORD16 * __restrict__ p_bias,          /* bias: 4 * rows, gate-interleaved */
+    WORD32 rows,                           /* rows per gate */
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,                    /* row stride for matrix1 */
+    WORD32 row_stride2,                    /* row stride for matrix2 */
+    WORD32 acc_shift,                        /* out accumulator shift amount */
+    WORD32 bias_shift)                       /* bias shift amount */
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
+
+  if(p_mat2 != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_vec2, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat2, ALIGNMENT, -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec2, ALIGNMENT, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
+    /* Implementation dependent checks */
+    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
+    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
+  }
+
+  /* Iterators used in for loops, m_itr walks the interleaved weight rows */
+  int m_itr, c_itr;
+  int rows_itr = 4 * rows;
+
+#define UNROLL_SETUP_ACC          SETUP_ACC_FOR_16bx16b
+#define UNROLL_SETUP_MAT1         SETUP_MAT1_16b
+#define UNROLL_SETUP_MAT2         SETUP_MAT2_16b
+#define UNROLL_KERNEL_MAT1_VEC1   KERNEL_MAT1_VEC1_16b_16b
+#define UNROLL_KERNEL_MAT2_VEC2   KERNEL_MAT2_VEC2_16b_16b
+#define UNROLL_ADD_BIAS_ACC       LSTM_GATES_ADD_BIAS_16b
+#define SETUP_VEC1                SETUP_VEC1_16b
+#define SETUP_VEC2                SETUP_VEC2_16b
+#define LOAD_VEC1                 LOAD_VEC1_16b
+#define LOAD_VEC2                 LOAD_VEC2_16b
+
+  ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD16, WORD16, WORD32);
+
+  for(m_itr = 0; m_itr < (rows_itr & ~(2 * LSTM_NUM_GATES - 1)); m_itr += 2 * LSTM_NUM_GATES)
+  {
+    LSTM_GATES_X2(UNROLL_SETUP_ACC); SETUP_VEC1; LSTM_GATES_X2(UNROLL_SETUP_MAT1);
+    for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+    {
+      LOAD_VEC1; LSTM_GATES_X2(UNROLL_KERNEL_MAT1_VEC1);
+    }
+    if(p_mat2 && p_vec2)
+    {
+      SETUP_VEC2; LSTM_GATES_X2(UNROLL_SETUP_MAT2);
+      for(c_itr = 0; c_itr < (cols2 >> 2); c_itr++)
+      {
+        LOAD_VEC2; LSTM_GATES_X2(UNROLL_KERNEL_MAT2_VEC2);
+      }
+    }
+    LSTM_GATES_X2(UNROLL_ADD_BIAS_ACC);
+    LSTM_GATES_ACTIVATE_AND_STORE_X2;
+  }
+  if(m_itr < rows_itr)
+  {
+    LSTM_GATES_X1(UNROLL_SETUP_ACC); SETUP_VEC1; LSTM_GATES_X1(UNROLL_SETUP_MAT1);
+    for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+    {
+      LOAD_VEC1; LSTM_GATES_X1(UNROLL_KERNEL_MAT1_VEC1);
+    }
+    if(p_mat2 && p_vec2)
+    {
+      SETUP_VEC2; LSTM_GATES_X1(UNROLL_SETUP_MAT2);
+      for(c_itr = 0; c_itr < (cols2 >> 2); c_itr++)
+      {
+        LOAD_VEC2; LSTM_GATES_X1(UNROLL_KERNEL_MAT2_VEC2);
+      }
+    }
+    LSTM_GATES_X1(UNROLL_ADD_BIAS_ACC);
+    LSTM_GATES_ACTIVATE_AND_STORE_X1;
+  }
+
+#undef UNROLL_SETUP_ACC
+#undef UNROLL_SETUP_MAT1
+#undef UNROLL_SETUP_MAT2
+#undef UNROLL_KERNEL_MAT1_VEC1
+#undef UNROLL_KERNEL_MAT2_VEC2
+#undef UNROLL_ADD_BIAS_ACC
+#undef SETUP_VEC1
+#undef SETUP_VEC2
+#undef LOAD_VEC1
+#undef LOAD_VEC2
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_8x16_16_lstm_gates(
+    WORD16 * __restrict__ p_out,     /* output: 4 planes of rows (f, i, c, o) */
+    WORD8  * __restrict__ p_mat1,    /* matrix1: (4 * rows) x cols1, gate-interleaved */
+    WORD8  * __restrict__ p_mat2,    /* matrix2: (4 * rows) x cols2, gate-interleaved */
+    WORD16 * __restrict__ p_vec1,    /* vec1: cols1 x 1 */
+    WORD16 * __restrict__ p_vec2,    /* vec2: cols2 x 1 */
+    WORD16 * __restrict__ p_bias,    /* bias: 4 * rows, gate-interleaved */
+    WORD32 rows,                     /* rows per gate */
+    WORD32 cols1,
+    WORD32 cols2,
+    WORD32 row_stride1,              /* row stride for matrix1 */
+    WORD32 row_stride2,              /* row stride for matrix2 */
+    WORD32 acc_shift,                  /* out accumulator shift amount */
+    WORD32 bias_shift)                 /* bias shift amount */
+{
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_bias, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, (ALIGNMENT>>1), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, ALIGNMENT, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((acc_shift < -31 || acc_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((bias_shift < -31 || bias_shift > 31), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
+
+  if(p_mat2 != NULL)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_vec2, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat2, (ALIGNMENT>>1), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec2, ALIGNMENT, -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((cols2 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride2 < cols2), -1);
+    /* Implementation dependent checks */
+    XA_NNLIB_ARG_CHK_COND(((cols2&3) != 0), -1);
+    XA_NNLIB_ARG_CHK_COND(((row_stride2&3) != 0), -1);
+  }
+
+  /* Iterators used in for loops, m_itr walks the interleaved weight rows */
+  int m_itr, c_itr;
+  int rows_itr = 4 * rows;
+
+#define UNROLL_SETUP_ACC          SETUP_ACC_FOR_8bx16b
+#define UNROLL_SETUP_MAT1         SETUP_MAT1_8b
+#define UNROLL_SETUP_MAT2         SETUP_MAT2_8b
+#define UNROLL_KERNEL_MAT1_VEC1   KERNEL_MAT1_VEC1_8b_16b
+#define UNROLL_KERNEL_MAT2_VEC2   KERNEL_MAT2_VEC2_8b_16b
+#define UNROLL_ADD_BIAS_ACC       LSTM_GATES_ADD_BIAS_16b_FOR_8bx16b
+#define SETUP_VEC1                SETUP_VEC1_16b
+#define SETUP_VEC2                SETUP_VEC2_16b
+#define LOAD_VEC1                 LOAD_VEC1_16b
+#define LOAD_VEC2                 LOAD_VEC2_16b
+
+  ADJUST_ACC_LSH_AND_BIAS_LSH_AxB_C(WORD8, WORD16, WORD32);
+
+  for(m_itr = 0; m_itr < (rows_itr & ~(2 * LSTM_NUM_GATES - 1)); m_itr += 2 * LSTM_NUM_GATES)
+  {
+    LSTM_GATES_X2(UNROLL_SETUP_ACC); SETUP_VEC1; LSTM_GATES_X2(UNROLL_SETUP_MAT1);
+    for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+    {
+      LOAD_VEC1; LSTM_GATES_X2(UNROLL_KERNEL_MAT1_VEC1);
+    }
+    if(p_mat2 && p_vec2)
+    {
+      SETUP_VEC2; LSTM_GATES_X2(UNROLL_SETUP_MAT2);
+      for(c_itr = 0; c_itr < (cols2 >> 2); c_itr++)
+      {
+        LOAD_VEC2; LSTM_GATES_X2(UNROLL_KERNEL_MAT2_VEC2);
+      }
+    }
+    LSTM_GATES_X2(UNROLL_ADD_BIAS_ACC);
+    LSTM_GATES_ACTIVATE_AND_STORE_X2;
+  }
+  if(m_itr < rows_itr)
+  {
+    LSTM_GATES_X1(UNROLL_SETUP_ACC); SETUP_VEC1; LSTM_GATES_X1(UNROLL_SETUP_MAT1);
+    for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+    {
+      LOAD_VEC1; LSTM_GATES_X1(UNROLL_KERNEL_MAT1_VEC1);
+    }
+    if(p_mat2 && p_vec2)
+    {
+      SETUP_VEC2; LSTM_GATES_X1(UNROLL_SETUP_MAT2);
+      for(c_itr = 0; c_itr < (cols2 >> 2); c_itr++)
+      {
+        LOAD_VEC2; LSTM_GATES_X1(UNROLL_KERNEL_MAT2_VEC2);
+      }
+    }
+    LSTM_GATES_X1(UNROLL_ADD_BIAS_ACC);
+    LSTM_GATES_ACTIVATE_AND_STORE_X1;
+  }
+
+#undef UNROLL_SETUP_ACC
+#undef UNROLL_SETUP_MAT1
+#undef UNROLL_SETUP_MAT2
+#undef UNROLL_KERNEL_MAT1_VEC1
+#undef UNROLL_KERNEL_MAT2_VEC2
+#undef UNROLL_ADD_BIAS_ACC
+#undef SETUP_VEC1
+#undef SETUP_VEC2
+#undef LOAD_VEC1
+#undef LOAD_VEC2
+
+  return 0;
+}
@@ -0,0 +1,124 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XA_NN_MATXVEC_RNN_ACT_H__
+#define __XA_NN_MATXVEC_RNN_ACT_H__
+
+/*
+ * Sigmoid and tanh on a pair of 32 bit accumulators, for the fused RNN
+ * gate kernels that activate in registers instead of going through a
+ * temp buffer and the vec_*_32_16 kernels.
+ */
+
+static const int32_t rnn_act_polypow2[] = { 14685184, -114217216 , 514075392, -1488269056, 2147483647 };// coefficients in q31 format
+
+/* Register version of xa_nn_vec_sigmoid_32_16(): Q6.25 in, Q0.15 in 32 bit lanes out */
+static inline ae_int32x2 rnn_act_sigmoid_32x2_q15(ae_int32x2 x)
+{
+  ae_int32x2 X, X0, X1, E, Y, Z, D;
+  ae_f32x2 t;
+  xtbool2 sign;
+
+  sign = AE_LT32(x, 0);
+
+  Z = AE_MULFP32X2RAS(x, AE_MOVDA32X2(774541002, 774541002));
+  X = AE_ABS32S(Z);
+
+  E = AE_SRAI32(X, 23);
+  X = AE_AND32(X, AE_MOVDA32X2(0x007fffff, 0x007fffff));
+  X = AE_SLAI32S(X, 8);
+
+  Y = AE_L32_I((const ae_int32 *)rnn_act_polypow2, 4 * 0);
+  t = AE_L32_I((const ae_int32 *)rnn_act_polypow2, 4 * 1); AE_MULAFP32X2RAS(t, X, Y); Y = t;
+  t = AE_L32_I((const ae_int32 *)rnn_act_polypow2, 4 * 2); AE_MULAFP32X2RAS(t, X, Y); Y = t;
+  t = AE_L32_I((const ae_int32 *)rnn_act_polypow2, 4 * 3); AE_MULAFP32X2RAS(t, X, Y); Y = t;
+  t = AE_L32_I((const ae_int32 *)rnn_act_polypow2, 4 * 4); AE_MULAFP32X2RAS(t, X, Y); Y = t;
+  X0 = AE_SRAA32RS(Y, AE_MOVAD32_H(E));
+  X1 = AE_SRAA32RS(Y, AE_MOVAD32_L(E));
+  X = AE_SEL32_HL(X0, X1);
+
+  Z = AE_SUB32(2061584302, AE_SRAI32(X, 1));
+  t = AE_SUB32(2147483647, Z);AE_MULSFP32X2RAS(t, Z, X);D = t;
+  AE_MULAFP32X2RAS(Z, Z, D);
+  t = AE_SUB32(2147483647, Z);AE_MULSFP32X2RAS(t, Z, X);D = t;
+  AE_MULAFP32X2RAS(Z, Z, D);
+
+  Z = AE_SRAA32RS(Z, 16);
+
+  Y = AE_SUB32(32768, Z);
+  AE_MOVT32X2(Z, Y, sign);
+
+  return Z;
+}
+
+/* Register version of xa_nn_vec_tanh_32_16(): Q6.25 in, Q0.31 out */
+static inline ae_int32x2 rnn_act_tanh_32x2_q31(ae_int32x2 x)
+{
+  ae_int32x2 X, X0, X1, E, Y, Z, D;
+  ae_f32x2 t;
+  xtbool2 sign;
+
+  sign = AE_LT32(x, 0);
+
+  Z = AE_MULFP32X2RAS(x, AE_MOVDA32X2(1549082005, 1549082005));
+  X = AE_ABS32S(Z);
+
+  E = AE_SRAI32(X, 23);
+  X = AE_AND32(X, AE_MOVDA32X2(0x007fffff, 0x007fffff));
+  X = AE_SLAI32S(X, 8);
+
+  Y = AE_L32_I((const ae_int32 *)rnn_act_polypow2, 4 * 0);
+  t = AE_L32_I((const ae_int32 *)rnn_act_polypow2, 4 * 1); AE_MULAFP32X2RAS(t, X, Y); Y = t;
+  t = AE_L32_I((const ae_int32 *)rnn_act_polypow2, 4 * 2); AE_MULAFP32X2RAS(t, X, Y); Y = t;
+  t = AE_L32_I((const ae_int32 *)rnn_act_polypow2, 4 * 3); AE_MULAFP32X2RAS(t, X, Y); Y = t;
+  t = AE_L32_I((const ae_int32 *)rnn_act_polypow2, 4 * 4); AE_MULAFP32X2RAS(t, X, Y); Y = t;
+  X0 = AE_SRAA32RS(Y, AE_MOVAD32_H(E));
+  X1 = AE_SRAA32RS(Y, AE_MOVAD32_L(E));
+  X = AE_SEL32_HL(X0, X1);
+
+  Z = AE_SUB32(2061584302, AE_SRAI32(X, 1));
+  t = AE_SUB32(2147483647, Z);AE_MULSFP32X2RAS(t, Z, X);D = t;
+  AE_MULAFP32X2RAS(Z, Z, D);
+  t = AE_SUB32(2147483647, Z);AE_MULSFP32X2RAS(t, Z, X);D = t;
+  AE_MULAFP32X2RAS(Z, Z, D);
+  Y = AE_SUB32(2147483647, X);
+  Z = AE_MULFP32X2RAS(Z, Y);
+
+  X = AE_NEG32S(Z);
+  AE_MOVT32X2(Z, X, sign);
+
+  return Z;
+}
+
+/* Q0.15 results of one pair, replicated in both halves */
+static inline ae_int16x4 rnn_act_sigmoid_32x2(ae_int32x2 x)
+{
+  ae_int32x2 y = rnn_act_sigmoid_32x2_q15(x);
+  return AE_SAT16X4(y, y);
+}
+
+static inline ae_int16x4 rnn_act_tanh_32x2(ae_int32x2 x)
+{
+  ae_int32x2 y = rnn_act_tanh_32x2_q31(x);
+  return AE_ROUND16X4F32SASYM(y, y);
+}
+
+#endif /* __XA_NN_MATXVEC_RNN_ACT_H__ */
@@ -1504,6 +1504,9 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s(
     }else if((uintptr_t)p_vec2%4 == 0){
       mat2vec2_4R1C_dotprod_func = _xa_nn_dot_product_4_rows_1_vec_mat_unaligned_vec_aligned;
     }
+    XA_NNLIB_PATH_COUNT(XA_NN_PATH_MATXVEC_SYM8SXASYM8S,
+        (mat1vec1_4R1C_dotprod_func == _xa_nn_dot_product_4_rows_1_vec_mat_aligned_vec_aligned) &&
+        (mat2vec2_4R1C_dotprod_func == _xa_nn_dot_product_4_rows_1_vec_mat_aligned_vec_aligned));
 
     ae_int32x2 out_01 = 0, out_23 = 0;
 #if XCHAL_HAVE_HIFI1
@@ -1612,6 +1615,8 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s(
       const WORD8 *p_mat1_0;
       const WORD8 *p_vec1_0;
 
+      XA_NNLIB_PATH_COUNT(XA_NN_PATH_MATXVEC_SYM8SXASYM8S, 1);
+
       for(m_itr = 0; m_itr < (rows & ~7); m_itr += 8)
       {
         ae_int32x2 acc_row0_vec0 = ZERO32;
@@ -1760,6 +1765,7 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s(
     ae_valign align_out = AE_ZALIGN64();
     ae_int16x4 rowvec01;
 #endif
+      XA_NNLIB_PATH_COUNT(XA_NN_PATH_MATXVEC_SYM8SXASYM8S, 0);
     
       for(m_itr = 0; m_itr < (rows); m_itr += 4)
       {
@@ -1821,6 +1827,7 @@ WORD32 xa_nn_matXvec_sym8sxasym8s_asym8s(
     ae_valign align_out = AE_ZALIGN64();
     ae_int16x4 rowvec01;
 #endif
+      XA_NNLIB_PATH_COUNT(XA_NN_PATH_MATXVEC_SYM8SXASYM8S, 0);
     
       for(m_itr = 0; m_itr < (rows & ~(4 - 1)); m_itr += 4)
       {
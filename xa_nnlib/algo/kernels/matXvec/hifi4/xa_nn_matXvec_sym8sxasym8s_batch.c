@@ -0,0 +1,409 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros.h"
+
+/* Weight-stationary batched matXvec for 8-bit TFLite inputs.
+ *
+ * Rows are processed in blocks of 2 and every block is multiplied with the
+ * input vectors 4 at a time (2 rows x 4 vectors of accumulators), so each
+ * weight load is used by 4 vectors and each vector load by 2 rows. Vectors
+ * are walked in chunks of BATCH_VEC_CHUNK; the whole matrix is streamed
+ * once per chunk instead of once per vector.
+ *
+ * Both operands are loaded with AE_L8X4F (value << 8), so the inner loop has
+ * no sign extension or zero bias adds. The zero bias terms are applied
+ * through row and column sums:
+ *   sum((m + mzb) * (v + vzb)) = sum(m*v) + vzb*sum(m) + mzb*sum(v) + cols*mzb*vzb
+ * vzb*sum(m) only depends on the weights and is computed once per row block,
+ * mzb*sum(v) only depends on the inputs and is computed once per chunk.
+ */
+
+#define BATCH_VEC_CHUNK 32
+
+/* Dot products of 2 rows with 4 vectors, 4 columns per iteration.
+ * out_v holds rows (0, 1) of vector v. */
+static inline void _xa_nn_dot_product_2_rows_4_vecs_batch
+    (ae_int32x2*  out_0
+    ,ae_int32x2*  out_1
+    ,ae_int32x2*  out_2
+    ,ae_int32x2*  out_3
+    ,const WORD8* p_mat_0
+    ,const WORD8* p_vec_0
+    ,const WORD8* p_vec_1
+    ,const WORD8* p_vec_2
+    ,const WORD8* p_vec_3
+    ,WORD32       cols1
+    ,WORD32       row_stride1)
+{
+  int c_itr;
+  ae_int16x4 d_mat0, d_mat1;
+  ae_int16x4 d_vec0, d_vec1, d_vec2, d_vec3;
+  ae_int64 acc_0_0 = ZERO64, acc_1_0 = ZERO64;
+  ae_int64 acc_0_1 = ZERO64, acc_1_1 = ZERO64;
+  ae_int64 acc_0_2 = ZERO64, acc_1_2 = ZERO64;
+  ae_int64 acc_0_3 = ZERO64, acc_1_3 = ZERO64;
+
+  WORD8 *p_mat0 = (WORD8 *)p_mat_0;
+  WORD8 *p_mat1 = p_mat0 + row_stride1;
+  WORD8 *p_vec0 = (WORD8 *)p_vec_0;
+  WORD8 *p_vec1 = (WORD8 *)p_vec_1;
+  WORD8 *p_vec2 = (WORD8 *)p_vec_2;
+  WORD8 *p_vec3 = (WORD8 *)p_vec_3;
+
+#pragma loop_count min=1
+  for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+  {
+    AE_L8X4F_IP(d_mat0, p_mat0, 4);
+    AE_L8X4F_IP(d_mat1, p_mat1, 4);
+    AE_L8X4F_IP(d_vec0, p_vec0, 4);
+    AE_L8X4F_IP(d_vec1, p_vec1, 4);
+    AE_L8X4F_IP(d_vec2, p_vec2, 4);
+    AE_L8X4F_IP(d_vec3, p_vec3, 4);
+
+    AE_MULAAAAQ16(acc_0_0, d_mat0, d_vec0);
+    AE_MULAAAAQ16(acc_1_0, d_mat1, d_vec0);
+    AE_MULAAAAQ16(acc_0_1, d_mat0, d_vec1);
+    AE_MULAAAAQ16(acc_1_1, d_mat1, d_vec1);
+    AE_MULAAAAQ16(acc_0_2, d_mat0, d_vec2);
+    AE_MULAAAAQ16(acc_1_2, d_mat1, d_vec2);
+    AE_MULAAAAQ16(acc_0_3, d_mat0, d_vec3);
+    AE_MULAAAAQ16(acc_1_3, d_mat1, d_vec3);
+  }
+
+  /* Both operands carried a factor of 256 */
+  *out_0 = AE_SEL32_LL(AE_MOVINT32X2_FROMINT64(AE_SRAI64(acc_0_0, 16)), AE_MOVINT32X2_FROMINT64(AE_SRAI64(acc_1_0, 16)));
+  *out_1 = AE_SEL32_LL(AE_MOVINT32X2_FROMINT64(AE_SRAI64(acc_0_1, 16)), AE_MOVINT32X2_FROMINT64(AE_SRAI64(acc_1_1, 16)));
+  *out_2 = AE_SEL32_LL(AE_MOVINT32X2_FROMINT64(AE_SRAI64(acc_0_2, 16)), AE_MOVINT32X2_FROMINT64(AE_SRAI64(acc_1_2, 16)));
+  *out_3 = AE_SEL32_LL(AE_MOVINT32X2_FROMINT64(AE_SRAI64(acc_0_3, 16)), AE_MOVINT32X2_FROMINT64(AE_SRAI64(acc_1_3, 16)));
+}
+
+/* vzb*sum(m) for 2 rows, row 0 in the high half */
+static inline ae_int32x2 _xa_nn_row_sums_2_rows
+    (const WORD8* p_mat_0
+    ,WORD32       cols1
+    ,WORD32       row_stride1
+    ,WORD32       vec_zero_bias)
+{
+  int c_itr;
+  ae_int16x4 d_mat0, d_mat1;
+  ae_int16x4 d_vzb = AE_MOVDA16(vec_zero_bias);
+  ae_int64 sum_0 = ZERO64, sum_1 = ZERO64;
+
+  WORD8 *p_mat0 = (WORD8 *)p_mat_0;
+  WORD8 *p_mat1 = p_mat0 + row_stride1;
+
+#pragma loop_count min=1
+  for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+  {
+    AE_L8X4F_IP(d_mat0, p_mat0, 4);
+    AE_L8X4F_IP(d_mat1, p_mat1, 4);
+    AE_MULAAAAQ16(sum_0, d_mat0, d_vzb);
+    AE_MULAAAAQ16(sum_1, d_mat1, d_vzb);
+  }
+
+  return AE_SEL32_LL(AE_MOVINT32X2_FROMINT64(AE_SRAI64(sum_0, 8)), AE_MOVINT32X2_FROMINT64(AE_SRAI64(sum_1, 8)));
+}
+
+/* mzb*sum(v) for one vector */
+static inline WORD32 _xa_nn_vec_sum_batch
+    (const WORD8* p_vec_0
+    ,WORD32       cols1
+    ,WORD32       mat_zero_bias)
+{
+  int c_itr;
+  ae_int16x4 d_vec;
+  ae_int16x4 d_mzb = AE_MOVDA16(mat_zero_bias);
+  ae_int64 sum = ZERO64;
+
+  WORD8 *p_vec = (WORD8 *)p_vec_0;
+
+#pragma loop_count min=1
+  for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+  {
+    AE_L8X4F_IP(d_vec, p_vec, 4);
+    AE_MULAAAAQ16(sum, d_vec, d_mzb);
+  }
+
+  return AE_MOVAD32_L(AE_MOVINT32X2_FROMINT64(AE_SRAI64(sum, 8)));
+}
+
+/* Complete dot product of one row with one vector including zero biases */
+static inline WORD32 _xa_nn_dot_product_1_row_1_vec_batch
+    (const WORD8* p_mat_0
+    ,const WORD8* p_vec_0
+    ,WORD32       cols1
+    ,WORD32       mat_zero_bias
+    ,WORD32       vec_zero_bias)
+{
+  int c_itr;
+  ae_int16x4 d_mat, d_vec;
+  ae_int16x4 d_mzb = AE_MOVDA16(mat_zero_bias);
+  ae_int16x4 d_vzb = AE_MOVDA16(vec_zero_bias);
+  ae_int64 acc = ZERO64, sum_m = ZERO64, sum_v = ZERO64;
+
+  WORD8 *p_mat = (WORD8 *)p_mat_0;
+  WORD8 *p_vec = (WORD8 *)p_vec_0;
+
+#pragma loop_count min=1
+  for(c_itr = 0; c_itr < (cols1 >> 2); c_itr++)
+  {
+    AE_L8X4F_IP(d_mat, p_mat, 4);
+    AE_L8X4F_IP(d_vec, p_vec, 4);
+    AE_MULAAAAQ16(acc, d_mat, d_vec);
+    AE_MULAAAAQ16(sum_m, d_mat, d_vzb);
+    AE_MULAAAAQ16(sum_v, d_vec, d_mzb);
+  }
+
+  acc = AE_ADD64(AE_SRAI64(acc, 16), AE_ADD64(AE_SRAI64(sum_m, 8), AE_SRAI64(sum_v, 8)));
+  return AE_MOVAD32_L(AE_MOVINT32X2_FROMINT64(acc)) + cols1 * mat_zero_bias * vec_zero_bias;
+}
+
+static inline void _xa_nn_requant_store_2_rows
+    (WORD8*      p_dst
+    ,ae_int32x2  acc
+    ,WORD32      out_multiplier
+    ,WORD32      left_shift
+    ,WORD32      right_shift
+    ,WORD32      out_zero_bias)
+{
+  ae_int32x2 max_int8 = AE_MOVDA32(127);
+  ae_int32x2 min_int8 = AE_MOVDA32(-128);
+
+  MPY_BY_QUANT_MULT_SLS_X2_OUT32(acc, acc, out_multiplier, left_shift, right_shift);
+  acc = AE_ADD32S(acc, AE_MOVDA32(out_zero_bias));
+  acc = AE_MAX32(acc, min_int8);
+  acc = AE_MIN32(acc, max_int8);
+
+  p_dst[0] = (WORD8)AE_MOVAD32_H(acc);
+  p_dst[1] = (WORD8)AE_MOVAD32_L(acc);
+}
+
+static void internal_matXvec_batch_8bx8b_asym8s(
+    WORD8 ** __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 ** __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 mat1_zero_bias,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  int m_itr, vec_itr, vec_base, k;
+  ae_int32x2 max_int8 = AE_MOVDA32(127);
+  ae_int32x2 min_int8 = AE_MOVDA32(-128);
+  WORD32 zb_prod = cols1 * mat1_zero_bias * vec1_zero_bias;
+  WORD32 vec_sums[BATCH_VEC_CHUNK];
+
+  /* Shifts to match with Tensorflow */
+  int left_shift, right_shift;
+#if TFLITE_SINGLE_ROUNDING
+  left_shift = out_shift;
+  /* Single rounding macro doesn't need two shifts so this is not used */
+  (void)right_shift;
+#else /* #if TFLITE_SINGLE_ROUNDING */
+  left_shift = out_shift<0?0:out_shift;
+  right_shift = out_shift>0?0:-out_shift;
+#endif /* #if TFLITE_SINGLE_ROUNDING */
+
+  for(vec_base = 0; vec_base < vec_count; vec_base += BATCH_VEC_CHUNK)
+  {
+    const WORD8 **p_vec = p_vec1 + vec_base;
+    WORD8 **p_dst = p_out + vec_base;
+    int chunk = vec_count - vec_base;
+    chunk = chunk < BATCH_VEC_CHUNK ? chunk : BATCH_VEC_CHUNK;
+
+    /* Input only terms, shared by all row blocks */
+    for(k = 0; k < chunk; k++)
+    {
+      vec_sums[k] = (mat1_zero_bias == 0) ? 0 : _xa_nn_vec_sum_batch(p_vec[k], cols1, mat1_zero_bias);
+    }
+
+    for(m_itr = 0; m_itr < (rows & ~1); m_itr += 2)
+    {
+      const WORD8 *p_mat = p_mat1 + m_itr * row_stride1;
+      ae_int32x2 row_off;
+
+      /* Weight only terms, shared by all vectors of the chunk */
+      row_off = _xa_nn_row_sums_2_rows(p_mat, cols1, row_stride1, vec1_zero_bias);
+      row_off = AE_ADD32(row_off, AE_MOVDA32(zb_prod));
+      if(p_bias != NULL)
+      {
+        row_off = AE_ADD32(row_off, AE_MOVDA32X2(p_bias[m_itr], p_bias[m_itr + 1]));
+      }
+
+      for(vec_itr = 0; vec_itr < chunk; vec_itr += 4)
+      {
+        ae_int32x2 acc[4];
+        int idx[4];
+        /* Short last pass: missing vectors repeat the last one */
+        for(k = 0; k < 4; k++)
+        {
+          idx[k] = (vec_itr + k < chunk) ? vec_itr + k : chunk - 1;
+        }
+
+        _xa_nn_dot_product_2_rows_4_vecs_batch(&acc[0], &acc[1], &acc[2], &acc[3],
+            p_mat, p_vec[idx[0]], p_vec[idx[1]], p_vec[idx[2]], p_vec[idx[3]],
+            cols1, row_stride1);
+
+        for(k = 0; k < 4 && vec_itr + k < chunk; k++)
+        {
+          _xa_nn_requant_store_2_rows(p_dst[vec_itr + k] + m_itr,
+              AE_ADD32(AE_ADD32(acc[k], row_off), AE_MOVDA32(vec_sums[vec_itr + k])),
+              out_multiplier, left_shift, right_shift, out_zero_bias);
+        }
+      }
+    }
+  }
+
+  /* Remaining row */
+  for(m_itr = (rows & ~1); m_itr < rows; m_itr++)
+  {
+    const WORD8 *p_mat = p_mat1 + m_itr * row_stride1;
+    WORD32 bias = (p_bias != NULL) ? p_bias[m_itr] : 0;
+
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+    {
+      ae_int32x2 acc;
+      acc = AE_MOVDA32(bias + _xa_nn_dot_product_1_row_1_vec_batch(p_mat, p_vec1[vec_itr], cols1, mat1_zero_bias, vec1_zero_bias));
+
+      MPY_BY_QUANT_MULT_SLS_X2_OUT32(acc, acc, out_multiplier, left_shift, right_shift);
+      acc = AE_ADD32S(acc, AE_MOVDA32(out_zero_bias));
+      acc = AE_MAX32(acc, min_int8);
+      acc = AE_MIN32(acc, max_int8);
+      p_out[vec_itr][m_itr] = (WORD8)AE_MOVAD32_L(acc);
+    }
+  }
+}
+
+WORD32 xa_nn_matXvec_batch_sym8sxasym8s_asym8s(
+    WORD8 ** __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 ** __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  int i;
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  for(i = 0; i < vec_count; i++)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_out[i], -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec1[i], -1);
+  }
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD8 *), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, (ALIGNMENT>>1), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, sizeof(WORD8 *), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  for(i = 0; i < vec_count; i++)
+  {
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec1[i], (ALIGNMENT>>1), -1);
+  }
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
+
+  internal_matXvec_batch_8bx8b_asym8s(p_out, p_mat1, p_vec1, p_bias,
+      rows, cols1, row_stride1, vec_count,
+      0, vec1_zero_bias,
+      out_multiplier, out_shift, out_zero_bias);
+
+  return 0;
+}
+
+WORD32 xa_nn_matXvec_batch_asym8sxasym8s_asym8s(
+    WORD8 ** __restrict__ p_out,
+    const WORD8 * __restrict__ p_mat1,
+    const WORD8 ** __restrict__ p_vec1,
+    const WORD32 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 mat1_zero_bias,
+    WORD32 vec1_zero_bias,
+    WORD32 out_multiplier,
+    WORD32 out_shift,
+    WORD32 out_zero_bias)
+{
+  int i;
+  /* NULL pointer checks */
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+  for(i = 0; i < vec_count; i++)
+  {
+    XA_NNLIB_ARG_CHK_PTR(p_out[i], -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec1[i], -1);
+  }
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD8 *), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_mat1, (ALIGNMENT>>1), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_vec1, sizeof(WORD8 *), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD32), -1);
+  for(i = 0; i < vec_count; i++)
+  {
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec1[i], (ALIGNMENT>>1), -1);
+  }
+  /* Basic Parameter checks */
+  XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+  XA_NNLIB_ARG_CHK_COND((vec_count <= 0), -1);
+  XA_NNLIB_ARG_CHK_COND((mat1_zero_bias < -127 || mat1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((vec1_zero_bias < -127 || vec1_zero_bias > 128), -1);
+  XA_NNLIB_ARG_CHK_COND((out_shift < -31 || out_shift > 31), -1);
+  XA_NNLIB_ARG_CHK_COND((out_zero_bias < -128 || out_zero_bias > 127), -1);
+  /* Implementation dependent checks */
+  XA_NNLIB_ARG_CHK_COND(((cols1&3) != 0), -1);
+  XA_NNLIB_ARG_CHK_COND(((row_stride1&3) != 0), -1);
+
+  internal_matXvec_batch_8bx8b_asym8s(p_out, p_mat1, p_vec1, p_bias,
+      rows, cols1, row_stride1, vec_count,
+      mat1_zero_bias, vec1_zero_bias,
+      out_multiplier, out_shift, out_zero_bias);
+
+  return 0;
+}
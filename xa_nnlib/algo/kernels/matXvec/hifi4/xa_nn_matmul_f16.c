@@ -0,0 +1,133 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common_fpu.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_common_macros.h"
+
+/*----------------------------Main function---------------------------------*/
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32,xa_nn_matmul_f16xf16_f16,(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride))
+
+#else
+/* Half precision operands are widened to single precision, each output is
+ * accumulated in single precision and rounded to half precision once. */
+WORD32 xa_nn_matmul_f16xf16_f16(
+    WORD16 * __restrict__ p_out,
+    const WORD16 * __restrict__ p_mat1,
+    const WORD16 * __restrict__ p_vec1,
+    const WORD16 * __restrict__ p_bias,
+    WORD32 rows,
+    WORD32 cols1,
+    WORD32 row_stride1,
+    WORD32 vec_count,
+    WORD32 vec_offset,
+    WORD32 out_offset,
+    WORD32 out_stride)
+{
+    /* NULL pointer checks */
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_mat1, -1);
+    XA_NNLIB_ARG_CHK_PTR(p_vec1, -1);
+    /* Pointer alignment checks */
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_mat1, sizeof(WORD16), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_vec1, sizeof(WORD16), -1);
+    XA_NNLIB_ARG_CHK_ALIGN(p_bias, sizeof(WORD16), -1);
+    /* Basic Parameter checks */
+    XA_NNLIB_ARG_CHK_COND((rows <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((cols1 <= 0), -1);
+    XA_NNLIB_ARG_CHK_COND((row_stride1 < cols1), -1);
+    XA_NNLIB_ARG_CHK_COND((vec_offset == 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_offset == 0), -1);
+    XA_NNLIB_ARG_CHK_COND((out_stride == 0), -1);
+
+    /* Iterators used in for loops */
+    int m_itr, c_itr, vec_itr;
+
+    for(vec_itr = 0; vec_itr < vec_count; vec_itr++)
+    {
+        const WORD16 *p_vec = p_vec1 + vec_itr * vec_offset;
+        WORD16 *p_dst = p_out + vec_itr * out_offset;
+
+        for(m_itr = 0; m_itr < (rows & ~3); m_itr += 4)
+        {
+            const WORD16 *p_mat_0 = p_mat1 + (m_itr + 0) * row_stride1;
+            const WORD16 *p_mat_1 = p_mat1 + (m_itr + 1) * row_stride1;
+            const WORD16 *p_mat_2 = p_mat1 + (m_itr + 2) * row_stride1;
+            const WORD16 *p_mat_3 = p_mat1 + (m_itr + 3) * row_stride1;
+            FLOAT32 acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+
+            for(c_itr = 0; c_itr < cols1; c_itr++)
+            {
+                FLOAT32 vec = xa_nn_f16_to_f32(p_vec[c_itr]);
+                acc0 += xa_nn_f16_to_f32(p_mat_0[c_itr]) * vec;
+                acc1 += xa_nn_f16_to_f32(p_mat_1[c_itr]) * vec;
+                acc2 += xa_nn_f16_to_f32(p_mat_2[c_itr]) * vec;
+                acc3 += xa_nn_f16_to_f32(p_mat_3[c_itr]) * vec;
+            }
+
+            if(p_bias != NULL)
+            {
+                acc0 += xa_nn_f16_to_f32(p_bias[m_itr + 0]);
+                acc1 += xa_nn_f16_to_f32(p_bias[m_itr + 1]);
+                acc2 += xa_nn_f16_to_f32(p_bias[m_itr + 2]);
+                acc3 += xa_nn_f16_to_f32(p_bias[m_itr + 3]);
+            }
+            p_dst[(m_itr + 0) * out_stride] = xa_nn_f32_to_f16(acc0);
+            p_dst[(m_itr + 1) * out_stride] = xa_nn_f32_to_f16(acc1);
+            p_dst[(m_itr + 2) * out_stride] = xa_nn_f32_to_f16(acc2);
+            p_dst[(m_itr + 3) * out_stride] = xa_nn_f32_to_f16(acc3);
+        }
+
+        for(; m_itr < rows; m_itr++)
+        {
+            const WORD16 *p_mat_0 = p_mat1 + m_itr * row_stride1;
+            FLOAT32 acc0 = 0.0f;
+
+            for(c_itr = 0; c_itr < cols1; c_itr++)
+            {
+                acc0 += xa_nn_f16_to_f32(p_mat_0[c_itr]) * xa_nn_f16_to_f32(p_vec[c_itr]);
+            }
+
+            if(p_bias != NULL)
+            {
+                acc0 += xa_nn_f16_to_f32(p_bias[m_itr]);
+            }
+            p_dst[m_itr * out_stride] = xa_nn_f32_to_f16(acc0);
+        }
+    }
+
+    return 0;
+}
+#endif /* !HAVE_VFPU */
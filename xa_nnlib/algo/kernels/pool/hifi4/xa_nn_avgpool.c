@@ -295,6 +295,12 @@ WORD32 xa_nn_avgpool_getsize(
     (void)y_padding;
     (void)inp_data_format;
 
+    /* asym8s and asym16s run on the signed 8 and 16 bit kernels */
+    if(inp_precision == -4)
+        inp_precision = 8;
+    else if(inp_precision == -7)
+        inp_precision = 16;
+
     if(out_data_format == 0)
     {
         scratch_size = xa_nn_avgpool_getsize_nhwc(
@@ -0,0 +1,70 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_avgpool_state.h"
+#include "xa_nnlib_err_chk.h"
+
+WORD32 xa_nn_avgpool_asym8s(
+      WORD8* __restrict__ p_out,
+const WORD8* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels,
+      WORD32  kernel_height,
+      WORD32  kernel_width,
+      WORD32  x_stride,
+      WORD32  y_stride,
+      WORD32  x_padding,
+      WORD32  y_padding,
+      WORD32  out_height,
+      WORD32  out_width,
+      WORD32  inp_data_format,
+      WORD32  out_data_format,
+      VOID   *p_scratch)
+{
+    /* With equal input and output quantization, the zero point passes
+     * through the average unchanged and asym8s averaging is the signed
+     * 8-bit averaging on the raw values. The divisor is the number of
+     * valid (non padding) input elements in the window, via inv_256_tbl,
+     * and the symmetric Q31 rounding of the reciprocal multiply matches
+     * the round half away from zero division of TFLite for all int8
+     * window sums of windows with up to 1024 valid elements.
+     */
+    return xa_nn_avgpool_8(p_out
+            ,p_inp
+            ,input_height
+            ,input_width
+            ,input_channels
+            ,kernel_height
+            ,kernel_width
+            ,x_stride
+            ,y_stride
+            ,x_padding
+            ,y_padding
+            ,out_height
+            ,out_width
+            ,inp_data_format
+            ,out_data_format
+            ,p_scratch);
+}
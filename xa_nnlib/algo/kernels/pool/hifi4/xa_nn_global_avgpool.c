@@ -0,0 +1,284 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_avgpool_state.h"
+#include "xa_nnlib_err_chk.h"
+
+/* Global average pooling, NHWC: one output per channel, averaged over the
+ * whole input_height x input_width plane. Channel blocks are accumulated in
+ * registers over a single pass through the plane, so no scratch is needed.
+ * The divisor and the rounding are the ones xa_nn_avgpool_* uses for a
+ * window covering the full plane, the outputs are bit exact to it.
+ */
+
+static inline ae_int32x2 global_avgpool_inv(
+      WORD32  input_height,
+      WORD32  input_width)
+{
+    ae_int32x2 d_inv;
+
+    if(input_height * input_width <= 1024)
+    {
+        d_inv = AE_MOVDA32(inv_256_tbl[input_height * input_width]);
+    }
+    else
+    {
+        ae_int32x2 den_h, den_w;
+        ae_int64 d_tmp;
+
+        den_h = AE_MOVDA32(inv_256_tbl[input_height]);
+        den_w = AE_MOVDA32(inv_256_tbl[input_width]);
+        d_tmp = AE_MUL32U_LL(den_h, den_w);
+
+        /* Max value of den_h or den_w is 0x80000000
+           so 1 left shift is possible without overflow */
+        d_inv = AE_TRUNCI32X2F64S(d_tmp, d_tmp, 1);
+    }
+    return d_inv;
+}
+
+#define GLOBAL_AVGPOOL_ARG_CHK(type) \
+    /* NULL pointer checks */ \
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1); \
+    /* Pointer alignment checks */ \
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(type), -1); \
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(type), -1); \
+    /* Basic Parameter checks */ \
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1); \
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1); \
+    /* Implementation dependent checks */ \
+    XA_NNLIB_ARG_CHK_COND((input_height > 1024 || input_width > 1024), -1);
+
+WORD32 xa_nn_global_avgpool_8(
+      WORD8* __restrict__ p_out,
+const WORD8* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels)
+{
+    int plane_size, itr_c, i;
+    ae_int32x2 d_inv, d_out0, d_out1;
+    ae_int16x4 one;
+
+    GLOBAL_AVGPOOL_ARG_CHK(WORD8)
+
+    plane_size = input_height * input_width;
+    d_inv = global_avgpool_inv(input_height, input_width);
+    one = AE_MOVDA16(1);
+    itr_c = 0;
+
+    /* Every pixel starts 4 byte aligned: 8 channels (4 for the tail) per
+     * pass, two 8x4 loads per pixel */
+    if(((input_channels & 3) == 0) && (((unsigned int)p_inp & 3) == 0))
+    {
+        for(; itr_c < (input_channels & ~7); itr_c += 8)
+        {
+            const WORD8 *p_src = p_inp + itr_c;
+            ae_int32x2 d_acc0, d_acc1, d_acc2, d_acc3;
+
+            d_acc0 = d_acc1 = d_acc2 = d_acc3 = AE_ZERO32();
+            for(i = 0; i < plane_size; i++)
+            {
+                ae_int16x4 d_inp0, d_inp1;
+
+                d_inp0 = AE_L8X4F_I(p_src, 0);
+                d_inp1 = AE_L8X4F_I(p_src, 4);
+                p_src += input_channels;
+                d_inp0 = AE_SRAI16(d_inp0, 8);
+                d_inp1 = AE_SRAI16(d_inp1, 8);
+                AE_MULA16X4(d_acc0, d_acc1, d_inp0, one);
+                AE_MULA16X4(d_acc2, d_acc3, d_inp1, one);
+            }
+
+            d_out0 = AE_MULFP32X2RS(d_acc0, d_inv);
+            d_out1 = AE_MULFP32X2RS(d_acc1, d_inv);
+            p_out[itr_c + 0] = (WORD8)AE_MOVAD32_H(d_out0);
+            p_out[itr_c + 1] = (WORD8)AE_MOVAD32_L(d_out0);
+            p_out[itr_c + 2] = (WORD8)AE_MOVAD32_H(d_out1);
+            p_out[itr_c + 3] = (WORD8)AE_MOVAD32_L(d_out1);
+            d_out0 = AE_MULFP32X2RS(d_acc2, d_inv);
+            d_out1 = AE_MULFP32X2RS(d_acc3, d_inv);
+            p_out[itr_c + 4] = (WORD8)AE_MOVAD32_H(d_out0);
+            p_out[itr_c + 5] = (WORD8)AE_MOVAD32_L(d_out0);
+            p_out[itr_c + 6] = (WORD8)AE_MOVAD32_H(d_out1);
+            p_out[itr_c + 7] = (WORD8)AE_MOVAD32_L(d_out1);
+        }
+        if(itr_c < input_channels)
+        {
+            const WORD8 *p_src = p_inp + itr_c;
+            ae_int32x2 d_acc0, d_acc1;
+
+            d_acc0 = d_acc1 = AE_ZERO32();
+            for(i = 0; i < plane_size; i++)
+            {
+                ae_int16x4 d_inp0;
+
+                d_inp0 = AE_L8X4F_I(p_src, 0);
+                p_src += input_channels;
+                d_inp0 = AE_SRAI16(d_inp0, 8);
+                AE_MULA16X4(d_acc0, d_acc1, d_inp0, one);
+            }
+
+            d_out0 = AE_MULFP32X2RS(d_acc0, d_inv);
+            d_out1 = AE_MULFP32X2RS(d_acc1, d_inv);
+            p_out[itr_c + 0] = (WORD8)AE_MOVAD32_H(d_out0);
+            p_out[itr_c + 1] = (WORD8)AE_MOVAD32_L(d_out0);
+            p_out[itr_c + 2] = (WORD8)AE_MOVAD32_H(d_out1);
+            p_out[itr_c + 3] = (WORD8)AE_MOVAD32_L(d_out1);
+            itr_c += 4;
+        }
+    }
+
+    /* Unaligned pixels, one channel per pass with scalar loads */
+    for(; itr_c < input_channels; itr_c++)
+    {
+        const WORD8 *p_src = p_inp + itr_c;
+        WORD32 sum = 0;
+
+        for(i = 0; i < plane_size; i++)
+        {
+            sum += *p_src;
+            p_src += input_channels;
+        }
+
+        d_out0 = AE_MULFP32X2RS(AE_MOVDA32(sum), d_inv);
+        p_out[itr_c] = (WORD8)AE_MOVAD32_L(d_out0);
+    }
+
+    return 0;
+}
+
+WORD32 xa_nn_global_avgpool_asym8s(
+      WORD8* __restrict__ p_out,
+const WORD8* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels)
+{
+    /* Input and output share the quantization, see xa_nn_avgpool_asym8s */
+    return xa_nn_global_avgpool_8(p_out
+            ,p_inp
+            ,input_height
+            ,input_width
+            ,input_channels);
+}
+
+WORD32 xa_nn_global_avgpool_16(
+      WORD16* __restrict__ p_out,
+const WORD16* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels)
+{
+    int plane_size, itr_c, i;
+    ae_int32x2 d_inv, d_out0, d_out1;
+    ae_int16x4 one;
+
+    GLOBAL_AVGPOOL_ARG_CHK(WORD16)
+    /* Plane sum has to fit the 32 bit accumulators */
+    XA_NNLIB_ARG_CHK_COND((input_height * input_width > 65536), -1);
+
+    plane_size = input_height * input_width;
+    d_inv = global_avgpool_inv(input_height, input_width);
+    one = AE_MOVDA16(1);
+    itr_c = 0;
+
+    /* Every pixel starts 8 byte aligned: 8 channels (4 for the tail) per
+     * pass, two 16x4 loads per pixel */
+    if(((input_channels & 3) == 0) && (((unsigned int)p_inp & 7) == 0))
+    {
+        for(; itr_c < (input_channels & ~7); itr_c += 8)
+        {
+            const ae_int16x4 *p_src = (const ae_int16x4 *)(p_inp + itr_c);
+            ae_int32x2 d_acc0, d_acc1, d_acc2, d_acc3;
+
+            d_acc0 = d_acc1 = d_acc2 = d_acc3 = AE_ZERO32();
+            for(i = 0; i < plane_size; i++)
+            {
+                ae_int16x4 d_inp0, d_inp1;
+
+                d_inp0 = AE_L16X4_I(p_src, 0);
+                d_inp1 = AE_L16X4_I(p_src, 8);
+                p_src = (const ae_int16x4 *)((const WORD16 *)p_src + input_channels);
+                AE_MULA16X4(d_acc0, d_acc1, d_inp0, one);
+                AE_MULA16X4(d_acc2, d_acc3, d_inp1, one);
+            }
+
+            d_out0 = AE_MULFP32X2RS(d_acc0, d_inv);
+            d_out1 = AE_MULFP32X2RS(d_acc1, d_inv);
+            p_out[itr_c + 0] = (WORD16)AE_MOVAD32_H(d_out0);
+            p_out[itr_c + 1] = (WORD16)AE_MOVAD32_L(d_out0);
+            p_out[itr_c + 2] = (WORD16)AE_MOVAD32_H(d_out1);
+            p_out[itr_c + 3] = (WORD16)AE_MOVAD32_L(d_out1);
+            d_out0 = AE_MULFP32X2RS(d_acc2, d_inv);
+            d_out1 = AE_MULFP32X2RS(d_acc3, d_inv);
+            p_out[itr_c + 4] = (WORD16)AE_MOVAD32_H(d_out0);
+            p_out[itr_c + 5] = (WORD16)AE_MOVAD32_L(d_out0);
+            p_out[itr_c + 6] = (WORD16)AE_MOVAD32_H(d_out1);
+            p_out[itr_c + 7] = (WORD16)AE_MOVAD32_L(d_out1);
+        }
+        if(itr_c < input_channels)
+        {
+            const ae_int16x4 *p_src = (const ae_int16x4 *)(p_inp + itr_c);
+            ae_int32x2 d_acc0, d_acc1;
+
+            d_acc0 = d_acc1 = AE_ZERO32();
+            for(i = 0; i < plane_size; i++)
+            {
+                ae_int16x4 d_inp0;
+
+                d_inp0 = AE_L16X4_I(p_src, 0);
+                p_src = (const ae_int16x4 *)((const WORD16 *)p_src + input_channels);
+                AE_MULA16X4(d_acc0, d_acc1, d_inp0, one);
+            }
+
+            d_out0 = AE_MULFP32X2RS(d_acc0, d_inv);
+            d_out1 = AE_MULFP32X2RS(d_acc1, d_inv);
+            p_out[itr_c + 0] = (WORD16)AE_MOVAD32_H(d_out0);
+            p_out[itr_c + 1] = (WORD16)AE_MOVAD32_L(d_out0);
+            p_out[itr_c + 2] = (WORD16)AE_MOVAD32_H(d_out1);
+            p_out[itr_c + 3] = (WORD16)AE_MOVAD32_L(d_out1);
+            itr_c += 4;
+        }
+    }
+
+    /* Unaligned pixels, one channel per pass with scalar loads */
+    for(; itr_c < input_channels; itr_c++)
+    {
+        const WORD16 *p_src = p_inp + itr_c;
+        WORD32 sum = 0;
+
+        for(i = 0; i < plane_size; i++)
+        {
+            sum += *p_src;
+            p_src += input_channels;
+        }
+
+        d_out0 = AE_MULFP32X2RS(AE_MOVDA32(sum), d_inv);
+        p_out[itr_c] = (WORD16)AE_MOVAD32_L(d_out0);
+    }
+
+    return 0;
+}
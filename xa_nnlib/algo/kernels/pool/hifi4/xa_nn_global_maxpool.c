@@ -0,0 +1,240 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nn_maxpool_state.h"
+#include "xa_nnlib_err_chk.h"
+
+/* Global max pooling, NHWC: one output per channel, the maximum over the
+ * whole input_height x input_width plane, in a single pass and without
+ * scratch. The first pixel seeds the running maximum.
+ */
+
+#define GLOBAL_MAX_16X4(acc, inp) \
+{ \
+    xtbool4 b0 = AE_LT16(acc, inp); \
+    AE_MOVT16X4(acc, inp, b0); \
+}
+
+#define GLOBAL_MAXPOOL_ARG_CHK(type) \
+    /* NULL pointer checks */ \
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1); \
+    /* Pointer alignment checks */ \
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(type), -1); \
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(type), -1); \
+    /* Basic Parameter checks */ \
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1); \
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+
+WORD32 xa_nn_global_maxpool_8(
+      WORD8* __restrict__ p_out,
+const WORD8* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels)
+{
+    int plane_size, itr_c, i;
+
+    GLOBAL_MAXPOOL_ARG_CHK(WORD8)
+
+    plane_size = input_height * input_width;
+    itr_c = 0;
+
+    /* Every pixel starts 4 byte aligned: 8 channels (4 for the tail) per
+     * pass. Values stay in the 8.8 form of the load, it orders the same. */
+    if(((input_channels & 3) == 0) && (((unsigned int)p_inp & 3) == 0))
+    {
+        for(; itr_c < (input_channels & ~7); itr_c += 8)
+        {
+            const WORD8 *p_src = p_inp + itr_c;
+            ae_int16x4 d_max0, d_max1;
+
+            d_max0 = AE_L8X4F_I(p_src, 0);
+            d_max1 = AE_L8X4F_I(p_src, 4);
+            p_src += input_channels;
+            for(i = 1; i < plane_size; i++)
+            {
+                ae_int16x4 d_inp0, d_inp1;
+
+                d_inp0 = AE_L8X4F_I(p_src, 0);
+                d_inp1 = AE_L8X4F_I(p_src, 4);
+                p_src += input_channels;
+                GLOBAL_MAX_16X4(d_max0, d_inp0);
+                GLOBAL_MAX_16X4(d_max1, d_inp1);
+            }
+
+            d_max0 = AE_SRAI16(d_max0, 8);
+            d_max1 = AE_SRAI16(d_max1, 8);
+            p_out[itr_c + 0] = (WORD8)AE_MOVAD16_3(d_max0);
+            p_out[itr_c + 1] = (WORD8)AE_MOVAD16_2(d_max0);
+            p_out[itr_c + 2] = (WORD8)AE_MOVAD16_1(d_max0);
+            p_out[itr_c + 3] = (WORD8)AE_MOVAD16_0(d_max0);
+            p_out[itr_c + 4] = (WORD8)AE_MOVAD16_3(d_max1);
+            p_out[itr_c + 5] = (WORD8)AE_MOVAD16_2(d_max1);
+            p_out[itr_c + 6] = (WORD8)AE_MOVAD16_1(d_max1);
+            p_out[itr_c + 7] = (WORD8)AE_MOVAD16_0(d_max1);
+        }
+        if(itr_c < input_channels)
+        {
+            const WORD8 *p_src = p_inp + itr_c;
+            ae_int16x4 d_max0;
+
+            d_max0 = AE_L8X4F_I(p_src, 0);
+            p_src += input_channels;
+            for(i = 1; i < plane_size; i++)
+            {
+                ae_int16x4 d_inp0;
+
+                d_inp0 = AE_L8X4F_I(p_src, 0);
+                p_src += input_channels;
+                GLOBAL_MAX_16X4(d_max0, d_inp0);
+            }
+
+            d_max0 = AE_SRAI16(d_max0, 8);
+            p_out[itr_c + 0] = (WORD8)AE_MOVAD16_3(d_max0);
+            p_out[itr_c + 1] = (WORD8)AE_MOVAD16_2(d_max0);
+            p_out[itr_c + 2] = (WORD8)AE_MOVAD16_1(d_max0);
+            p_out[itr_c + 3] = (WORD8)AE_MOVAD16_0(d_max0);
+            itr_c += 4;
+        }
+    }
+
+    /* Unaligned pixels, one channel per pass with scalar loads */
+    for(; itr_c < input_channels; itr_c++)
+    {
+        const WORD8 *p_src = p_inp + itr_c;
+        WORD32 max = *p_src;
+
+        for(i = 1; i < plane_size; i++)
+        {
+            p_src += input_channels;
+            max = XT_MAX(max, (WORD32)*p_src);
+        }
+        p_out[itr_c] = (WORD8)max;
+    }
+
+    return 0;
+}
+
+WORD32 xa_nn_global_maxpool_asym8s(
+      WORD8* __restrict__ p_out,
+const WORD8* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels)
+{
+    /* Input and output share the quantization, see xa_nn_maxpool_asym8s */
+    return xa_nn_global_maxpool_8(p_out
+            ,p_inp
+            ,input_height
+            ,input_width
+            ,input_channels);
+}
+
+WORD32 xa_nn_global_maxpool_16(
+      WORD16* __restrict__ p_out,
+const WORD16* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels)
+{
+    int plane_size, itr_c, i;
+
+    GLOBAL_MAXPOOL_ARG_CHK(WORD16)
+
+    plane_size = input_height * input_width;
+    itr_c = 0;
+
+    /* Every pixel starts 8 byte aligned: 8 channels (4 for the tail) per
+     * pass, two 16x4 loads per pixel */
+    if(((input_channels & 3) == 0) && (((unsigned int)p_inp & 7) == 0))
+    {
+        for(; itr_c < (input_channels & ~7); itr_c += 8)
+        {
+            const ae_int16x4 *p_src = (const ae_int16x4 *)(p_inp + itr_c);
+            ae_int16x4 d_max0, d_max1;
+
+            d_max0 = AE_L16X4_I(p_src, 0);
+            d_max1 = AE_L16X4_I(p_src, 8);
+            p_src = (const ae_int16x4 *)((const WORD16 *)p_src + input_channels);
+            for(i = 1; i < plane_size; i++)
+            {
+                ae_int16x4 d_inp0, d_inp1;
+
+                d_inp0 = AE_L16X4_I(p_src, 0);
+                d_inp1 = AE_L16X4_I(p_src, 8);
+                p_src = (const ae_int16x4 *)((const WORD16 *)p_src + input_channels);
+                GLOBAL_MAX_16X4(d_max0, d_inp0);
+                GLOBAL_MAX_16X4(d_max1, d_inp1);
+            }
+
+            p_out[itr_c + 0] = (WORD16)AE_MOVAD16_3(d_max0);
+            p_out[itr_c + 1] = (WORD16)AE_MOVAD16_2(d_max0);
+            p_out[itr_c + 2] = (WORD16)AE_MOVAD16_1(d_max0);
+            p_out[itr_c + 3] = (WORD16)AE_MOVAD16_0(d_max0);
+            p_out[itr_c + 4] = (WORD16)AE_MOVAD16_3(d_max1);
+            p_out[itr_c + 5] = (WORD16)AE_MOVAD16_2(d_max1);
+            p_out[itr_c + 6] = (WORD16)AE_MOVAD16_1(d_max1);
+            p_out[itr_c + 7] = (WORD16)AE_MOVAD16_0(d_max1);
+        }
+        if(itr_c < input_channels)
+        {
+            const ae_int16x4 *p_src = (const ae_int16x4 *)(p_inp + itr_c);
+            ae_int16x4 d_max0;
+
+            d_max0 = AE_L16X4_I(p_src, 0);
+            p_src = (const ae_int16x4 *)((const WORD16 *)p_src + input_channels);
+            for(i = 1; i < plane_size; i++)
+            {
+                ae_int16x4 d_inp0;
+
+                d_inp0 = AE_L16X4_I(p_src, 0);
+                p_src = (const ae_int16x4 *)((const WORD16 *)p_src + input_channels);
+                GLOBAL_MAX_16X4(d_max0, d_inp0);
+            }
+
+            p_out[itr_c + 0] = (WORD16)AE_MOVAD16_3(d_max0);
+            p_out[itr_c + 1] = (WORD16)AE_MOVAD16_2(d_max0);
+            p_out[itr_c + 2] = (WORD16)AE_MOVAD16_1(d_max0);
+            p_out[itr_c + 3] = (WORD16)AE_MOVAD16_0(d_max0);
+            itr_c += 4;
+        }
+    }
+
+    /* Unaligned pixels, one channel per pass with scalar loads */
+    for(; itr_c < input_channels; itr_c++)
+    {
+        const WORD16 *p_src = p_inp + itr_c;
+        WORD32 max = *p_src;
+
+        for(i = 1; i < plane_size; i++)
+        {
+            p_src += input_channels;
+            max = XT_MAX(max, (WORD32)*p_src);
+        }
+        p_out[itr_c] = (WORD16)max;
+    }
+
+    return 0;
+}
@@ -0,0 +1,169 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common_fpu.h"
+#include "xa_type_def.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nnlib_err_chk.h"
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_global_avgpool_f32,(
+      FLOAT32* __restrict__ p_out,
+const FLOAT32* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels))
+DISCARD_FUN_FOR_NONVOID_RETURN(WORD32, xa_nn_global_maxpool_f32,(
+      FLOAT32* __restrict__ p_out,
+const FLOAT32* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels))
+#else /* #if !HAVE_VFPU */
+
+/* Global average / max pooling, NHWC, in one pass over the plane without
+ * scratch. 4 channels per pass from 8 byte aligned pixels, one channel per
+ * pass otherwise.
+ */
+
+#define GLOBAL_POOL_F32_ARG_CHK \
+    /* NULL pointer checks */ \
+    XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+    XA_NNLIB_ARG_CHK_PTR(p_inp, -1); \
+    /* Pointer alignment checks */ \
+    XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1); \
+    XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1); \
+    /* Basic Parameter checks */ \
+    XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1); \
+    XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
+
+WORD32 xa_nn_global_avgpool_f32(
+      FLOAT32* __restrict__ p_out,
+const FLOAT32* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels)
+{
+    int plane_size, itr_c, i;
+    xtfloat recip_den;
+
+    GLOBAL_POOL_F32_ARG_CHK
+
+    plane_size = input_height * input_width;
+    recip_den = XT_RECIP_S((FLOAT32)plane_size);
+    itr_c = 0;
+
+    if(((input_channels & 1) == 0) && (((unsigned int)p_inp & 7) == 0))
+    {
+        for(; itr_c < (input_channels & ~3); itr_c += 4)
+        {
+            const xtfloatx2 *p_src = (const xtfloatx2 *)(p_inp + itr_c);
+            xtfloatx2 d_acc0, d_acc1;
+
+            d_acc0 = d_acc1 = XT_CONST_S(0);
+            for(i = 0; i < plane_size; i++)
+            {
+                d_acc0 = XT_ADD_SX2(d_acc0, XT_LSX2I(p_src, 0));
+                d_acc1 = XT_ADD_SX2(d_acc1, XT_LSX2I(p_src, 8));
+                p_src = (const xtfloatx2 *)((const FLOAT32 *)p_src + input_channels);
+            }
+
+            d_acc0 = XT_MUL_SX2(d_acc0, recip_den);
+            d_acc1 = XT_MUL_SX2(d_acc1, recip_den);
+            p_out[itr_c + 0] = XT_HIGH_S(d_acc0);
+            p_out[itr_c + 1] = XT_LOW_S(d_acc0);
+            p_out[itr_c + 2] = XT_HIGH_S(d_acc1);
+            p_out[itr_c + 3] = XT_LOW_S(d_acc1);
+        }
+    }
+
+    for(; itr_c < input_channels; itr_c++)
+    {
+        const FLOAT32 *p_src = p_inp + itr_c;
+        xtfloat acc = XT_CONST_S(0);
+
+        for(i = 0; i < plane_size; i++)
+        {
+            acc = XT_ADD_S(acc, *p_src);
+            p_src += input_channels;
+        }
+        p_out[itr_c] = XT_MUL_S(acc, recip_den);
+    }
+
+    return 0;
+}
+
+WORD32 xa_nn_global_maxpool_f32(
+      FLOAT32* __restrict__ p_out,
+const FLOAT32* __restrict__ p_inp,
+      WORD32  input_height,
+      WORD32  input_width,
+      WORD32  input_channels)
+{
+    int plane_size, itr_c, i;
+
+    GLOBAL_POOL_F32_ARG_CHK
+
+    plane_size = input_height * input_width;
+    itr_c = 0;
+
+    if(((input_channels & 1) == 0) && (((unsigned int)p_inp & 7) == 0))
+    {
+        for(; itr_c < (input_channels & ~3); itr_c += 4)
+        {
+            const xtfloatx2 *p_src = (const xtfloatx2 *)(p_inp + itr_c);
+            xtfloatx2 d_max0, d_max1;
+
+            d_max0 = XT_LSX2I(p_src, 0);
+            d_max1 = XT_LSX2I(p_src, 8);
+            for(i = 1; i < plane_size; i++)
+            {
+                p_src = (const xtfloatx2 *)((const FLOAT32 *)p_src + input_channels);
+                d_max0 = XT_MAX_SX2(d_max0, XT_LSX2I(p_src, 0));
+                d_max1 = XT_MAX_SX2(d_max1, XT_LSX2I(p_src, 8));
+            }
+
+            p_out[itr_c + 0] = XT_HIGH_S(d_max0);
+            p_out[itr_c + 1] = XT_LOW_S(d_max0);
+            p_out[itr_c + 2] = XT_HIGH_S(d_max1);
+            p_out[itr_c + 3] = XT_LOW_S(d_max1);
+        }
+    }
+
+    for(; itr_c < input_channels; itr_c++)
+    {
+        const FLOAT32 *p_src = p_inp + itr_c;
+        xtfloat max = *p_src;
+
+        for(i = 1; i < plane_size; i++)
+        {
+            xtfloat inp;
+
+            p_src += input_channels;
+            inp = *p_src;
+            max = XT_MAX_S(max, inp);
+        }
+        p_out[itr_c] = max;
+    }
+
+    return 0;
+}
+#endif /* #if !HAVE_VFPU */
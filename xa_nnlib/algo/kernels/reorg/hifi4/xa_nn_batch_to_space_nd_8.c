@@ -27,7 +27,7 @@
 
 #include "xa_nnlib_common.h"
 
-WORD32 xa_nn_batch_to_space_nd_8_8(
+static WORD32 batch_to_space_nd_bytes(
     WORD8 *__restrict__ p_out,
     const WORD32 *const p_out_shape,
     const WORD8 *__restrict__ p_inp,
@@ -35,7 +35,8 @@ WORD32 xa_nn_batch_to_space_nd_8_8(
     const WORD32 *const p_block_sizes,
     const WORD32 *const p_crop_sizes,
     WORD32  num_out_dims,
-    WORD32  num_inp_dims)
+    WORD32  num_inp_dims,
+    WORD32  elem_bytes)
 {
   int i;
 
@@ -48,6 +49,8 @@ WORD32 xa_nn_batch_to_space_nd_8_8(
   XA_NNLIB_ARG_CHK_PTR(p_out_shape, -1);
 
   /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, elem_bytes, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, elem_bytes, -1);
   XA_NNLIB_ARG_CHK_ALIGN(p_inp_shape, sizeof(WORD32), -1);
   XA_NNLIB_ARG_CHK_ALIGN(p_block_sizes, sizeof(WORD32), -1);
   XA_NNLIB_ARG_CHK_ALIGN(p_crop_sizes, sizeof(WORD32), -1);
@@ -98,6 +101,9 @@ WORD32 xa_nn_batch_to_space_nd_8_8(
   XA_NNLIB_ARG_CHK_COND((input_batch != out_batch * block_size_h * block_size_w), -1);
   XA_NNLIB_ARG_CHK_COND((input_channels != out_channels), -1);
 
+  input_channels *= elem_bytes;
+  out_channels *= elem_bytes;
+
   int itr_bh, itr_bw, itr_ih, itr_iw, itr_ib;
   int itr_ob, itr_oh, itr_ow;
 
@@ -132,3 +138,44 @@ WORD32 xa_nn_batch_to_space_nd_8_8(
   return 0;
 }
 
+WORD32 xa_nn_batch_to_space_nd_8_8(
+    WORD8 *__restrict__ p_out,
+    const WORD32 *const p_out_shape,
+    const WORD8 *__restrict__ p_inp,
+    const WORD32 *const p_inp_shape,
+    const WORD32 *const p_block_sizes,
+    const WORD32 *const p_crop_sizes,
+    WORD32  num_out_dims,
+    WORD32  num_inp_dims)
+{
+  return batch_to_space_nd_bytes(p_out, p_out_shape, p_inp, p_inp_shape, p_block_sizes, p_crop_sizes,
+      num_out_dims, num_inp_dims, sizeof(WORD8));
+}
+
+WORD32 xa_nn_batch_to_space_nd_16_16(
+    WORD16 *__restrict__ p_out,
+    const WORD32 *const p_out_shape,
+    const WORD16 *__restrict__ p_inp,
+    const WORD32 *const p_inp_shape,
+    const WORD32 *const p_block_sizes,
+    const WORD32 *const p_crop_sizes,
+    WORD32  num_out_dims,
+    WORD32  num_inp_dims)
+{
+  return batch_to_space_nd_bytes((WORD8 *)p_out, p_out_shape, (const WORD8 *)p_inp, p_inp_shape, p_block_sizes, p_crop_sizes,
+      num_out_dims, num_inp_dims, sizeof(WORD16));
+}
+
+WORD32 xa_nn_batch_to_space_nd_32_32(
+    WORD32 *__restrict__ p_out,
+    const WORD32 *const p_out_shape,
+    const WORD32 *__restrict__ p_inp,
+    const WORD32 *const p_inp_shape,
+    const WORD32 *const p_block_sizes,
+    const WORD32 *const p_crop_sizes,
+    WORD32  num_out_dims,
+    WORD32  num_inp_dims)
+{
+  return batch_to_space_nd_bytes((WORD8 *)p_out, p_out_shape, (const WORD8 *)p_inp, p_inp_shape, p_block_sizes, p_crop_sizes,
+      num_out_dims, num_inp_dims, sizeof(WORD32));
+}
@@ -26,20 +26,23 @@
 #include "xa_nnlib_err_chk.h"
 #include "xa_nnlib_common.h"
 
-WORD32 xa_nn_concat_8_8(WORD8 * __restrict__ p_out
+/* Element size agnostic concat, the copies work on bytes */
+static WORD32 concat_bytes(WORD8 * __restrict__ p_out
                         ,const WORD32 *const p_out_shape
                         ,const WORD8 **pp_inps
                         ,const WORD32 *const *pp_inps_shape
                         ,WORD32 num_out_dims
                         ,WORD32 num_inp
                         ,WORD32 num_inp_dims
-                        ,WORD32 axis)
+                        ,WORD32 axis
+                        ,WORD32 elem_bytes)
 {
   XA_NNLIB_ARG_CHK_PTR(p_out, -1);
   XA_NNLIB_ARG_CHK_PTR(p_out_shape, -1);
   XA_NNLIB_ARG_CHK_PTR(pp_inps, -1);
   XA_NNLIB_ARG_CHK_PTR(pp_inps_shape, -1);
   /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, elem_bytes, -1);
   XA_NNLIB_ARG_CHK_ALIGN(p_out_shape, sizeof(WORD32), -1);
   XA_NNLIB_ARG_CHK_ALIGN(pp_inps, sizeof(WORD8 *), -1);
   XA_NNLIB_ARG_CHK_ALIGN(pp_inps_shape, sizeof(WORD32 *), -1);
@@ -62,6 +65,7 @@ WORD32 xa_nn_concat_8_8(WORD8 * __restrict__ p_out
   for (i = 0; i < num_inp; i++)
   {
     XA_NNLIB_ARG_CHK_PTR(pp_inps[i], -1);
+    XA_NNLIB_ARG_CHK_ALIGN(pp_inps[i], elem_bytes, -1);
     XA_NNLIB_ARG_CHK_PTR(pp_inps_shape[i], -1);
     XA_NNLIB_ARG_CHK_ALIGN(pp_inps_shape[i], sizeof(WORD32), -1);
 #pragma loop_count min=1
@@ -89,6 +93,7 @@ WORD32 xa_nn_concat_8_8(WORD8 * __restrict__ p_out
   {
     base_inner_size *= p_out_shape[i];
   }
+  base_inner_size *= elem_bytes;
 
   WORD8 *ptmp_out = p_out;
   for(int i = 0; i < num_inp; i++)
@@ -191,3 +196,110 @@ WORD32 xa_nn_concat_8_8(WORD8 * __restrict__ p_out
   }
   return 0;
 }
+
+WORD32 xa_nn_concat_8_8(WORD8 * __restrict__ p_out
+                        ,const WORD32 *const p_out_shape
+                        ,const WORD8 **pp_inps
+                        ,const WORD32 *const *pp_inps_shape
+                        ,WORD32 num_out_dims
+                        ,WORD32 num_inp
+                        ,WORD32 num_inp_dims
+                        ,WORD32 axis)
+{
+  return concat_bytes(p_out, p_out_shape, pp_inps, pp_inps_shape,
+      num_out_dims, num_inp, num_inp_dims, axis, sizeof(WORD8));
+}
+
+WORD32 xa_nn_concat_16_16(WORD16 * __restrict__ p_out
+                        ,const WORD32 *const p_out_shape
+                        ,const WORD16 **pp_inps
+                        ,const WORD32 *const *pp_inps_shape
+                        ,WORD32 num_out_dims
+                        ,WORD32 num_inp
+                        ,WORD32 num_inp_dims
+                        ,WORD32 axis)
+{
+  return concat_bytes((WORD8 *)p_out, p_out_shape, (const WORD8 **)pp_inps, pp_inps_shape,
+      num_out_dims, num_inp, num_inp_dims, axis, sizeof(WORD16));
+}
+
+WORD32 xa_nn_concat_32_32(WORD32 * __restrict__ p_out
+                        ,const WORD32 *const p_out_shape
+                        ,const WORD32 **pp_inps
+                        ,const WORD32 *const *pp_inps_shape
+                        ,WORD32 num_out_dims
+                        ,WORD32 num_inp
+                        ,WORD32 num_inp_dims
+                        ,WORD32 axis)
+{
+  return concat_bytes((WORD8 *)p_out, p_out_shape, (const WORD8 **)pp_inps, pp_inps_shape,
+      num_out_dims, num_inp, num_inp_dims, axis, sizeof(WORD32));
+}
+
+/* Slice descriptors that let producers write straight into the concat
+ * output instead of calling xa_nn_concat_*: input i starts p_offsets[i]
+ * elements into p_out, and its outer_size rows are *p_out_stride elements
+ * apart. For an NHWC channel concat p_offsets[i] is the first channel of
+ * input i and *p_out_stride the total channel count, as taken by the
+ * out_stride kernels. The same descriptors address the outputs of split_v
+ * inside its input. */
+WORD32 xa_nn_concat_get_slices(WORD32 * __restrict__ p_offsets
+                        ,WORD32 *p_out_stride
+                        ,WORD32 *p_outer_size
+                        ,const WORD32 *const p_out_shape
+                        ,const WORD32 *const *pp_inps_shape
+                        ,WORD32 num_out_dims
+                        ,WORD32 num_inp
+                        ,WORD32 axis)
+{
+  XA_NNLIB_ARG_CHK_PTR(p_offsets, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_stride, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_outer_size, -1);
+  XA_NNLIB_ARG_CHK_PTR(p_out_shape, -1);
+  XA_NNLIB_ARG_CHK_PTR(pp_inps_shape, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_offsets, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_out_shape, sizeof(WORD32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(pp_inps_shape, sizeof(WORD32 *), -1);
+  //Validate Arguments
+  XA_NNLIB_ARG_CHK_COND((num_out_dims <= 0 || num_out_dims > 6), -1);
+  XA_NNLIB_ARG_CHK_COND((num_inp <= 0 || num_inp > 10), -1);
+  XA_NNLIB_ARG_CHK_COND((axis < -num_out_dims || axis >= num_out_dims), -1);
+
+  int i, j;
+  for(i = 0; i < num_out_dims; i++)
+  {
+    XA_NNLIB_ARG_CHK_COND((p_out_shape[i] <= 0), -1);
+  }
+
+  if(axis < 0)
+    axis = num_out_dims + axis;
+
+  WORD32 outer_size = 1, inner_size = 1, concat_size = 0;
+  for(i = 0; i < axis; i++)
+  {
+    outer_size *= p_out_shape[i];
+  }
+  for(i = axis + 1; i < num_out_dims; i++)
+  {
+    inner_size *= p_out_shape[i];
+  }
+
+  for(i = 0; i < num_inp; i++)
+  {
+    XA_NNLIB_ARG_CHK_PTR(pp_inps_shape[i], -1);
+    XA_NNLIB_ARG_CHK_ALIGN(pp_inps_shape[i], sizeof(WORD32), -1);
+    for(j = 0; j < num_out_dims; j++)
+    {
+      XA_NNLIB_ARG_CHK_COND((pp_inps_shape[i][j] != p_out_shape[j] && j != axis), -1);
+    }
+    XA_NNLIB_ARG_CHK_COND((pp_inps_shape[i][axis] <= 0), -1);
+    p_offsets[i] = concat_size * inner_size;
+    concat_size += pp_inps_shape[i][axis];
+  }
+  XA_NNLIB_ARG_CHK_COND((p_out_shape[axis] != concat_size), -1);
+
+  *p_out_stride = concat_size * inner_size;
+  *p_outer_size = outer_size;
+  return 0;
+}
@@ -0,0 +1,728 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_type_def.h"
+#include "xa_nnlib_common_fpu.h"
+#include "xa_nn_common.h"
+#include "xa_nnlib_kernels_api.h"
+#include "xa_nnlib_common_macros.h"
+#include "xa_nnlib_err_chk.h"
+#include "xa_nnlib_common.h"
+#include "xa_nnlib_hifi_isa_compat.h"
+
+/*
+ * Separable bilinear resize for NHWC data.
+ *
+ * Source offsets and weights of every output column and row are computed
+ * once into scratch. Each input row that is needed is interpolated along
+ * the width into a row buffer of out_width * channels elements, an output
+ * row is then the vertical blend of two such buffers. Two row buffers are
+ * kept, so output rows that share input rows (any upscale) reuse them and
+ * the horizontal pass runs about once per input row.
+ *
+ * For the integer kernels the row buffers hold the horizontal result in
+ * Q10 without rounding, the vertical blend gives the same Q20 sum as the
+ * direct four-tap formula of xa_nn_resize_bilinear_8_8.
+ *
+ * Scratch layout, every part ALIGNMENT aligned:
+ *   x table  : x0 offsets, x1 offsets, weights  (3 x out_width)
+ *   y table  : y0 rows, y1 rows, weights        (3 x out_height)
+ *   rows     : 2 x out_width * channels WORD32 / FLOAT32
+ */
+
+#define ALIGNED_SIZE(x, bytes)  (((x)+(bytes-1))&(~(bytes-1)))
+#define ALIGN_PTR(x, bytes)     ((((unsigned)(x))+(bytes-1))&(~(bytes-1)))
+
+#if TFLITE_SINGLE_ROUNDING
+#define ROUND_Q20_TO_8X4(d_out16, d_out_0, d_out_1) \
+  d_out_0 = AE_SRAI32(d_out_0, 4); \
+  d_out_1 = AE_SRAI32(d_out_1, 4); \
+  d_out16 = AE_ROUND16X4F32SASYM(d_out_0, d_out_1); \
+  d_out16 = AE_SRAI16(AE_SLAI16S(d_out16, 8), 8);
+#else
+#define ROUND_Q20_TO_8X4(d_out16, d_out_0, d_out_1) \
+  d_out_0 = AE_MULFP32X2RS(d_out_0, AE_MOVDA32(1 << 11)); \
+  d_out_1 = AE_MULFP32X2RS(d_out_1, AE_MOVDA32(1 << 11)); \
+  d_out16 = AE_SAT16X4(d_out_0, d_out_1); \
+  d_out16 = AE_SRAI16(AE_SLAI16S(d_out16, 8), 8);
+#endif /* #if TFLITE_SINGLE_ROUNDING */
+
+WORD32 xa_nn_resize_bilinear_getsize(WORD32 inp_precision
+                                     ,WORD32 input_channels
+                                     ,WORD32 out_height
+                                     ,WORD32 out_width)
+{
+  XA_NNLIB_ARG_CHK_COND((inp_precision != 8 && inp_precision != 16 && inp_precision != -1), -1);
+  XA_NNLIB_ARG_CHK_COND((input_channels <= 0 || out_height <= 0 || out_width <= 0), -1);
+
+  WORD32 total_size = 0;
+  /* Row buffers are WORD32 (Q10) or FLOAT32 for all precisions */
+  total_size += ALIGNED_SIZE(3 * out_width * sizeof(WORD32), ALIGNMENT);
+  total_size += ALIGNED_SIZE(3 * out_height * sizeof(WORD32), ALIGNMENT);
+  total_size += 2 * ALIGNED_SIZE(out_width * input_channels * sizeof(WORD32), ALIGNMENT);
+
+  return total_size;
+}
+
+/* Same Q10 source coordinates as the integer TFLite kernel */
+static void resize_bilinear_coords_q10(WORD32 *p_idx0
+                                       ,WORD32 *p_idx1
+                                       ,WORD32 *p_wgt
+                                       ,WORD32 input_size
+                                       ,WORD32 out_size
+                                       ,WORD32 idx_mul
+                                       ,WORD32 align_corners
+                                       ,WORD32 half_pixel_centers)
+{
+  WORD32 itr, scale_10, shift;
+
+  if(align_corners && out_size > 1)
+    scale_10 = (((input_size - 1) << 10) + (out_size - 1) / 2) / (out_size - 1);
+  else
+    scale_10 = ((input_size << 10) + out_size / 2) / out_size;
+  shift = half_pixel_centers ? (scale_10 / 2 - (1 << 9)) : 0;
+
+  for(itr = 0; itr < out_size; itr++)
+  {
+    WORD32 scaled = itr * scale_10 + shift;
+    WORD32 lower = XT_MIN(XT_MAX((scaled >> 10), 0), input_size - 1);
+    WORD32 upper = XT_MIN(((scaled + (1 << 10) - 1) >> 10), input_size - 1);
+    p_idx0[itr] = lower * idx_mul;
+    p_idx1[itr] = upper * idx_mul;
+    p_wgt[itr]  = scaled - (lower << 10);
+  }
+}
+
+/* Returns the row buffer holding input row 'row'. If it is not cached, the
+ * buffer not holding 'keep' is taken over and *p_fill is set. */
+static WORD32 resize_bilinear_pick_row(WORD32 *p_cached
+                                       ,WORD32 row
+                                       ,WORD32 keep
+                                       ,WORD32 *p_fill)
+{
+  WORD32 slot;
+  *p_fill = 0;
+  if(p_cached[0] == row)
+    return 0;
+  if(p_cached[1] == row)
+    return 1;
+  slot = (p_cached[0] == keep) ? 1 : 0;
+  p_cached[slot] = row;
+  *p_fill = 1;
+  return slot;
+}
+
+static void resize_bilinear_hrow_8(WORD32 *__restrict__ p_row
+                                   ,const WORD8 *__restrict__ p_inp_row
+                                   ,const WORD32 *p_x0
+                                   ,const WORD32 *p_x1
+                                   ,const WORD32 *p_wx
+                                   ,WORD32 out_width
+                                   ,WORD32 channels)
+{
+  int itr_w, itr_c;
+
+  if((((unsigned)p_inp_row) & 3) == 0 && (channels & 3) == 0)
+  {
+    ae_int32x2 *p_dst = (ae_int32x2 *)p_row;
+    for(itr_w = 0; itr_w < out_width; itr_w++)
+    {
+      WORD8 *p_l = (WORD8 *)p_inp_row + p_x0[itr_w];
+      WORD8 *p_r = (WORD8 *)p_inp_row + p_x1[itr_w];
+      ae_int16x4 d_wl = AE_MOVDA16((1 << 10) - p_wx[itr_w]);
+      ae_int16x4 d_wr = AE_MOVDA16(p_wx[itr_w]);
+      for(itr_c = 0; itr_c < (channels >> 3); itr_c++)
+      {
+        ae_int16x4 d_l0, d_l1, d_r0, d_r1;
+        ae_int32x2 d_h0, d_h1, d_h2, d_h3;
+        AE_L8X4F_IP(d_l0, p_l, 4);
+        AE_L8X4F_IP(d_l1, p_l, 4);
+        AE_L8X4F_IP(d_r0, p_r, 4);
+        AE_L8X4F_IP(d_r1, p_r, 4);
+        d_l0 = AE_SRAI16(d_l0, 8);
+        d_l1 = AE_SRAI16(d_l1, 8);
+        d_r0 = AE_SRAI16(d_r0, 8);
+        d_r1 = AE_SRAI16(d_r1, 8);
+        AE_MUL16X4(d_h0, d_h1, d_l0, d_wl);
+        AE_MULA16X4(d_h0, d_h1, d_r0, d_wr);
+        AE_MUL16X4(d_h2, d_h3, d_l1, d_wl);
+        AE_MULA16X4(d_h2, d_h3, d_r1, d_wr);
+        AE_S32X2_IP(d_h0, p_dst, 8);
+        AE_S32X2_IP(d_h1, p_dst, 8);
+        AE_S32X2_IP(d_h2, p_dst, 8);
+        AE_S32X2_IP(d_h3, p_dst, 8);
+      }
+      if(channels & 4)
+      {
+        ae_int16x4 d_l0, d_r0;
+        ae_int32x2 d_h0, d_h1;
+        AE_L8X4F_IP(d_l0, p_l, 4);
+        AE_L8X4F_IP(d_r0, p_r, 4);
+        d_l0 = AE_SRAI16(d_l0, 8);
+        d_r0 = AE_SRAI16(d_r0, 8);
+        AE_MUL16X4(d_h0, d_h1, d_l0, d_wl);
+        AE_MULA16X4(d_h0, d_h1, d_r0, d_wr);
+        AE_S32X2_IP(d_h0, p_dst, 8);
+        AE_S32X2_IP(d_h1, p_dst, 8);
+      }
+    }
+  }
+  else
+  {
+    for(itr_w = 0; itr_w < out_width; itr_w++)
+    {
+      WORD8 *p_l = (WORD8 *)p_inp_row + p_x0[itr_w];
+      WORD8 *p_r = (WORD8 *)p_inp_row + p_x1[itr_w];
+      ae_int32x2 *p_dst = (ae_int32x2 *)&p_row[itr_w * channels];
+      WORD32 wl = (1 << 10) - p_wx[itr_w];
+      WORD32 wr = p_wx[itr_w];
+      ae_int16x4 d_wl = AE_MOVDA16(wl);
+      ae_int16x4 d_wr = AE_MOVDA16(wr);
+      ALIGN_REGISTER_TYPE align_l, align_r;
+      ae_valign align_dst = AE_ZALIGN64();
+      PRIME_8X4F(p_l, align_l);
+      PRIME_8X4F(p_r, align_r);
+#pragma concurrent
+      for(itr_c = 0; itr_c < (channels >> 2); itr_c++)
+      {
+        ae_int16x4 d_l0, d_r0;
+        ae_int32x2 d_h0, d_h1;
+        AE_LA8X4F_IP(d_l0, align_l, p_l);
+        AE_LA8X4F_IP(d_r0, align_r, p_r);
+        d_l0 = AE_SRAI16(d_l0, 8);
+        d_r0 = AE_SRAI16(d_r0, 8);
+        AE_MUL16X4(d_h0, d_h1, d_l0, d_wl);
+        AE_MULA16X4(d_h0, d_h1, d_r0, d_wr);
+        AE_SA32X2_IP(d_h0, align_dst, p_dst);
+        AE_SA32X2_IP(d_h1, align_dst, p_dst);
+      }
+      AE_SA64POS_FP(align_dst, p_dst);
+      /* Remainder channels, p_l/p_r have advanced past the vector part */
+      WORD32 *p_dst32 = (WORD32 *)p_dst;
+      for(itr_c = 0; itr_c < (channels & 3); itr_c++)
+      {
+        p_dst32[itr_c] = wl * p_l[itr_c] + wr * p_r[itr_c];
+      }
+    }
+  }
+}
+
+static void resize_bilinear_vblend_8(WORD8 *__restrict__ p_out
+                                     ,const WORD32 *__restrict__ p_row0
+                                     ,const WORD32 *__restrict__ p_row1
+                                     ,WORD32 wy
+                                     ,WORD32 num_elm)
+{
+  int itr;
+  const ae_int32x2 *p_r0 = (const ae_int32x2 *)p_row0;
+  const ae_int32x2 *p_r1 = (const ae_int32x2 *)p_row1;
+  ae_int32x2 d_wt = AE_MOVDA32((1 << 10) - wy);
+  ae_int32x2 d_wb = AE_MOVDA32(wy);
+
+#pragma concurrent
+  for(itr = 0; itr < (num_elm >> 2); itr++)
+  {
+    ae_int32x2 d_t0, d_t1, d_b0, d_b1, d_out_0, d_out_1;
+    ae_int16x4 d_out16;
+    AE_L32X2_IP(d_t0, p_r0, 8);
+    AE_L32X2_IP(d_t1, p_r0, 8);
+    AE_L32X2_IP(d_b0, p_r1, 8);
+    AE_L32X2_IP(d_b1, p_r1, 8);
+    d_out_0 = AE_MULP32X2(d_t0, d_wt);
+    d_out_1 = AE_MULP32X2(d_t1, d_wt);
+    AE_MULAP32X2(d_out_0, d_b0, d_wb);
+    AE_MULAP32X2(d_out_1, d_b1, d_wb);
+    ROUND_Q20_TO_8X4(d_out16, d_out_0, d_out_1)
+    *p_out++ = (WORD8)AE_MOVAD16_3(d_out16);
+    *p_out++ = (WORD8)AE_MOVAD16_2(d_out16);
+    *p_out++ = (WORD8)AE_MOVAD16_1(d_out16);
+    *p_out++ = (WORD8)AE_MOVAD16_0(d_out16);
+  }
+  for(itr = (num_elm & ~3); itr < num_elm; itr++)
+  {
+    ae_int32x2 d_out_0, d_out_1;
+    ae_int16x4 d_out16;
+    d_out_0 = AE_MULP32X2(AE_MOVDA32(p_row0[itr]), d_wt);
+    AE_MULAP32X2(d_out_0, AE_MOVDA32(p_row1[itr]), d_wb);
+    d_out_1 = d_out_0;
+    ROUND_Q20_TO_8X4(d_out16, d_out_0, d_out_1)
+    *p_out++ = (WORD8)AE_MOVAD16_0(d_out16);
+  }
+}
+
+static void resize_bilinear_hrow_16(WORD32 *__restrict__ p_row
+                                    ,const WORD16 *__restrict__ p_inp_row
+                                    ,const WORD32 *p_x0
+                                    ,const WORD32 *p_x1
+                                    ,const WORD32 *p_wx
+                                    ,WORD32 out_width
+                                    ,WORD32 channels)
+{
+  int itr_w, itr_c;
+
+  if((((unsigned)p_inp_row) & 7) == 0 && (channels & 3) == 0)
+  {
+    ae_int32x2 *p_dst = (ae_int32x2 *)p_row;
+    for(itr_w = 0; itr_w < out_width; itr_w++)
+    {
+      ae_int16x4 *p_l = (ae_int16x4 *)(p_inp_row + p_x0[itr_w]);
+      ae_int16x4 *p_r = (ae_int16x4 *)(p_inp_row + p_x1[itr_w]);
+      ae_int16x4 d_wl = AE_MOVDA16((1 << 10) - p_wx[itr_w]);
+      ae_int16x4 d_wr = AE_MOVDA16(p_wx[itr_w]);
+      for(itr_c = 0; itr_c < (channels >> 3); itr_c++)
+      {
+        ae_int16x4 d_l0, d_l1, d_r0, d_r1;
+        ae_int32x2 d_h0, d_h1, d_h2, d_h3;
+        AE_L16X4_IP(d_l0, p_l, 8);
+        AE_L16X4_IP(d_l1, p_l, 8);
+        AE_L16X4_IP(d_r0, p_r, 8);
+        AE_L16X4_IP(d_r1, p_r, 8);
+        AE_MUL16X4(d_h0, d_h1, d_l0, d_wl);
+        AE_MULA16X4(d_h0, d_h1, d_r0, d_wr);
+        AE_MUL16X4(d_h2, d_h3, d_l1, d_wl);
+        AE_MULA16X4(d_h2, d_h3, d_r1, d_wr);
+        AE_S32X2_IP(d_h0, p_dst, 8);
+        AE_S32X2_IP(d_h1, p_dst, 8);
+        AE_S32X2_IP(d_h2, p_dst, 8);
+        AE_S32X2_IP(d_h3, p_dst, 8);
+      }
+      if(channels & 4)
+      {
+        ae_int16x4 d_l0, d_r0;
+        ae_int32x2 d_h0, d_h1;
+        AE_L16X4_IP(d_l0, p_l, 8);
+        AE_L16X4_IP(d_r0, p_r, 8);
+        AE_MUL16X4(d_h0, d_h1, d_l0, d_wl);
+        AE_MULA16X4(d_h0, d_h1, d_r0, d_wr);
+        AE_S32X2_IP(d_h0, p_dst, 8);
+        AE_S32X2_IP(d_h1, p_dst, 8);
+      }
+    }
+  }
+  else
+  {
+    for(itr_w = 0; itr_w < out_width; itr_w++)
+    {
+      ae_int16x4 *p_l = (ae_int16x4 *)(p_inp_row + p_x0[itr_w]);
+      ae_int16x4 *p_r = (ae_int16x4 *)(p_inp_row + p_x1[itr_w]);
+      ae_int32x2 *p_dst = (ae_int32x2 *)&p_row[itr_w * channels];
+      WORD32 wl = (1 << 10) - p_wx[itr_w];
+      WORD32 wr = p_wx[itr_w];
+      ae_int16x4 d_wl = AE_MOVDA16(wl);
+      ae_int16x4 d_wr = AE_MOVDA16(wr);
+      ae_valign align_l = AE_LA64_PP(p_l);
+      ae_valign align_r = AE_LA64_PP(p_r);
+      ae_valign align_dst = AE_ZALIGN64();
+#pragma concurrent
+      for(itr_c = 0; itr_c < (channels >> 2); itr_c++)
+      {
+        ae_int16x4 d_l0, d_r0;
+        ae_int32x2 d_h0, d_h1;
+        AE_LA16X4_IP(d_l0, align_l, p_l);
+        AE_LA16X4_IP(d_r0, align_r, p_r);
+        AE_MUL16X4(d_h0, d_h1, d_l0, d_wl);
+        AE_MULA16X4(d_h0, d_h1, d_r0, d_wr);
+        AE_SA32X2_IP(d_h0, align_dst, p_dst);
+        AE_SA32X2_IP(d_h1, align_dst, p_dst);
+      }
+      AE_SA64POS_FP(align_dst, p_dst);
+      WORD16 *p_l16 = (WORD16 *)p_l;
+      WORD16 *p_r16 = (WORD16 *)p_r;
+      WORD32 *p_dst32 = (WORD32 *)p_dst;
+      for(itr_c = 0; itr_c < (channels & 3); itr_c++)
+      {
+        p_dst32[itr_c] = wl * p_l16[itr_c] + wr * p_r16[itr_c];
+      }
+    }
+  }
+}
+
+/* Q10 x Q10 sum needs up to 36 bits for 16-bit data, accumulate in 64 bits
+ * and round half away from zero as the TFLite reference */
+static void resize_bilinear_vblend_16(WORD16 *__restrict__ p_out
+                                      ,const WORD32 *__restrict__ p_row0
+                                      ,const WORD32 *__restrict__ p_row1
+                                      ,WORD32 wy
+                                      ,WORD32 num_elm)
+{
+  int itr;
+  const ae_int32x2 *p_r0 = (const ae_int32x2 *)p_row0;
+  const ae_int32x2 *p_r1 = (const ae_int32x2 *)p_row1;
+  ae_int16x4 *p_o = (ae_int16x4 *)p_out;
+  ae_valign align_out = AE_ZALIGN64();
+  ae_int32x2 d_wt = AE_MOVDA32((1 << 10) - wy);
+  ae_int32x2 d_wb = AE_MOVDA32(wy);
+
+#pragma concurrent
+  for(itr = 0; itr < (num_elm >> 2); itr++)
+  {
+    ae_int32x2 d_t0, d_t1, d_b0, d_b1, d_out_0, d_out_1;
+    ae_int64 d_acc0, d_acc1, d_acc2, d_acc3;
+    AE_L32X2_IP(d_t0, p_r0, 8);
+    AE_L32X2_IP(d_t1, p_r0, 8);
+    AE_L32X2_IP(d_b0, p_r1, 8);
+    AE_L32X2_IP(d_b1, p_r1, 8);
+    d_acc0 = AE_ADD64(AE_MUL32_HH(d_t0, d_wt), AE_MUL32_HH(d_b0, d_wb));
+    d_acc1 = AE_MUL32_LL(d_t0, d_wt);
+    AE_MULA32_LL(d_acc1, d_b0, d_wb);
+    d_acc2 = AE_ADD64(AE_MUL32_HH(d_t1, d_wt), AE_MUL32_HH(d_b1, d_wb));
+    d_acc3 = AE_MUL32_LL(d_t1, d_wt);
+    AE_MULA32_LL(d_acc3, d_b1, d_wb);
+    d_out_0 = AE_ROUND32X2F64SSYM(AE_SLAI64(d_acc0, 12), AE_SLAI64(d_acc1, 12));
+    d_out_1 = AE_ROUND32X2F64SSYM(AE_SLAI64(d_acc2, 12), AE_SLAI64(d_acc3, 12));
+    AE_SA16X4_IP(AE_SAT16X4(d_out_0, d_out_1), align_out, p_o);
+  }
+  AE_SA64POS_FP(align_out, p_o);
+
+  for(itr = (num_elm & ~3); itr < num_elm; itr++)
+  {
+    ae_int64 d_acc;
+    ae_int32x2 d_out_0;
+    d_acc = AE_MUL32_LL(AE_MOVDA32(p_row0[itr]), d_wt);
+    AE_MULA32_LL(d_acc, AE_MOVDA32(p_row1[itr]), d_wb);
+    d_acc = AE_SLAI64(d_acc, 12);
+    d_out_0 = AE_ROUND32X2F64SSYM(d_acc, d_acc);
+    p_out[itr] = (WORD16)AE_MOVAD16_0(AE_SAT16X4(d_out_0, d_out_0));
+  }
+}
+
+#define RESIZE_BILINEAR_ARG_CHK() \
+  XA_NNLIB_ARG_CHK_PTR(p_out, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_inp, -1); \
+  XA_NNLIB_ARG_CHK_PTR(p_scratch, -1); \
+  XA_NNLIB_ARG_CHK_ALIGN(p_scratch, ALIGNMENT, -1); \
+  XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((input_batch <= 0 || input_channels <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_height <= 0 || out_width <= 0), -1); \
+  XA_NNLIB_ARG_CHK_COND((out_batch != input_batch || out_channels != input_channels), -1); \
+  XA_NNLIB_ARG_CHK_COND((align_corners != 0 && align_corners != 1), -1); \
+  XA_NNLIB_ARG_CHK_COND((half_pixel_centers != 0 && half_pixel_centers != 1), -1); \
+  XA_NNLIB_ARG_CHK_COND((align_corners && half_pixel_centers), -1);
+
+#define RESIZE_BILINEAR_SCRATCH_SETUP() \
+  WORD32 *p_x0, *p_x1, *p_wx, *p_y0, *p_y1, *p_wy, *p_rows[2]; \
+  p_x0 = (WORD32 *)p_scratch; \
+  p_x1 = p_x0 + out_width; \
+  p_wx = p_x1 + out_width; \
+  p_y0 = (WORD32 *)ALIGN_PTR(p_wx + out_width, ALIGNMENT); \
+  p_y1 = p_y0 + out_height; \
+  p_wy = p_y1 + out_height; \
+  p_rows[0] = (WORD32 *)ALIGN_PTR(p_wy + out_height, ALIGNMENT); \
+  p_rows[1] = (WORD32 *)ALIGN_PTR(p_rows[0] + out_width * out_channels, ALIGNMENT);
+
+WORD32 xa_nn_resize_bilinear_nhwc_8_8
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_inp
+  ,WORD32  input_batch
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  out_batch
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  out_channels
+  ,WORD32  align_corners
+  ,WORD32  half_pixel_centers
+  ,pVOID   p_scratch
+  )
+{
+  RESIZE_BILINEAR_ARG_CHK();
+  RESIZE_BILINEAR_SCRATCH_SETUP();
+
+  int itr_n, itr_h;
+  WORD32 height_off = input_width * input_channels;
+  WORD32 row_len = out_width * out_channels;
+
+  resize_bilinear_coords_q10(p_x0, p_x1, p_wx, input_width, out_width,
+                             input_channels, align_corners, half_pixel_centers);
+  resize_bilinear_coords_q10(p_y0, p_y1, p_wy, input_height, out_height,
+                             1, align_corners, half_pixel_centers);
+
+  for(itr_n = 0; itr_n < out_batch; itr_n++)
+  {
+    const WORD8 *p_inp_n = p_inp + itr_n * input_height * height_off;
+    WORD32 cached[2] = {-1, -1};
+    for(itr_h = 0; itr_h < out_height; itr_h++)
+    {
+      WORD32 slot0, slot1, fill;
+      slot0 = resize_bilinear_pick_row(cached, p_y0[itr_h], p_y1[itr_h], &fill);
+      if(fill)
+        resize_bilinear_hrow_8(p_rows[slot0], p_inp_n + p_y0[itr_h] * height_off,
+                               p_x0, p_x1, p_wx, out_width, input_channels);
+      slot1 = resize_bilinear_pick_row(cached, p_y1[itr_h], p_y0[itr_h], &fill);
+      if(fill)
+        resize_bilinear_hrow_8(p_rows[slot1], p_inp_n + p_y1[itr_h] * height_off,
+                               p_x0, p_x1, p_wx, out_width, input_channels);
+      resize_bilinear_vblend_8(p_out, p_rows[slot0], p_rows[slot1], p_wy[itr_h], row_len);
+      p_out += row_len;
+    }
+  }
+
+  return 0;
+}
+
+WORD32 xa_nn_resize_bilinear_nhwc_16_16
+  (pWORD16 __restrict__ p_out
+  ,const WORD16 *__restrict__ p_inp
+  ,WORD32  input_batch
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  out_batch
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  out_channels
+  ,WORD32  align_corners
+  ,WORD32  half_pixel_centers
+  ,pVOID   p_scratch
+  )
+{
+  RESIZE_BILINEAR_ARG_CHK();
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(WORD16), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(WORD16), -1);
+  RESIZE_BILINEAR_SCRATCH_SETUP();
+
+  int itr_n, itr_h;
+  WORD32 height_off = input_width * input_channels;
+  WORD32 row_len = out_width * out_channels;
+
+  resize_bilinear_coords_q10(p_x0, p_x1, p_wx, input_width, out_width,
+                             input_channels, align_corners, half_pixel_centers);
+  resize_bilinear_coords_q10(p_y0, p_y1, p_wy, input_height, out_height,
+                             1, align_corners, half_pixel_centers);
+
+  for(itr_n = 0; itr_n < out_batch; itr_n++)
+  {
+    const WORD16 *p_inp_n = p_inp + itr_n * input_height * height_off;
+    WORD32 cached[2] = {-1, -1};
+    for(itr_h = 0; itr_h < out_height; itr_h++)
+    {
+      WORD32 slot0, slot1, fill;
+      slot0 = resize_bilinear_pick_row(cached, p_y0[itr_h], p_y1[itr_h], &fill);
+      if(fill)
+        resize_bilinear_hrow_16(p_rows[slot0], p_inp_n + p_y0[itr_h] * height_off,
+                                p_x0, p_x1, p_wx, out_width, input_channels);
+      slot1 = resize_bilinear_pick_row(cached, p_y1[itr_h], p_y0[itr_h], &fill);
+      if(fill)
+        resize_bilinear_hrow_16(p_rows[slot1], p_inp_n + p_y1[itr_h] * height_off,
+                                p_x0, p_x1, p_wx, out_width, input_channels);
+      resize_bilinear_vblend_16(p_out, p_rows[slot0], p_rows[slot1], p_wy[itr_h], row_len);
+      p_out += row_len;
+    }
+  }
+
+  return 0;
+}
+
+#if !HAVE_VFPU
+DISCARD_FUN_FOR_NONVOID_RETURN(
+             WORD32, xa_nn_resize_bilinear_nhwc_f32_f32,
+             (
+                FLOAT32 *__restrict__ p_out
+                ,const FLOAT32 *__restrict__ p_inp
+                ,WORD32  input_batch
+                ,WORD32  input_height
+                ,WORD32  input_width
+                ,WORD32  input_channels
+                ,WORD32  out_batch
+                ,WORD32  out_height
+                ,WORD32  out_width
+                ,WORD32  out_channels
+                ,WORD32  align_corners
+                ,WORD32  half_pixel_centers
+                ,pVOID   p_scratch
+             )
+           )
+#else
+/* Float source coordinates as the TFLite float kernel */
+static void resize_bilinear_coords_f32(WORD32 *p_idx0
+                                       ,WORD32 *p_idx1
+                                       ,FLOAT32 *p_wgt
+                                       ,WORD32 input_size
+                                       ,WORD32 out_size
+                                       ,WORD32 idx_mul
+                                       ,WORD32 align_corners
+                                       ,WORD32 half_pixel_centers)
+{
+  WORD32 itr;
+  FLOAT32 scale;
+
+  if(align_corners && out_size > 1)
+    scale = (FLOAT32)(input_size - 1) / (FLOAT32)(out_size - 1);
+  else
+    scale = (FLOAT32)input_size / (FLOAT32)out_size;
+
+  for(itr = 0; itr < out_size; itr++)
+  {
+    FLOAT32 scaled = half_pixel_centers ? (((FLOAT32)itr + 0.5f) * scale - 0.5f)
+                                        : ((FLOAT32)itr * scale);
+    WORD32 floor_val = (WORD32)scaled;
+    if((FLOAT32)floor_val > scaled)
+      floor_val--;
+    WORD32 ceil_val = ((FLOAT32)floor_val < scaled) ? (floor_val + 1) : floor_val;
+    WORD32 lower = XT_MIN(XT_MAX(floor_val, 0), input_size - 1);
+    WORD32 upper = XT_MIN(ceil_val, input_size - 1);
+    p_idx0[itr] = lower * idx_mul;
+    p_idx1[itr] = upper * idx_mul;
+    p_wgt[itr]  = scaled - (FLOAT32)lower;
+  }
+}
+
+static void resize_bilinear_hrow_f32(FLOAT32 *__restrict__ p_row
+                                     ,const FLOAT32 *__restrict__ p_inp_row
+                                     ,const WORD32 *p_x0
+                                     ,const WORD32 *p_x1
+                                     ,const FLOAT32 *p_wx
+                                     ,WORD32 out_width
+                                     ,WORD32 channels)
+{
+  int itr_w, itr_c;
+
+  if((((unsigned)p_inp_row) & 7) == 0 && (channels & 1) == 0)
+  {
+    xtfloatx2 *p_dst = (xtfloatx2 *)p_row;
+    for(itr_w = 0; itr_w < out_width; itr_w++)
+    {
+      xtfloatx2 *p_l = (xtfloatx2 *)(p_inp_row + p_x0[itr_w]);
+      xtfloatx2 *p_r = (xtfloatx2 *)(p_inp_row + p_x1[itr_w]);
+      xtfloatx2 d_wl = (xtfloatx2)(1.0f - p_wx[itr_w]);
+      xtfloatx2 d_wr = (xtfloatx2)p_wx[itr_w];
+#pragma concurrent
+      for(itr_c = 0; itr_c < (channels >> 1); itr_c++)
+      {
+        xtfloatx2 d_l, d_r, d_h;
+        XT_LSX2IP(d_l, p_l, 2*sizeof(FLOAT32));
+        XT_LSX2IP(d_r, p_r, 2*sizeof(FLOAT32));
+        d_h = XT_MUL_SX2(d_l, d_wl);
+        XT_MADD_SX2(d_h, d_r, d_wr);
+        XT_SSX2IP(d_h, p_dst, 2*sizeof(FLOAT32));
+      }
+    }
+  }
+  else
+  {
+    FLOAT32 *p_dst = p_row;
+    for(itr_w = 0; itr_w < out_width; itr_w++)
+    {
+      const FLOAT32 *p_l = p_inp_row + p_x0[itr_w];
+      const FLOAT32 *p_r = p_inp_row + p_x1[itr_w];
+      xtfloat wl = 1.0f - p_wx[itr_w];
+      xtfloat wr = p_wx[itr_w];
+      for(itr_c = 0; itr_c < channels; itr_c++)
+      {
+        xtfloat d_h = XT_MUL_S(p_l[itr_c], wl);
+        XT_MADD_S(d_h, p_r[itr_c], wr);
+        *p_dst++ = d_h;
+      }
+    }
+  }
+}
+
+static void resize_bilinear_vblend_f32(FLOAT32 *__restrict__ p_out
+                                       ,const FLOAT32 *__restrict__ p_row0
+                                       ,const FLOAT32 *__restrict__ p_row1
+                                       ,FLOAT32 wy
+                                       ,WORD32 num_elm)
+{
+  int itr;
+  const xtfloatx2 *p_r0 = (const xtfloatx2 *)p_row0;
+  const xtfloatx2 *p_r1 = (const xtfloatx2 *)p_row1;
+  xtfloatx2 *p_o = (xtfloatx2 *)p_out;
+  ae_valign align_out = AE_ZALIGN64();
+  xtfloatx2 d_wt = (xtfloatx2)(1.0f - wy);
+  xtfloatx2 d_wb = (xtfloatx2)wy;
+
+#pragma concurrent
+  for(itr = 0; itr < (num_elm >> 1); itr++)
+  {
+    xtfloatx2 d_t, d_b, d_out;
+    XT_LSX2IP(d_t, p_r0, 2*sizeof(FLOAT32));
+    XT_LSX2IP(d_b, p_r1, 2*sizeof(FLOAT32));
+    d_out = XT_MUL_SX2(d_t, d_wt);
+    XT_MADD_SX2(d_out, d_b, d_wb);
+    XT_SASX2IP(d_out, align_out, p_o);
+  }
+  XT_SASX2POSFP(align_out, p_o);
+
+  if(num_elm & 1)
+  {
+    xtfloat d_out = XT_MUL_S(p_row0[num_elm - 1], (1.0f - wy));
+    XT_MADD_S(d_out, p_row1[num_elm - 1], wy);
+    p_out[num_elm - 1] = d_out;
+  }
+}
+
+WORD32 xa_nn_resize_bilinear_nhwc_f32_f32
+  (FLOAT32 *__restrict__ p_out
+  ,const FLOAT32 *__restrict__ p_inp
+  ,WORD32  input_batch
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  out_batch
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  out_channels
+  ,WORD32  align_corners
+  ,WORD32  half_pixel_centers
+  ,pVOID   p_scratch
+  )
+{
+  RESIZE_BILINEAR_ARG_CHK();
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, sizeof(FLOAT32), -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, sizeof(FLOAT32), -1);
+  RESIZE_BILINEAR_SCRATCH_SETUP();
+
+  int itr_n, itr_h;
+  WORD32 height_off = input_width * input_channels;
+  WORD32 row_len = out_width * out_channels;
+  FLOAT32 *p_wx_f = (FLOAT32 *)p_wx;
+  FLOAT32 *p_wy_f = (FLOAT32 *)p_wy;
+
+  resize_bilinear_coords_f32(p_x0, p_x1, p_wx_f, input_width, out_width,
+                             input_channels, align_corners, half_pixel_centers);
+  resize_bilinear_coords_f32(p_y0, p_y1, p_wy_f, input_height, out_height,
+                             1, align_corners, half_pixel_centers);
+
+  for(itr_n = 0; itr_n < out_batch; itr_n++)
+  {
+    const FLOAT32 *p_inp_n = p_inp + itr_n * input_height * height_off;
+    WORD32 cached[2] = {-1, -1};
+    for(itr_h = 0; itr_h < out_height; itr_h++)
+    {
+      WORD32 slot0, slot1, fill;
+      slot0 = resize_bilinear_pick_row(cached, p_y0[itr_h], p_y1[itr_h], &fill);
+      if(fill)
+        resize_bilinear_hrow_f32((FLOAT32 *)p_rows[slot0], p_inp_n + p_y0[itr_h] * height_off,
+                                 p_x0, p_x1, p_wx_f, out_width, input_channels);
+      slot1 = resize_bilinear_pick_row(cached, p_y1[itr_h], p_y0[itr_h], &fill);
+      if(fill)
+        resize_bilinear_hrow_f32((FLOAT32 *)p_rows[slot1], p_inp_n + p_y1[itr_h] * height_off,
+                                 p_x0, p_x1, p_wx_f, out_width, input_channels);
+      resize_bilinear_vblend_f32(p_out, (FLOAT32 *)p_rows[slot0], (FLOAT32 *)p_rows[slot1],
+                                 p_wy_f[itr_h], row_len);
+      p_out += row_len;
+    }
+  }
+
+  return 0;
+}
+#endif /* #if !HAVE_VFPU */
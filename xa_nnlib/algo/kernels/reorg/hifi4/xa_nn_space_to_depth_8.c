@@ -27,7 +27,7 @@
 
 #include "xa_nnlib_common.h"
 
-WORD32 xa_nn_space_to_depth_8_8
+static WORD32 space_to_depth_bytes
   (pWORD8 __restrict__ p_out
   ,const WORD8 *__restrict__ p_inp
   ,WORD32  input_height
@@ -39,11 +39,15 @@ WORD32 xa_nn_space_to_depth_8_8
   ,WORD32  out_channels
   ,WORD32  inp_data_format
   ,WORD32  out_data_format
+  ,WORD32  elem_bytes
   )
 {
   /* NULL pointer checks */
   XA_NNLIB_ARG_CHK_PTR(p_out, -1);
   XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
+  /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_out, elem_bytes, -1);
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, elem_bytes, -1);
   /* Basic Parameter checks */
   XA_NNLIB_ARG_CHK_COND((input_height <= 0 || input_width <= 0), -1);
   XA_NNLIB_ARG_CHK_COND((input_channels <= 0), -1);
@@ -56,6 +60,9 @@ WORD32 xa_nn_space_to_depth_8_8
   XA_NNLIB_ARG_CHK_COND((inp_data_format != 0), -1);
   XA_NNLIB_ARG_CHK_COND((out_data_format != 0), -1);
 
+  input_channels *= elem_bytes;
+  out_channels *= elem_bytes;
+
   int itr_h, itr_b0;
 
   WORD8 *ptmp_inp1, *ptmp_out1;
@@ -94,3 +101,57 @@ WORD32 xa_nn_space_to_depth_8_8
 
   return 0;
 }
+
+WORD32 xa_nn_space_to_depth_8_8
+  (pWORD8 __restrict__ p_out
+  ,const WORD8 *__restrict__ p_inp
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  block_size
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  out_channels
+  ,WORD32  inp_data_format
+  ,WORD32  out_data_format
+  )
+{
+  return space_to_depth_bytes(p_out, p_inp, input_height, input_width, input_channels, block_size,
+      out_height, out_width, out_channels, inp_data_format, out_data_format, sizeof(WORD8));
+}
+
+WORD32 xa_nn_space_to_depth_16_16
+  (WORD16 *__restrict__ p_out
+  ,const WORD16 *__restrict__ p_inp
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  block_size
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  out_channels
+  ,WORD32  inp_data_format
+  ,WORD32  out_data_format
+  )
+{
+  return space_to_depth_bytes((pWORD8)p_out, (const WORD8 *)p_inp, input_height, input_width, input_channels, block_size,
+      out_height, out_width, out_channels, inp_data_format, out_data_format, sizeof(WORD16));
+}
+
+WORD32 xa_nn_space_to_depth_32_32
+  (WORD32 *__restrict__ p_out
+  ,const WORD32 *__restrict__ p_inp
+  ,WORD32  input_height
+  ,WORD32  input_width
+  ,WORD32  input_channels
+  ,WORD32  block_size
+  ,WORD32  out_height
+  ,WORD32  out_width
+  ,WORD32  out_channels
+  ,WORD32  inp_data_format
+  ,WORD32  out_data_format
+  )
+{
+  return space_to_depth_bytes((pWORD8)p_out, (const WORD8 *)p_inp, input_height, input_width, input_channels, block_size,
+      out_height, out_width, out_channels, inp_data_format, out_data_format, sizeof(WORD32));
+}
@@ -26,20 +26,22 @@
 #include "xa_nnlib_err_chk.h"
 #include "xa_nnlib_common.h"
 
-WORD32 xa_nn_split_v_8_8(WORD8 ** __restrict__ pp_outs
+static WORD32 split_v_bytes(WORD8 ** __restrict__ pp_outs
                          ,const WORD32 *const *pp_outs_shape
                          ,const WORD8 * __restrict__ p_inp
                          ,const WORD32 *const p_inp_shape
                          ,WORD32 num_out
                          ,WORD32 num_out_dims
                          ,WORD32 num_inp_dims
-                         ,WORD32 axis)
+                         ,WORD32 axis
+                         ,WORD32 elem_bytes)
 {
   XA_NNLIB_ARG_CHK_PTR(pp_outs, -1);
   XA_NNLIB_ARG_CHK_PTR(pp_outs_shape, -1);
   XA_NNLIB_ARG_CHK_PTR(p_inp, -1);
   XA_NNLIB_ARG_CHK_PTR(p_inp_shape, -1);
   /* Pointer alignment checks */
+  XA_NNLIB_ARG_CHK_ALIGN(p_inp, elem_bytes, -1);
   XA_NNLIB_ARG_CHK_ALIGN(p_inp_shape, sizeof(WORD32), -1);
   XA_NNLIB_ARG_CHK_ALIGN(pp_outs, sizeof(WORD8 *), -1);
   XA_NNLIB_ARG_CHK_ALIGN(pp_outs_shape, sizeof(WORD32 *), -1);
@@ -62,6 +64,7 @@ WORD32 xa_nn_split_v_8_8(WORD8 ** __restrict__ pp_outs
   for (i = 0; i < num_out; i++)
   {
     XA_NNLIB_ARG_CHK_PTR(pp_outs[i], -1);
+    XA_NNLIB_ARG_CHK_ALIGN(pp_outs[i], elem_bytes, -1);
     XA_NNLIB_ARG_CHK_PTR(pp_outs_shape[i], -1);
     XA_NNLIB_ARG_CHK_ALIGN(pp_outs_shape[i], sizeof(WORD32), -1);
 #pragma loop_count min=1
@@ -89,6 +92,7 @@ WORD32 xa_nn_split_v_8_8(WORD8 ** __restrict__ pp_outs
   {
     base_inner_size *= p_inp_shape[i];
   }
+  base_inner_size *= elem_bytes;
 
   const WORD8 *ptmp_inp = p_inp;
   for(int i = 0; i < num_out; i++)
@@ -191,3 +195,42 @@ WORD32 xa_nn_split_v_8_8(WORD8 ** __restrict__ pp_outs
   }
   return 0;
 }
+
+WORD32 xa_nn_split_v_8_8(WORD8 ** __restrict__ pp_outs
+                         ,const WORD32 *const *pp_outs_shape
+                         ,const WORD8 * __restrict__ p_inp
+                         ,const WORD32 *const p_inp_shape
+                         ,WORD32 num_out
+                         ,WORD32 num_out_dims
+                         ,WORD32 num_inp_dims
+                         ,WORD32 axis)
+{
+  return split_v_bytes(pp_outs, pp_outs_shape, p_inp, p_inp_shape,
+      num_out, num_out_dims, num_inp_dims, axis, sizeof(WORD8));
+}
+
+WORD32 xa_nn_split_v_16_16(WORD16 ** __restrict__ pp_outs
+                         ,const WORD32 *const *pp_outs_shape
+                         ,const WORD16 * __restrict__ p_inp
+                         ,const WORD32 *const p_inp_shape
+                         ,WORD32 num_out
+                         ,WORD32 num_out_dims
+                         ,WORD32 num_inp_dims
+                         ,WORD32 axis)
+{
+  return split_v_bytes((WORD8 **)pp_outs, pp_outs_shape, (const WORD8 *)p_inp, p_inp_shape,
+      num_out, num_out_dims, num_inp_dims, axis, sizeof(WORD16));
+}
+
+WORD32 xa_nn_split_v_32_32(WORD32 ** __restrict__ pp_outs
+                         ,const WORD32 *const *pp_outs_shape
+                         ,const WORD32 * __restrict__ p_inp
+                         ,const WORD32 *const p_inp_shape
+                         ,WORD32 num_out
+                         ,WORD32 num_out_dims
+                         ,WORD32 num_inp_dims
+                         ,WORD32 axis)
+{
+  return split_v_bytes((WORD8 **)pp_outs, pp_outs_shape, (const WORD8 *)p_inp, p_inp_shape,
+      num_out, num_out_dims, num_inp_dims, axis, sizeof(WORD32));
+}
@@ -20,6 +20,52 @@
 
 ******************************************************************************/
 #include "xa_nnlib_common.h"
+#include "xa_nn_reorg_state.h"
+
+/* [batch][rows][cols] -> [batch][cols][rows] in 4x4 tiles, rows and cols
+ * multiples of 4, both pointers 8 byte aligned */
+static void transpose_2d_16_4x4(WORD16 * __restrict__ p_out
+                    ,const WORD16 * __restrict__ p_inp
+                    ,int batch
+                    ,int rows
+                    ,int cols)
+{
+  int itr_b, itr_r, itr_c;
+  for(itr_b = 0; itr_b < batch; itr_b++)
+  {
+    for(itr_r = 0; itr_r < rows; itr_r += 4)
+    {
+      const ae_int16x4 *pae_i0 = (const ae_int16x4 *)(p_inp + itr_r * cols);
+      const ae_int16x4 *pae_i1 = (const ae_int16x4 *)(p_inp + (itr_r + 1) * cols);
+      const ae_int16x4 *pae_i2 = (const ae_int16x4 *)(p_inp + (itr_r + 2) * cols);
+      const ae_int16x4 *pae_i3 = (const ae_int16x4 *)(p_inp + (itr_r + 3) * cols);
+      WORD16 *p_o = p_out + itr_r;
+#pragma loop_count min=1
+      for(itr_c = 0; itr_c < (cols >> 2); itr_c++)
+      {
+        ae_int16x4 d0, d1, d2, d3;
+        ae_int16x4 t0, t1, t2, t3;
+        AE_L16X4_IP(d0, pae_i0, 8);
+        AE_L16X4_IP(d1, pae_i1, 8);
+        AE_L16X4_IP(d2, pae_i2, 8);
+        AE_L16X4_IP(d3, pae_i3, 8);
+
+        t0 = AE_SEL16_7531(d0, d1);
+        t1 = AE_SEL16_6420(d0, d1);
+        t2 = AE_SEL16_7531(d2, d3);
+        t3 = AE_SEL16_6420(d2, d3);
+
+        *(ae_int16x4 *)p_o = AE_SEL16_7531(t0, t2);
+        *(ae_int16x4 *)(p_o + rows) = AE_SEL16_7531(t1, t3);
+        *(ae_int16x4 *)(p_o + 2 * rows) = AE_SEL16_6420(t0, t2);
+        *(ae_int16x4 *)(p_o + 3 * rows) = AE_SEL16_6420(t1, t3);
+        p_o += 4 * rows;
+      }
+    }
+    p_inp += rows * cols;
+    p_out += rows * cols;
+  }
+}
 
 /*
  * Currently only supports upto 5D input tensors.
@@ -73,6 +119,24 @@ WORD32 xa_nn_transpose_16_16(WORD16 * __restrict__ p_out
   XA_NNLIB_ARG_CHK_ALIGN(p_out_shape, sizeof(WORD32), -1);
   XA_NNLIB_ARG_CHK_ALIGN(p_inp_shape, sizeof(WORD32), -1);
 
+  /* Batched 2D transposes (NHWC <-> NCHW, matrix transpose) */
+  {
+    int red_inp_shape[5], red_perm[5];
+    int red_dims = internal_transpose_reduce_dims(red_inp_shape, red_perm, p_inp_shape, p_permute_vec, num_inp_dims);
+    if((red_dims == 2 && red_perm[0] == 1) || (red_dims == 3 && red_perm[0] == 0 && red_perm[1] == 2))
+    {
+      int batch = (red_dims == 3) ? red_inp_shape[0] : 1;
+      int rows = red_inp_shape[red_dims - 2];
+      int cols = red_inp_shape[red_dims - 1];
+      if(((rows & 3) == 0) && ((cols & 3) == 0) &&
+         ((((unsigned)p_inp) & 7) == 0) && ((((unsigned)p_out) & 7) == 0))
+      {
+        transpose_2d_16_4x4(p_out, p_inp, batch, rows, cols);
+        return 0;
+      }
+    }
+  }
+
   /* Shift all dim with 1 in the outer part */
   int eff_output_shape[5];
   int eff_permute_vec[5];
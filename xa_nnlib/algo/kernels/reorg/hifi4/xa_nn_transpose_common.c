@@ -0,0 +1,71 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#include "xa_nnlib_common.h"
+#include "xa_nn_reorg_state.h"
+
+/* Drops unit dims and folds output dims that are also neighbours in the
+ * input, e.g. NHWC -> NCHW reduces to [N, HW, C] -> [N, C, HW].
+ * Returns the reduced rank, p_red_perm/p_red_inp_shape are of that rank. */
+int internal_transpose_reduce_dims(int *p_red_inp_shape
+                    ,int *p_red_perm
+                    ,const WORD32 *const p_inp_shape
+                    ,const WORD32 * __restrict__ p_permute_vec
+                    ,int num_dims)
+{
+  int inp_label[5], grp_start[5], grp_shape[5];
+  int i, j, num_kept = 0, num_grp = 0, prev_label = -2;
+
+  for(i = 0; i < num_dims; i++)
+  {
+    inp_label[i] = (p_inp_shape[i] != 1) ? num_kept++ : -1;
+  }
+
+  for(i = 0; i < num_dims; i++)
+  {
+    int label = inp_label[p_permute_vec[i]];
+    if(label < 0)
+      continue;
+    if(label == prev_label + 1)
+    {
+      grp_shape[num_grp - 1] *= p_inp_shape[p_permute_vec[i]];
+    }
+    else
+    {
+      grp_start[num_grp] = label;
+      grp_shape[num_grp] = p_inp_shape[p_permute_vec[i]];
+      num_grp++;
+    }
+    prev_label = label;
+  }
+
+  for(i = 0; i < num_grp; i++)
+  {
+    int rank = 0;
+    for(j = 0; j < num_grp; j++)
+    {
+      rank += (grp_start[j] < grp_start[i]);
+    }
+    p_red_perm[i] = rank;
+    p_red_inp_shape[rank] = grp_shape[i];
+  }
+  return num_grp;
+}
@@ -25,6 +25,8 @@
 #include "xa_nnlib_cnn_api.h"
 
 #define ALIGN_SIZE(n) (((n)+7)&(~7))
+#define CNN_MIN(a, b) (((a) < (b)) ? (a) : (b))
+#define CNN_MAX(a, b) (((a) > (b)) ? (a) : (b))
 #define CHECK_PTR(ptr, err) if(NULL == ptr) return err;
 #define CHECK_PTR_ALIGN(ptr, alignment, err) if((((unsigned)(ptr))&(alignment-1)) != 0) return err;
 
@@ -149,6 +151,43 @@ typedef struct _scratch_mem_t
   temp_mem_t temp_mem;
 } scratch_mem_t;
 
+/* Depthwise output bytes per tile targeted when ds_tile_height is 0 (auto) */
+#define DS_AUTO_TILE_BYTES (32*1024)
+
+/* Tile height for ds_tile_height 0: as many rows as fit DS_AUTO_TILE_BYTES,
+ * unfused when the first or last tile would read no input rows */
+static Int32 ds_auto_tile_height(xa_nnlib_cnn_init_config_t *config)
+{
+  Int32 row_bytes = IO_PRECISION_BYTES(config->precision) * config->output_width *
+                    config->input_shape.dim.cube.depth * config->channels_multiplier;
+
+  if((config->y_padding >= config->kernel_ds_depth_shape.dim.cube.height) ||
+     ((config->output_height - 1) * config->y_stride - config->y_padding >= config->input_shape.dim.cube.height) ||
+     (row_bytes <= 0))
+    return 0;
+
+  return CNN_MAX(1, DS_AUTO_TILE_BYTES / row_bytes);
+}
+
+/* Output rows per fused depthwise+pointwise pass, 0 if CONV2D_DS runs unfused */
+static Int32 ds_tile_height(xa_nnlib_cnn_init_config_t *config)
+{
+  Int32 tile_height = config->ds_tile_height;
+
+  if(tile_height == 0)
+    tile_height = ds_auto_tile_height(config);
+  if(tile_height <= 0 || tile_height >= config->output_height)
+    return 0;
+  return tile_height;
+}
+
+/* Largest number of input rows read by one tile of tile_height output rows */
+static Int32 ds_band_height(xa_nnlib_cnn_init_config_t *config, Int32 tile_height)
+{
+  Int32 band_height = (tile_height - 1) * config->y_stride + config->kernel_ds_depth_shape.dim.cube.height;
+  return CNN_MIN(band_height, config->input_shape.dim.cube.height);
+}
+
 static Int32 validate_config(xa_nnlib_cnn_init_config_t *config)
 {
   if((config->algo != XA_NNLIB_CNN_CONV1D_STD) &&
@@ -284,11 +323,36 @@ static Int32 validate_config(xa_nnlib_cnn_init_config_t *config)
     /* kernel_ds_depth_width must be padded to be multiple of 4 */
     if(((config->kernel_ds_depth_shape.dim.cube.width+3)&(~3)) != config->kernel_ds_depth_shape.dim.cube.height_offset)
       return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_KERNEL_SHAPE;
+
+    if(config->ds_tile_height < 0)
+      return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_TILE_HEIGHT;
+
+    /* Every tile must read at least one input row: first and last output rows must overlap the input */
+    if(config->ds_tile_height > 0 && ds_tile_height(config) > 0)
+    {
+      if((config->y_padding >= config->kernel_ds_depth_shape.dim.cube.height) ||
+         ((config->output_height - 1) * config->y_stride - config->y_padding >= config->input_shape.dim.cube.height))
+        return XA_NNLIB_CNN_CONFIG_FATAL_INVALID_TILE_HEIGHT;
+    }
   }
 
   return XA_NNLIB_NO_ERROR;
 }
 
+Int32 xa_nnlib_cnn_init_config(
+     xa_nnlib_cnn_init_config_t *config )
+{
+  CHECK_PTR(config, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  memset(config, 0, sizeof(xa_nnlib_cnn_init_config_t));
+  config->channels_multiplier = 1;
+  config->x_stride = 1;
+  config->y_stride = 1;
+  config->ds_tile_height = 0;   /* auto */
+
+  return XA_NNLIB_NO_ERROR;
+}
+
 Int32 xa_nnlib_cnn_get_persistent_fast(
      xa_nnlib_cnn_init_config_t *config )
 {
@@ -348,6 +412,30 @@ Int32 xa_nnlib_cnn_get_scratch_fast(
                                              config->output_format
                                              );
   }
+  else if(config->algo == XA_NNLIB_CNN_CONV2D_DS && ds_tile_height(config) > 0)
+  {
+    int tile_height = ds_tile_height(config);
+    int band_height = ds_band_height(config, tile_height);
+
+    /* depthwise scratch + input row band + depthwise output rows of one tile */
+    scratch_size = xa_nn_conv2d_depthwise_getsize(band_height,
+                                                  config->input_shape.dim.cube.width,
+                                                  config->input_shape.dim.cube.depth,
+                                                  config->kernel_ds_depth_shape.dim.cube.height,
+                                                  config->kernel_ds_depth_shape.dim.cube.width,
+                                                  config->channels_multiplier,
+                                                  config->x_stride,
+                                                  config->y_stride,
+                                                  config->x_padding,
+                                                  config->y_padding,
+                                                  tile_height,
+                                                  config->output_width,
+                                                  inp_precision,
+                                                  1);   // WHD supported for all precisions
+    scratch_size  = ALIGN_SIZE(scratch_size);
+    scratch_size += ALIGN_SIZE(out_bytewidth * band_height * config->input_shape.dim.cube.width * config->input_shape.dim.cube.depth);
+    scratch_size += out_bytewidth * tile_height * config->output_width * config->input_shape.dim.cube.depth * config->channels_multiplier;
+  }
   else if(config->algo == XA_NNLIB_CNN_CONV2D_DS)
   {
     scratch_size = xa_nn_conv2d_depthwise_getsize(config->input_shape.dim.cube.height,
@@ -552,6 +640,246 @@ int xa_nnlib_cnn_get_config(
   return XA_NNLIB_NO_ERROR;
 }
 
+/* CONV2D_DS with the depthwise output produced tile_height rows at a time and
+ * consumed by pointwise straight away, so only one tile of the intermediate
+ * tensor lives in scratch. Input is WHD, so the rows a tile needs are gathered
+ * from every channel plane into a contiguous band first; pointwise is run as a
+ * matmul writing into the full-size WHD output planes. */
+static int cnn_ds_process_tiled(cnn_state_t *cnn,
+    void *scratch,
+    void *input,
+    void *output,
+    int tile_height)
+{
+  xa_nnlib_cnn_init_config_t *config = &cnn->config;
+  int inp_precision = IO_PRECISION_BITS(config->precision);
+  int bytewidth = IO_PRECISION_BYTES(config->precision);
+  int input_height = config->input_shape.dim.cube.height;
+  int input_width = config->input_shape.dim.cube.width;
+  int input_channels = config->input_shape.dim.cube.depth;
+  int kernel_height = config->kernel_ds_depth_shape.dim.cube.height;
+  int kernel_width = config->kernel_ds_depth_shape.dim.cube.width;
+  int depth_channels = input_channels * config->channels_multiplier;
+  int out_height = cnn->output_shape.dim.cube.height;
+  int out_width = cnn->output_shape.dim.cube.width;
+  int out_channels = cnn->output_shape.dim.cube.depth;
+  int out_plane_size = out_height * out_width;
+  int scratch_size, band_size, itr_oh, itr_ic;
+  char *p_band, *p_tile;
+  int err = 0;
+
+  band_size = bytewidth * ds_band_height(config, tile_height) * input_width * input_channels;
+  scratch_size = xa_nn_conv2d_depthwise_getsize(ds_band_height(config, tile_height),
+                                                input_width,
+                                                input_channels,
+                                                kernel_height,
+                                                kernel_width,
+                                                config->channels_multiplier,
+                                                config->x_stride,
+                                                config->y_stride,
+                                                config->x_padding,
+                                                config->y_padding,
+                                                tile_height,
+                                                out_width,
+                                                inp_precision,
+                                                1);       //must be WHD
+  p_band = (char *) scratch + ALIGN_SIZE(scratch_size);
+  p_tile = p_band + ALIGN_SIZE(band_size);
+
+  for(itr_oh = 0; itr_oh < out_height; itr_oh += tile_height)
+  {
+    int rows = CNN_MIN(tile_height, out_height - itr_oh);
+    int first_row = itr_oh * config->y_stride - config->y_padding;
+    int band_start = CNN_MAX(first_row, 0);
+    int band_end = CNN_MIN(first_row + (rows - 1) * config->y_stride + kernel_height, input_height);
+    int band_height = band_end - band_start;
+    int top_padding = band_start - first_row;
+    int plane_bytes = bytewidth * band_height * input_width;
+
+    for(itr_ic = 0; itr_ic < input_channels; itr_ic++)
+    {
+      memcpy(p_band + itr_ic * plane_bytes,
+             (char *) input + bytewidth * (itr_ic * input_height + band_start) * input_width,
+             plane_bytes);
+    }
+
+    switch(config->precision)
+    {
+      case XA_NNLIB_CNN_16bx16b:
+      {
+        err = xa_nn_conv2d_depthwise_16x16((WORD16 *) p_tile,
+                                           cnn->kernel_ds_depth,
+                                           (WORD16 *) p_band,
+                                           cnn->bias_ds_depth,
+                                           band_height,
+                                           input_width,
+                                           input_channels,
+                                           kernel_height,
+                                           kernel_width,
+                                           config->channels_multiplier,
+                                           config->x_stride,
+                                           config->y_stride,
+                                           config->x_padding,
+                                           top_padding,
+                                           rows,
+                                           out_width,
+                                           config->acc_shift,
+                                           config->bias_shift,
+                                           1, //must be WHD
+                                           0, //must be DWH
+                                           scratch);
+
+        if (err) break;
+
+        err = xa_nn_matmul_16x16_16((WORD16 *) output + itr_oh * out_width,
+                                    cnn->kernel_ds_point,
+                                    (WORD16 *) p_tile,
+                                    cnn->bias_ds_point,
+                                    out_channels,
+                                    depth_channels,
+                                    depth_channels,
+                                    config->acc_shift,
+                                    config->bias_shift,
+                                    rows * out_width,
+                                    depth_channels,
+                                    1,
+                                    out_plane_size);
+      }
+      break;
+      case XA_NNLIB_CNN_8bx16b:
+      {
+        err = xa_nn_conv2d_depthwise_8x16((WORD16 *) p_tile,
+                                          cnn->kernel_ds_depth,
+                                          (WORD16 *) p_band,
+                                          cnn->bias_ds_depth,
+                                          band_height,
+                                          input_width,
+                                          input_channels,
+                                          kernel_height,
+                                          kernel_width,
+                                          config->channels_multiplier,
+                                          config->x_stride,
+                                          config->y_stride,
+                                          config->x_padding,
+                                          top_padding,
+                                          rows,
+                                          out_width,
+                                          config->acc_shift,
+                                          config->bias_shift,
+                                          1, //must be WHD
+                                          0, //must be DWH
+                                          scratch);
+
+        if (err) break;
+
+        err = xa_nn_matmul_8x16_16((WORD16 *) output + itr_oh * out_width,
+                                   cnn->kernel_ds_point,
+                                   (WORD16 *) p_tile,
+                                   cnn->bias_ds_point,
+                                   out_channels,
+                                   depth_channels,
+                                   depth_channels,
+                                   config->acc_shift,
+                                   config->bias_shift,
+                                   rows * out_width,
+                                   depth_channels,
+                                   1,
+                                   out_plane_size);
+      }
+      break;
+      case XA_NNLIB_CNN_8bx8b:
+      {
+        err = xa_nn_conv2d_depthwise_8x8((WORD8 *) p_tile,
+                                         cnn->kernel_ds_depth,
+                                         (WORD8 *) p_band,
+                                         cnn->bias_ds_depth,
+                                         band_height,
+                                         input_width,
+                                         input_channels,
+                                         kernel_height,
+                                         kernel_width,
+                                         config->channels_multiplier,
+                                         config->x_stride,
+                                         config->y_stride,
+                                         config->x_padding,
+                                         top_padding,
+                                         rows,
+                                         out_width,
+                                         config->acc_shift,
+                                         config->bias_shift,
+                                         1, //must be WHD
+                                         0, //must be DWH
+                                         scratch);
+
+        if (err) break;
+
+        err = xa_nn_matmul_8x8_8((WORD8 *) output + itr_oh * out_width,
+                                 cnn->kernel_ds_point,
+                                 (WORD8 *) p_tile,
+                                 cnn->bias_ds_point,
+                                 out_channels,
+                                 depth_channels,
+                                 depth_channels,
+                                 config->acc_shift,
+                                 config->bias_shift,
+                                 rows * out_width,
+                                 depth_channels,
+                                 1,
+                                 out_plane_size);
+      }
+      break;
+#if HAVE_VFPU
+      case XA_NNLIB_CNN_f32xf32:
+      {
+        err = xa_nn_conv2d_depthwise_f32((FLOAT32 *) p_tile,
+                                         cnn->kernel_ds_depth,
+                                         (FLOAT32 *) p_band,
+                                         cnn->bias_ds_depth,
+                                         band_height,
+                                         input_width,
+                                         input_channels,
+                                         kernel_height,
+                                         kernel_width,
+                                         config->channels_multiplier,
+                                         config->x_stride,
+                                         config->y_stride,
+                                         config->x_padding,
+                                         top_padding,
+                                         rows,
+                                         out_width,
+                                         1, //must be WHD
+                                         0, //must be DWH
+                                         scratch);
+
+        if (err) break;
+
+        err = xa_nn_matmul_f32xf32_f32((FLOAT32 *) output + itr_oh * out_width,
+                                       cnn->kernel_ds_point,
+                                       (FLOAT32 *) p_tile,
+                                       cnn->bias_ds_point,
+                                       out_channels,
+                                       depth_channels,
+                                       depth_channels,
+                                       rows * out_width,
+                                       depth_channels,
+                                       1,
+                                       out_plane_size);
+      }
+      break;
+#else
+      case XA_NNLIB_CNN_f32xf32:
+      {
+      }
+      break;
+#endif
+    }
+
+    if (err) break;
+  }
+
+  return err;
+}
+
 int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
     void *scratch,
     void *input,
@@ -802,6 +1130,10 @@ int xa_nnlib_cnn_process(xa_nnlib_handle_t handle,
 #endif
     }
   }
+  else if(config->algo == XA_NNLIB_CNN_CONV2D_DS && ds_tile_height(config) > 0)
+  {
+    err = cnn_ds_process_tiled(cnn, scratch, input, output, ds_tile_height(config));
+  }
   else if(config->algo == XA_NNLIB_CNN_CONV2D_DS)
   {
     int scratch_size;
@@ -216,22 +216,52 @@ Int32 xa_nnlib_gru_get_scratch_fast(
 #if HAVE_VFPU
   if(config->precision == XA_NNLIB_GRU_flt32xflt32) {
     scratch_size += 3 * ALIGN_SIZE(config->out_feats * sizeof(FLOAT32));
+
+    if(config->split_bias == 1){
+      /* For split bias implementation, two extra arrays are needed to hold intermediate sums */
+      scratch_size += 2 * ALIGN_SIZE(config->out_feats * sizeof(FLOAT32));
+    }
+#ifdef MODEL_INT16
+    scratch_size += ALIGN_SIZE(1 * config->out_feats * sizeof(FLOAT32));    //vect scratch
+#endif
   } 
   else
 #endif   
   {
-    scratch_size += 3 * ALIGN_SIZE(config->out_feats * sizeof(vect_t));
+    /* r * prev_h for the fused cell kernel */
+    scratch_size += ALIGN_SIZE(config->out_feats * sizeof(vect_t));
   }
 
-  if(config->split_bias == 1){
-    /* For split bias implementation, two extra arrays are needed to hold intermediate sums */
-    scratch_size += 2 * ALIGN_SIZE(config->out_feats * sizeof(Int32));
+  return scratch_size;
+}
+
+Int32 xa_nnlib_gru_get_scratch_sequence_fast(
+       xa_nnlib_gru_init_config_t *config,
+       Int32 num_steps )
+{
+  int scratch_size;
+
+  scratch_size = xa_nnlib_gru_get_scratch_fast(config);
+  if(scratch_size < 0)
+    return scratch_size;
+
+  if(num_steps < 1)
+    return XA_NNLIB_GRU_CONFIG_FATAL_INVALID_NUM_STEPS;
+
+  if(config->precision != XA_NNLIB_GRU_flt32xflt32)
+  {
+    // The steps go through the per gate kernels: z_or_r and h next to r_x_prev_h,
+    // the 32 bit partial sums for split bias and the activation input
+    scratch_size += 2 * ALIGN_SIZE(config->out_feats * sizeof(vect_t));
+    if(config->split_bias == 1)
+      scratch_size += 2 * ALIGN_SIZE(config->out_feats * sizeof(Int32));
+    scratch_size += ALIGN_SIZE(config->out_feats * sizeof(Int32));
+    // Input projections of the r, h and z gates for all steps, as 64 bit accumulators
+    scratch_size += ALIGN_SIZE(3 * num_steps * config->out_feats * sizeof(WORD64));
+    // Per step input and projection pointers for the batch kernel
+    scratch_size += ALIGN_SIZE(num_steps * sizeof(vect_t *));
+    scratch_size += ALIGN_SIZE(num_steps * sizeof(WORD64 *));
   }
-#ifdef MODEL_FLT64
-  scratch_size += 0;
-#elif MODEL_INT16
-  scratch_size += ALIGN_SIZE(1 * config->out_feats * sizeof(Int32));    //vect scratch
-#endif
 
   return scratch_size;
 }
@@ -576,6 +606,26 @@ static void internal_xa_nn_elm_mul_16x32_32(WORD32 * __restrict__ p_out,
     }
 }
 
+/* 64 bit accumulators to 32 bit with the rounding of the matXvec _32 kernels */
+static void internal_xa_nn_round_64_32(WORD32 * __restrict__ p_out,
+                               const WORD64 * __restrict__ p_inp,
+                               WORD32 lsh,
+                               WORD32 num_elm)
+{
+    int i;
+    ae_int64 *inp = (ae_int64 *)p_inp;
+    ae_int32x2 *out = (ae_int32x2 *)p_out;
+    ae_int64 x1, x2;
+
+    for(i=0;i < num_elm>>1;i++)
+    {
+        AE_L64_IP(x1, inp, 8);
+        AE_L64_IP(x2, inp, 8);
+
+        AE_S32X2_IP(AE_ROUND32X2F64SSYM(AE_SLAA64S(x1, lsh), AE_SLAA64S(x2, lsh)), out, 8);
+    }
+}
+
 static WORD32 internal_xa_nn_elm_add_32x32_32(WORD32 * __restrict__ p_out,
                                const WORD32 * __restrict__ p_inp1,
                                const WORD32 * __restrict__ p_inp2,
@@ -704,17 +754,11 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
   else 
 #endif
   {
+        /* The fused cell kernel keeps the gates in registers, only r * prev_h
+           of the non split bias case needs to go through memory */
         scratch_alloc(sptr, scratch_mem,   scratch_mem_t,  1 );
 
-        scratch_alloc(sptr, scratch_mem->z_or_r, vect_t, gru->out_feats);
         scratch_alloc(sptr, scratch_mem->r_x_prev_h, vect_t, gru->out_feats);
-        scratch_alloc(sptr, scratch_mem->h, vect_t, gru->out_feats);
-
-        if(gru->split_bias == 1) {
-          /* Additional storage sum_part1/2 are required only in split_bias case */
-          scratch_alloc(sptr, scratch_mem->sum_part1, Int32, gru->out_feats);
-          scratch_alloc(sptr, scratch_mem->sum_part2, Int32, gru->out_feats);
-        }
 	}
 
 #ifdef MODEL_FLT64
@@ -725,11 +769,7 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
   if(gru->precision == XA_NNLIB_GRU_flt32xflt32){
         scratch_alloc(sptr, scratch_mem_f32->temp_mem.vec, FLOAT32, gru->out_feats);
 	}
-  else 
 #endif  
-  {
-		scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, gru->out_feats);
-	}
 
 #endif
   }
@@ -737,247 +777,57 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
 #ifdef MODEL_INT16
   if(gru->precision == XA_NNLIB_GRU_16bx16b)
   {
-
-    if(gru->split_bias == 1){
-      xa_nn_matXvec_16x16_32( scratch_mem->sum_part1,
-        gru->weights.weights16.w_r, NULL,
-        input, NULL, gru->biases.bs_r,
-        gru->out_feats, gru->in_feats, 0,
-        gru->in_feats + (gru->pad*XA_PAD_BYTES >> 1), 0,
-        gru->matmul_lsh, gru->bias_shift);
-      xa_nn_matXvec_16x16_32( scratch_mem->sum_part2,
-        gru->weights.weights16.u_r, NULL,
-        gru->prev_h, NULL, gru->biases.b_r,
-        gru->out_feats, gru->out_feats, 0,
-        gru->out_feats + (gru->pad*XA_PAD_BYTES >> 1), 0,
-        gru->matmul_lsh, gru->bias_shift);
-      internal_xa_nn_elm_add_32x32_32(scratch_mem->temp_mem.vec, scratch_mem->sum_part1, scratch_mem->sum_part2, gru->out_feats);
-      xa_nn_vec_sigmoid_32_16(scratch_mem->z_or_r, scratch_mem->temp_mem.vec, gru->out_feats); /* Compute r */
-
-      
-      xa_nn_matXvec_16x16_32( scratch_mem->sum_part1,
-        gru->weights.weights16.u_h, NULL,
-        gru->prev_h, NULL, gru->biases.b_h,
-        gru->out_feats, gru->out_feats, 0,
-        gru->out_feats + (gru->pad*XA_PAD_BYTES >> 1), 0,
-        gru->matmul_lsh, gru->bias_shift);
-      internal_xa_nn_elm_mul_16x32_32(scratch_mem->sum_part2, scratch_mem->z_or_r, scratch_mem->sum_part1, gru->out_feats);
-      xa_nn_matXvec_16x16_32( scratch_mem->sum_part1,
-        gru->weights.weights16.w_h, NULL,
-        input, NULL, gru->biases.bs_h,
-        gru->out_feats, gru->in_feats, 0,
-        gru->in_feats + (gru->pad*XA_PAD_BYTES >> 1), 0,
-        gru->matmul_lsh, gru->bias_shift);
-      internal_xa_nn_elm_add_32x32_32(scratch_mem->temp_mem.vec, scratch_mem->sum_part1, scratch_mem->sum_part2, gru->out_feats);
-      xa_nn_vec_tanh_32_16(scratch_mem->h, scratch_mem->temp_mem.vec, gru->out_feats); /* compute h */
-      
-      apply_inplace_lsh(scratch_mem->h, gru->out_feats, gru->tanh_lsh);
-
-       
-      xa_nn_matXvec_16x16_32( scratch_mem->sum_part1,
-        gru->weights.weights16.w_z, NULL,
-        input, NULL, gru->biases.bs_z,
-        gru->out_feats, gru->in_feats, 0,
-        gru->in_feats + (gru->pad*XA_PAD_BYTES >> 1), 0,
-        gru->matmul_lsh, gru->bias_shift);
-      xa_nn_matXvec_16x16_32( scratch_mem->sum_part2,
-        gru->weights.weights16.u_z, NULL,
-        gru->prev_h, NULL, gru->biases.b_z,
-        gru->out_feats, gru->out_feats, 0,
-        gru->out_feats + (gru->pad*XA_PAD_BYTES >> 1), 0,
-        gru->matmul_lsh, gru->bias_shift);
-      internal_xa_nn_elm_add_32x32_32(scratch_mem->temp_mem.vec, scratch_mem->sum_part1, scratch_mem->sum_part2, gru->out_feats);
-      xa_nn_vec_sigmoid_32_16(scratch_mem->z_or_r, scratch_mem->temp_mem.vec, gru->out_feats); /* Compute z */
-
-      xa_nn_vec_interpolation_q15((vect_t *)output,
-        scratch_mem->z_or_r,
-        gru->prev_h, scratch_mem->h, gru->out_feats);
-
-    } else {
-
-      xa_nn_matXvec_16x16_16_sigmoid(
-        scratch_mem->z_or_r,
-        gru->weights.weights16.w_r,
-        gru->weights.weights16.u_r,
-        input,
-        gru->prev_h,
-        gru->biases.b_r,
-        gru->out_feats,
-        gru->in_feats,
-        gru->out_feats,
-        gru->in_feats + (gru->pad*XA_PAD_BYTES >> 1),
-        gru->out_feats + (gru->pad*XA_PAD_BYTES >> 1),
-        gru->matmul_lsh,
-        gru->bias_shift,
-        16,
-        scratch_mem->temp_mem.vec);
-
-      xa_nn_elm_mul_16x16_16(scratch_mem->r_x_prev_h, scratch_mem->z_or_r, gru->prev_h, gru->out_feats);
-
-      xa_nn_matXvec_16x16_16_tanh(
-        scratch_mem->h,
-        gru->weights.weights16.w_h,
-        gru->weights.weights16.u_h,
-        input,
-        scratch_mem->r_x_prev_h,
-        gru->biases.b_h,
-        gru->out_feats,
-        gru->in_feats,
-        gru->out_feats,
-        gru->in_feats + (gru->pad*XA_PAD_BYTES >> 1),
-        gru->out_feats + (gru->pad*XA_PAD_BYTES >> 1),
-        gru->matmul_lsh,
-        gru->bias_shift,
-        16,
-        scratch_mem->temp_mem.vec);
-
-      apply_inplace_lsh(scratch_mem->h, gru->out_feats, gru->tanh_lsh);
-
-      xa_nn_matXvec_16x16_16_sigmoid(
-        scratch_mem->z_or_r,
-        gru->weights.weights16.w_z,
-        gru->weights.weights16.u_z,
-        input,
-        gru->prev_h,
-        gru->biases.b_z,
-        gru->out_feats,
-        gru->in_feats,
-        gru->out_feats,
-        gru->in_feats + (gru->pad*XA_PAD_BYTES >> 1),
-        gru->out_feats + (gru->pad*XA_PAD_BYTES >> 1),
-        gru->matmul_lsh,
-        gru->bias_shift,
-        16,
-        scratch_mem->temp_mem.vec);
-
-    //h_t step
-      xa_nn_vec_interpolation_q15((vect_t *)output,
-        scratch_mem->z_or_r,
-        gru->prev_h,
-        scratch_mem->h,
-        gru->out_feats);
-    }
+    xa_nn_matXvec_16x16_16_gru_cell(
+      (vect_t *)output,
+      gru->prev_h,
+      gru->weights.weights16.w_z,
+      gru->weights.weights16.w_r,
+      gru->weights.weights16.w_h,
+      gru->weights.weights16.u_z,
+      gru->weights.weights16.u_r,
+      gru->weights.weights16.u_h,
+      input,
+      gru->biases.b_z,
+      gru->biases.b_r,
+      gru->biases.b_h,
+      gru->split_bias ? gru->biases.bs_z : NULL,
+      gru->biases.bs_r,
+      gru->biases.bs_h,
+      gru->out_feats,
+      gru->in_feats,
+      gru->in_feats + (gru->pad*XA_PAD_BYTES >> 1),
+      gru->out_feats + (gru->pad*XA_PAD_BYTES >> 1),
+      gru->matmul_lsh,
+      gru->bias_shift,
+      gru->tanh_lsh,
+      scratch_mem->r_x_prev_h);
   }
   else if(gru->precision == XA_NNLIB_GRU_8bx16b)
   {
-
-    if(gru->split_bias == 1){
-      xa_nn_matXvec_8x16_32( scratch_mem->sum_part1,
-        gru->weights.weights8.w_r, NULL,
-        input, NULL, gru->biases.bs_r,
-        gru->out_feats, gru->in_feats, 0,
-        gru->in_feats + gru->pad*XA_PAD_BYTES, 0,
-        gru->matmul_lsh, gru->bias_shift);
-      xa_nn_matXvec_8x16_32( scratch_mem->sum_part2,
-        gru->weights.weights8.u_r, NULL,
-        gru->prev_h, NULL, gru->biases.b_r,
-        gru->out_feats, gru->out_feats, 0,
-        gru->out_feats + gru->pad*XA_PAD_BYTES, 0,
-        gru->matmul_lsh, gru->bias_shift);
-      internal_xa_nn_elm_add_32x32_32(scratch_mem->temp_mem.vec, scratch_mem->sum_part1, scratch_mem->sum_part2, gru->out_feats);
-      xa_nn_vec_sigmoid_32_16(scratch_mem->z_or_r, scratch_mem->temp_mem.vec, gru->out_feats); /* Compute r */
-
-      
-      xa_nn_matXvec_8x16_32( scratch_mem->sum_part1,
-        gru->weights.weights8.u_h, NULL,
-        gru->prev_h, NULL, gru->biases.b_h,
-        gru->out_feats, gru->out_feats, 0,
-        gru->out_feats + gru->pad*XA_PAD_BYTES, 0,
-        gru->matmul_lsh, gru->bias_shift);
-      internal_xa_nn_elm_mul_16x32_32(scratch_mem->sum_part2, scratch_mem->z_or_r, scratch_mem->sum_part1, gru->out_feats);
-      xa_nn_matXvec_8x16_32( scratch_mem->sum_part1,
-        gru->weights.weights8.w_h, NULL,
-        input, NULL, gru->biases.bs_h,
-        gru->out_feats, gru->in_feats, 0,
-        gru->in_feats + gru->pad*XA_PAD_BYTES, 0,
-        gru->matmul_lsh, gru->bias_shift);
-      internal_xa_nn_elm_add_32x32_32(scratch_mem->temp_mem.vec, scratch_mem->sum_part1, scratch_mem->sum_part2, gru->out_feats);
-      xa_nn_vec_tanh_32_16(scratch_mem->h, scratch_mem->temp_mem.vec, gru->out_feats); /* compute h */
-      
-      apply_inplace_lsh(scratch_mem->h, gru->out_feats, gru->tanh_lsh);
-
-       
-      xa_nn_matXvec_8x16_32( scratch_mem->sum_part1,
-        gru->weights.weights8.w_z, NULL,
-        input, NULL, gru->biases.bs_z,
-        gru->out_feats, gru->in_feats, 0,
-        gru->in_feats + gru->pad*XA_PAD_BYTES, 0,
-        gru->matmul_lsh, gru->bias_shift);
-      xa_nn_matXvec_8x16_32( scratch_mem->sum_part2,
-        gru->weights.weights8.u_z, NULL,
-        gru->prev_h, NULL, gru->biases.b_z,
-        gru->out_feats, gru->out_feats, 0,
-        gru->out_feats + gru->pad*XA_PAD_BYTES, 0,
-        gru->matmul_lsh, gru->bias_shift);
-      internal_xa_nn_elm_add_32x32_32(scratch_mem->temp_mem.vec, scratch_mem->sum_part1, scratch_mem->sum_part2, gru->out_feats);
-      xa_nn_vec_sigmoid_32_16(scratch_mem->z_or_r, scratch_mem->temp_mem.vec, gru->out_feats); /* Compute z */
-
-      xa_nn_vec_interpolation_q15((vect_t *)output,
-        scratch_mem->z_or_r,
-        gru->prev_h, scratch_mem->h, gru->out_feats);
-
-    } else {
-      xa_nn_matXvec_8x16_16_sigmoid(
-        scratch_mem->z_or_r,
-        gru->weights.weights8.w_r,
-        gru->weights.weights8.u_r,
-        input,
-        gru->prev_h,
-        gru->biases.b_r,
-        gru->out_feats,
-        gru->in_feats,
-        gru->out_feats,
-        gru->in_feats + gru->pad*XA_PAD_BYTES,
-        gru->out_feats + gru->pad*XA_PAD_BYTES,
-        gru->matmul_lsh,
-        gru->bias_shift,
-        16,
-        scratch_mem->temp_mem.vec);
-      xa_nn_elm_mul_16x16_16(scratch_mem->r_x_prev_h, scratch_mem->z_or_r, gru->prev_h, gru->out_feats);
-
-      xa_nn_matXvec_8x16_16_tanh(
-        scratch_mem->h,
-        gru->weights.weights8.w_h,
-        gru->weights.weights8.u_h,
-        input,
-        scratch_mem->r_x_prev_h,
-        gru->biases.b_h,
-        gru->out_feats,
-        gru->in_feats,
-        gru->out_feats,
-        gru->in_feats + gru->pad*XA_PAD_BYTES,
-        gru->out_feats + gru->pad*XA_PAD_BYTES,
-        gru->matmul_lsh,
-        gru->bias_shift,
-        16,
-        scratch_mem->temp_mem.vec);
-
-      apply_inplace_lsh(scratch_mem->h, gru->out_feats, gru->tanh_lsh);
-
-      xa_nn_matXvec_8x16_16_sigmoid(
-        scratch_mem->z_or_r,
-        gru->weights.weights8.w_z,
-        gru->weights.weights8.u_z,
-        input,
-        gru->prev_h,
-        gru->biases.b_z,
-        gru->out_feats,
-        gru->in_feats,
-        gru->out_feats,
-        gru->in_feats + gru->pad*XA_PAD_BYTES,
-        gru->out_feats + gru->pad*XA_PAD_BYTES,
-        gru->matmul_lsh,
-        gru->bias_shift,
-        16,
-        scratch_mem->temp_mem.vec);
-
-      //h_t step
-      xa_nn_vec_interpolation_q15((vect_t *)output,
-        scratch_mem->z_or_r,
-        gru->prev_h,
-        scratch_mem->h,
-        gru->out_feats);
-    }
+    xa_nn_matXvec_8x16_16_gru_cell(
+      (vect_t *)output,
+      gru->prev_h,
+      gru->weights.weights8.w_z,
+      gru->weights.weights8.w_r,
+      gru->weights.weights8.w_h,
+      gru->weights.weights8.u_z,
+      gru->weights.weights8.u_r,
+      gru->weights.weights8.u_h,
+      input,
+      gru->biases.b_z,
+      gru->biases.b_r,
+      gru->biases.b_h,
+      gru->split_bias ? gru->biases.bs_z : NULL,
+      gru->biases.bs_r,
+      gru->biases.bs_h,
+      gru->out_feats,
+      gru->in_feats,
+      gru->in_feats + gru->pad*XA_PAD_BYTES,
+      gru->out_feats + gru->pad*XA_PAD_BYTES,
+      gru->matmul_lsh,
+      gru->bias_shift,
+      gru->tanh_lsh,
+      scratch_mem->r_x_prev_h);
   }
 #if HAVE_VFPU
   else if(gru->precision == XA_NNLIB_GRU_flt32xflt32)
@@ -1087,3 +937,275 @@ int xa_nnlib_gru_process(xa_nnlib_handle_t handle,
 
   return XA_NNLIB_NO_ERROR;
 }
+
+#ifdef MODEL_INT16
+static char *gru_setup_scratch(gru_state_t *gru, void *scratch, scratch_mem_t **pp_scratch_mem)
+{
+  char *sptr = (char *)scratch;
+  scratch_mem_t *scratch_mem;
+
+  scratch_alloc(sptr, scratch_mem,   scratch_mem_t,  1 );
+
+  scratch_alloc(sptr, scratch_mem->z_or_r, vect_t, gru->out_feats);
+  scratch_alloc(sptr, scratch_mem->r_x_prev_h, vect_t, gru->out_feats);
+  scratch_alloc(sptr, scratch_mem->h, vect_t, gru->out_feats);
+
+  if(gru->split_bias == 1) {
+    scratch_alloc(sptr, scratch_mem->sum_part1, Int32, gru->out_feats);
+    scratch_alloc(sptr, scratch_mem->sum_part2, Int32, gru->out_feats);
+  }
+
+  scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, gru->out_feats);
+
+  *pp_scratch_mem = scratch_mem;
+
+  return sptr;
+}
+
+/* W * x + bias of one gate for all steps, kept as unshifted 64 bit accumulators */
+static void gru_input_projection(gru_state_t *gru, WORD64 **pp_proj, void *p_w, void *p_bias, vect_t **pp_input, int num_steps)
+{
+  if(gru->precision == XA_NNLIB_GRU_16bx16b)
+  {
+    xa_nn_matXvec_batch_16x16_64(
+        pp_proj,
+        (coeff_t *)p_w,
+        pp_input,
+        (coeff_t *)p_bias,
+        gru->out_feats,
+        gru->in_feats,
+        gru->in_feats + (gru->pad*XA_PAD_BYTES >> 1),
+        0,
+        gru->bias_shift,
+        num_steps);
+  }
+  else if(gru->precision == XA_NNLIB_GRU_8bx16b)
+  {
+    xa_nn_matXvec_batch_8x16_64(
+        pp_proj,
+        (coeff8_t *)p_w,
+        pp_input,
+        (coeff_t *)p_bias,
+        gru->out_feats,
+        gru->in_feats,
+        gru->in_feats + gru->pad*XA_PAD_BYTES,
+        0,
+        gru->bias_shift,
+        num_steps);
+  }
+}
+
+/* sigmoid or tanh of U * p_vec + p_proj, the projection goes in as a 64 bit bias */
+static void gru_recurrent_gate(gru_state_t *gru, vect_t *p_out, void *p_u, vect_t *p_vec, WORD64 *p_proj, int use_tanh, Int32 *p_scratch)
+{
+  if(gru->precision == XA_NNLIB_GRU_16bx16b)
+  {
+    if(use_tanh)
+    {
+      xa_nn_matXvec_16x16_16_tanh(p_out, (coeff_t *)p_u, NULL, p_vec, NULL, p_proj,
+          gru->out_feats, gru->out_feats, 0,
+          gru->out_feats + (gru->pad*XA_PAD_BYTES >> 1), 0,
+          gru->matmul_lsh, 0, 64, p_scratch);
+    }
+    else
+    {
+      xa_nn_matXvec_16x16_16_sigmoid(p_out, (coeff_t *)p_u, NULL, p_vec, NULL, p_proj,
+          gru->out_feats, gru->out_feats, 0,
+          gru->out_feats + (gru->pad*XA_PAD_BYTES >> 1), 0,
+          gru->matmul_lsh, 0, 64, p_scratch);
+    }
+  }
+  else if(gru->precision == XA_NNLIB_GRU_8bx16b)
+  {
+    if(use_tanh)
+    {
+      xa_nn_matXvec_8x16_16_tanh(p_out, (coeff8_t *)p_u, NULL, p_vec, NULL, p_proj,
+          gru->out_feats, gru->out_feats, 0,
+          gru->out_feats + gru->pad*XA_PAD_BYTES, 0,
+          gru->matmul_lsh, 0, 64, p_scratch);
+    }
+    else
+    {
+      xa_nn_matXvec_8x16_16_sigmoid(p_out, (coeff8_t *)p_u, NULL, p_vec, NULL, p_proj,
+          gru->out_feats, gru->out_feats, 0,
+          gru->out_feats + gru->pad*XA_PAD_BYTES, 0,
+          gru->matmul_lsh, 0, 64, p_scratch);
+    }
+  }
+}
+
+/* U * prev_h + bias as 32 bit partial sum, for the split bias case */
+static void gru_recurrent_sum(gru_state_t *gru, Int32 *p_out, void *p_u, void *p_bias)
+{
+  if(gru->precision == XA_NNLIB_GRU_16bx16b)
+  {
+    xa_nn_matXvec_16x16_32( p_out,
+      (coeff_t *)p_u, NULL,
+      gru->prev_h, NULL, p_bias,
+      gru->out_feats, gru->out_feats, 0,
+      gru->out_feats + (gru->pad*XA_PAD_BYTES >> 1), 0,
+      gru->matmul_lsh, gru->bias_shift);
+  }
+  else if(gru->precision == XA_NNLIB_GRU_8bx16b)
+  {
+    xa_nn_matXvec_8x16_32( p_out,
+      (coeff8_t *)p_u, NULL,
+      gru->prev_h, NULL, p_bias,
+      gru->out_feats, gru->out_feats, 0,
+      gru->out_feats + gru->pad*XA_PAD_BYTES, 0,
+      gru->matmul_lsh, gru->bias_shift);
+  }
+}
+#endif
+
+int xa_nnlib_gru_process_sequence(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    Int32 num_steps)
+{
+  gru_state_t *gru;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  if(num_steps < 1)
+  {
+    return XA_NNLIB_GRU_EXECUTE_FATAL_INVALID_NUM_STEPS;
+  }
+
+  gru = (gru_state_t *) handle;
+
+#if HAVE_VFPU
+  if(gru->precision == XA_NNLIB_GRU_flt32xflt32)
+  {
+    /* No accumulator to carry across the split, run the steps one by one */
+    xa_nnlib_shape_t in_shape, out_shape;
+    int t, ret;
+
+    for(t = 0; t < num_steps; t++)
+    {
+      in_shape.shape_type = SHAPE_VECTOR_T;
+      in_shape.dim.vector.length = gru->in_feats;
+      out_shape.shape_type = SHAPE_VECTOR_T;
+      out_shape.dim.vector.length = gru->out_feats;
+
+      ret = xa_nnlib_gru_process(handle, scratch,
+          (FLOAT32 *)input + t * gru->in_feats,
+          (FLOAT32 *)output + t * gru->out_feats,
+          &in_shape, &out_shape);
+      if(ret != XA_NNLIB_NO_ERROR)
+        return ret;
+    }
+    return XA_NNLIB_NO_ERROR;
+  }
+#endif
+
+#ifdef MODEL_INT16
+  {
+    scratch_mem_t *scratch_mem;
+    WORD64 *proj;
+    WORD64 **pp_proj;
+    vect_t **pp_input;
+    char *sptr;
+    void *w[3], *u[3], *b[3], *bs[3];
+    int g, t;
+    int out_feats = gru->out_feats;
+
+    //setup scratch
+    sptr = gru_setup_scratch(gru, scratch, &scratch_mem);
+    scratch_alloc(sptr, proj, WORD64, 3 * num_steps * out_feats);
+    scratch_alloc(sptr, pp_input, vect_t *, num_steps);
+    scratch_alloc(sptr, pp_proj, WORD64 *, num_steps);
+
+    /* Gates in r, h, z order */
+    if(gru->precision == XA_NNLIB_GRU_16bx16b)
+    {
+      w[0] = gru->weights.weights16.w_r; u[0] = gru->weights.weights16.u_r;
+      w[1] = gru->weights.weights16.w_h; u[1] = gru->weights.weights16.u_h;
+      w[2] = gru->weights.weights16.w_z; u[2] = gru->weights.weights16.u_z;
+    }
+    else
+    {
+      w[0] = gru->weights.weights8.w_r; u[0] = gru->weights.weights8.u_r;
+      w[1] = gru->weights.weights8.w_h; u[1] = gru->weights.weights8.u_h;
+      w[2] = gru->weights.weights8.w_z; u[2] = gru->weights.weights8.u_z;
+    }
+    b[0] = gru->biases.b_r; bs[0] = gru->biases.bs_r;
+    b[1] = gru->biases.b_h; bs[1] = gru->biases.bs_h;
+    b[2] = gru->biases.b_z; bs[2] = gru->biases.bs_z;
+
+    for(t = 0; t < num_steps; t++)
+    {
+      pp_input[t] = (vect_t *)input + t * gru->in_feats;
+    }
+
+    /* Input half of every gate for all steps; with split bias the input side
+       carries bs_*, otherwise the whole bias goes in here */
+    for(g = 0; g < 3; g++)
+    {
+      for(t = 0; t < num_steps; t++)
+      {
+        pp_proj[t] = proj + (g * num_steps + t) * out_feats;
+      }
+      gru_input_projection(gru, pp_proj, w[g], gru->split_bias ? bs[g] : b[g], pp_input, num_steps);
+    }
+
+    for(t = 0; t < num_steps; t++)
+    {
+      WORD64 *proj_r = proj + (0 * num_steps + t) * out_feats;
+      WORD64 *proj_h = proj + (1 * num_steps + t) * out_feats;
+      WORD64 *proj_z = proj + (2 * num_steps + t) * out_feats;
+
+      if(gru->split_bias == 1)
+      {
+        internal_xa_nn_round_64_32(scratch_mem->sum_part1, proj_r, gru->matmul_lsh + 32, out_feats);
+        gru_recurrent_sum(gru, scratch_mem->sum_part2, u[0], b[0]);
+        internal_xa_nn_elm_add_32x32_32(scratch_mem->temp_mem.vec, scratch_mem->sum_part1, scratch_mem->sum_part2, out_feats);
+        xa_nn_vec_sigmoid_32_16(scratch_mem->z_or_r, scratch_mem->temp_mem.vec, out_feats); /* Compute r */
+
+        gru_recurrent_sum(gru, scratch_mem->sum_part1, u[1], b[1]);
+        internal_xa_nn_elm_mul_16x32_32(scratch_mem->sum_part2, scratch_mem->z_or_r, scratch_mem->sum_part1, out_feats);
+        internal_xa_nn_round_64_32(scratch_mem->sum_part1, proj_h, gru->matmul_lsh + 32, out_feats);
+        internal_xa_nn_elm_add_32x32_32(scratch_mem->temp_mem.vec, scratch_mem->sum_part1, scratch_mem->sum_part2, out_feats);
+        xa_nn_vec_tanh_32_16(scratch_mem->h, scratch_mem->temp_mem.vec, out_feats); /* compute h */
+
+        apply_inplace_lsh(scratch_mem->h, out_feats, gru->tanh_lsh);
+
+        internal_xa_nn_round_64_32(scratch_mem->sum_part1, proj_z, gru->matmul_lsh + 32, out_feats);
+        gru_recurrent_sum(gru, scratch_mem->sum_part2, u[2], b[2]);
+        internal_xa_nn_elm_add_32x32_32(scratch_mem->temp_mem.vec, scratch_mem->sum_part1, scratch_mem->sum_part2, out_feats);
+        xa_nn_vec_sigmoid_32_16(scratch_mem->z_or_r, scratch_mem->temp_mem.vec, out_feats); /* Compute z */
+      }
+      else
+      {
+        gru_recurrent_gate(gru, scratch_mem->z_or_r, u[0], gru->prev_h, proj_r, 0, scratch_mem->temp_mem.vec);
+
+        xa_nn_elm_mul_16x16_16(scratch_mem->r_x_prev_h, scratch_mem->z_or_r, gru->prev_h, out_feats);
+
+        gru_recurrent_gate(gru, scratch_mem->h, u[1], scratch_mem->r_x_prev_h, proj_h, 1, scratch_mem->temp_mem.vec);
+
+        apply_inplace_lsh(scratch_mem->h, out_feats, gru->tanh_lsh);
+
+        gru_recurrent_gate(gru, scratch_mem->z_or_r, u[2], gru->prev_h, proj_z, 0, scratch_mem->temp_mem.vec);
+      }
+
+      //h_t step
+      xa_nn_vec_interpolation_q15((vect_t *)output + t * out_feats,
+        scratch_mem->z_or_r,
+        gru->prev_h,
+        scratch_mem->h,
+        out_feats);
+    }
+  }
+#endif
+
+  return XA_NNLIB_NO_ERROR;
+}
@@ -79,7 +79,10 @@ typedef struct _lstm_state_t
   vect_t *prev_h;
   int *prev_c;
   xa_nnlib_lstm_weights_t weights;
+  xa_nnlib_lstm_gate_weights_t gate_weights;
   xa_nnlib_lstm_biases_t biases;
+  coeff_t *gate_bias;
+  int use_gate_weights;
   int in_feats;
   int out_feats;
   int pad;
@@ -101,6 +104,7 @@ typedef struct _scratch_mem_t
   vect_t *f_f;
   vect_t *i_f_or_o_f;
   vect_t *c_hat_f_or_tanh_c_f;
+  vect_t *o_f;
   temp_mem_t temp_mem;
 } scratch_mem_t;
 
@@ -183,6 +187,8 @@ Int32 xa_nnlib_lstm_get_persistent_fast(
   // Size of prev_h and prev_c
   persistent_size += ALIGN_SIZE(config->out_feats * sizeof(vect_t));
   persistent_size += ALIGN_SIZE(config->out_feats * sizeof(int));
+  // Gate-interleaved copy of the biases
+  persistent_size += ALIGN_SIZE(4 * config->out_feats * sizeof(coeff_t));
 
   return persistent_size;
 }
@@ -198,7 +204,8 @@ Int32 xa_nnlib_lstm_get_scratch_fast(
     return ret;
 
   scratch_size = ALIGN_SIZE(sizeof(scratch_mem_t));
-  scratch_size += 3 * ALIGN_SIZE(config->out_feats * sizeof(vect_t));
+  // f, i, c_hat and o gates, contiguous for the fused gate kernel
+  scratch_size += ALIGN_SIZE(4 * config->out_feats * sizeof(vect_t));
 #ifdef MODEL_FLT64
   scratch_size += 0;
 #elif MODEL_INT16
@@ -208,6 +215,28 @@ Int32 xa_nnlib_lstm_get_scratch_fast(
   return scratch_size;
 }
 
+Int32 xa_nnlib_lstm_get_scratch_sequence_fast(
+       xa_nnlib_lstm_init_config_t *config,
+       Int32 num_steps )
+{
+  int scratch_size;
+
+  scratch_size = xa_nnlib_lstm_get_scratch_fast(config);
+  if(scratch_size < 0)
+    return scratch_size;
+
+  if(num_steps < 1)
+    return XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_NUM_STEPS;
+
+  // Input projections of the four gates for all steps, as 64 bit accumulators
+  scratch_size += ALIGN_SIZE(4 * num_steps * config->out_feats * sizeof(WORD64));
+  // Per step input and projection pointers for the batch kernel
+  scratch_size += ALIGN_SIZE(num_steps * sizeof(vect_t *));
+  scratch_size += ALIGN_SIZE(num_steps * sizeof(WORD64 *));
+
+  return scratch_size;
+}
+
 int __attribute__((optimize ("-O0"))) xa_nnlib_lstm_init(
     xa_nnlib_handle_t handle,
     xa_nnlib_lstm_init_config_t *config )
@@ -242,6 +271,9 @@ int __attribute__((optimize ("-O0"))) xa_nnlib_lstm_init(
   lstm->prev_c = (int *)ALIGN_MEM((char *)lstm->prev_h + config->out_feats * sizeof(vect_t));
   memset(lstm->prev_c,0, config->out_feats * sizeof(int));
 
+  lstm->gate_bias = (coeff_t *)ALIGN_MEM((char *)lstm->prev_c + config->out_feats * sizeof(int));
+  memset(lstm->gate_bias,0, 4 * config->out_feats * sizeof(coeff_t));
+
   return XA_NNLIB_NO_ERROR;
 }
 
@@ -310,11 +342,38 @@ int xa_nnlib_lstm_set_config(
           lstm->weights.weights8.w_hc = p_weights->weights8.w_hc;
           lstm->weights.weights8.w_ho = p_weights->weights8.w_ho;
       }
+      lstm->use_gate_weights = 0;
+    }
+    break;
+
+    case XA_NNLIB_LSTM_GATE_WEIGHT:
+    {
+      xa_nnlib_lstm_gate_weights_t *p_weights;
+      p_weights = (xa_nnlib_lstm_gate_weights_t *)params;
+
+      if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+      {
+          CHECK_MTX_SHAPE(p_weights->weights16.shape_w_x, 4 * lstm->out_feats, lstm->in_feats)
+          CHECK_MTX_SHAPE(p_weights->weights16.shape_w_h, 4 * lstm->out_feats, lstm->out_feats)
+
+          lstm->gate_weights.weights16.w_x = p_weights->weights16.w_x;
+          lstm->gate_weights.weights16.w_h = p_weights->weights16.w_h;
+      }
+      else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+      {
+          CHECK_MTX_SHAPE(p_weights->weights8.shape_w_x, 4 * lstm->out_feats, lstm->in_feats)
+          CHECK_MTX_SHAPE(p_weights->weights8.shape_w_h, 4 * lstm->out_feats, lstm->out_feats)
+
+          lstm->gate_weights.weights8.w_x = p_weights->weights8.w_x;
+          lstm->gate_weights.weights8.w_h = p_weights->weights8.w_h;
+      }
+      lstm->use_gate_weights = 1;
     }
     break;
 
     case XA_NNLIB_LSTM_BIAS:
     {
+      int i;
       xa_nnlib_lstm_biases_t *p_biases;
       p_biases = (xa_nnlib_lstm_biases_t *)params;
 
@@ -327,6 +386,15 @@ int xa_nnlib_lstm_set_config(
       lstm->biases.b_i = p_biases->b_i;
       lstm->biases.b_c = p_biases->b_c;
       lstm->biases.b_o = p_biases->b_o;
+
+      // Interleaved copy for the fused gate kernel, same order as the gate weights
+      for(i = 0; i < lstm->out_feats; i++)
+      {
+        lstm->gate_bias[4*i + 0] = p_biases->b_f[i];
+        lstm->gate_bias[4*i + 1] = p_biases->b_i[i];
+        lstm->gate_bias[4*i + 2] = p_biases->b_c[i];
+        lstm->gate_bias[4*i + 3] = p_biases->b_o[i];
+      }
     }
     break;
 
@@ -424,6 +492,30 @@ int xa_nnlib_lstm_get_config(
     }
     break;
 
+    case XA_NNLIB_LSTM_GATE_WEIGHT:
+    {
+      xa_nnlib_lstm_gate_weights_t *p_weights;
+      p_weights = (xa_nnlib_lstm_gate_weights_t *)params;
+
+      if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+      {
+          memcpy(&(p_weights->weights16.shape_w_x), &(lstm->gate_weights.weights16.shape_w_x), sizeof(xa_nnlib_shape_t));
+          memcpy(&(p_weights->weights16.shape_w_h), &(lstm->gate_weights.weights16.shape_w_h), sizeof(xa_nnlib_shape_t));
+
+          p_weights->weights16.w_x = lstm->gate_weights.weights16.w_x;
+          p_weights->weights16.w_h = lstm->gate_weights.weights16.w_h;
+      }
+      else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+      {
+          memcpy(&(p_weights->weights8.shape_w_x), &(lstm->gate_weights.weights8.shape_w_x), sizeof(xa_nnlib_shape_t));
+          memcpy(&(p_weights->weights8.shape_w_h), &(lstm->gate_weights.weights8.shape_w_h), sizeof(xa_nnlib_shape_t));
+
+          p_weights->weights8.w_x = lstm->gate_weights.weights8.w_x;
+          p_weights->weights8.w_h = lstm->gate_weights.weights8.w_h;
+      }
+    }
+    break;
+
     case XA_NNLIB_LSTM_BIAS:
     {
       xa_nnlib_lstm_biases_t *p_biases;
@@ -488,6 +580,31 @@ int xa_nnlib_lstm_get_config(
   return XA_NNLIB_NO_ERROR;
 }
 
+static char *lstm_setup_scratch(lstm_state_t *lstm, void *scratch, scratch_mem_t **pp_scratch_mem)
+{
+  char *sptr = (char *)scratch;
+  scratch_mem_t *scratch_mem;
+
+  scratch_alloc(sptr, scratch_mem,   scratch_mem_t,  1 );
+
+  scratch_alloc(sptr, scratch_mem->f_f, vect_t, 4 * lstm->out_feats);
+  scratch_mem->i_f_or_o_f = scratch_mem->f_f + lstm->out_feats;
+  scratch_mem->c_hat_f_or_tanh_c_f = scratch_mem->i_f_or_o_f + lstm->out_feats;
+  scratch_mem->o_f = scratch_mem->c_hat_f_or_tanh_c_f + lstm->out_feats;
+
+#ifdef MODEL_FLT64
+  scratch_mem->temp_mem.vec = NULL ;
+
+#elif MODEL_INT16
+  scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, lstm->out_feats);
+
+#endif
+
+  *pp_scratch_mem = scratch_mem;
+
+  return sptr;
+}
+
 int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
     void *scratch,
     void *input,
@@ -531,26 +648,72 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
   p_out_shape->dim.vector.length = lstm->out_feats;
 
   //setup scratch
-  {
-    char *sptr = (char *)scratch;
-
-    scratch_alloc(sptr, scratch_mem,   scratch_mem_t,  1 );
+  lstm_setup_scratch(lstm, scratch, &scratch_mem);
 
-    scratch_alloc(sptr, scratch_mem->f_f, vect_t, lstm->out_feats);
-    scratch_alloc(sptr, scratch_mem->i_f_or_o_f, vect_t, lstm->out_feats);
-    scratch_alloc(sptr, scratch_mem->c_hat_f_or_tanh_c_f, vect_t, lstm->out_feats);
+#ifdef MODEL_INT16
+  if(lstm->use_gate_weights)
+  {
+    /* All four gates in one pass over input and prev_h, written to
+       f_f, i_f_or_o_f, c_hat_f_or_tanh_c_f and o_f */
+    if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+    {
+      xa_nn_matXvec_16x16_16_lstm_gates(
+          scratch_mem->f_f,
+          lstm->gate_weights.weights16.w_x,
+          lstm->gate_weights.weights16.w_h,
+          input,
+          lstm->prev_h,
+          lstm->gate_bias,
+          lstm->out_feats,
+          lstm->in_feats,
+          lstm->out_feats,
+          lstm->in_feats + lstm->pad*XA_PAD_BYTES,
+          lstm->out_feats + lstm->pad*XA_PAD_BYTES,
+          lstm->matmul_lsh,
+          lstm->bias_shift);
+    }
+    else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+    {
+      xa_nn_matXvec_8x16_16_lstm_gates(
+          scratch_mem->f_f,
+          lstm->gate_weights.weights8.w_x,
+          lstm->gate_weights.weights8.w_h,
+          input,
+          lstm->prev_h,
+          lstm->gate_bias,
+          lstm->out_feats,
+          lstm->in_feats,
+          lstm->out_feats,
+          lstm->in_feats + lstm->pad*XA_PAD_BYTES,
+          lstm->out_feats + lstm->pad*XA_PAD_BYTES,
+          lstm->matmul_lsh,
+          lstm->bias_shift);
+    }
 
-#ifdef MODEL_FLT64
-    scratch_mem->temp_mem.vec = NULL ;
+    vec_elem_mul_16x32plus16x16_16(
+        lstm->prev_c,
+        scratch_mem->f_f,
+        lstm->prev_c,
+        scratch_mem->i_f_or_o_f,
+        scratch_mem->c_hat_f_or_tanh_c_f,
+        lstm->fXprev_c_lsh,
+        lstm->iXc_hat_lsh,
+        lstm->out_feats);
 
-#elif MODEL_INT16
-    scratch_alloc(sptr, scratch_mem->temp_mem.vec, Int32, lstm->out_feats);
+    xa_nn_vec_tanh_32_16(
+        scratch_mem->c_hat_f_or_tanh_c_f,
+        lstm->prev_c,
+        lstm->out_feats);
 
-#endif
+    lstm_output_kernel_16x16_16(
+        (vect_t*)output,
+        lstm->prev_h,
+        scratch_mem->o_f,
+        scratch_mem->c_hat_f_or_tanh_c_f,
+        lstm->h_lsh,
+        lstm->out_feats);
   }
-
-#ifdef MODEL_INT16
-  if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+  else if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
   {
 
     xa_nn_matXvec_16x16_16_sigmoid(
@@ -744,3 +907,223 @@ int xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
 
   return XA_NNLIB_NO_ERROR;
 }
+
+#ifdef MODEL_INT16
+/* Per gate weight matrices in f, i, c, o order. With gate-interleaved weights
+   gate g starts at row g and takes every 4th row, so only the row stride changes. */
+static void lstm_gate_matrices(lstm_state_t *lstm, void **p_w_x, void **p_w_h, int *x_row_stride, int *h_row_stride)
+{
+  int g;
+
+  *x_row_stride = lstm->in_feats + lstm->pad*XA_PAD_BYTES;
+  *h_row_stride = lstm->out_feats + lstm->pad*XA_PAD_BYTES;
+
+  if(lstm->use_gate_weights)
+  {
+    for(g = 0; g < 4; g++)
+    {
+      if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+      {
+        p_w_x[g] = lstm->gate_weights.weights16.w_x + g * (*x_row_stride);
+        p_w_h[g] = lstm->gate_weights.weights16.w_h + g * (*h_row_stride);
+      }
+      else
+      {
+        p_w_x[g] = lstm->gate_weights.weights8.w_x + g * (*x_row_stride);
+        p_w_h[g] = lstm->gate_weights.weights8.w_h + g * (*h_row_stride);
+      }
+    }
+    *x_row_stride *= 4;
+    *h_row_stride *= 4;
+  }
+  else if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+  {
+    p_w_x[0] = lstm->weights.weights16.w_xf; p_w_h[0] = lstm->weights.weights16.w_hf;
+    p_w_x[1] = lstm->weights.weights16.w_xi; p_w_h[1] = lstm->weights.weights16.w_hi;
+    p_w_x[2] = lstm->weights.weights16.w_xc; p_w_h[2] = lstm->weights.weights16.w_hc;
+    p_w_x[3] = lstm->weights.weights16.w_xo; p_w_h[3] = lstm->weights.weights16.w_ho;
+  }
+  else
+  {
+    p_w_x[0] = lstm->weights.weights8.w_xf; p_w_h[0] = lstm->weights.weights8.w_hf;
+    p_w_x[1] = lstm->weights.weights8.w_xi; p_w_h[1] = lstm->weights.weights8.w_hi;
+    p_w_x[2] = lstm->weights.weights8.w_xc; p_w_h[2] = lstm->weights.weights8.w_hc;
+    p_w_x[3] = lstm->weights.weights8.w_xo; p_w_h[3] = lstm->weights.weights8.w_ho;
+  }
+}
+
+/* W_x * x + bias of one gate for all steps, kept as unshifted 64 bit accumulators */
+static void lstm_input_projection(lstm_state_t *lstm, WORD64 **pp_proj, void *p_w_x, int x_row_stride, coeff_t *p_bias, vect_t **pp_input, int num_steps)
+{
+  if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+  {
+    xa_nn_matXvec_batch_16x16_64(
+        pp_proj,
+        (coeff_t *)p_w_x,
+        pp_input,
+        p_bias,
+        lstm->out_feats,
+        lstm->in_feats,
+        x_row_stride,
+        0,
+        lstm->bias_shift,
+        num_steps);
+  }
+  else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+  {
+    xa_nn_matXvec_batch_8x16_64(
+        pp_proj,
+        (coeff8_t *)p_w_x,
+        pp_input,
+        p_bias,
+        lstm->out_feats,
+        lstm->in_feats,
+        x_row_stride,
+        0,
+        lstm->bias_shift,
+        num_steps);
+  }
+}
+
+/* sigmoid or tanh of W_h * prev_h + p_proj, the projection goes in as a 64 bit bias */
+static void lstm_recurrent_gate(lstm_state_t *lstm, vect_t *p_out, void *p_w_h, int h_row_stride, WORD64 *p_proj, int use_tanh, Int32 *p_scratch)
+{
+  if(lstm->precision == XA_NNLIB_LSTM_16bx16b)
+  {
+    if(use_tanh)
+    {
+      xa_nn_matXvec_16x16_16_tanh(p_out, (coeff_t *)p_w_h, NULL, lstm->prev_h, NULL, p_proj,
+          lstm->out_feats, lstm->out_feats, 0, h_row_stride, 0,
+          lstm->matmul_lsh, 0, 64, p_scratch);
+    }
+    else
+    {
+      xa_nn_matXvec_16x16_16_sigmoid(p_out, (coeff_t *)p_w_h, NULL, lstm->prev_h, NULL, p_proj,
+          lstm->out_feats, lstm->out_feats, 0, h_row_stride, 0,
+          lstm->matmul_lsh, 0, 64, p_scratch);
+    }
+  }
+  else if(lstm->precision == XA_NNLIB_LSTM_8bx16b)
+  {
+    if(use_tanh)
+    {
+      xa_nn_matXvec_8x16_16_tanh(p_out, (coeff8_t *)p_w_h, NULL, lstm->prev_h, NULL, p_proj,
+          lstm->out_feats, lstm->out_feats, 0, h_row_stride, 0,
+          lstm->matmul_lsh, 0, 64, p_scratch);
+    }
+    else
+    {
+      xa_nn_matXvec_8x16_16_sigmoid(p_out, (coeff8_t *)p_w_h, NULL, lstm->prev_h, NULL, p_proj,
+          lstm->out_feats, lstm->out_feats, 0, h_row_stride, 0,
+          lstm->matmul_lsh, 0, 64, p_scratch);
+    }
+  }
+}
+#endif
+
+int xa_nnlib_lstm_process_sequence(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    Int32 num_steps)
+{
+  lstm_state_t *lstm;
+  scratch_mem_t *scratch_mem;
+  WORD64 *proj;
+  WORD64 **pp_proj;
+  vect_t **pp_input;
+  char *sptr;
+
+  CHECK_PTR(handle, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(scratch, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(input, XA_NNLIB_FATAL_MEM_ALLOC);
+  CHECK_PTR(output, XA_NNLIB_FATAL_MEM_ALLOC);
+
+  CHECK_PTR_ALIGN(handle, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(scratch, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(input, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+  CHECK_PTR_ALIGN(output, 8, XA_NNLIB_FATAL_MEM_ALIGN);
+
+  if(num_steps < 1)
+  {
+    return XA_NNLIB_LSTM_EXECUTE_FATAL_INVALID_NUM_STEPS;
+  }
+
+  lstm = (lstm_state_t *) handle;
+
+  //setup scratch
+  sptr = lstm_setup_scratch(lstm, scratch, &scratch_mem);
+  scratch_alloc(sptr, proj, WORD64, 4 * num_steps * lstm->out_feats);
+  scratch_alloc(sptr, pp_input, vect_t *, num_steps);
+  scratch_alloc(sptr, pp_proj, WORD64 *, num_steps);
+
+#ifdef MODEL_INT16
+  {
+    void *w_x[4], *w_h[4];
+    int x_row_stride, h_row_stride;
+    coeff_t *b[4];
+    int g, t;
+    int out_feats = lstm->out_feats;
+
+    lstm_gate_matrices(lstm, w_x, w_h, &x_row_stride, &h_row_stride);
+    b[0] = lstm->biases.b_f;
+    b[1] = lstm->biases.b_i;
+    b[2] = lstm->biases.b_c;
+    b[3] = lstm->biases.b_o;
+
+    for(t = 0; t < num_steps; t++)
+    {
+      pp_input[t] = (vect_t *)input + t * lstm->in_feats;
+    }
+
+    /* Input half of every gate for all steps, one batched pass per gate
+       so each weight row is loaded once for several steps */
+    for(g = 0; g < 4; g++)
+    {
+      for(t = 0; t < num_steps; t++)
+      {
+        pp_proj[t] = proj + (g * num_steps + t) * out_feats;
+      }
+      lstm_input_projection(lstm, pp_proj, w_x[g], x_row_stride, b[g], pp_input, num_steps);
+    }
+
+    for(t = 0; t < num_steps; t++)
+    {
+      lstm_recurrent_gate(lstm, scratch_mem->f_f, w_h[0], h_row_stride,
+          proj + (0 * num_steps + t) * out_feats, 0, scratch_mem->temp_mem.vec);
+      lstm_recurrent_gate(lstm, scratch_mem->i_f_or_o_f, w_h[1], h_row_stride,
+          proj + (1 * num_steps + t) * out_feats, 0, scratch_mem->temp_mem.vec);
+      lstm_recurrent_gate(lstm, scratch_mem->c_hat_f_or_tanh_c_f, w_h[2], h_row_stride,
+          proj + (2 * num_steps + t) * out_feats, 1, scratch_mem->temp_mem.vec);
+
+      vec_elem_mul_16x32plus16x16_16(
+          lstm->prev_c,
+          scratch_mem->f_f,
+          lstm->prev_c,
+          scratch_mem->i_f_or_o_f,
+          scratch_mem->c_hat_f_or_tanh_c_f,
+          lstm->fXprev_c_lsh,
+          lstm->iXc_hat_lsh,
+          out_feats);
+
+      lstm_recurrent_gate(lstm, scratch_mem->i_f_or_o_f, w_h[3], h_row_stride,
+          proj + (3 * num_steps + t) * out_feats, 0, scratch_mem->temp_mem.vec);
+
+      xa_nn_vec_tanh_32_16(
+          scratch_mem->c_hat_f_or_tanh_c_f,
+          lstm->prev_c,
+          out_feats);
+
+      lstm_output_kernel_16x16_16(
+          (vect_t*)output + t * out_feats,
+          lstm->prev_h,
+          scratch_mem->i_f_or_o_f,
+          scratch_mem->c_hat_f_or_tanh_c_f,
+          lstm->h_lsh,
+          out_feats);
+    }
+  }
+#endif
+
+  return XA_NNLIB_NO_ERROR;
+}
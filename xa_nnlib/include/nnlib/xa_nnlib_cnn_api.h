@@ -73,6 +73,7 @@ typedef enum _xa_nnlib_fatal_config_cnn_error_code_t
     XA_NNLIB_CNN_CONFIG_FATAL_INVALID_BIAS_SHAPE        = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 9),
     XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_ID          = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 10),
     XA_NNLIB_CNN_CONFIG_FATAL_INVALID_PARAM_COMBINATION = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 11),
+    XA_NNLIB_CNN_CONFIG_FATAL_INVALID_TILE_HEIGHT       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_CNN, 12),
 } xa_nnlib_fatal_config_cnn_error_code_t;
 
 /************************************************************/
@@ -122,6 +123,11 @@ typedef struct _xa_nnlib_cnn_init_config_t
     /* Convolution algorithm */
     xa_nnlib_cnn_algo_t algo;
 
+    /* Depthwise Separable 2D Convolution - output rows produced per fused depthwise+pointwise pass,
+       0 - auto, the library picks the tile height (unfused if the whole depthwise output is small),
+       >= output_height - whole depthwise output is computed into scratch before pointwise (unfused) */
+    Int32 ds_tile_height;
+
 } xa_nnlib_cnn_init_config_t;
 
 
@@ -132,6 +138,10 @@ extern "C" {
 /************************************************************/
 /* CNN Query Functions                                      */
 /************************************************************/
+/* Zero-fills config and sets the defaults: channels_multiplier 1, strides 1,
+   ds_tile_height 0 (auto); shapes, precision and algo must be set by the caller */
+Int32 xa_nnlib_cnn_init_config( xa_nnlib_cnn_init_config_t *config);
+
 Int32 xa_nnlib_cnn_get_persistent_fast( xa_nnlib_cnn_init_config_t *config);
 
 Int32 xa_nnlib_cnn_get_scratch_fast( xa_nnlib_cnn_init_config_t *config);
@@ -63,7 +63,8 @@ typedef enum _xa_nnlib_fatal_config_gru_error_code_t
   XA_NNLIB_GRU_CONFIG_FATAL_INVALID_IO_QFORMAT       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 4),
   XA_NNLIB_GRU_CONFIG_FATAL_INVALID_PARAM_ID         = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 5),
   XA_NNLIB_GRU_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 6),
-  XA_NNLIB_GRU_CONFIG_FATAL_INVALID_SPLIT_BIAS       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 7)
+  XA_NNLIB_GRU_CONFIG_FATAL_INVALID_SPLIT_BIAS       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 7),
+  XA_NNLIB_GRU_CONFIG_FATAL_INVALID_NUM_STEPS        = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_GRU, 8)
 } xa_nnlib_fatal_config_gru_error_code_t;
 
 /************************************************************/
@@ -76,7 +77,8 @@ typedef enum _xa_nnlib_fatal_config_gru_error_code_t
 typedef enum _xa_nnlib_fatal_exec_gru_error_code_t
 {
   XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE    = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_GRU, 0),
-  XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_DATA                   = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_GRU, 1)
+  XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_DATA                   = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_GRU, 1),
+  XA_NNLIB_GRU_EXECUTE_FATAL_INVALID_NUM_STEPS                   = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_GRU, 2)
 } xa_nnlib_fatal_exec_gru_error_code_t;
 
 
@@ -160,6 +162,9 @@ Int32 xa_nnlib_gru_get_persistent_fast( xa_nnlib_gru_init_config_t *config);
 
 Int32 xa_nnlib_gru_get_scratch_fast( xa_nnlib_gru_init_config_t *config);
 
+/* Scratch for xa_nnlib_gru_process_sequence() with up to num_steps timesteps */
+Int32 xa_nnlib_gru_get_scratch_sequence_fast( xa_nnlib_gru_init_config_t *config, Int32 num_steps);
+
 /************************************************************/
 /* GRU Initialization Function                              */
 /************************************************************/
@@ -179,6 +184,17 @@ Int32 xa_nnlib_gru_process(xa_nnlib_handle_t handle,
     xa_nnlib_shape_t *p_in_shape,
     xa_nnlib_shape_t *p_out_shape );
 
+/* Processes num_steps timesteps: input is num_steps x in_feats and output is
+ num_steps x out_feats, both contiguous. For fixed point precisions the input
+ projections of all steps are computed up front and only the recurrent part
+ runs per step; flt32xflt32 runs xa_nnlib_gru_process() for each step.
+ scratch must be at least xa_nnlib_gru_get_scratch_sequence_fast(config, num_steps). */
+Int32 xa_nnlib_gru_process_sequence(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    Int32 num_steps);
+
 #if defined(__cplusplus)
 }
 #endif    /* __cplusplus */
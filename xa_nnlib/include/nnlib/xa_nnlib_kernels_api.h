@@ -131,28 +131,38 @@
 
 #if defined(hifi5)
 #define get_softmax_scratch_size                get_softmax_scratch_size_hifi5
+#define get_softmax_rows_scratch_size           get_softmax_rows_scratch_size_hifi5
 #define xa_nn_avgpool_getsize                   xa_nn_avgpool_getsize_hifi5
 #define xa_nn_conv2d_depthwise_getsize          xa_nn_conv2d_depthwise_getsize_hifi5
 #define xa_nn_conv2d_getsize                    xa_nn_conv2d_getsize_hifi5
+#define xa_nn_conv2d_group_prepack_getsize      xa_nn_conv2d_group_prepack_getsize_hifi5
 #define xa_nn_conv2d_std_getsize                xa_nn_conv2d_std_getsize_hifi5
 #define xa_nn_conv2d_std_getsize_sym4s          xa_nn_conv2d_std_getsize_sym4s_hifi5
+#define xa_nn_conv2d_std_prepack_getsize        xa_nn_conv2d_std_prepack_getsize_hifi5
+#define xa_nn_conv2d_std_prepacked_getsize      xa_nn_conv2d_std_prepacked_getsize_hifi5
 #define xa_nn_dilated_conv2d_depthwise_getsize  xa_nn_dilated_conv2d_depthwise_getsize_hifi5
 #define xa_nn_dilated_conv2d_std_getsize        xa_nn_dilated_conv2d_std_getsize_hifi5
 #define xa_nn_maxpool_getsize                   xa_nn_maxpool_getsize_hifi5
 #define xa_nn_reduce_getsize_nhwc               xa_nn_reduce_getsize_nhwc_hifi5
+#define xa_nn_resize_bilinear_getsize           xa_nn_resize_bilinear_getsize_hifi5
 #define xa_nn_transpose_conv_getsize            xa_nn_transpose_conv_getsize_hifi5
 
 #elif defined(hifi4)
 #define get_softmax_scratch_size                get_softmax_scratch_size_hifi4
+#define get_softmax_rows_scratch_size           get_softmax_rows_scratch_size_hifi4
 #define xa_nn_avgpool_getsize                   xa_nn_avgpool_getsize_hifi4
 #define xa_nn_conv2d_depthwise_getsize          xa_nn_conv2d_depthwise_getsize_hifi4
 #define xa_nn_conv2d_getsize                    xa_nn_conv2d_getsize_hifi4
+#define xa_nn_conv2d_group_prepack_getsize      xa_nn_conv2d_group_prepack_getsize_hifi4
 #define xa_nn_conv2d_std_getsize                xa_nn_conv2d_std_getsize_hifi4
 #define xa_nn_conv2d_std_getsize_sym4s          xa_nn_conv2d_std_getsize_sym4s_hifi4
+#define xa_nn_conv2d_std_prepack_getsize        xa_nn_conv2d_std_prepack_getsize_hifi4
+#define xa_nn_conv2d_std_prepacked_getsize      xa_nn_conv2d_std_prepacked_getsize_hifi4
 #define xa_nn_dilated_conv2d_depthwise_getsize  xa_nn_dilated_conv2d_depthwise_getsize_hifi4
 #define xa_nn_dilated_conv2d_std_getsize        xa_nn_dilated_conv2d_std_getsize_hifi4
 #define xa_nn_maxpool_getsize                   xa_nn_maxpool_getsize_hifi4
 #define xa_nn_reduce_getsize_nhwc               xa_nn_reduce_getsize_nhwc_hifi4
+#define xa_nn_resize_bilinear_getsize           xa_nn_resize_bilinear_getsize_hifi4
 #define xa_nn_transpose_conv_getsize            xa_nn_transpose_conv_getsize_hifi4
 
 #endif
@@ -244,6 +254,57 @@
 			VOID   * __restrict__ p_scratch             /*!< [in,out] scratch: rows x 4 bytes */
 			);
 
+	/* Fused LSTM gates: mat1/mat2/bias rows are gate-interleaved (row 4*r+g is
+	 * gate g of output row r, gates ordered f, i, c, o). Sigmoid is applied to
+	 * f, i, o and tanh to c; p_out holds the four gates as planes of rows. */
+	WORD32 xa_nn_matXvec_16x16_16_lstm_gates(
+			WORD16 * __restrict__ p_out,                /*!< [out] 16b result: 4 x rows, planes f, i, c, o */
+			WORD16 * __restrict__ p_mat1,               /*!< [in] 16b mat1: (4 * rows) x cols1 */
+			WORD16 * __restrict__ p_mat2,               /*!< [in] 16b mat2: (4 * rows) x cols2 */
+			WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+			WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+			WORD16 * __restrict__ p_bias,               /*!< [in] 16b bias: (4 * rows) x 1 */
+			WORD32 rows,                                /*!< [in] number of rows per gate */
+			WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+			WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+			WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+			WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+			WORD32 acc_shift,                             /*!< [in] out accumulator left shift amount */
+			WORD32 bias_shift                             /*!< [in] bias left shift amount */
+			);
+
+	/* Fused GRU cell: z, r, candidate and the interpolation in one kernel.
+	 * mat*1 are the input weights, mat*2 the recurrent weights (rows x rows).
+	 * With bias_sz/sr/sh NULL the reset gate is applied to prev_h before
+	 * U_h and p_scratch (rows x 2 bytes) is needed; otherwise the split
+	 * biases are used, the reset gate is applied to U_h * prev_h + b_h and
+	 * p_scratch may be NULL. p_prev_h is updated with the new state. */
+	WORD32 xa_nn_matXvec_16x16_16_gru_cell(
+			WORD16 * __restrict__ p_out,                /*!< [out] 16b new hidden state: rows x 1 */
+			WORD16 * __restrict__ p_prev_h,             /*!< [in,out] 16b previous hidden state: rows x 1 */
+			WORD16 * __restrict__ p_mat_z1,             /*!< [in] 16b z input weights: rows x cols1 */
+			WORD16 * __restrict__ p_mat_r1,             /*!< [in] 16b r input weights: rows x cols1 */
+			WORD16 * __restrict__ p_mat_h1,             /*!< [in] 16b h input weights: rows x cols1 */
+			WORD16 * __restrict__ p_mat_z2,             /*!< [in] 16b z recurrent weights: rows x rows */
+			WORD16 * __restrict__ p_mat_r2,             /*!< [in] 16b r recurrent weights: rows x rows */
+			WORD16 * __restrict__ p_mat_h2,             /*!< [in] 16b h recurrent weights: rows x rows */
+			WORD16 * __restrict__ p_vec,                /*!< [in] 16b input: cols1 x 1 */
+			WORD16 * __restrict__ p_bias_z,             /*!< [in] 16b z bias: rows x 1 */
+			WORD16 * __restrict__ p_bias_r,             /*!< [in] 16b r bias: rows x 1 */
+			WORD16 * __restrict__ p_bias_h,             /*!< [in] 16b h bias: rows x 1 */
+			WORD16 * __restrict__ p_bias_sz,            /*!< [in] 16b z input side bias: rows x 1, NULL if not split */
+			WORD16 * __restrict__ p_bias_sr,            /*!< [in] 16b r input side bias: rows x 1 */
+			WORD16 * __restrict__ p_bias_sh,            /*!< [in] 16b h input side bias: rows x 1 */
+			WORD32 rows,                                /*!< [in] number of rows */
+			WORD32 cols1,                               /*!< [in] number of columns of input weights */
+			WORD32 row_stride1,                         /*!< [in] row stride for input weights */
+			WORD32 row_stride2,                         /*!< [in] row stride for recurrent weights */
+			WORD32 acc_shift,                             /*!< [in] out accumulator left shift amount */
+			WORD32 bias_shift,                            /*!< [in] bias left shift amount */
+			WORD32 tanh_lsh,                              /*!< [in] left shift of the Q15 candidate */
+			WORD16 * __restrict__ p_scratch             /*!< [in,out] scratch: rows x 2 bytes */
+			);
+
 	WORD32 xa_nn_matXvec_batch_16x16_64(
 			WORD64 ** __restrict__ p_out,               /*!< [out] array of result: rows x 1 pointers */
 			WORD16 *  __restrict__ p_mat1,              /*!< [in] 16b mat1: rows x cols1 */
@@ -356,6 +417,50 @@
 			VOID   * __restrict__ p_scratch             /*!< [in,out] scratch: rows x 4 bytes */
 			);
 
+	/* 8b weight variant of xa_nn_matXvec_16x16_16_lstm_gates */
+	WORD32 xa_nn_matXvec_8x16_16_lstm_gates(
+			WORD16 * __restrict__ p_out,                /*!< [out] 16b result: 4 x rows, planes f, i, c, o */
+			WORD8  * __restrict__ p_mat1,               /*!< [in] 8b mat1: (4 * rows) x cols1 */
+			WORD8  * __restrict__ p_mat2,               /*!< [in] 8b mat2: (4 * rows) x cols2 */
+			WORD16 * __restrict__ p_vec1,               /*!< [in] 16b vec1: cols1 x 1 */
+			WORD16 * __restrict__ p_vec2,               /*!< [in] 16b vec2: cols2 x 1 */
+			WORD16 * __restrict__ p_bias,               /*!< [in] 16b bias: (4 * rows) x 1 */
+			WORD32 rows,                                /*!< [in] number of rows per gate */
+			WORD32 cols1,                               /*!< [in] number of columns of mat1 */
+			WORD32 cols2,                               /*!< [in] number of columns of mat2 */
+			WORD32 row_stride1,                         /*!< [in] row stride for mat1 */
+			WORD32 row_stride2,                         /*!< [in] row stride for mat2 */
+			WORD32 acc_shift,                             /*!< [in] out accumulator left shift amount */
+			WORD32 bias_shift                             /*!< [in] bias left shift amount */
+			);
+
+	/* 8b weight variant of xa_nn_matXvec_16x16_16_gru_cell */
+	WORD32 xa_nn_matXvec_8x16_16_gru_cell(
+			WORD16 * __restrict__ p_out,                /*!< [out] 16b new hidden state: rows x 1 */
+			WORD16 * __restrict__ p_prev_h,             /*!< [in,out] 16b previous hidden state: rows x 1 */
+			WORD8  * __restrict__ p_mat_z1,             /*!< [in] 8b z input weights: rows x cols1 */
+			WORD8  * __restrict__ p_mat_r1,             /*!< [in] 8b r input weights: rows x cols1 */
+			WORD8  * __restrict__ p_mat_h1,             /*!< [in] 8b h input weights: rows x cols1 */
+			WORD8  * __restrict__ p_mat_z2,             /*!< [in] 8b z recurrent weights: rows x rows */
+			WORD8  * __restrict__ p_mat_r2,             /*!< [in] 8b r recurrent weights: rows x rows */
+			WORD8  * __restrict__ p_mat_h2,             /*!< [in] 8b h recurrent weights: rows x rows */
+			WORD16 * __restrict__ p_vec,                /*!< [in] 16b input: cols1 x 1 */
+			WORD16 * __restrict__ p_bias_z,             /*!< [in] 16b z bias: rows x 1 */
+			WORD16 * __restrict__ p_bias_r,             /*!< [in] 16b r bias: rows x 1 */
+			WORD16 * __restrict__ p_bias_h,             /*!< [in] 16b h bias: rows x 1 */
+			WORD16 * __restrict__ p_bias_sz,            /*!< [in] 16b z input side bias: rows x 1, NULL if not split */
+			WORD16 * __restrict__ p_bias_sr,            /*!< [in] 16b r input side bias: rows x 1 */
+			WORD16 * __restrict__ p_bias_sh,            /*!< [in] 16b h input side bias: rows x 1 */
+			WORD32 rows,                                /*!< [in] number of rows */
+			WORD32 cols1,                               /*!< [in] number of columns of input weights */
+			WORD32 row_stride1,                         /*!< [in] row stride for input weights */
+			WORD32 row_stride2,                         /*!< [in] row stride for recurrent weights */
+			WORD32 acc_shift,                             /*!< [in] out accumulator left shift amount */
+			WORD32 bias_shift,                            /*!< [in] bias left shift amount */
+			WORD32 tanh_lsh,                              /*!< [in] left shift of the Q15 candidate */
+			WORD16 * __restrict__ p_scratch             /*!< [in,out] scratch: rows x 2 bytes */
+			);
+
 	WORD32 xa_nn_matXvec_batch_8x16_64(
 			WORD64 ** __restrict__ p_out,               /*!< [out] array of result: rows x 1 pointers */
 			WORD8  *  __restrict__ p_mat1,              /*!< [in] 8b mat1: rows x cols1 */
@@ -541,7 +646,6 @@
 			WORD32 row_stride2                            /*!< [in] row stride for mat2 */
 			);
 			
-#if XCHAL_HAVE_HIFI5_HP_VFPU
 	WORD32 xa_nn_matXvec_f16xf16_f16(
 			WORD16  * __restrict__ p_out,                /*!< [out] f16b result: rows x 1 */
 			const WORD16  * __restrict__ p_mat1,         /*!< [in] f16b mat1: rows x cols1 */
@@ -568,7 +672,6 @@
             WORD32 vec_offset,
             WORD32 out_offset,
             WORD32 out_stride);
-#endif
 
 	WORD32 xa_nn_matXvec_batch_f32xf32_f32(
 			FLOAT32  ** __restrict__ p_out,               /*!< [out] f32b result: rows x vec_count */
@@ -1023,6 +1126,92 @@
 			WORD32 dilation_height
 			);
 
+	/* Pre-packed conv2d_std kernels: xa_nn_conv2d_std_prepack_kernel pads the
+	 * kernel once into a caller-owned persistent buffer of
+	 * xa_nn_conv2d_std_prepack_getsize bytes (ALIGNMENT aligned), which is then
+	 * passed to the xa_nn_conv2d_std_prepacked_* kernels on every call. Scratch
+	 * for those is given by xa_nn_conv2d_std_prepacked_getsize.
+	 * p_kernel to xa_nn_conv2d_std_prepack_kernel has the same layout the
+	 * non-prepacked API takes for that precision:
+	 *   f32, 16x16, 8x16   : rows padded by the caller to input_channels_pad
+	 *                        (2 for f32, 4 for 16-bit input), zero filled
+	 *   sym8sxasym8s       : unpadded (input_channels_pad == input_channels)
+	 *   8x8, asym8uxasym8u,
+	 *   sym8sxsym16s       : unpadded, rows of input_channels
+	 *   sym4sxasym8s       : unpadded stream of 4-bit weights, two per byte,
+	 *                        lower nibble first
+	 * With ENABLE_PADDING_CONV2D_STD only 16-bit input is caller padded. */
+	WORD32 xa_nn_conv2d_std_prepack_getsize(
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 input_precision,
+			WORD32 kernel_precision);
+
+	WORD32 xa_nn_conv2d_std_prepack_kernel(
+			VOID *p_prepacked,
+			const VOID *p_kernel,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 input_precision,
+			WORD32 kernel_precision);
+
+	WORD32 xa_nn_conv2d_std_prepacked_getsize(
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 kernel_channels,
+			WORD32 y_stride,
+			WORD32 y_padding,
+			WORD32 x_stride,
+			WORD32 x_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 output_channels,
+			WORD32 input_precision,
+			WORD32 kernel_precision,
+			WORD32 dilation_height,
+			WORD32 dilation_width,
+			WORD32 out_data_format);
+
+	/* Pre-arranged kernels for grouped conv2d (kernel_channels < input_channels):
+	 * xa_nn_conv2d_group_prepack_kernel stores the kernel once, in the depthwise
+	 * layout for one channel per group and group-blocked and padded otherwise,
+	 * into a caller-owned persistent buffer of xa_nn_conv2d_group_prepack_getsize
+	 * bytes (ALIGNMENT aligned). It is then passed to
+	 * xa_nn_conv2d_group_prepacked_per_chan_sym8sxasym8s, scratch for which is
+	 * given by xa_nn_conv2d_getsize. The layout depends on out_data_format and
+	 * on whether a bias is passed (bias_present), the prepacked call must use the
+	 * same ones or it returns -1. */
+	WORD32 xa_nn_conv2d_group_prepack_getsize(
+			WORD32 input_channels,
+			WORD32 kernel_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 input_precision,
+			WORD32 kernel_precision,
+			WORD32 out_data_format,
+			WORD32 bias_present);
+
+	WORD32 xa_nn_conv2d_group_prepack_kernel(
+			VOID *p_prepacked,
+			const VOID *p_kernel,
+			WORD32 input_channels,
+			WORD32 kernel_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 input_precision,
+			WORD32 kernel_precision,
+			WORD32 out_data_format,
+			WORD32 bias_present);
+
 	WORD32 xa_nn_conv2d_std_8x16(
 			WORD16* __restrict__ p_out,
 			WORD16* __restrict__ p_inp,
@@ -1109,7 +1298,6 @@
 			WORD32 out_data_format,
 			VOID *p_handle);
 
-#if XCHAL_HAVE_HIFI5_HP_VFPU
     WORD32 xa_nn_conv2d_std_f16(
             WORD16* __restrict__ p_out,
             const WORD16* __restrict__ p_inp,
@@ -1129,7 +1317,6 @@
             WORD32 out_width,
             WORD32 out_data_format,
             VOID *p_scratch);
-#endif
 
 	WORD32 xa_nn_conv2d_pointwise_f32(
 			FLOAT32* __restrict__ p_out,
@@ -1142,7 +1329,6 @@
 			WORD32  out_channels,
 			WORD32  out_data_format);
 
-#if XCHAL_HAVE_HIFI5_HP_VFPU
 	WORD32 xa_nn_conv2d_pointwise_f16(
 			WORD16* __restrict__ p_out,
 			WORD16* __restrict__ p_kernel,
@@ -1153,7 +1339,6 @@
 			WORD32  input_channels,
 			WORD32  out_channels,
 			WORD32  out_data_format);
-#endif
 
 	WORD32 xa_nn_conv2d_pointwise_8x16
 		(pWORD16 __restrict__ p_out
@@ -1287,7 +1472,6 @@
 			WORD32  out_data_format,
 			pVOID p_scratch);
 
-#if XCHAL_HAVE_HIFI5_HP_VFPU
 	WORD32 xa_nn_conv2d_depthwise_f16(
 			WORD16* __restrict__ p_out,
 			const WORD16* __restrict__ p_kernel,
@@ -1308,7 +1492,6 @@
 			WORD32  inp_data_format,
 			WORD32  out_data_format,
 			pVOID p_scratch);
-#endif
 
 	WORD32 xa_nn_conv2d_depthwise_8x16
 		(pWORD16 __restrict__ p_out
@@ -1444,6 +1627,42 @@
 			WORD32  out_data_format,
 			VOID *p_scratch);
 
+	WORD32 xa_nn_avgpool_asym8s(
+			WORD8* __restrict__ p_out,
+			const WORD8* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  kernel_height,
+			WORD32  kernel_width,
+			WORD32  x_stride,
+			WORD32  y_stride,
+			WORD32  x_padding,
+			WORD32  y_padding,
+			WORD32  out_height,
+			WORD32  out_width,
+			WORD32  inp_data_format,
+			WORD32  out_data_format,
+			VOID *p_scratch);
+
+	WORD32 xa_nn_avgpool_asym16s(
+			WORD16* __restrict__ p_out,
+			const WORD16* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  kernel_height,
+			WORD32  kernel_width,
+			WORD32  x_stride,
+			WORD32  y_stride,
+			WORD32  x_padding,
+			WORD32  y_padding,
+			WORD32  out_height,
+			WORD32  out_width,
+			WORD32  inp_data_format,
+			WORD32  out_data_format,
+			VOID *p_scratch);
+
 	WORD32 xa_nn_avgpool_getsize(
 			WORD32 input_channels,
 			WORD32 inp_precision,
@@ -1533,6 +1752,42 @@
 			WORD32  out_data_format,
 			VOID   *p_scratch);
 
+	WORD32 xa_nn_maxpool_asym8s(
+			WORD8* __restrict__ p_out,
+			const WORD8* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  kernel_height,
+			WORD32  kernel_width,
+			WORD32  x_stride,
+			WORD32  y_stride,
+			WORD32  x_padding,
+			WORD32  y_padding,
+			WORD32  out_height,
+			WORD32  out_width,
+			WORD32  inp_data_format,
+			WORD32  out_data_format,
+			VOID   *p_scratch);
+
+	WORD32 xa_nn_maxpool_asym16s(
+			WORD16* __restrict__ p_out,
+			const WORD16* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  kernel_height,
+			WORD32  kernel_width,
+			WORD32  x_stride,
+			WORD32  y_stride,
+			WORD32  x_padding,
+			WORD32  y_padding,
+			WORD32  out_height,
+			WORD32  out_width,
+			WORD32  inp_data_format,
+			WORD32  out_data_format,
+			VOID   *p_scratch);
+
 	WORD32 xa_nn_maxpool_getsize(
 			WORD32 input_channels,
 			WORD32 inp_precision,
@@ -1550,7 +1805,65 @@
 			WORD32 inp_data_format,
 			WORD32 out_data_format);
 
-#if XCHAL_HAVE_HIFI5_HP_VFPU
+	/* Global pooling over the full input_height x input_width plane of an
+	 * NHWC input, p_out holds input_channels values. No scratch memory.
+	 */
+	WORD32 xa_nn_global_avgpool_8(
+			WORD8* __restrict__ p_out,
+			const WORD8* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels);
+
+	WORD32 xa_nn_global_avgpool_asym8s(
+			WORD8* __restrict__ p_out,
+			const WORD8* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels);
+
+	WORD32 xa_nn_global_avgpool_16(
+			WORD16* __restrict__ p_out,
+			const WORD16* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels);
+
+	WORD32 xa_nn_global_avgpool_f32(
+			FLOAT32* __restrict__ p_out,
+			const FLOAT32* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels);
+
+	WORD32 xa_nn_global_maxpool_8(
+			WORD8* __restrict__ p_out,
+			const WORD8* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels);
+
+	WORD32 xa_nn_global_maxpool_asym8s(
+			WORD8* __restrict__ p_out,
+			const WORD8* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels);
+
+	WORD32 xa_nn_global_maxpool_16(
+			WORD16* __restrict__ p_out,
+			const WORD16* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels);
+
+	WORD32 xa_nn_global_maxpool_f32(
+			FLOAT32* __restrict__ p_out,
+			const FLOAT32* __restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels);
+
 	WORD32 xa_nn_fully_connected_f16
 		(WORD16 *__restrict__ p_out
 		 ,const WORD16 *__restrict__ p_weight
@@ -1559,7 +1872,6 @@
 		 ,WORD32  weight_depth
 		 ,WORD32  out_depth
 		);
-#endif
 
 	WORD32 xa_nn_fully_connected_f32
 		(FLOAT32 *__restrict__ p_out
@@ -1670,6 +1982,104 @@
      ,VOID *p_scratch
     );
 
+  WORD32 xa_nn_fully_connected_batch_sym8sxasym8s_asym8s
+    (WORD8 *__restrict__ p_out
+     ,const WORD8 *__restrict__ p_weight
+     ,const WORD8 *__restrict__ p_inp
+     ,const WORD32 *__restrict__ p_bias
+     ,WORD32  weight_depth
+     ,WORD32  out_depth
+     ,WORD32  batch
+     ,WORD32  input_zero_bias
+     ,WORD32  out_multiplier
+     ,WORD32  out_shift
+     ,WORD32  out_zero_bias
+    );
+
+  WORD32 xa_nn_fully_connected_batch_out_stride_sym8sxasym8s_asym8s
+    (WORD8 *__restrict__ p_out
+     ,const WORD8 *__restrict__ p_weight
+     ,const WORD8 *__restrict__ p_inp
+     ,const WORD32 *__restrict__ p_bias
+     ,WORD32  weight_depth
+     ,WORD32  out_depth
+     ,WORD32  batch
+     ,WORD32  input_zero_bias
+     ,WORD32  out_multiplier
+     ,WORD32  out_shift
+     ,WORD32  out_zero_bias
+     ,WORD32  out_stride
+    );
+
+  /* Epilogue of the *_epilogue_* asym8s output kernels, applied in place
+   * in a single pass over each block of output:
+   *   out = lut[clamp(add(out, residual))]
+   * p_residual == NULL skips the add and only clamps, p_lut == NULL skips
+   * the table (see xa_nn_vec_lut_asym8s_asym8s). The add takes the
+   * parameters of xa_nn_elm_add_asym8sxasym8s_asym8s with the kernel output
+   * as input 1, its zero bias comes from the kernel. out_zero_bias,
+   * out_left_shift and out_multiplier are the add output requantization.
+   * The residual is passed to the kernels as p_residual with the layout of
+   * the output and residual_stride elements between pixels (conv) or rows
+   * (fully connected). */
+  typedef struct _xa_nn_epilogue_asym8s_t
+  {
+    WORD32 out_activation_min;
+    WORD32 out_activation_max;
+    WORD32 residual_zero_bias;
+    WORD32 residual_left_shift;
+    WORD32 residual_multiplier;
+    WORD32 inp1_left_shift;
+    WORD32 inp1_multiplier;
+    WORD32 left_shift;
+    WORD32 out_zero_bias;
+    WORD32 out_left_shift;
+    WORD32 out_multiplier;
+    const WORD8 *p_lut;
+  } xa_nn_epilogue_asym8s_t;
+
+  WORD32 xa_nn_elm_epilogue_asym8s(WORD8 * __restrict__ p_out,
+      WORD32  out_row_stride,
+      const WORD8 * __restrict__ p_residual,
+      WORD32  residual_row_stride,
+      WORD32  out_zero_bias,
+      WORD32  num_rows,
+      WORD32  row_len,
+      const xa_nn_epilogue_asym8s_t *p_epilogue);
+
+  WORD32 xa_nn_fully_connected_batch_epilogue_sym8sxasym8s_asym8s
+    (WORD8 *__restrict__ p_out
+     ,const WORD8 *__restrict__ p_weight
+     ,const WORD8 *__restrict__ p_inp
+     ,const WORD32 *__restrict__ p_bias
+     ,WORD32  weight_depth
+     ,WORD32  out_depth
+     ,WORD32  batch
+     ,WORD32  input_zero_bias
+     ,WORD32  out_multiplier
+     ,WORD32  out_shift
+     ,WORD32  out_zero_bias
+     ,WORD32  out_stride
+     ,const WORD8 *__restrict__ p_residual
+     ,WORD32  residual_stride
+     ,const xa_nn_epilogue_asym8s_t *p_epilogue
+    );
+
+  WORD32 xa_nn_fully_connected_batch_asym8sxasym8s_asym8s
+    (WORD8 *__restrict__ p_out
+     ,const WORD8 *__restrict__ p_weight
+     ,const WORD8 *__restrict__ p_inp
+     ,const WORD32 *__restrict__ p_bias
+     ,WORD32  weight_depth
+     ,WORD32  out_depth
+     ,WORD32  batch
+     ,WORD32  input_zero_bias
+     ,WORD32  weight_zero_bias
+     ,WORD32  out_multiplier
+     ,WORD32  out_shift
+     ,WORD32  out_zero_bias
+    );
+
 	WORD32 xa_nn_vec_activation_min_max_asym8u_asym8u(
 			UWORD8 * __restrict__ p_out,
 			const  UWORD8 * __restrict__ p_vec,
@@ -1737,17 +2147,58 @@
 
 	int get_softmax_scratch_size(int inp_precision, int out_precision, int length);
 
-	WORD32 xa_nn_vec_activation_min_max_8_8(WORD8 * __restrict__ p_out,
-			const  WORD8 * __restrict__ p_vec,
-			int    activation_min,
-			int    activation_max,
-			WORD32 vec_length);
+	/* Softmax over outer_size rows of depth contiguous elements, parameters
+	 * as for the single vector kernels. The asym8s variants need
+	 * get_softmax_rows_scratch_size() bytes of scratch. The log-softmax
+	 * output uses TFLite's fixed quantization, scale 16/256 and zero
+	 * point 127. */
+	WORD32 xa_nn_softmax_rows_asym8s_asym8s( WORD8 * __restrict__ p_out,
+			const   WORD8 * __restrict__ p_vec,
+			WORD32  diffmin,
+			WORD32  input_beta_left_shift,
+			WORD32  input_beta_multiplier,
+			WORD32  outer_size,
+			WORD32  depth,
+			pVOID   p_scratch);
 
-	WORD32 xa_nn_vec_activation_min_max_16_16(WORD16 * __restrict__ p_out,
-			const  WORD16 * __restrict__ p_vec,
-			int    activation_min,
-			int    activation_max,
-			WORD32 vec_length);
+	WORD32 xa_nn_softmax_rows_asym8s_16( WORD16 * __restrict__ p_out,
+			const   WORD8 * __restrict__ p_vec,
+			WORD32  diffmin,
+			WORD32  input_beta_left_shift,
+			WORD32  input_beta_multiplier,
+			WORD32  outer_size,
+			WORD32  depth,
+			pVOID   p_scratch);
+
+	WORD32 xa_nn_log_softmax_rows_asym8s_asym8s( WORD8 * __restrict__ p_out,
+			const   WORD8 * __restrict__ p_vec,
+			WORD32  diffmin,
+			WORD32  input_beta_left_shift,
+			WORD32  input_beta_multiplier,
+			WORD32  outer_size,
+			WORD32  depth,
+			pVOID   p_scratch);
+
+	WORD32 xa_nn_softmax_rows_sym16s_16( WORD16 * __restrict__ p_out,
+			const   WORD16 * __restrict__ p_vec,
+			WORD32  input_beta_left_shift,
+			WORD32  input_beta_multiplier,
+			WORD32  outer_size,
+			WORD32  depth);
+
+	int get_softmax_rows_scratch_size(int inp_precision, int out_precision, int depth);
+
+	WORD32 xa_nn_vec_activation_min_max_8_8(WORD8 * __restrict__ p_out,
+			const  WORD8 * __restrict__ p_vec,
+			int    activation_min,
+			int    activation_max,
+			WORD32 vec_length);
+
+	WORD32 xa_nn_vec_activation_min_max_16_16(WORD16 * __restrict__ p_out,
+			const  WORD16 * __restrict__ p_vec,
+			int    activation_min,
+			int    activation_max,
+			WORD32 vec_length);
 
 	WORD32 xa_nn_vec_relu_asym8u_asym8u( UWORD8 * __restrict__ p_out,
 			const   UWORD8 * __restrict__ p_vec,
@@ -1825,6 +2276,35 @@
 			WORD32 input_left_shift,
 			WORD32 vec_length);
 
+	/* Activation types for xa_nn_vec_act_lut_init_asym8s. alpha is the
+	 * negative slope for LEAKY_RELU and the saturation value for ELU, it is
+	 * ignored for the others. GELU uses the tanh approximation. */
+	typedef enum _xa_nn_act_lut_type_t
+	{
+		XA_NN_ACT_LUT_SIGMOID    = 0,
+		XA_NN_ACT_LUT_TANH       = 1,
+		XA_NN_ACT_LUT_HARD_SWISH = 2,
+		XA_NN_ACT_LUT_LEAKY_RELU = 3,
+		XA_NN_ACT_LUT_ELU        = 4,
+		XA_NN_ACT_LUT_GELU       = 5,
+		XA_NN_ACT_LUT_SWISH      = 6
+	} xa_nn_act_lut_type_t;
+
+	/* Builds the 256 byte table used by xa_nn_vec_lut_asym8s_asym8s,
+	 * p_lut[x + 128] = quantize(act(dequantize(x))) */
+	WORD32 xa_nn_vec_act_lut_init_asym8s(WORD8 * __restrict__ p_lut,
+			WORD32 act_type,
+			WORD32 inp_zero_bias,
+			FLOAT32 inp_scale,
+			WORD32 out_zero_bias,
+			FLOAT32 out_scale,
+			FLOAT32 alpha);
+
+	WORD32 xa_nn_vec_lut_asym8s_asym8s(WORD8 * __restrict__ p_out,
+			const WORD8 * __restrict__ p_vec,
+			const WORD8 * __restrict__ p_lut,
+			WORD32 vec_length);
+
 	WORD32 xa_nn_conv1d_std_asym8uxasym8u(
 			UWORD8* __restrict__ p_out,
 			UWORD8* __restrict__ p_inp,
@@ -1946,6 +2426,57 @@
 			WORD32 out_data_format,
 			VOID *p_scratch);
 
+	WORD32 xa_nn_conv2d_std_out_stride_per_chan_sym8sxasym8s(
+			WORD8* __restrict__ p_out,
+			const WORD8* __restrict__ p_inp,
+			const WORD8* __restrict__ p_kernel,
+			const WORD32* __restrict__ p_bias,
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 x_stride,
+			WORD32 y_stride,
+			WORD32 x_padding,
+			WORD32 y_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 input_zero_bias,
+			WORD32 * p_out_multiplier,
+			WORD32 * p_out_shift,
+			WORD32 out_zero_bias,
+			WORD32 out_stride,
+			VOID *p_scratch);
+
+	WORD32 xa_nn_conv2d_std_epilogue_per_chan_sym8sxasym8s(
+			WORD8* __restrict__ p_out,
+			const WORD8* __restrict__ p_inp,
+			const WORD8* __restrict__ p_kernel,
+			const WORD32* __restrict__ p_bias,
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 x_stride,
+			WORD32 y_stride,
+			WORD32 x_padding,
+			WORD32 y_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 input_zero_bias,
+			WORD32 * p_out_multiplier,
+			WORD32 * p_out_shift,
+			WORD32 out_zero_bias,
+			WORD32 out_stride,
+			const WORD8 *p_residual,
+			WORD32 residual_stride,
+			const xa_nn_epilogue_asym8s_t *p_epilogue,
+			VOID *p_scratch);
+
     WORD32 xa_nn_conv2d_per_chan_sym8sxasym8s(
 			WORD8* __restrict__ p_out,
 			const WORD8* __restrict__ p_inp,
@@ -1973,6 +2504,33 @@
 			WORD32 out_data_format,
 			VOID *p_scratch);
 
+	WORD32 xa_nn_conv2d_group_prepacked_per_chan_sym8sxasym8s(
+			WORD8* __restrict__ p_out,
+			const WORD8* __restrict__ p_inp,
+			const VOID* __restrict__ p_kernel_prepacked,
+			const WORD32* __restrict__ p_bias,
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 kernel_channels,
+			WORD32 dilation_height,
+			WORD32 dilation_width,
+			WORD32 out_channels,
+			WORD32 x_stride,
+			WORD32 y_stride,
+			WORD32 x_padding,
+			WORD32 y_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 input_zero_bias,
+			WORD32 * p_out_multiplier,
+			WORD32 * p_out_shift,
+			WORD32 out_zero_bias,
+			WORD32 out_data_format,
+			VOID *p_scratch);
+
 	WORD32 xa_nn_conv2d_std_per_chan_sym4sxasym8s(
 			WORD8* __restrict__ p_out,
 			const WORD8* __restrict__ p_inp,
@@ -2023,6 +2581,189 @@
 			WORD32 dilation_height,
 			WORD32 dilation_width);
 
+	WORD32 xa_nn_conv2d_std_prepacked_8x16(
+			WORD16* __restrict__ p_out,
+			WORD16* __restrict__ p_inp,
+			const VOID* __restrict__ p_kernel_prepacked,
+			WORD16* __restrict__ p_bias,
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 x_stride,
+			WORD32 y_stride,
+			WORD32 x_padding,
+			WORD32 y_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 bias_shift,
+			WORD32 acc_shift,
+			WORD32 out_data_format,
+			VOID *p_scratch);
+
+	WORD32 xa_nn_conv2d_std_prepacked_8x8(
+			WORD8* __restrict__ p_out,
+			WORD8* __restrict__ p_inp,
+			const VOID* __restrict__ p_kernel_prepacked,
+			WORD8* __restrict__ p_bias,
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 x_stride,
+			WORD32 y_stride,
+			WORD32 x_padding,
+			WORD32 y_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 bias_shift,
+			WORD32 acc_shift,
+			WORD32 out_data_format,
+			VOID *p_scratch);
+
+	WORD32 xa_nn_conv2d_std_prepacked_16x16(
+			WORD16* __restrict__ p_out,
+			WORD16* __restrict__ p_inp,
+			const VOID* __restrict__ p_kernel_prepacked,
+			WORD16* __restrict__ p_bias,
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 x_stride,
+			WORD32 y_stride,
+			WORD32 x_padding,
+			WORD32 y_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 bias_shift,
+			WORD32 acc_shift,
+			WORD32 out_data_format,
+			VOID *p_scratch);
+
+	WORD32 xa_nn_conv2d_std_prepacked_f32(
+			FLOAT32* __restrict__ p_out,
+			const FLOAT32* __restrict__ p_inp,
+			const VOID* __restrict__ p_kernel_prepacked,
+			const FLOAT32* __restrict__ p_bias,
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 x_stride,
+			WORD32 y_stride,
+			WORD32 x_padding,
+			WORD32 y_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 out_data_format,
+			VOID *p_scratch);
+
+	WORD32 xa_nn_conv2d_std_prepacked_asym8uxasym8u(
+			UWORD8* __restrict__ p_out,
+			const UWORD8* __restrict__ p_inp,
+			const VOID* __restrict__ p_kernel_prepacked,
+			const WORD32* __restrict__ p_bias,
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 x_stride,
+			WORD32 y_stride,
+			WORD32 x_padding,
+			WORD32 y_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 input_zero_bias,
+			WORD32 kernel_zero_bias,
+			WORD32 out_multiplier,
+			WORD32 out_shift,
+			WORD32 out_zero_bias,
+			WORD32 out_data_format,
+			VOID *p_scratch);
+
+	WORD32 xa_nn_conv2d_std_prepacked_per_chan_sym8sxasym8s(
+			WORD8* __restrict__ p_out,
+			const WORD8* __restrict__ p_inp,
+			const VOID* __restrict__ p_kernel_prepacked,
+			const WORD32* __restrict__ p_bias,
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 x_stride,
+			WORD32 y_stride,
+			WORD32 x_padding,
+			WORD32 y_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 input_zero_bias,
+			WORD32 * p_out_multiplier,
+			WORD32 * p_out_shift,
+			WORD32 out_zero_bias,
+			WORD32 out_data_format,
+			VOID *p_scratch);
+
+	WORD32 xa_nn_conv2d_std_prepacked_per_chan_sym8sxsym16s(
+			WORD16* __restrict__ p_out,
+			const WORD16* __restrict__ p_inp,
+			const VOID* __restrict__ p_kernel_prepacked,
+			const WORD64* __restrict__ p_bias,
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 x_stride,
+			WORD32 y_stride,
+			WORD32 x_padding,
+			WORD32 y_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 input_zero_bias,
+			WORD32 * p_out_multiplier,
+			WORD32 * p_out_shift,
+			WORD32 out_zero_bias,
+			WORD32 out_data_format,
+			VOID *p_scratch);
+
+	WORD32 xa_nn_conv2d_std_prepacked_per_chan_sym4sxasym8s(
+			WORD8* __restrict__ p_out,
+			const WORD8* __restrict__ p_inp,
+			const VOID* __restrict__ p_kernel_prepacked,
+			const WORD32* __restrict__ p_bias,
+			WORD32 input_height,
+			WORD32 input_width,
+			WORD32 input_channels,
+			WORD32 kernel_height,
+			WORD32 kernel_width,
+			WORD32 out_channels,
+			WORD32 x_stride,
+			WORD32 y_stride,
+			WORD32 x_padding,
+			WORD32 y_padding,
+			WORD32 out_height,
+			WORD32 out_width,
+			WORD32 input_zero_bias,
+			WORD32 * p_out_multiplier,
+			WORD32 * p_out_shift,
+			WORD32 out_zero_bias,
+			WORD32 out_data_format,
+			VOID *p_scratch);
+
 	WORD32 xa_nn_matXvec_batch_asym8uxasym8u_asym8u(
 			UWORD8 ** __restrict__ p_out,
 			UWORD8 * __restrict__ p_mat1,
@@ -2038,6 +2779,35 @@
 			WORD32 out_shift,
 			WORD32 out_zero_bias);
 
+	WORD32 xa_nn_matXvec_batch_sym8sxasym8s_asym8s(
+			WORD8 ** __restrict__ p_out,
+			const WORD8 * __restrict__ p_mat1,
+			const WORD8 ** __restrict__ p_vec1,
+			const WORD32 * __restrict__ p_bias,
+			WORD32 rows,
+			WORD32 cols1,
+			WORD32 row_stride1,
+			WORD32 vec_count,
+			WORD32 vec1_zero_bias,
+			WORD32 out_multiplier,
+			WORD32 out_shift,
+			WORD32 out_zero_bias);
+
+	WORD32 xa_nn_matXvec_batch_asym8sxasym8s_asym8s(
+			WORD8 ** __restrict__ p_out,
+			const WORD8 * __restrict__ p_mat1,
+			const WORD8 ** __restrict__ p_vec1,
+			const WORD32 * __restrict__ p_bias,
+			WORD32 rows,
+			WORD32 cols1,
+			WORD32 row_stride1,
+			WORD32 vec_count,
+			WORD32 mat1_zero_bias,
+			WORD32 vec1_zero_bias,
+			WORD32 out_multiplier,
+			WORD32 out_shift,
+			WORD32 out_zero_bias);
+
 	WORD32 xa_nn_matmul_asym8uxasym8u_asym8u(
 			UWORD8 * __restrict__ p_out,
 			const UWORD8 * __restrict__ p_mat1,
@@ -2211,6 +2981,57 @@
 			WORD32  out_data_format,
 			pVOID p_scratch);
 
+	WORD32 xa_nn_conv2d_depthwise_out_stride_per_chan_sym8sxasym8s(
+			pWORD8 __restrict__ p_out,
+			const WORD8 *__restrict__ p_kernel,
+			const WORD8 *__restrict__ p_inp,
+			const WORD32 *__restrict__ p_bias,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  kernel_height,
+			WORD32  kernel_width,
+			WORD32  channels_multiplier,
+			WORD32  x_stride,
+			WORD32  y_stride,
+			WORD32  x_padding,
+			WORD32  y_padding,
+			WORD32  out_height,
+			WORD32  out_width,
+			WORD32  input_zero_bias,
+			const WORD32  *p_out_multiplier,
+			const WORD32  *p_out_shift,
+			WORD32  out_zero_bias,
+			WORD32  out_stride,
+			pVOID p_scratch);
+
+	WORD32 xa_nn_conv2d_depthwise_epilogue_per_chan_sym8sxasym8s(
+			pWORD8 __restrict__ p_out,
+			const WORD8 *__restrict__ p_kernel,
+			const WORD8 *__restrict__ p_inp,
+			const WORD32 *__restrict__ p_bias,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  kernel_height,
+			WORD32  kernel_width,
+			WORD32  channels_multiplier,
+			WORD32  x_stride,
+			WORD32  y_stride,
+			WORD32  x_padding,
+			WORD32  y_padding,
+			WORD32  out_height,
+			WORD32  out_width,
+			WORD32  input_zero_bias,
+			const WORD32  *p_out_multiplier,
+			const WORD32  *p_out_shift,
+			WORD32  out_zero_bias,
+			WORD32  out_stride,
+			const WORD8 *p_residual,
+			WORD32  residual_stride,
+			const xa_nn_epilogue_asym8s_t *p_epilogue,
+			pVOID p_scratch);
+
     WORD32 xa_nn_dilated_conv2d_depthwise_per_chan_sym8sxasym8s
       (pWORD8 __restrict__ p_out
       ,const WORD8 *__restrict__ p_kernel
@@ -2263,7 +3084,22 @@
                         ,WORD32  out_data_format
                         ,pVOID p_scratch);
 
-	WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
+	WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxasym8s(
+			WORD8* __restrict__ p_out,
+			WORD8* __restrict__ p_kernel,
+			WORD8* __restrict__ p_inp,
+			WORD32* __restrict__ p_bias,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  out_channels,
+			WORD32  input_zero_bias,
+			WORD32* __restrict__ p_out_multiplier,
+			WORD32* __restrict__ p_out_shift,
+			WORD32  out_zero_bias,
+			WORD32  out_data_format);
+
+	WORD32 xa_nn_conv2d_pointwise_out_stride_per_chan_sym8sxasym8s(
 			WORD8* __restrict__ p_out,
 			WORD8* __restrict__ p_kernel,
 			WORD8* __restrict__ p_inp,
@@ -2276,7 +3112,25 @@
 			WORD32* __restrict__ p_out_multiplier,
 			WORD32* __restrict__ p_out_shift,
 			WORD32  out_zero_bias,
-			WORD32  out_data_format);
+			WORD32  out_stride);
+
+	WORD32 xa_nn_conv2d_pointwise_epilogue_per_chan_sym8sxasym8s(
+			WORD8* __restrict__ p_out,
+			WORD8* __restrict__ p_kernel,
+			WORD8* __restrict__ p_inp,
+			WORD32* __restrict__ p_bias,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  out_channels,
+			WORD32  input_zero_bias,
+			WORD32* __restrict__ p_out_multiplier,
+			WORD32* __restrict__ p_out_shift,
+			WORD32  out_zero_bias,
+			WORD32  out_stride,
+			const WORD8 *p_residual,
+			WORD32  residual_stride,
+			const xa_nn_epilogue_asym8s_t *p_epilogue);
 
 	WORD32 xa_nn_conv2d_pointwise_per_chan_sym8sxsym16s(
 			WORD16* __restrict__ p_out,
@@ -2382,6 +3236,25 @@
 			WORD32  left_shift,
 			WORD32  num_elm);
 
+	WORD32 xa_nn_elm_add_out_stride_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
+			WORD32  out_stride,
+			WORD32  out_zero_bias,
+			WORD32  out_left_shift,
+			WORD32  out_multiplier,
+			WORD32  out_activation_min,
+			WORD32  out_activation_max,
+			const    WORD8 * __restrict__ p_inp1,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_left_shift,
+			WORD32  inp1_multiplier,
+			const    WORD8 * __restrict__ p_inp2,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_left_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift,
+			WORD32  num_rows,
+			WORD32  row_len);
+
     WORD32 xa_nn_elm_add_broadcast_4D_asym8sxasym8s_asym8s(WORD8 * __restrict__ p_out,
             const WORD32 *const p_out_shape,
             WORD32  out_zero_bias,
@@ -2451,6 +3324,123 @@
             const FLOAT32 * __restrict__ p_inp2,
             const WORD32 *const p_inp2_shape);
 
+	WORD32 xa_nn_elm_add_broadcast_4D_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const FLOAT32 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const FLOAT32 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_mul_broadcast_4D_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const FLOAT32 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const FLOAT32 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_div_broadcast_4D_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const FLOAT32 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const FLOAT32 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_min_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+			const FLOAT32 * __restrict__ p_inp1,
+			const FLOAT32 * __restrict__ p_inp2,
+			WORD32 num_elm);
+
+	WORD32 xa_nn_elm_min_broadcast_4D_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const FLOAT32 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const FLOAT32 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_max_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+			const FLOAT32 * __restrict__ p_inp1,
+			const FLOAT32 * __restrict__ p_inp2,
+			WORD32 num_elm);
+
+	WORD32 xa_nn_elm_max_broadcast_4D_f32xf32_f32(FLOAT32 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const FLOAT32 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const FLOAT32 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_equal_f32xf32(WORD8 * __restrict__ p_out,
+			const FLOAT32 * __restrict__ p_inp1,
+			const FLOAT32 * __restrict__ p_inp2,
+			WORD32 num_elm);
+
+	WORD32 xa_nn_elm_equal_broadcast_4D_f32xf32(WORD8 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const FLOAT32 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const FLOAT32 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_notequal_f32xf32(WORD8 * __restrict__ p_out,
+			const FLOAT32 * __restrict__ p_inp1,
+			const FLOAT32 * __restrict__ p_inp2,
+			WORD32 num_elm);
+
+	WORD32 xa_nn_elm_notequal_broadcast_4D_f32xf32(WORD8 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const FLOAT32 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const FLOAT32 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_greater_f32xf32(WORD8 * __restrict__ p_out,
+			const FLOAT32 * __restrict__ p_inp1,
+			const FLOAT32 * __restrict__ p_inp2,
+			WORD32 num_elm);
+
+	WORD32 xa_nn_elm_greater_broadcast_4D_f32xf32(WORD8 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const FLOAT32 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const FLOAT32 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_greaterequal_f32xf32(WORD8 * __restrict__ p_out,
+			const FLOAT32 * __restrict__ p_inp1,
+			const FLOAT32 * __restrict__ p_inp2,
+			WORD32 num_elm);
+
+	WORD32 xa_nn_elm_greaterequal_broadcast_4D_f32xf32(WORD8 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const FLOAT32 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const FLOAT32 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_less_f32xf32(WORD8 * __restrict__ p_out,
+			const FLOAT32 * __restrict__ p_inp1,
+			const FLOAT32 * __restrict__ p_inp2,
+			WORD32 num_elm);
+
+	WORD32 xa_nn_elm_less_broadcast_4D_f32xf32(WORD8 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const FLOAT32 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const FLOAT32 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_lessequal_f32xf32(WORD8 * __restrict__ p_out,
+			const FLOAT32 * __restrict__ p_inp1,
+			const FLOAT32 * __restrict__ p_inp2,
+			WORD32 num_elm);
+
+	WORD32 xa_nn_elm_lessequal_broadcast_4D_f32xf32(WORD8 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const FLOAT32 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const FLOAT32 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
 	WORD32 xa_nn_elm_sub_asym8uxasym8u_asym8u(UWORD8 * __restrict__ p_out,
 			WORD32  out_zero_bias,
 			WORD32  out_left_shift,
@@ -2554,6 +3544,18 @@
               const WORD32 *const p_inp2_shape
               );
 
+	WORD32 xa_nn_elm_mul_broadcast_4D_sym16sxsym16s_asym16s(WORD16 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            WORD32  out_zero_bias,
+            WORD32  out_shift,
+            WORD32  out_multiplier,
+            WORD32  out_activation_min,
+            WORD32  out_activation_max,
+            const    WORD16 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const    WORD16 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
 	WORD32 xa_nn_elm_mul_sym16sxsym16s_asym8s(WORD8 * __restrict__ p_out,
             WORD32  out_zero_bias,
             WORD32  out_shift,
@@ -2720,94 +3722,372 @@
 			const  WORD8* __restrict__ in2,     /* pointer to unextended input data for tensor 2 */
 			const int * const in2_strides);     /* member 'strides' as defined in struct 'NdArrayDesc' for tensor 2*/
 
-	WORD32 xa_nn_elm_max_8D_Bcast_8x8_8(
-			WORD8* __restrict__ out,            /* pointer to write output data to */
-			const int *const out_shape,         /* shape of output. This is the resulting shape after broadcast */
+	WORD32 xa_nn_elm_max_8D_Bcast_8x8_8(
+			WORD8* __restrict__ out,            /* pointer to write output data to */
+			const int *const out_shape,         /* shape of output. This is the resulting shape after broadcast */
+
+			const  WORD8* __restrict__ in1,     /* pointer to unextended input data for tensor 1 */
+			const int * const in1_strides,      /* member 'strides' as defined in struct 'NdArrayDesc' for tensor 1*/
+
+			const  WORD8* __restrict__ in2,     /* pointer to unextended input data for tensor 2 */
+			const int * const in2_strides);     /* member 'strides' as defined in struct 'NdArrayDesc' for tensor 2*/
+
+	WORD32 xa_nn_elm_min_broadcast_4D_8x8_8(WORD8 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const WORD8 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const WORD8 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_max_broadcast_4D_8x8_8(WORD8 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const WORD8 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const WORD8 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_min_16x16_16(WORD16 * __restrict__ p_out,
+			const WORD16 * __restrict__ p_in1,
+			const WORD16 * __restrict__ p_in2,
+			WORD32               num_element);
+
+	WORD32 xa_nn_elm_min_broadcast_4D_16x16_16(WORD16 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const WORD16 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const WORD16 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_elm_max_16x16_16(WORD16 * __restrict__ p_out,
+			const WORD16 * __restrict__ p_in1,
+			const WORD16 * __restrict__ p_in2,
+			WORD32               num_element);
+
+	WORD32 xa_nn_elm_max_broadcast_4D_16x16_16(WORD16 * __restrict__ p_out,
+            const WORD32 *const p_out_shape,
+            const WORD16 * __restrict__ p_inp1,
+            const WORD32 *const p_inp1_shape,
+            const WORD16 * __restrict__ p_inp2,
+            const WORD32 *const p_inp2_shape);
+
+	WORD32 xa_nn_broadcast_8_8( WORD8* __restrict__ p_out,          /* pointer to write broadcasted output data to */
+			const int *const out_shape,             /* output shape resulting after broadcast */
+			const  WORD8* __restrict__ p_in,        /* pointer to unextended input data */
+			const int * const in_shape,             /* input shape */
+			int num_dims);                    /* number of dimensions in [in,out]_shape */
+
+	WORD32 xa_nn_elm_equal_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD8 * __restrict__ p_inp1,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD8 * __restrict__ p_inp2,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift,
+			WORD32  num_elm);
+
+	WORD32 xa_nn_elm_notequal_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD8 * __restrict__ p_inp1,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD8 * __restrict__ p_inp2,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift,
+			WORD32  num_elm);
+
+	WORD32 xa_nn_elm_greater_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD8 * __restrict__ p_inp1,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD8 * __restrict__ p_inp2,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift,
+			WORD32  num_elm);
+
+	WORD32 xa_nn_elm_greaterequal_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD8 * __restrict__ p_inp1,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD8 * __restrict__ p_inp2,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift,
+			WORD32  num_elm);
+
+	WORD32 xa_nn_elm_less_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD8 * __restrict__ p_inp1,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD8 * __restrict__ p_inp2,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift,
+			WORD32  num_elm);
+
+	WORD32 xa_nn_elm_lessequal_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD8 * __restrict__ p_inp1,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD8 * __restrict__ p_inp2,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift,
+			WORD32  num_elm);
+
+	WORD32 xa_nn_elm_equal_broadcast_4D_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD8 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD8 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
+
+	WORD32 xa_nn_elm_notequal_broadcast_4D_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD8 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD8 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
 
-			const  WORD8* __restrict__ in1,     /* pointer to unextended input data for tensor 1 */
-			const int * const in1_strides,      /* member 'strides' as defined in struct 'NdArrayDesc' for tensor 1*/
+	WORD32 xa_nn_elm_greater_broadcast_4D_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD8 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD8 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
 
-			const  WORD8* __restrict__ in2,     /* pointer to unextended input data for tensor 2 */
-			const int * const in2_strides);     /* member 'strides' as defined in struct 'NdArrayDesc' for tensor 2*/
+	WORD32 xa_nn_elm_greaterequal_broadcast_4D_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD8 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD8 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
 
-	WORD32 xa_nn_broadcast_8_8( WORD8* __restrict__ p_out,          /* pointer to write broadcasted output data to */
-			const int *const out_shape,             /* output shape resulting after broadcast */
-			const  WORD8* __restrict__ p_in,        /* pointer to unextended input data */
-			const int * const in_shape,             /* input shape */
-			int num_dims);                    /* number of dimensions in [in,out]_shape */
+	WORD32 xa_nn_elm_less_broadcast_4D_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD8 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD8 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
 
-	WORD32 xa_nn_elm_equal_asym8sxasym8s(WORD8 * __restrict__ p_out,
+	WORD32 xa_nn_elm_lessequal_broadcast_4D_asym8sxasym8s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
 			const WORD8 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
 			WORD32  inp1_zero_bias,
 			WORD32  inp1_shift,
 			WORD32  inp1_multiplier,
 			const WORD8 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
+
+	WORD32 xa_nn_elm_equal_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD16 * __restrict__ p_inp1,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD16 * __restrict__ p_inp2,
 			WORD32  inp2_zero_bias,
 			WORD32  inp2_shift,
 			WORD32  inp2_multiplier,
 			WORD32  left_shift,
 			WORD32  num_elm);
 
-	WORD32 xa_nn_elm_notequal_asym8sxasym8s(WORD8 * __restrict__ p_out,
-			const WORD8 * __restrict__ p_inp1,
+	WORD32 xa_nn_elm_notequal_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD16 * __restrict__ p_inp1,
 			WORD32  inp1_zero_bias,
 			WORD32  inp1_shift,
 			WORD32  inp1_multiplier,
-			const WORD8 * __restrict__ p_inp2,
+			const WORD16 * __restrict__ p_inp2,
 			WORD32  inp2_zero_bias,
 			WORD32  inp2_shift,
 			WORD32  inp2_multiplier,
 			WORD32  left_shift,
 			WORD32  num_elm);
 
-	WORD32 xa_nn_elm_greater_asym8sxasym8s(WORD8 * __restrict__ p_out,
-			const WORD8 * __restrict__ p_inp1,
+	WORD32 xa_nn_elm_greater_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD16 * __restrict__ p_inp1,
 			WORD32  inp1_zero_bias,
 			WORD32  inp1_shift,
 			WORD32  inp1_multiplier,
-			const WORD8 * __restrict__ p_inp2,
+			const WORD16 * __restrict__ p_inp2,
 			WORD32  inp2_zero_bias,
 			WORD32  inp2_shift,
 			WORD32  inp2_multiplier,
 			WORD32  left_shift,
 			WORD32  num_elm);
 
-	WORD32 xa_nn_elm_greaterequal_asym8sxasym8s(WORD8 * __restrict__ p_out,
-			const WORD8 * __restrict__ p_inp1,
+	WORD32 xa_nn_elm_greaterequal_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD16 * __restrict__ p_inp1,
 			WORD32  inp1_zero_bias,
 			WORD32  inp1_shift,
 			WORD32  inp1_multiplier,
-			const WORD8 * __restrict__ p_inp2,
+			const WORD16 * __restrict__ p_inp2,
 			WORD32  inp2_zero_bias,
 			WORD32  inp2_shift,
 			WORD32  inp2_multiplier,
 			WORD32  left_shift,
 			WORD32  num_elm);
 
-	WORD32 xa_nn_elm_less_asym8sxasym8s(WORD8 * __restrict__ p_out,
-			const WORD8 * __restrict__ p_inp1,
+	WORD32 xa_nn_elm_less_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD16 * __restrict__ p_inp1,
 			WORD32  inp1_zero_bias,
 			WORD32  inp1_shift,
 			WORD32  inp1_multiplier,
-			const WORD8 * __restrict__ p_inp2,
+			const WORD16 * __restrict__ p_inp2,
 			WORD32  inp2_zero_bias,
 			WORD32  inp2_shift,
 			WORD32  inp2_multiplier,
 			WORD32  left_shift,
 			WORD32  num_elm);
 
-	WORD32 xa_nn_elm_lessequal_asym8sxasym8s(WORD8 * __restrict__ p_out,
-			const WORD8 * __restrict__ p_inp1,
+	WORD32 xa_nn_elm_lessequal_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD16 * __restrict__ p_inp1,
 			WORD32  inp1_zero_bias,
 			WORD32  inp1_shift,
 			WORD32  inp1_multiplier,
-			const WORD8 * __restrict__ p_inp2,
+			const WORD16 * __restrict__ p_inp2,
 			WORD32  inp2_zero_bias,
 			WORD32  inp2_shift,
 			WORD32  inp2_multiplier,
 			WORD32  left_shift,
 			WORD32  num_elm);
 
+	WORD32 xa_nn_elm_equal_broadcast_4D_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD16 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD16 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
+
+	WORD32 xa_nn_elm_notequal_broadcast_4D_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD16 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD16 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
+
+	WORD32 xa_nn_elm_greater_broadcast_4D_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD16 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD16 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
+
+	WORD32 xa_nn_elm_greaterequal_broadcast_4D_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD16 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD16 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
+
+	WORD32 xa_nn_elm_less_broadcast_4D_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD16 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD16 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
+
+	WORD32 xa_nn_elm_lessequal_broadcast_4D_asym16sxasym16s(WORD8 * __restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD16 * __restrict__ p_inp1,
+			const WORD32 *const p_inp1_shape,
+			WORD32  inp1_zero_bias,
+			WORD32  inp1_shift,
+			WORD32  inp1_multiplier,
+			const WORD16 * __restrict__ p_inp2,
+			const WORD32 *const p_inp2_shape,
+			WORD32  inp2_zero_bias,
+			WORD32  inp2_shift,
+			WORD32  inp2_multiplier,
+			WORD32  left_shift);
+
 	WORD32 xa_nn_memmove_16( void *pdst,
 			const void *psrc,
 			WORD32 n);
@@ -2970,6 +4250,32 @@
 			WORD32  inp_data_format,
 			WORD32  out_data_format);
 
+	WORD32 xa_nn_depth_to_space_16_16(
+			WORD16 *__restrict__ p_out,
+			const WORD16 *__restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  block_size,
+			WORD32  out_height,
+			WORD32  out_width,
+			WORD32  out_channels,
+			WORD32  inp_data_format,
+			WORD32  out_data_format);
+
+	WORD32 xa_nn_depth_to_space_32_32(
+			WORD32 *__restrict__ p_out,
+			const WORD32 *__restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  block_size,
+			WORD32  out_height,
+			WORD32  out_width,
+			WORD32  out_channels,
+			WORD32  inp_data_format,
+			WORD32  out_data_format);
+
 	WORD32 xa_nn_space_to_depth_8_8(
 			WORD8 *__restrict__ p_out,
 			const WORD8 *__restrict__ p_inp,
@@ -2983,6 +4289,32 @@
 			WORD32  inp_data_format,
 			WORD32  out_data_format);
 
+	WORD32 xa_nn_space_to_depth_16_16(
+			WORD16 *__restrict__ p_out,
+			const WORD16 *__restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  block_size,
+			WORD32  out_height,
+			WORD32  out_width,
+			WORD32  out_channels,
+			WORD32  inp_data_format,
+			WORD32  out_data_format);
+
+	WORD32 xa_nn_space_to_depth_32_32(
+			WORD32 *__restrict__ p_out,
+			const WORD32 *__restrict__ p_inp,
+			WORD32  input_height,
+			WORD32  input_width,
+			WORD32  input_channels,
+			WORD32  block_size,
+			WORD32  out_height,
+			WORD32  out_width,
+			WORD32  out_channels,
+			WORD32  inp_data_format,
+			WORD32  out_data_format);
+
 	WORD32 xa_nn_batch_to_space_nd_8_8(
 			WORD8 *__restrict__ p_out,
 			const WORD32 *const p_out_shape,
@@ -2993,6 +4325,26 @@
 			WORD32  num_out_dims,
 			WORD32  num_inp_dims);
 
+	WORD32 xa_nn_batch_to_space_nd_16_16(
+			WORD16 *__restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD16 *__restrict__ p_inp,
+			const WORD32 *const p_inp_shape,
+			const WORD32 *const p_block_sizes,
+			const WORD32 *const p_crop_sizes,
+			WORD32  num_out_dims,
+			WORD32  num_inp_dims);
+
+	WORD32 xa_nn_batch_to_space_nd_32_32(
+			WORD32 *__restrict__ p_out,
+			const WORD32 *const p_out_shape,
+			const WORD32 *__restrict__ p_inp,
+			const WORD32 *const p_inp_shape,
+			const WORD32 *const p_block_sizes,
+			const WORD32 *const p_crop_sizes,
+			WORD32  num_out_dims,
+			WORD32  num_inp_dims);
+
 	WORD32 xa_nn_space_to_batch_nd_8_8(
 			WORD8 *__restrict__ p_out,
 			const WORD32 *const p_out_shape,
@@ -3092,6 +4444,14 @@
                     ,WORD32 num_out_dims
                     ,WORD32 num_inp_dims);
 
+  WORD32 xa_nn_transpose_32_32(WORD32 * __restrict__ p_out
+                    ,const WORD32 *const p_out_shape
+                    ,const WORD32 * __restrict__ p_inp
+                    ,const WORD32 *const p_inp_shape
+                    ,const WORD32 * __restrict__ p_permute_vec
+                    ,WORD32 num_out_dims
+                    ,WORD32 num_inp_dims);
+
   WORD32 xa_nn_batch_norm_3D_8_8(WORD8 * __restrict__ p_out
                     ,const WORD8 * __restrict__ p_inp
                     ,const WORD16 * __restrict__ p_alpha
@@ -3136,6 +4496,57 @@ WORD32 xa_nn_resize_nearest_neighbour_8_8(pWORD8 __restrict__ p_out
                     ,FLOAT32 width_offset
                     ,WORD32  align_corners);
 
+WORD32 xa_nn_resize_bilinear_getsize(WORD32 inp_precision
+                    ,WORD32  input_channels
+                    ,WORD32  out_height
+                    ,WORD32  out_width);
+
+/* Separable resize_bilinear, source coordinates and weights are computed
+ * from align_corners / half_pixel_centers into p_scratch of
+ * xa_nn_resize_bilinear_getsize bytes. The 8_8 variant matches
+ * xa_nn_resize_bilinear_8_8 bit-exactly. */
+WORD32 xa_nn_resize_bilinear_nhwc_8_8(pWORD8 __restrict__ p_out
+                    ,const WORD8 *__restrict__ p_inp
+                    ,WORD32  input_batch
+                    ,WORD32  input_height
+                    ,WORD32  input_width
+                    ,WORD32  input_channels
+                    ,WORD32  out_batch
+                    ,WORD32  out_height
+                    ,WORD32  out_width
+                    ,WORD32  out_channels
+                    ,WORD32  align_corners
+                    ,WORD32  half_pixel_centers
+                    ,pVOID   p_scratch);
+
+WORD32 xa_nn_resize_bilinear_nhwc_16_16(pWORD16 __restrict__ p_out
+                    ,const WORD16 *__restrict__ p_inp
+                    ,WORD32  input_batch
+                    ,WORD32  input_height
+                    ,WORD32  input_width
+                    ,WORD32  input_channels
+                    ,WORD32  out_batch
+                    ,WORD32  out_height
+                    ,WORD32  out_width
+                    ,WORD32  out_channels
+                    ,WORD32  align_corners
+                    ,WORD32  half_pixel_centers
+                    ,pVOID   p_scratch);
+
+WORD32 xa_nn_resize_bilinear_nhwc_f32_f32(FLOAT32 * __restrict__ p_out
+                    ,const FLOAT32 *__restrict__ p_inp
+                    ,WORD32  input_batch
+                    ,WORD32  input_height
+                    ,WORD32  input_width
+                    ,WORD32  input_channels
+                    ,WORD32  out_batch
+                    ,WORD32  out_height
+                    ,WORD32  out_width
+                    ,WORD32  out_channels
+                    ,WORD32  align_corners
+                    ,WORD32  half_pixel_centers
+                    ,pVOID   p_scratch);
+
 WORD32 xa_nn_concat_8_8(WORD8 * __restrict__ p_out
         ,const WORD32 *const p_out_shape
         ,const WORD8 **p_inps
@@ -3144,6 +4555,33 @@ WORD32 xa_nn_concat_8_8(WORD8 * __restrict__ p_out
         ,WORD32 num_inp
         ,WORD32 num_inp_dims
         ,WORD32 axis);
+
+WORD32 xa_nn_concat_16_16(WORD16 * __restrict__ p_out
+        ,const WORD32 *const p_out_shape
+        ,const WORD16 **p_inps
+        ,const WORD32 *const *pp_inps_shape
+        ,WORD32 num_out_dims
+        ,WORD32 num_inp
+        ,WORD32 num_inp_dims
+        ,WORD32 axis);
+
+WORD32 xa_nn_concat_32_32(WORD32 * __restrict__ p_out
+        ,const WORD32 *const p_out_shape
+        ,const WORD32 **p_inps
+        ,const WORD32 *const *pp_inps_shape
+        ,WORD32 num_out_dims
+        ,WORD32 num_inp
+        ,WORD32 num_inp_dims
+        ,WORD32 axis);
+
+WORD32 xa_nn_concat_get_slices(WORD32 * __restrict__ p_offsets
+        ,WORD32 *p_out_stride
+        ,WORD32 *p_outer_size
+        ,const WORD32 *const p_out_shape
+        ,const WORD32 *const *pp_inps_shape
+        ,WORD32 num_out_dims
+        ,WORD32 num_inp
+        ,WORD32 axis);
         
 WORD32 xa_nn_split_v_8_8(WORD8 ** __restrict__ pp_outs
                         ,const WORD32 *const *pp_outs_shape
@@ -3154,6 +4592,74 @@ WORD32 xa_nn_split_v_8_8(WORD8 ** __restrict__ pp_outs
                         ,WORD32 num_inp_dims
                         ,WORD32 axis);
 
+WORD32 xa_nn_split_v_16_16(WORD16 ** __restrict__ pp_outs
+                        ,const WORD32 *const *pp_outs_shape
+                        ,const WORD16 *p_inp
+                        ,const WORD32 *const p_inp_shape
+                        ,WORD32 num_out
+                        ,WORD32 num_out_dims
+                        ,WORD32 num_inp_dims
+                        ,WORD32 axis);
+
+WORD32 xa_nn_split_v_32_32(WORD32 ** __restrict__ pp_outs
+                        ,const WORD32 *const *pp_outs_shape
+                        ,const WORD32 *p_inp
+                        ,const WORD32 *const p_inp_shape
+                        ,WORD32 num_out
+                        ,WORD32 num_out_dims
+                        ,WORD32 num_inp_dims
+                        ,WORD32 axis);
+
+  /* Alignment contract of the 8-bit kernels
+   *
+   * 8-bit inputs and outputs only need byte alignment, any pointer is
+   * accepted. HiFi4 has no unaligned 8-bit vector load, so when a pointer
+   * is not word aligned the kernels emulate it (PRIME_8X4F / AE_LA8X4F_IP)
+   * at a cost of several extra operations per load. The kernels check
+   * alignment once per call and run fully aligned inner loops when:
+   * - xa_nn_matXvec_sym8sxasym8s_asym8s, xa_nn_fully_connected_sym8sxasym8s_asym8s:
+   *   p_mat1 and p_vec1 4-byte aligned (8-byte on HiFi1s), row_stride1
+   *   and cols1 multiples of 4.
+   * - xa_nn_elm_add_asym8sxasym8s_asym8s, xa_nn_elm_sub_asym8sxasym8s_asym8s:
+   *   p_inp1 and p_inp2 4-byte aligned, p_out has no requirement.
+   * - xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s (NHWC input):
+   *   channels_multiplier 1, 3x3, 5x5, 7x7, 1x9 or 9x1 kernel, p_inp,
+   *   p_kernel and p_out 4-byte aligned, input_channels and out_stride
+   *   multiples of 4, even out_height.
+   * - xa_nn_conv2d_depthwise_per_chan_sym8sxsym16s (NHWC input): same
+   *   kernel shapes, p_kernel 4-byte and p_out 8-byte aligned,
+   *   input_channels multiple of 4, even out_height.
+   * Tensors placed at 8-byte aligned offsets of an arena with channel
+   * counts that are multiples of 4 always meet these conditions.
+   *
+   * When the library is built with PATH_COUNTERS=1 (NNLIB_PATH_COUNTERS)
+   * these kernels count per call which path was taken: specialised is the
+   * aligned path of the matXvec and elm kernels and the fixed-shape kernel
+   * of the depthwise ones, generic is everything else.
+   * xa_nn_get_path_counters returns -1 when counters are not compiled in
+   * or kernel is out of range. */
+  typedef enum _xa_nn_path_kernel_t
+  {
+    XA_NN_PATH_MATXVEC_SYM8SXASYM8S = 0,
+    XA_NN_PATH_ELM_ADD_ASYM8S,
+    XA_NN_PATH_ELM_SUB_ASYM8S,
+    XA_NN_PATH_CONV2D_DEPTHWISE_SYM8SXASYM8S,
+    XA_NN_PATH_CONV2D_DEPTHWISE_SYM8SXSYM16S,
+    XA_NN_PATH_KERNELS
+  } xa_nn_path_kernel_t;
+
+  typedef struct _xa_nn_path_counters_t
+  {
+    const char *name;
+    UWORD32 specialised; /* calls that ran the specialised path */
+    UWORD32 generic;     /* calls that ran the generic path */
+  } xa_nn_path_counters_t;
+
+  WORD32 xa_nn_get_path_counters(xa_nn_path_counters_t *p_counters,
+      WORD32 kernel);
+
+  void xa_nn_reset_path_counters(void);
+
 	/* Mapping the functions names from previous naming convension for backward compatibility */
 #define xa_nn_matXvec_asym8xasym8_asym8 xa_nn_matXvec_asym8uxasym8u_asym8u
 #define xa_nn_matmul_asym8xasym8_asym8 xa_nn_matmul_asym8uxasym8u_asym8u
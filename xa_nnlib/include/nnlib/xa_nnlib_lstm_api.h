@@ -35,7 +35,8 @@ typedef enum _xa_nnlib_lstm_param_id_t
   XA_NNLIB_LSTM_BIAS                   = 3,             // GET/SET biases
   XA_NNLIB_LSTM_INPUT_SHAPE            = 4,             // GET input shape information
   XA_NNLIB_LSTM_OUTPUT_SHAPE           = 5,             // GET output shape information
-  XA_NNLIB_LSTM_CELL_SHAPE             = 6              // GET cell shape information. Not Supported.
+  XA_NNLIB_LSTM_CELL_SHAPE             = 6,             // GET cell shape information. Not Supported.
+  XA_NNLIB_LSTM_GATE_WEIGHT            = 7              // GET/SET gate-interleaved weights
 } xa_nnlib_lstm_param_id_t;
 
 /* I/O Precision Settings */
@@ -64,7 +65,8 @@ typedef enum _xa_nnlib_fatal_config_lstm_error_code_t
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_CELL_QFORMAT     = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 4),
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_IO_QFORMAT       = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 5),
   XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_PARAM_ID         = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 6),
-  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 7)
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_MEMBANK_PADDING  = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 7),
+  XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_NUM_STEPS        = XA_ERROR_CODE(xa_severity_fatal, xa_class_config, XA_NNLIB_LSTM, 8)
 } xa_nnlib_fatal_config_lstm_error_code_t;
 
 /************************************************************/
@@ -77,7 +79,8 @@ typedef enum _xa_nnlib_fatal_config_lstm_error_code_t
 typedef enum _xa_nnlib_fatal_exec_lstm_error_code_t
 {
   XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_OUTPUT_BUFFER_SPACE    = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_LSTM, 0),
-  XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_DATA                   = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_LSTM, 1)
+  XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_DATA                   = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_LSTM, 1),
+  XA_NNLIB_LSTM_EXECUTE_FATAL_INVALID_NUM_STEPS                   = XA_ERROR_CODE(xa_severity_fatal, xa_class_execute, XA_NNLIB_LSTM, 2)
 } xa_nnlib_fatal_exec_lstm_error_code_t;
 
 
@@ -132,6 +135,27 @@ typedef union _xa_nnlib_lstm_weights_t
     }weights8;
 } xa_nnlib_lstm_weights_t;
 
+/* Structure for getting/setting XA_NNLIB_LSTM_GATE_WEIGHT parameter.
+ The four gate matrices are interleaved row by row: row (4*r + g) holds
+ row r of gate g, gates ordered f, i, c, o. w_x is (4*out_feats) x in_feats
+ and w_h is (4*out_feats) x out_feats. Once set, xa_nnlib_lstm_process
+ computes all four gates in a single pass; setting XA_NNLIB_LSTM_WEIGHT
+ switches back to the per-gate matrices.
+ All pointer needs to be 8 bytes aligned.                   */
+typedef union _xa_nnlib_lstm_gate_weights_t
+{
+    struct
+    {
+        coeff_t *w_x; xa_nnlib_shape_t shape_w_x;
+        coeff_t *w_h; xa_nnlib_shape_t shape_w_h;
+    }weights16;
+    struct
+    {
+        coeff8_t *w_x; xa_nnlib_shape_t shape_w_x;
+        coeff8_t *w_h; xa_nnlib_shape_t shape_w_h;
+    }weights8;
+} xa_nnlib_lstm_gate_weights_t;
+
 /* Structure for getting/setting XA_NNLIB_LSTM_BIAS parameter.
  All pointer needs to be 8 bytes aligned.                   */
 typedef struct _xa_nnlib_lstm_biases_t
@@ -153,6 +177,9 @@ Int32 xa_nnlib_lstm_get_persistent_fast( xa_nnlib_lstm_init_config_t *config);
 
 Int32 xa_nnlib_lstm_get_scratch_fast( xa_nnlib_lstm_init_config_t *config);
 
+/* Scratch for xa_nnlib_lstm_process_sequence() with up to num_steps timesteps */
+Int32 xa_nnlib_lstm_get_scratch_sequence_fast( xa_nnlib_lstm_init_config_t *config, Int32 num_steps);
+
 /************************************************************/
 /* LSTM Initialization Function                              */
 /************************************************************/
@@ -172,6 +199,16 @@ Int32 xa_nnlib_lstm_process(xa_nnlib_handle_t handle,
     xa_nnlib_shape_t *p_in_shape,
     xa_nnlib_shape_t *p_out_shape);
 
+/* Processes num_steps timesteps: input is num_steps x in_feats and output is
+ num_steps x out_feats, both contiguous. The input projections of all steps
+ are computed up front, only the recurrent part runs per step. scratch must
+ be at least xa_nnlib_lstm_get_scratch_sequence_fast(config, num_steps). */
+Int32 xa_nnlib_lstm_process_sequence(xa_nnlib_handle_t handle,
+    void *scratch,
+    void *input,
+    void *output,
+    Int32 num_steps);
+
 #if defined(__cplusplus)
 }
 #endif    /* __cplusplus */
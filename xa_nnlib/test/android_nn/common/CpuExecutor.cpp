@@ -57,7 +57,11 @@
 #ifndef HIFI_BUILD
 #include <sys/mman.h>
 #else
+#include <algorithm>
 #include <cstring>
+#include <limits>
+#include <new>
+#include <numeric>
 #define PROF_ALLOCATE
 #include "xt_profiler.h"
 
@@ -238,10 +242,16 @@ static bool setInfoAndAllocateIfNeeded(RunTimeOperandInfo* info, const Shape& sh
     info->dimensions = shape.dimensions;
     info->scale = shape.scale;
     info->zeroPoint = shape.offset;
-    if (info->lifetime == OperandLifeTime::TEMPORARY_VARIABLE && info->buffer == nullptr) {
+    if (info->lifetime == OperandLifeTime::TEMPORARY_VARIABLE) {
         uint32_t length = sizeOfData(info->type, info->dimensions);
-        info->buffer = new uint8_t[length];
         if (info->buffer == nullptr) {
+            info->buffer = new uint8_t[length];
+            if (info->buffer == nullptr) {
+                return false;
+            }
+            info->length = length;
+        } else if (length > info->length) {
+            // Larger than the memory planned from the model shape
             return false;
         }
     }
@@ -271,7 +281,23 @@ int CpuExecutor::run(const V1_1::Model& model, const Request& request,
 
     mModel = &model;
     mRequest = &request; // TODO check if mRequest is needed
+#ifdef HIFI_NNLIB_OPT
+    if (!planTemporaryMemory()) {
+        mModel = nullptr;
+        mRequest = nullptr;
+        return ANEURALNETWORKS_OUT_OF_MEMORY;
+    }
+#endif
     initializeRunTimeInfo(modelPoolInfos, requestPoolInfos);
+#ifdef HIFI_NNLIB_OPT
+    // Size the arena for the whole model up front, so operations only hand
+    // out slices of it while the model executes.
+    if (getScratch(getModelScratchSize()) == nullptr) {
+        mModel = nullptr;
+        mRequest = nullptr;
+        return ANEURALNETWORKS_OUT_OF_MEMORY;
+    }
+#endif
     // The model has serialized the operation in execution order.
     for (const auto& operation : model.operations) {
         int n = executeOperation(operation);
@@ -340,6 +366,14 @@ bool CpuExecutor::initializeRunTimeInfo(const std::vector<RunTimePoolInfo>& mode
         }
     }
 
+#ifdef HIFI_NNLIB_OPT
+    // Planned temporaries stay in the arena for the whole execution
+    for (const PlannedTemporary& t : mPlan) {
+        mOperands[t.operand].buffer = mArena + t.offset;
+        mOperands[t.operand].length = t.size;
+    }
+#endif
+
     // Adjust the runtime info for the arguments passed to the model,
     // modifying the buffer location, and possibly the dimensions.
     auto updateForArguments = [this, &requestPoolInfos](const std::vector<uint32_t>& indexes,
@@ -384,6 +418,9 @@ void CpuExecutor::freeNoLongerUsedOperands(const std::vector<uint32_t>& inputs)
         info.numberOfUsesLeft--;
         if (info.numberOfUsesLeft == 0) {
             nnAssert(info.buffer != nullptr);
+#ifdef HIFI_NNLIB_OPT
+            if (!isInTemporaryArena(info.buffer))
+#endif
             delete[] info.buffer;
             info.buffer = nullptr;
         }
@@ -427,6 +464,294 @@ static void pad_shape(const RunTimeOperandInfo& input, RunTimeOperandInfo& outpu
         }
     }
 }
+
+static constexpr int32_t kScratchAlignment = 8;
+
+static inline int32_t alignScratchSize(int32_t size) {
+    return (size + kScratchAlignment - 1) & ~(kScratchAlignment - 1);
+}
+
+void* CpuExecutor::getScratch(int32_t size) {
+    if (size < 0) {
+        size = 0;
+    }
+    if (mScratch == nullptr || static_cast<size_t>(size) > mScratchSize) {
+        // Only reached for the first execution, or if an operation needs
+        // more than getModelScratchSize() predicted (e.g. shapes that were
+        // not known before execution).
+        mScratchStorage.reset(new (std::nothrow) uint8_t[size + kScratchAlignment]);
+        if (mScratchStorage == nullptr) {
+            mScratch = nullptr;
+            mScratchSize = 0;
+            return nullptr;
+        }
+        uintptr_t base = reinterpret_cast<uintptr_t>(mScratchStorage.get());
+        mScratch = reinterpret_cast<uint8_t*>((base + kScratchAlignment - 1) &
+                                              ~static_cast<uintptr_t>(kScratchAlignment - 1));
+        mScratchSize = size;
+    }
+    return mScratch;
+}
+
+bool CpuExecutor::planTemporaryMemory() {
+    const uint32_t kNotWritten = std::numeric_limits<uint32_t>::max();
+
+    // Temporaries with a size known from the model, in operand order. Shapes
+    // only known at execution time keep the allocation in
+    // setInfoAndAllocateIfNeeded().
+    mPlanCandidates.clear();
+    for (size_t i = 0; i < mModel->operands.size(); i++) {
+        const Operand& operand = mModel->operands[i];
+        if (operand.lifetime != OperandLifeTime::TEMPORARY_VARIABLE ||
+            std::find(operand.dimensions.begin(), operand.dimensions.end(), 0u) !=
+                    operand.dimensions.end()) {
+            continue;
+        }
+        uint32_t size = sizeOfData(operand.type, operand.dimensions);
+        if (size == 0) {
+            continue;
+        }
+        mPlanCandidates.push_back({static_cast<uint32_t>(i),
+                                   static_cast<uint32_t>(alignScratchSize(size)),
+                                   kNotWritten, 0, 0});
+    }
+
+    // Lifetimes from the execution order of the operations
+    auto findCandidate = [this](uint32_t operand) -> PlannedTemporary* {
+        auto it = std::lower_bound(mPlanCandidates.begin(), mPlanCandidates.end(), operand,
+                                   [](const PlannedTemporary& t, uint32_t index) {
+                                       return t.operand < index;
+                                   });
+        return (it != mPlanCandidates.end() && it->operand == operand) ? &*it : nullptr;
+    };
+    for (uint32_t k = 0; k < mModel->operations.size(); k++) {
+        const Operation& operation = mModel->operations[k];
+        for (uint32_t i : operation.outputs) {
+            PlannedTemporary* t = findCandidate(i);
+            if (t != nullptr) {
+                t->firstOperation = std::min(t->firstOperation, k);
+            }
+        }
+        for (uint32_t i : operation.inputs) {
+            PlannedTemporary* t = findCandidate(i);
+            if (t != nullptr) {
+                t->lastOperation = std::max(t->lastOperation, k);
+            }
+        }
+    }
+    mPlanCandidates.erase(std::remove_if(mPlanCandidates.begin(), mPlanCandidates.end(),
+                                         [kNotWritten](const PlannedTemporary& t) {
+                                             return t.firstOperation == kNotWritten;
+                                         }),
+                          mPlanCandidates.end());
+    for (PlannedTemporary& t : mPlanCandidates) {
+        t.lastOperation = std::max(t.lastOperation, t.firstOperation);
+    }
+
+    // Same model as the last run, keep its offsets and arena
+    auto sameLifetime = [](const PlannedTemporary& a, const PlannedTemporary& b) {
+        return a.operand == b.operand && a.size == b.size &&
+               a.firstOperation == b.firstOperation && a.lastOperation == b.lastOperation;
+    };
+    if (mPlan.size() == mPlanCandidates.size() &&
+        std::equal(mPlan.begin(), mPlan.end(), mPlanCandidates.begin(), sameLifetime)) {
+        return true;
+    }
+
+    // Greedy by size: largest first, each at the lowest offset that does not
+    // overlap a placed temporary whose lifetime intersects its own.
+    std::vector<uint32_t> order(mPlanCandidates.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](uint32_t a, uint32_t b) {
+        return mPlanCandidates[a].size > mPlanCandidates[b].size;
+    });
+    std::vector<std::pair<uint32_t, uint32_t>> busy;
+    size_t arenaSize = 0;
+    for (size_t n = 0; n < order.size(); n++) {
+        PlannedTemporary& t = mPlanCandidates[order[n]];
+        busy.clear();
+        for (size_t m = 0; m < n; m++) {
+            const PlannedTemporary& placed = mPlanCandidates[order[m]];
+            if (placed.firstOperation <= t.lastOperation &&
+                t.firstOperation <= placed.lastOperation) {
+                busy.emplace_back(placed.offset, placed.offset + placed.size);
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+        uint32_t offset = 0;
+        for (const auto& range : busy) {
+            if (range.first >= offset + t.size) {
+                break;
+            }
+            offset = std::max(offset, range.second);
+        }
+        t.offset = offset;
+        arenaSize = std::max(arenaSize, static_cast<size_t>(offset) + t.size);
+    }
+
+    if (arenaSize > mArenaCapacity) {
+        mArenaStorage.reset(new (std::nothrow) uint8_t[arenaSize + kScratchAlignment]);
+        if (mArenaStorage == nullptr) {
+            mArena = nullptr;
+            mArenaCapacity = 0;
+            mArenaSize = 0;
+            mPlan.clear();
+            return false;
+        }
+        uintptr_t base = reinterpret_cast<uintptr_t>(mArenaStorage.get());
+        mArena = reinterpret_cast<uint8_t*>((base + kScratchAlignment - 1) &
+                                            ~static_cast<uintptr_t>(kScratchAlignment - 1));
+        mArenaCapacity = arenaSize;
+    }
+    mArenaSize = arenaSize;
+    mPlan.swap(mPlanCandidates);
+    return true;
+}
+
+int32_t CpuExecutor::getOperationScratchSize(const Operation& operation) {
+    const hidl_vec<uint32_t>& ins = operation.inputs;
+    int32_t scratch_size = 0;
+    Shape outShape;
+
+    for (uint32_t i : ins) {
+        if (mOperands[i].lifetime == OperandLifeTime::NO_VALUE) {
+            return 0;
+        }
+    }
+
+    switch (operation.type) {
+        case OperationType::DEPTHWISE_CONV_2D:
+        case OperationType::CONV_2D: {
+            const bool depthwise = (operation.type == OperationType::DEPTHWISE_CONV_2D);
+            const size_t explicitCount = depthwise ? 11 : 10;
+            const size_t implicitCount = depthwise ? 8 : 7;
+            if (ins.size() != explicitCount && ins.size() != implicitCount) {
+                return 0;
+            }
+            const RunTimeOperandInfo& input  = mOperands[ins[0]];
+            const RunTimeOperandInfo& filter = mOperands[ins[1]];
+            const RunTimeOperandInfo& bias   = mOperands[ins[2]];
+
+            int32_t padding_left, padding_right;
+            int32_t padding_top, padding_bottom;
+            int32_t stride_width, stride_height;
+
+            if (ins.size() == explicitCount) {
+                padding_left     = getScalarData<int32_t>(mOperands[ins[3]]);
+                padding_right    = getScalarData<int32_t>(mOperands[ins[4]]);
+                padding_top      = getScalarData<int32_t>(mOperands[ins[5]]);
+                padding_bottom   = getScalarData<int32_t>(mOperands[ins[6]]);
+                stride_width     = getScalarData<int32_t>(mOperands[ins[7]]);
+                stride_height    = getScalarData<int32_t>(mOperands[ins[8]]);
+            } else {
+                int32_t padding_implicit = getScalarData<int32_t>(mOperands[ins[3]]);
+                stride_width     = getScalarData<int32_t>(mOperands[ins[4]]);
+                stride_height    = getScalarData<int32_t>(mOperands[ins[5]]);
+
+                Shape inputShape = input.shape();
+                Shape filterShape = filter.shape();
+                calculateExplicitPadding(getSizeOfDimension(inputShape, 2), stride_width,
+                                         getSizeOfDimension(filterShape, 2), padding_implicit,
+                                         &padding_left, &padding_right);
+                calculateExplicitPadding(getSizeOfDimension(inputShape, 1), stride_height,
+                                         getSizeOfDimension(filterShape, 1), padding_implicit,
+                                         &padding_top, &padding_bottom);
+            }
+
+            if (depthwise) {
+                if (!depthwiseConvPrepare(input.shape(), filter.shape(), bias.shape(),
+                                          padding_left, padding_right,
+                                          padding_top, padding_bottom,
+                                          stride_width, stride_height,
+                                          &outShape, scratch_size)) {
+                    return 0;
+                }
+            } else {
+                if (!convPrepare(input.shape(), filter.shape(), bias.shape(),
+                                 padding_left, padding_right,
+                                 padding_top, padding_bottom,
+                                 stride_width, stride_height,
+                                 &outShape, scratch_size)) {
+                    return 0;
+                }
+                if (input.type == OperandType::TENSOR_FLOAT32) {
+                    // CONV_2D float32 also keeps a depth-padded filter in the arena
+                    Shape filterShapePadded = filter.shape();
+                    filterShapePadded.dimensions[3] = ((filterShapePadded.dimensions[3]+1)&(~1));
+                    scratch_size = alignScratchSize(scratch_size) +
+                                   sizeOfData(filterShapePadded.type, filterShapePadded.dimensions);
+                }
+            }
+        } break;
+        case OperationType::AVERAGE_POOL_2D:
+        case OperationType::MAX_POOL_2D: {
+            if (ins.size() != 10 && ins.size() != 7) {
+                return 0;
+            }
+            const RunTimeOperandInfo& input = mOperands[ins[0]];
+
+            int32_t padding_left, padding_right;
+            int32_t padding_top, padding_bottom;
+            int32_t stride_width, stride_height;
+            int32_t filter_width, filter_height;
+
+            if (ins.size() == 10) {
+                padding_left     = getScalarData<int32_t>(mOperands[ins[1]]);
+                padding_right    = getScalarData<int32_t>(mOperands[ins[2]]);
+                padding_top      = getScalarData<int32_t>(mOperands[ins[3]]);
+                padding_bottom   = getScalarData<int32_t>(mOperands[ins[4]]);
+                stride_width     = getScalarData<int32_t>(mOperands[ins[5]]);
+                stride_height    = getScalarData<int32_t>(mOperands[ins[6]]);
+                filter_width     = getScalarData<int32_t>(mOperands[ins[7]]);
+                filter_height    = getScalarData<int32_t>(mOperands[ins[8]]);
+            } else {
+                int32_t padding_implicit = getScalarData<int32_t>(mOperands[ins[1]]);
+                stride_width     = getScalarData<int32_t>(mOperands[ins[2]]);
+                stride_height    = getScalarData<int32_t>(mOperands[ins[3]]);
+                filter_width     = getScalarData<int32_t>(mOperands[ins[4]]);
+                filter_height    = getScalarData<int32_t>(mOperands[ins[5]]);
+
+                Shape inputShape = input.shape();
+                calculateExplicitPadding(getSizeOfDimension(inputShape, 2), stride_width,
+                                         filter_width, padding_implicit,
+                                         &padding_left, &padding_right);
+                calculateExplicitPadding(getSizeOfDimension(inputShape, 1), stride_height,
+                                         filter_height, padding_implicit,
+                                         &padding_top, &padding_bottom);
+            }
+
+            if (!genericPoolingPrepare(input.shape(),
+                                       padding_left, padding_right,
+                                       padding_top, padding_bottom,
+                                       stride_width, stride_height,
+                                       filter_width, filter_height,
+                                       &outShape, operation, scratch_size)) {
+                return 0;
+            }
+        } break;
+        case OperationType::SOFTMAX: {
+            if (ins.size() != 2) {
+                return 0;
+            }
+            if (!genericActivationPrepare(mOperands[ins[0]].shape(), &outShape,
+                                          operation, scratch_size)) {
+                return 0;
+            }
+        } break;
+        default:
+            break;
+    }
+
+    return scratch_size > 0 ? scratch_size : 0;
+}
+
+int32_t CpuExecutor::getModelScratchSize() {
+    int32_t max_scratch_size = 0;
+    for (const auto& operation : mModel->operations) {
+        max_scratch_size = std::max(max_scratch_size, getOperationScratchSize(operation));
+    }
+    return max_scratch_size;
+}
 #endif
 
 int CpuExecutor::executeOperation(const Operation& operation) {
@@ -647,7 +972,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
 
             if (input.type == OperandType::TENSOR_FLOAT32) {
 #ifdef HIFI_NNLIB_OPT
-                int32_t scratch_size;
+                int32_t scratch_size = 0;
                 filterShapePadded.dimensions[3] = ((filterShapePadded.dimensions[3]+1)&(~1));
 #endif
                 success = depthwiseConvPrepare(input.shape(), filter.shape(), bias.shape(),
@@ -677,8 +1002,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                                outShape);
                 PROFILER_STOP;
 #else
-                printf("Scratch %d \n", scratch_size);
-                void *p_scratch = malloc(scratch_size);
+                void *p_scratch = getScratch(scratch_size);
                 PROFILER_START("DEPTHWISE_CONV_2D float32");
                 if(success) success = 
                           setInfoAndAllocateIfNeeded(&output, outShape) &&
@@ -695,11 +1019,10 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                                reinterpret_cast<float*>(output.buffer),
                                                outShape, p_scratch);
                 PROFILER_STOP;
-                free(p_scratch);
 #endif
             } else if (input.type == OperandType::TENSOR_QUANT8_ASYMM) {
 #ifdef HIFI_NNLIB_OPT
-                int32_t scratch_size;
+                int32_t scratch_size = 0;
                 //filterShapePadded.dimensions[3] = ((filterShapePadded.dimensions[3]+3)&(~3));
 #endif
                 success = depthwiseConvPrepare(input.shape(), filter.shape(), bias.shape(),
@@ -729,8 +1052,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                               outShape);
                 PROFILER_STOP;
 #else
-                printf("Scratch %d \n", scratch_size);
-                void *p_scratch = malloc(scratch_size);
+                void *p_scratch = getScratch(scratch_size);
                 PROFILER_START("DEPTHWISE_CONV_2D aym8");
                 if(success) success = 
                           depthwiseConvQuant8(reinterpret_cast<const uint8_t*>(input.buffer),
@@ -746,7 +1068,6 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                               reinterpret_cast<uint8_t*>(output.buffer),
                                               outShape, p_scratch);
                 PROFILER_STOP;
-                free(p_scratch);
 #endif
             }
 
@@ -807,7 +1128,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
 
             if (input.type == OperandType::TENSOR_FLOAT32) {
 #ifdef HIFI_NNLIB_OPT
-                int32_t scratch_size;
+                int32_t scratch_size = 0;
                 filterShapePadded.dimensions[3] = ((filterShapePadded.dimensions[3]+1)&(~1));
 #endif
                 success = convPrepare(input.shape(), filter.shape(), bias.shape(),
@@ -825,7 +1146,11 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                 filter_padded.dimensions = filterShapePadded.dimensions;
                 filter_padded.scale = filterShapePadded.scale;
                 filter_padded.zeroPoint = filterShapePadded.offset;
-                filter_padded.buffer = (uint8_t *)malloc(sizeOfData(filter_padded.type, filter_padded.dimensions));
+                /* The padded filter lives in the arena right after the kernel scratch */
+                void *p_scratch = getScratch(alignScratchSize(scratch_size) +
+                                             sizeOfData(filter_padded.type, filter_padded.dimensions));
+                filter_padded.buffer = reinterpret_cast<uint8_t*>(p_scratch) + alignScratchSize(scratch_size);
+                if (p_scratch == nullptr) success = false;
 #endif
 
 #ifndef HIFI_NNLIB_OPT
@@ -840,9 +1165,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                       reinterpret_cast<float*>(output.buffer), outShape);
                 PROFILER_STOP;
 #else
-                pad_shape(filter, filter_padded, filter.shape(), filterShapePadded);
-                printf("Scratch %d \n", scratch_size);
-                void *p_scratch = malloc(scratch_size);
+                if(success) pad_shape(filter, filter_padded, filter.shape(), filterShapePadded);
                 PROFILER_START("CONV_2D float32");
                 if(success) success = 
                           convFloat32(reinterpret_cast<const float*>(input.buffer), input.shape(),
@@ -853,12 +1176,10 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                       stride_width, stride_height, activation,
                                       reinterpret_cast<float*>(output.buffer), outShape, p_scratch);
                 PROFILER_STOP;
-                free(filter_padded.buffer);
-                free(p_scratch);
 #endif
             } else if (input.type == OperandType::TENSOR_QUANT8_ASYMM) {
 #ifdef HIFI_NNLIB_OPT
-                int32_t scratch_size;
+                int32_t scratch_size = 0;
                 filterShapePadded.dimensions[3] = ((filterShapePadded.dimensions[3]+3)&(~3));
 #endif
                 success = convPrepare(input.shape(), filter.shape(), bias.shape(),
@@ -887,8 +1208,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                      outShape);
                 PROFILER_STOP;
 #else
-                printf("Scratch %d \n", scratch_size);
-                void *p_scratch = malloc(scratch_size);
+                void *p_scratch = getScratch(scratch_size);
                 PROFILER_START("CONV_2D asym8");
                 if(success) success = 
                           convQuant8(reinterpret_cast<const uint8_t*>(input.buffer),
@@ -903,7 +1223,6 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                      reinterpret_cast<uint8_t*>(output.buffer),
                                      outShape, p_scratch);
                 PROFILER_STOP;
-                free(p_scratch);
 #endif
             }
         } break;
@@ -921,7 +1240,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
             int32_t filter_width, filter_height;
             int32_t activation;
 #ifdef HIFI_NNLIB_OPT
-            int32_t scratch_size;
+            int32_t scratch_size = 0;
 #endif
 
             if (inCount == 10) {
@@ -982,8 +1301,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                              outShape);
                 PROFILER_STOP;
 #else
-                printf("Scratch %d \n", scratch_size);
-                void *p_scratch = malloc(scratch_size);
+                void *p_scratch = getScratch(scratch_size);
                 
                 PROFILER_START("AVERAGE_POOL_2D float32");
                 if(success) success = 
@@ -996,7 +1314,6 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                              reinterpret_cast<float*>(output.buffer),
                                              outShape, p_scratch);
                 PROFILER_STOP;
-                free(p_scratch);
 #endif
             } else if (input.type == OperandType::TENSOR_QUANT8_ASYMM) {
                 success = genericPoolingPrepare(input.shape(),
@@ -1024,8 +1341,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                             outShape);
                 PROFILER_STOP;
 #else
-                printf("Scratch %d \n", scratch_size);
-                void *p_scratch = malloc(scratch_size);
+                void *p_scratch = getScratch(scratch_size);
 
                 PROFILER_START("AVERAGE_POOL_2D asym8");
                 if(success) success = 
@@ -1038,7 +1354,6 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                             reinterpret_cast<uint8_t*>(output.buffer),
                                             outShape, p_scratch);
                 PROFILER_STOP;
-                free(p_scratch);
 #endif
             }
         } break;
@@ -1130,7 +1445,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
             int32_t filter_width, filter_height;
             int32_t activation;
 #ifdef HIFI_NNLIB_OPT
-            int32_t scratch_size;
+            int32_t scratch_size = 0;
 #endif
 
             if (inCount == 10) {
@@ -1191,8 +1506,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                          outShape);
                 PROFILER_STOP;
 #else
-                printf("Scratch %d \n", scratch_size);
-                void *p_scratch = malloc(scratch_size);
+                void *p_scratch = getScratch(scratch_size);
 
                 PROFILER_START("MAX_POOL_2D float32");
                 if(success) success = 
@@ -1205,7 +1519,6 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                          reinterpret_cast<float*>(output.buffer),
                                          outShape, p_scratch);
                 PROFILER_STOP;
-                free(p_scratch);
 #endif
             } else if (input.type == OperandType::TENSOR_QUANT8_ASYMM) {
                 success = genericPoolingPrepare(input.shape(),
@@ -1232,8 +1545,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                         outShape);
                 PROFILER_STOP;
 #else
-                printf("Scratch %d \n", scratch_size);
-                void *p_scratch = malloc(scratch_size);
+                void *p_scratch = getScratch(scratch_size);
 
                 PROFILER_START("MAX_POOL_2D asym8");
                 if(success) success = 
@@ -1247,7 +1559,6 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                                         reinterpret_cast<uint8_t*>(output.buffer),
                                         outShape, p_scratch);
                 PROFILER_STOP;
-                free(p_scratch);
 #endif
             }
 
@@ -1454,7 +1765,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
         } break;
         case OperationType::SOFTMAX: {
 #ifdef HIFI_NNLIB_OPT
-            int32_t scratch_size;
+            int32_t scratch_size = 0;
 #endif
             if (!allParametersPresent(2, 1)) {
                 return ANEURALNETWORKS_BAD_DATA;
@@ -1506,7 +1817,7 @@ int CpuExecutor::executeOperation(const Operation& operation) {
                 PROFILER_STOP;
 #else
                 {
-                    void *p_scratch = malloc(scratch_size);
+                    void *p_scratch = getScratch(scratch_size);
                     PROFILER_START("SOFTMAX asym8");
                     if(success) success = 
                         softmaxQuant8(reinterpret_cast<const uint8_t*>(input.buffer),
@@ -350,6 +350,14 @@ bool convPrepare(const Shape& input,
                                             1,
                                             1,
                                             1 );
+#if !HIFI_VFPU
+    /* Float falls back to the reference implementation, whose im2col buffer
+       is taken from scratch */
+    if (input.type == OperandType::TENSOR_FLOAT32) {
+        scratch_size = (int32_t)(batches * outHeight * outWidth * getSizeOfDimension(input, 3) *
+                                 filterHeight * filterWidth * sizeof(float));
+    }
+#endif
 #endif
     return true;
 }
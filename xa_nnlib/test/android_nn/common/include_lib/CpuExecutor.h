@@ -50,6 +50,7 @@
 #ifndef HIFI_BUILD
 #include <android-base/macros.h>
 #endif //HIFI_BUILD
+#include <memory>
 #include <vector>
 
 namespace android {
@@ -151,6 +152,11 @@ public:
     int run(const V1_1::Model& model, const Request& request,
             const std::vector<RunTimePoolInfo>& modelPoolInfos,
             const std::vector<RunTimePoolInfo>& requestPoolInfos);
+#ifdef HIFI_NNLIB_OPT
+    // Bytes of the arena holding the temporaries of the last planned model,
+    // i.e. the peak temporary footprint of an execution.
+    size_t getTemporaryArenaSize() const { return mArenaSize; }
+#endif
 
 private:
     bool initializeRunTimeInfo(const std::vector<RunTimePoolInfo>& modelPoolInfos,
@@ -173,6 +179,46 @@ private:
     //    std::vector<uint32_t> mDimensions;
     // Runtime information about all the operands.
     std::vector<RunTimeOperandInfo> mOperands;
+
+#ifdef HIFI_NNLIB_OPT
+    // Largest xa_nn_*_getsize() over the operations of mModel, computed from
+    // the operand shapes before any operation runs.
+    int32_t getModelScratchSize();
+    int32_t getOperationScratchSize(const Operation& operation);
+    // Returns the scratch arena; it is only reallocated if size exceeds it.
+    void* getScratch(int32_t size);
+
+    // One aligned scratch arena per executor, shared by all its operations.
+    // It outlives run(), so an executor reused across executions does not
+    // allocate once the arena has reached the model's requirement.
+    std::unique_ptr<uint8_t[]> mScratchStorage;
+    uint8_t* mScratch = nullptr;
+    size_t mScratchSize = 0;
+
+    // Static memory plan of the TEMPORARY_VARIABLE operands. Every temporary
+    // whose size is known from the model gets an offset in one arena, from
+    // its lifetime in operation order; temporaries that are never live at
+    // the same time share memory. The plan is only recomputed when the model
+    // changes, so repeated executions do not allocate.
+    struct PlannedTemporary {
+        uint32_t operand;
+        uint32_t size;
+        uint32_t firstOperation;  // operation writing it
+        uint32_t lastOperation;   // last operation reading it
+        uint32_t offset;
+    };
+    bool planTemporaryMemory();
+    bool isInTemporaryArena(const uint8_t* buffer) const {
+        return buffer >= mArena && buffer < mArena + mArenaSize;
+    }
+
+    std::vector<PlannedTemporary> mPlan;
+    std::vector<PlannedTemporary> mPlanCandidates;
+    std::unique_ptr<uint8_t[]> mArenaStorage;
+    uint8_t* mArena = nullptr;
+    size_t mArenaCapacity = 0;
+    size_t mArenaSize = 0;
+#endif
 };
 #endif //HiFi_BUILD
 
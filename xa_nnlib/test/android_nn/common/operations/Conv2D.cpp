@@ -51,7 +51,8 @@ namespace android {
 namespace nn {
 
 // If possible we will use this static buffer for the tensor.
-#if !HIFI_VFPU || !defined HIFI_NNLIB_OPT 
+// With HIFI_NNLIB_OPT the im2col buffer comes from the executor's scratch arena.
+#ifndef HIFI_NNLIB_OPT
 static constexpr size_t kStaticBufferSize = 1605632;
 static char static_scratch_buffer[kStaticBufferSize];
 #endif
@@ -110,6 +111,23 @@ static std::mutex executionMutex;
     }
 #else /* without LOG prints */
 #if !HIFI_VFPU || !defined HIFI_NNLIB_OPT 
+#ifdef HIFI_NNLIB_OPT
+/* convPrepare() sizes scratch for im2col when float falls back to reference */
+#define ANDROID_NN_CONV_IM2COL_BUFFER(Type)                                     \
+    im2colData = reinterpret_cast<Type *>(p_scratch);                           \
+    (void) im2colGuard;
+#else
+#define ANDROID_NN_CONV_IM2COL_BUFFER(Type)                                     \
+    if (im2colByteSize <= kStaticBufferSize) {                                  \
+        im2colData = reinterpret_cast<Type *>(static_scratch_buffer);           \
+    } else {                                                                    \
+        im2colData = (Type *)malloc(im2colByteSize);                            \
+        if (im2colData == nullptr) {                                            \
+            return false;                                                       \
+        }                                                                       \
+        im2colGuard.reset(im2colData);                                          \
+    }
+#endif
 #define ANDROID_NN_CONV_PARAMETERS(Type)                                        \
     uint32_t height       = getSizeOfDimension(inputShape, 1);                  \
     uint32_t width        = getSizeOfDimension(inputShape, 2);                  \
@@ -143,15 +161,7 @@ static std::mutex executionMutex;
     if (im2colByteSize >= 0x7fffffff)  {                                        \
         return false;                                                           \
     }                                                                           \
-    if (im2colByteSize <= kStaticBufferSize) {                                  \
-        im2colData = reinterpret_cast<Type *>(static_scratch_buffer);           \
-    } else {                                                                    \
-        im2colData = (Type *)malloc(im2colByteSize);                            \
-        if (im2colData == nullptr) {                                            \
-            return false;                                                       \
-        }                                                                       \
-        im2colGuard.reset(im2colData);                                          \
-    }
+    ANDROID_NN_CONV_IM2COL_BUFFER(Type)
 #else // HIFI_NNLIB_OPT
 #define ANDROID_NN_CONV_PARAMETERS(Type)                                        \
     int32_t height       = (int32_t)getSizeOfDimension(inputShape, 1);          \
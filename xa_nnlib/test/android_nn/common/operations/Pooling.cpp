@@ -61,6 +61,13 @@ namespace nn {
     uint32_t outHeight    = getSizeOfDimension(outputShape, 1);                 \
     uint32_t outWidth     = getSizeOfDimension(outputShape, 2); 
 
+/* Kernel covers the whole unpadded plane with a single output */
+#define ANDROID_NN_POOLING_IS_GLOBAL                                            \
+    (filter_height == (int32_t)height && filter_width == (int32_t)width &&    \
+     outHeight == 1 && outWidth == 1 &&                                         \
+     padding_left == 0 && padding_right == 0 &&                                 \
+     padding_top == 0 && padding_bottom == 0)
+
 bool averagePoolFloat32(const float* inputData, const Shape& inputShape,
                         int32_t padding_left, int32_t padding_right,
                         int32_t padding_top, int32_t padding_bottom,
@@ -102,6 +109,16 @@ bool averagePoolFloat32(const float* inputData, const Shape& inputShape,
        ptr_tmp_out = &outputData[outHeight*outWidth*input_channels*itr]; 
        ptr_tmp_in  = &inputData[height*width*input_channels*itr];
 
+        if(ANDROID_NN_POOLING_IS_GLOBAL)
+        {
+            err_f = xa_nn_global_avgpool_f32(ptr_tmp_out,
+                    ptr_tmp_in,
+                    height,
+                    width,
+                    input_channels);
+            continue;
+        }
+
         err_f =  xa_nn_avgpool_f32(ptr_tmp_out,
                 ptr_tmp_in,
                 height,
@@ -273,6 +290,16 @@ bool maxPoolFloat32(const float* inputData, const Shape& inputShape,
        ptr_tmp_out = &outputData[outHeight*outWidth*input_channels*itr]; 
        ptr_tmp_in  = &inputData[height*width*input_channels*itr];
 
+        if(ANDROID_NN_POOLING_IS_GLOBAL)
+        {
+            err_f = xa_nn_global_maxpool_f32(ptr_tmp_out,
+                    ptr_tmp_in,
+                    height,
+                    width,
+                    input_channels);
+            continue;
+        }
+
         err_f =  xa_nn_maxpool_f32(ptr_tmp_out,
                 ptr_tmp_in,
                 height,
@@ -44,8 +44,12 @@
 #include "HalInterfaces.h"
 #include "Manager.h"
 #include "ModelBuilder.h"
+#ifndef HIFI_BUILD
+#include "StepScheduler.h"
+#endif //HIFI_BUILD
 #include "Utils.h"
 
+#include <memory>
 #include <mutex>
 #include <thread>
 #include <vector>
@@ -396,6 +400,58 @@ static void asyncStartComputePartitioned(const ExecutionBuilder* executionBuilde
 #endif //#ifndef DISABLE_PARTITIONED_EXECUTION
 #endif //#ifndef HIFI_BUILD
 
+#ifndef HIFI_BUILD
+#ifndef DISABLE_PARTITIONED_EXECUTION
+#ifndef DISABLE_PARALLEL_STEP_EXECUTION
+// Executes the steps of a COMPOUND plan on the StepWorkerPool, independent
+// steps (e.g. parallel branches of the model) overlapping.  Ensures that
+// executionCallback->notify() is called once all steps have completed.
+static void startComputePartitionedParallel(const ExecutionBuilder* executionBuilder,
+                                            const ExecutionPlan* plan,
+                                            std::shared_ptr<ExecutionPlan::Controller> controller,
+                                            bool allowFallback,
+                                            const sp<ExecutionCallback>& executionCallback) {
+    VLOG(EXECUTION) << "ExecutionBuilder::startCompute (from plan, step graph on worker pool)";
+    // makeStepExecutor() reads the Controller shared by all the steps
+    auto controllerMutex = std::make_shared<std::mutex>();
+    auto runStep = [plan, controller, controllerMutex](uint32_t stepIndex) {
+        std::shared_ptr<StepExecutor> executor;
+        int n;
+        {
+            std::lock_guard<std::mutex> lock(*controllerMutex);
+            n = plan->makeStepExecutor(controller, stepIndex, &executor);
+        }
+        if (n != ANEURALNETWORKS_NO_ERROR) {
+            return n;
+        }
+        sp<ExecutionCallback> stepCallback;
+        n = executor->startComputeInCallingThread(&stepCallback);
+        if (n == ANEURALNETWORKS_NO_ERROR) {
+            ErrorStatus status = stepCallback->getStatus();
+            if (status != ErrorStatus::NONE) {
+                n = convertErrorStatusToResultCode(status);
+            }
+        }
+        if (n != ANEURALNETWORKS_NO_ERROR) {
+            VLOG(EXECUTION) << "parallel step " << stepIndex << " failed";
+        }
+        return n;
+    };
+    auto onComplete = [executionBuilder, allowFallback, executionCallback](int n) {
+        if (n == ANEURALNETWORKS_NO_ERROR) {
+            executionCallback->notify(ErrorStatus::NONE);
+        } else if (allowFallback) {
+            cpuFallbackFull(executionBuilder, executionCallback);
+        } else {
+            executionCallback->notify(convertResultCodeToErrorStatus(n));
+        }
+    };
+    runStepGraph(plan->getStepGraph(), runStep, onComplete, StepWorkerPool::get());
+}
+#endif //#ifndef DISABLE_PARALLEL_STEP_EXECUTION
+#endif //#ifndef DISABLE_PARTITIONED_EXECUTION
+#endif //#ifndef HIFI_BUILD
+
 int ExecutionBuilder::startCompute(sp<ExecutionCallback>* synchronizationCallback) {
 #ifndef HIFI_BUILD
     *synchronizationCallback = nullptr;
@@ -447,6 +503,14 @@ int ExecutionBuilder::startCompute(sp<ExecutionCallback>* synchronizationCallbac
                 // nullptr is returned.  The executionCallback is
                 // abstracted in the NN API as an "event".
                 sp<ExecutionCallback> executionCallback = new ExecutionCallback();
+#ifndef DISABLE_PARALLEL_STEP_EXECUTION
+                if (mPlan->getStepCount() > 1) {
+                    startComputePartitionedParallel(this, mPlan, controller, allowFallback,
+                                                    executionCallback);
+                    *synchronizationCallback = executionCallback;
+                    return ANEURALNETWORKS_NO_ERROR;
+                }
+#endif //DISABLE_PARALLEL_STEP_EXECUTION
                 std::thread thread(asyncStartComputePartitioned, this, mPlan, controller,
                                    allowFallback,
                                    executionCallback);
@@ -654,6 +718,17 @@ int StepExecutor::startCompute(sp<ExecutionCallback>* synchronizationCallback) {
 #endif //HIFI_BUILD
 }
 
+#ifndef HIFI_BUILD
+int StepExecutor::startComputeInCallingThread(sp<ExecutionCallback>* synchronizationCallback) {
+    if (mDriver == nullptr) {
+        return startComputeOnCpu(synchronizationCallback, true);
+    } else {
+        // Waits for the driver before returning
+        return startComputeOnDevice(synchronizationCallback);
+    }
+}
+#endif //HIFI_BUILD
+
 #ifndef HIFI_BUILD
 int StepExecutor::startComputeOnDevice(sp<ExecutionCallback>* synchronizationCallback) {
     nnAssert(mDriver != nullptr);
@@ -816,13 +891,19 @@ static void asyncStartComputeOnCpu(const Model& model, const Request& request,
                                    const std::vector<RunTimePoolInfo>& modelPoolInfos,
                                    const std::vector<RunTimePoolInfo>& requestPoolInfos,
                                    const sp<ExecutionCallback>& executionCallback) {
+#ifdef HIFI_NNLIB_OPT
+    // One executor per thread keeps its scratch arena alive across runs.
+    static thread_local CpuExecutor executor;
+#else
     CpuExecutor executor;
+#endif
     int err = executor.run(model, request, modelPoolInfos, requestPoolInfos);
     executionCallback->notify(convertResultCodeToErrorStatus(err));
 }
 #endif //HIFI_BUILD
 
-int StepExecutor::startComputeOnCpu(sp<ExecutionCallback>* synchronizationCallback) {
+int StepExecutor::startComputeOnCpu(sp<ExecutionCallback>* synchronizationCallback,
+                                    bool inCallingThread) {
     // TODO: use a thread pool
 
     Model model;
@@ -874,11 +955,19 @@ int StepExecutor::startComputeOnCpu(sp<ExecutionCallback>* synchronizationCallba
     setRequestArgumentArray(mOutputs, &request.outputs);
 
 #ifndef HIFI_BUILD
-    // TODO: should model be moved with a std::cref?
-    std::thread thread(asyncStartComputeOnCpu, model, std::move(request),
-                       std::move(modelPoolInfos), std::move(requestPoolInfos),
-                       executionCallback);
-    executionCallback->bind_thread(std::move(thread));
+    if (inCallingThread) {
+        // A worker of the step pool keeps one executor, and with it the
+        // executor's scratch and temporary arenas, for all its steps.
+        static thread_local CpuExecutor executor;
+        int err = executor.run(model, request, modelPoolInfos, requestPoolInfos);
+        executionCallback->notify(convertResultCodeToErrorStatus(err));
+    } else {
+        // TODO: should model be moved with a std::cref?
+        std::thread thread(asyncStartComputeOnCpu, model, std::move(request),
+                           std::move(modelPoolInfos), std::move(requestPoolInfos),
+                           executionCallback);
+        executionCallback->bind_thread(std::move(thread));
+    }
     *synchronizationCallback = executionCallback;
 #else
     asyncStartComputeOnCpu(model, request, modelPoolInfos, requestPoolInfos, executionCallback);
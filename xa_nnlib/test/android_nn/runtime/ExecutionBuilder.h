@@ -191,8 +191,17 @@ public:
     int startCompute(sp<ExecutionCallback>* synchronizationCallback);
 
     // Executes using the CPU, regardless of the (driver,
-    // preparedModel) specified at construction time.
-    int startComputeOnCpu(sp<ExecutionCallback>* synchronizationCallback);
+    // preparedModel) specified at construction time.  With inCallingThread
+    // the model runs before returning, on the calling thread's CpuExecutor.
+    int startComputeOnCpu(sp<ExecutionCallback>* synchronizationCallback,
+                          bool inCallingThread = false);
+
+#ifndef HIFI_BUILD
+    // Like startCompute(), but returns only once the step has completed and
+    // *synchronizationCallback has been notified.  Used by the workers
+    // executing the steps of a partitioned plan in parallel.
+    int startComputeInCallingThread(sp<ExecutionCallback>* synchronizationCallback);
+#endif //HIFI_BUILD
 
     bool isCpu() const { return mDriver == nullptr; }
 
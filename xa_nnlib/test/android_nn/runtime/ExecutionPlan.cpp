@@ -44,8 +44,12 @@
 #include "ExecutionBuilder.h"
 #include "Manager.h"
 #include "ModelBuilder.h"
+#ifndef HIFI_BUILD
+#include "StepScheduler.h"
+#endif //HIFI_BUILD
 #include "Utils.h"
 
+#include <algorithm>
 #include <functional>
 #include <map>
 #include <queue>
@@ -597,11 +601,45 @@ int ExecutionPlan::CompoundBody::finish(const ModelBuilder* fromModel,
 #endif //HIFI_BUILD
         return ANEURALNETWORKS_OP_FAILED;
     }
+#ifndef HIFI_BUILD
+    findStepDependencies();
+#endif //HIFI_BUILD
 
     mSuccessfulFinish = true;
     return ANEURALNETWORKS_NO_ERROR;
 }
 
+#ifndef HIFI_BUILD
+void ExecutionPlan::CompoundBody::findStepDependencies() {
+    // Operands of the main model each step defines (temporaries and model
+    // outputs) and reads back (temporaries and model outputs of earlier steps)
+    std::vector<std::vector<uint32_t>> definedOperands(mSteps.size());
+    std::vector<std::vector<uint32_t>> readOperands(mSteps.size());
+    for (const auto& temporary : mTemporaryToDefiningStep) {
+        definedOperands[temporary.second].push_back(temporary.first);
+    }
+    for (uint32_t stepIndex = 0; stepIndex < mSteps.size(); stepIndex++) {
+        for (const auto& output : mSteps[stepIndex]->getModelOutputs()) {
+            definedOperands[stepIndex].push_back(output.first);
+        }
+        for (const auto& input : mSteps[stepIndex]->getTempsAsSubModelInputs()) {
+            readOperands[stepIndex].push_back(input.first);
+        }
+        for (const auto& input : mSteps[stepIndex]->getOutputsAsSubModelInputs()) {
+            readOperands[stepIndex].push_back(input.first);
+        }
+    }
+
+    [[maybe_unused]] const bool defined =
+            buildStepDependencies(definedOperands, readOperands, &mStepDependencies);
+    nnAssert(defined);
+    for (uint32_t stepIndex = 0; stepIndex < mSteps.size(); stepIndex++) {
+        VLOG(COMPILATION) << "ExecutionPlan::CompoundBody step " << stepIndex << " depends on "
+                          << mStepDependencies[stepIndex].size() << " step(s)";
+    }
+}
+#endif //HIFI_BUILD
+
 #ifndef HIFI_BUILD
 int ExecutionPlan::SimpleBody::finish([[maybe_unused]] const ModelBuilder* fromModel,
 #else
@@ -789,12 +827,43 @@ int ExecutionPlan::next(std::shared_ptr<Controller> controller,
         return ANEURALNETWORKS_NO_ERROR;
     }
 
+    int n = makeStepExecutor(controller, controller->mNextStepIndex, executor);
+    if (n != ANEURALNETWORKS_NO_ERROR) {
+        controller->mNextStepIndex = Controller::kBadStepIndex;
+        return n;
+    }
+
+    controller->mNextStepIndex++;
+#endif //HIFI_BUILD
+    return ANEURALNETWORKS_NO_ERROR;
+}
+
+#ifndef HIFI_BUILD
+size_t ExecutionPlan::getStepCount() const {
+    return mState == COMPOUND ? compound()->mSteps.size() : 0;
+}
+
+const std::vector<std::vector<uint32_t>>& ExecutionPlan::getStepGraph() const {
+    return compound()->mStepDependencies;
+}
+
+int ExecutionPlan::makeStepExecutor(std::shared_ptr<Controller> controller, size_t stepIndex,
+                                    std::shared_ptr<StepExecutor>* executor) const {
+    *executor = nullptr;
+    auto compoundBody = compound();
+    nnAssert(stepIndex < compoundBody->mSteps.size());
+
+    if (controller->mNextStepIndex == Controller::kBadStepIndex) {
+        // Temporaries could not be allocated, or next() failed.
+        return ANEURALNETWORKS_OP_FAILED;
+    }
+
     // Input order: model inputs, temps as submodel inputs, outputs as submodel inputs
     // Output order: model outputs, temps as submodel outputs
     //
     // ExecutionStep::finishSubModel() establishes these orderings.
 
-    const auto step = compoundBody->mSteps[controller->mNextStepIndex];
+    const auto step = compoundBody->mSteps[stepIndex];
     *executor = std::make_shared<StepExecutor>(
         controller->mExecutionBuilder,
         step->getSubModel(),
@@ -818,7 +887,7 @@ int ExecutionPlan::next(std::shared_ptr<Controller> controller,
                     &controller->mTemporaries,
                     offsetOfTemporary);
                 if (n != ANEURALNETWORKS_NO_ERROR) {
-                    controller->mNextStepIndex = Controller::kBadStepIndex;
+                    *executor = nullptr;
                     return n;
                 }
             }
@@ -839,7 +908,7 @@ int ExecutionPlan::next(std::shared_ptr<Controller> controller,
                     &controller->mTemporaries,
                     offsetOfTemporary);
                 if (n != ANEURALNETWORKS_NO_ERROR) {
-                    controller->mNextStepIndex = Controller::kBadStepIndex;
+                    *executor = nullptr;
                     return n;
                 }
             }
@@ -858,10 +927,9 @@ int ExecutionPlan::next(std::shared_ptr<Controller> controller,
         }
     }
 
-    controller->mNextStepIndex++;
-#endif //HIFI_BUILD
     return ANEURALNETWORKS_NO_ERROR;
 }
+#endif //HIFI_BUILD
 
 std::shared_ptr<ExecutionStep> ExecutionPlan::createNewStep(const std::shared_ptr<Device> device) {
     nnAssert(mState != SIMPLE);
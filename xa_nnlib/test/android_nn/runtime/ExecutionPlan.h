@@ -226,6 +226,22 @@ public:
     // Create the same executor as the last one created by next().
     int fallback(std::shared_ptr<Controller> controller, std::shared_ptr<StepExecutor>* executor) const;
 
+#ifndef HIFI_BUILD
+    // Step graph of a COMPOUND plan, for executing the steps out of order
+    // with runStepGraph().  getStepGraph()[i] lists the steps producing the
+    // temporaries and model outputs that step i reads; steps with no path
+    // between them in this graph may run concurrently.  Only valid after
+    // finish().
+    size_t getStepCount() const;
+    const std::vector<std::vector<uint32_t>>& getStepGraph() const;
+
+    // Create the executor of step stepIndex of a COMPOUND plan, without
+    // going through next().  Executors of different steps of the same
+    // Controller may execute concurrently.
+    int makeStepExecutor(std::shared_ptr<Controller> controller, size_t stepIndex,
+                         std::shared_ptr<StepExecutor>* executor) const;
+#endif //HIFI_BUILD
+
     std::shared_ptr<ExecutionStep> createNewStep(const std::shared_ptr<Device> device);
 
     void becomeSingleStep(const std::shared_ptr<Device> device,
@@ -299,9 +315,18 @@ private:
         // Used for all (and only) TEMPORARY_VARIABLEs.
         std::unordered_map<uint32_t, uint32_t> mTemporaryToDefiningStep;
 
+#ifndef HIFI_BUILD
+        // Indexes of the steps each step reads results of, see
+        // getStepGraph().
+        std::vector<std::vector<uint32_t>> mStepDependencies;
+#endif //HIFI_BUILD
+
         bool mHasSubModelOutputOfUnknownSize = false;
     private:
         void findTempsAsSubModelOutputs();
+#ifndef HIFI_BUILD
+        void findStepDependencies();
+#endif //HIFI_BUILD
     };
 
     enum { EMPTY, SIMPLE, COMPOUND } mState = EMPTY;
@@ -0,0 +1,310 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+
+#ifndef ANDROID_ML_NN_RUNTIME_STEP_SCHEDULER_H
+#define ANDROID_ML_NN_RUNTIME_STEP_SCHEDULER_H
+
+// Dependency driven execution of the steps of a partitioned (COMPOUND)
+// ExecutionPlan on a work-stealing thread pool.  Nothing here depends on
+// the HAL or on the model, so it builds on the host on its own and is
+// tested by test/TestStepScheduler.cpp.  HIFI_BUILD runs a model on a
+// single CpuExecutor and does not use it.
+
+#include "NeuralNetworks.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace android {
+namespace nn {
+
+// Step graph of a plan.  definedOperands[i] and readOperands[i] are the
+// operands (temporaries and model outputs, as indexes in the main model)
+// that step i writes and reads.  On return (*dependencies)[i] lists, sorted
+// and without duplicates, the steps defining what step i reads.  Returns
+// false if step i reads an operand that no step defines.
+inline bool buildStepDependencies(const std::vector<std::vector<uint32_t>>& definedOperands,
+                                  const std::vector<std::vector<uint32_t>>& readOperands,
+                                  std::vector<std::vector<uint32_t>>* dependencies) {
+    std::unordered_map<uint32_t, uint32_t> operandToDefiningStep;
+    for (uint32_t stepIndex = 0; stepIndex < definedOperands.size(); stepIndex++) {
+        for (uint32_t operand : definedOperands[stepIndex]) {
+            operandToDefiningStep[operand] = stepIndex;
+        }
+    }
+
+    dependencies->assign(readOperands.size(), std::vector<uint32_t>());
+    for (uint32_t stepIndex = 0; stepIndex < readOperands.size(); stepIndex++) {
+        std::vector<uint32_t>& stepDependencies = (*dependencies)[stepIndex];
+        for (uint32_t operand : readOperands[stepIndex]) {
+            const auto it = operandToDefiningStep.find(operand);
+            if (it == operandToDefiningStep.end()) {
+                return false;
+            }
+            stepDependencies.push_back(it->second);
+        }
+        std::sort(stepDependencies.begin(), stepDependencies.end());
+        stepDependencies.erase(std::unique(stepDependencies.begin(), stepDependencies.end()),
+                               stepDependencies.end());
+    }
+    return true;
+}
+
+// Fixed-size pool of threads executing the steps of partitioned plans.
+// Each worker owns a deque of tasks: it takes its own newest task first and
+// steals the oldest task of another worker when its deque is empty.  Steps
+// made ready by a worker are queued on that worker, so a chain of dependent
+// steps tends to stay on one thread, and with it on that thread's
+// CpuExecutor and its arenas.
+class StepWorkerPool {
+public:
+    // Pool shared by all executions of the process
+    static StepWorkerPool* get() {
+        static StepWorkerPool pool(std::max(2u, std::thread::hardware_concurrency()));
+        return &pool;
+    }
+
+    explicit StepWorkerPool(size_t workerCount) {
+        for (size_t i = 0; i < workerCount; i++) {
+            mQueues.emplace_back(new TaskQueue());
+        }
+        for (size_t i = 0; i < workerCount; i++) {
+            mWorkers.emplace_back(&StepWorkerPool::workerLoop, this, i);
+        }
+    }
+
+    // Runs the tasks already submitted, then joins the workers
+    ~StepWorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mCondition.notify_all();
+        for (auto& worker : mWorkers) {
+            worker.join();
+        }
+    }
+
+    StepWorkerPool(const StepWorkerPool&) = delete;
+    StepWorkerPool& operator=(const StepWorkerPool&) = delete;
+
+    void submit(std::function<void()> task) {
+        const size_t self = workerIndex();
+        const size_t queueIndex = (self != kNotAWorker && self < mQueues.size() &&
+                                   workerPool() == this)
+                ? self : mNextQueue++ % mQueues.size();
+        {
+            std::lock_guard<std::mutex> lock(mQueues[queueIndex]->mutex);
+            mQueues[queueIndex]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mPending++;
+        }
+        mCondition.notify_one();
+    }
+
+    size_t getWorkerCount() const { return mWorkers.size(); }
+
+private:
+    static constexpr size_t kNotAWorker = ~size_t(0);
+
+    struct TaskQueue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    // Index and pool of the calling worker thread
+    static size_t& workerIndex() {
+        static thread_local size_t index = kNotAWorker;
+        return index;
+    }
+    static StepWorkerPool*& workerPool() {
+        static thread_local StepWorkerPool* pool = nullptr;
+        return pool;
+    }
+
+    bool takeTask(size_t self, std::function<void()>* task) {
+        {
+            TaskQueue& own = *mQueues[self];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if (!own.tasks.empty()) {
+                *task = std::move(own.tasks.back());
+                own.tasks.pop_back();
+                return true;
+            }
+        }
+        for (size_t k = 1; k < mQueues.size(); k++) {
+            TaskQueue& other = *mQueues[(self + k) % mQueues.size()];
+            std::lock_guard<std::mutex> lock(other.mutex);
+            if (!other.tasks.empty()) {
+                *task = std::move(other.tasks.front());
+                other.tasks.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void workerLoop(size_t self) {
+        workerIndex() = self;
+        workerPool() = this;
+        while (true) {
+            {
+                // Reserve one of the queued tasks, pushed before mPending
+                // was incremented.
+                std::unique_lock<std::mutex> lock(mMutex);
+                mCondition.wait(lock, [this] { return mStop || mPending > 0; });
+                if (mPending == 0) {
+                    return;
+                }
+                mPending--;
+            }
+            std::function<void()> task;
+            while (!takeTask(self, &task)) {
+                std::this_thread::yield();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::unique_ptr<TaskQueue>> mQueues;
+    std::vector<std::thread> mWorkers;
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    size_t mPending = 0;
+    std::atomic<size_t> mNextQueue{0};  // round robin for non-worker threads
+    bool mStop = false;
+};
+
+// State of one runStepGraph() call
+struct StepGraphExecution {
+    std::function<int(uint32_t)> runStep;
+    std::function<void(int)> onComplete;
+    StepWorkerPool* pool = nullptr;
+
+    std::mutex mutex;
+    std::vector<uint32_t> unfinishedDependencies;
+    std::vector<std::vector<uint32_t>> dependents;
+    size_t stepsLeft = 0;
+    size_t stepsRunning = 0;
+    int status = ANEURALNETWORKS_NO_ERROR;
+};
+
+inline void finishGraphStep(const std::shared_ptr<StepGraphExecution>& execution,
+                            uint32_t stepIndex, int n);
+
+// Called with execution->mutex held.
+inline void dispatchGraphStep(const std::shared_ptr<StepGraphExecution>& execution,
+                              uint32_t stepIndex) {
+    execution->stepsRunning++;
+    execution->pool->submit([execution, stepIndex] {
+        finishGraphStep(execution, stepIndex, execution->runStep(stepIndex));
+    });
+}
+
+inline void finishGraphStep(const std::shared_ptr<StepGraphExecution>& execution,
+                            uint32_t stepIndex, int n) {
+    bool done;
+    {
+        std::lock_guard<std::mutex> lock(execution->mutex);
+        execution->stepsRunning--;
+        execution->stepsLeft--;
+        if (n != ANEURALNETWORKS_NO_ERROR && execution->status == ANEURALNETWORKS_NO_ERROR) {
+            execution->status = n;
+        }
+        if (execution->status == ANEURALNETWORKS_NO_ERROR) {
+            for (uint32_t dependent : execution->dependents[stepIndex]) {
+                if (--execution->unfinishedDependencies[dependent] == 0) {
+                    dispatchGraphStep(execution, dependent);
+                }
+            }
+        }
+        done = execution->stepsRunning == 0;
+        if (done && execution->stepsLeft > 0 && execution->status == ANEURALNETWORKS_NO_ERROR) {
+            // Steps left that can never become ready, the graph has a cycle
+            execution->status = ANEURALNETWORKS_BAD_STATE;
+        }
+    }
+    if (done) {
+        execution->onComplete(execution->status);
+    }
+}
+
+// Runs runStep(i) for every step i of the graph on pool, once all the steps
+// in dependencies[i] have completed.  Steps with no path between them may
+// run concurrently.  runStep returns ANEURALNETWORKS_NO_ERROR or an error;
+// the first error stops further dispatch.  onComplete(status) is called
+// exactly once, on the thread finishing the last running step (or on the
+// calling thread if no step could be dispatched), with the first error
+// or ANEURALNETWORKS_NO_ERROR.
+inline void runStepGraph(const std::vector<std::vector<uint32_t>>& dependencies,
+                         std::function<int(uint32_t)> runStep,
+                         std::function<void(int)> onComplete,
+                         StepWorkerPool* pool) {
+    auto execution = std::make_shared<StepGraphExecution>();
+    execution->runStep = std::move(runStep);
+    execution->onComplete = std::move(onComplete);
+    execution->pool = pool;
+
+    const size_t stepCount = dependencies.size();
+    execution->stepsLeft = stepCount;
+    execution->unfinishedDependencies.resize(stepCount);
+    execution->dependents.resize(stepCount);
+    for (uint32_t stepIndex = 0; stepIndex < stepCount; stepIndex++) {
+        execution->unfinishedDependencies[stepIndex] = dependencies[stepIndex].size();
+        for (uint32_t dependency : dependencies[stepIndex]) {
+            execution->dependents[dependency].push_back(stepIndex);
+        }
+    }
+
+    bool done;
+    {
+        std::lock_guard<std::mutex> lock(execution->mutex);
+        for (uint32_t stepIndex = 0; stepIndex < stepCount; stepIndex++) {
+            if (execution->unfinishedDependencies[stepIndex] == 0) {
+                dispatchGraphStep(execution, stepIndex);
+            }
+        }
+        done = execution->stepsRunning == 0;
+        if (done && stepCount > 0) {
+            // Every step waits on another one
+            execution->status = ANEURALNETWORKS_BAD_STATE;
+        }
+    }
+    if (done) {
+        execution->onComplete(execution->status);
+    }
+}
+
+}  // namespace nn
+}  // namespace android
+
+#endif  // ANDROID_ML_NN_RUNTIME_STEP_SCHEDULER_H
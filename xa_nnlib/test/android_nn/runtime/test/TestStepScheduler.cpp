@@ -0,0 +1,242 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+/*
+ * Copyright (C) 2017 The Android Open Source Project
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+// Host test of the step scheduler of partitioned executions (StepScheduler.h).
+// HIFI_BUILD runs a model on a single CpuExecutor and has no threads, so the
+// scheduler is built and run with the host compiler, see the ann_sched
+// target of test/build/makefile_testbench_sample.
+
+#include "StepScheduler.h"
+
+#include <chrono>
+#include <cstdio>
+
+using namespace android::nn;
+
+namespace {
+
+int gFailures = 0;
+
+#define CHECK(cond)                                                         \
+    do {                                                                    \
+        if (!(cond)) {                                                      \
+            printf("%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #cond); \
+            gFailures++;                                                    \
+        }                                                                   \
+    } while (0)
+
+typedef std::vector<std::vector<uint32_t>> StepGraph;
+
+// Blocks until onComplete of one runStepGraph() call has been called
+class Completion {
+public:
+    std::function<void(int)> callback() {
+        return [this](int n) {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mCalls++;
+            mStatus = n;
+            mCondition.notify_all();
+        };
+    }
+    int wait() {
+        std::unique_lock<std::mutex> lock(mMutex);
+        mCondition.wait(lock, [this] { return mCalls > 0; });
+        return mStatus;
+    }
+    int calls() {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return mCalls;
+    }
+
+private:
+    std::mutex mMutex;
+    std::condition_variable mCondition;
+    int mCalls = 0;
+    int mStatus = -1;
+};
+
+// Partition of an inception-like model: step 0 defines the temporaries 10
+// and 11, steps 1-3 are branches reading them, step 4 concatenates the
+// branches.  Step 3 also defines the model output 20 that step 4 reads
+// back.
+void buildInceptionGraph(StepGraph* dependencies) {
+    const StepGraph definedOperands = {{10, 11}, {12}, {13}, {14, 20}, {21}};
+    const StepGraph readOperands = {{}, {10}, {10, 11, 10}, {11}, {12, 14, 13, 20}};
+    CHECK(buildStepDependencies(definedOperands, readOperands, dependencies));
+}
+
+void testBuildStepDependencies() {
+    StepGraph dependencies;
+    buildInceptionGraph(&dependencies);
+    const StepGraph expected = {{}, {0}, {0}, {0}, {1, 2, 3}};
+    CHECK(dependencies == expected);
+
+    // Operand 30 is defined by no step
+    CHECK(!buildStepDependencies({{10}, {11}}, {{}, {10, 30}}, &dependencies));
+}
+
+// Steps 1-3 wait for each other, so the graph only completes if they run
+// concurrently.
+void testIndependentStepsOverlap() {
+    StepWorkerPool pool(4);
+    StepGraph dependencies;
+    buildInceptionGraph(&dependencies);
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::vector<int> runs(dependencies.size(), 0);
+    std::vector<int> order;
+    int branchesStarted = 0;
+    bool overlapped = true;
+    auto runStep = [&](uint32_t stepIndex) {
+        std::unique_lock<std::mutex> lock(mutex);
+        runs[stepIndex]++;
+        order.push_back(stepIndex);
+        if (stepIndex >= 1 && stepIndex <= 3) {
+            branchesStarted++;
+            condition.notify_all();
+            if (!condition.wait_for(lock, std::chrono::seconds(10),
+                                    [&] { return branchesStarted == 3; })) {
+                overlapped = false;
+            }
+        }
+        return ANEURALNETWORKS_NO_ERROR;
+    };
+
+    Completion completion;
+    runStepGraph(dependencies, runStep, completion.callback(), &pool);
+    CHECK(completion.wait() == ANEURALNETWORKS_NO_ERROR);
+    CHECK(completion.calls() == 1);
+    CHECK(overlapped);
+    for (int n : runs) {
+        CHECK(n == 1);
+    }
+    // Every step runs after the steps it depends on
+    std::vector<size_t> position(dependencies.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        position[order[i]] = i;
+    }
+    for (uint32_t stepIndex = 0; stepIndex < dependencies.size(); stepIndex++) {
+        for (uint32_t dependency : dependencies[stepIndex]) {
+            CHECK(position[dependency] < position[stepIndex]);
+        }
+    }
+}
+
+// A failing branch stops the dependent step and its error is reported once.
+void testFailingStep() {
+    StepWorkerPool pool(2);
+    StepGraph dependencies;
+    buildInceptionGraph(&dependencies);
+
+    std::atomic<int> runs[5];
+    for (auto& n : runs) {
+        n = 0;
+    }
+    auto runStep = [&](uint32_t stepIndex) {
+        runs[stepIndex]++;
+        return stepIndex == 2 ? ANEURALNETWORKS_OP_FAILED : ANEURALNETWORKS_NO_ERROR;
+    };
+
+    Completion completion;
+    runStepGraph(dependencies, runStep, completion.callback(), &pool);
+    CHECK(completion.wait() == ANEURALNETWORKS_OP_FAILED);
+    CHECK(runs[0] == 1);
+    CHECK(runs[2] == 1);
+    CHECK(runs[4] == 0);
+    CHECK(completion.calls() == 1);
+}
+
+// A long chain of dependent steps, several executions at once on one pool
+void testConcurrentExecutions() {
+    StepWorkerPool pool(3);
+    const uint32_t stepCount = 64;
+    StepGraph dependencies(stepCount);
+    for (uint32_t stepIndex = 1; stepIndex < stepCount; stepIndex++) {
+        dependencies[stepIndex].push_back(stepIndex - 1);
+    }
+
+    const int executionCount = 8;
+    std::vector<std::atomic<uint32_t>> nextStep(executionCount);
+    std::vector<Completion> completions(executionCount);
+    for (int e = 0; e < executionCount; e++) {
+        nextStep[e] = 0;
+        auto runStep = [&nextStep, e](uint32_t stepIndex) {
+            uint32_t expected = stepIndex;
+            return nextStep[e].compare_exchange_strong(expected, stepIndex + 1)
+                    ? ANEURALNETWORKS_NO_ERROR : ANEURALNETWORKS_BAD_STATE;
+        };
+        runStepGraph(dependencies, runStep, completions[e].callback(), &pool);
+    }
+    for (int e = 0; e < executionCount; e++) {
+        CHECK(completions[e].wait() == ANEURALNETWORKS_NO_ERROR);
+        CHECK(nextStep[e] == stepCount);
+    }
+}
+
+void testDegenerateGraphs() {
+    StepWorkerPool pool(2);
+    auto runStep = [](uint32_t) { return ANEURALNETWORKS_NO_ERROR; };
+
+    // No step: completes at once on the calling thread
+    Completion empty;
+    runStepGraph(StepGraph(), runStep, empty.callback(), &pool);
+    CHECK(empty.calls() == 1);
+    CHECK(empty.wait() == ANEURALNETWORKS_NO_ERROR);
+
+    // Steps waiting on each other are never run
+    Completion cycle;
+    runStepGraph({{1}, {0}}, runStep, cycle.callback(), &pool);
+    CHECK(cycle.calls() == 1);
+    CHECK(cycle.wait() == ANEURALNETWORKS_BAD_STATE);
+
+    Completion unreachable;
+    runStepGraph({{}, {2}, {1}}, runStep, unreachable.callback(), &pool);
+    CHECK(unreachable.wait() == ANEURALNETWORKS_BAD_STATE);
+}
+
+}  // namespace
+
+int main() {
+    testBuildStepDependencies();
+    testIndependentStepsOverlap();
+    testFailingStep();
+    testConcurrentExecutions();
+    testDegenerateGraphs();
+    printf("TestStepScheduler: %s\n", gFailures == 0 ? "PASSED" : "FAILED");
+    return gFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,222 @@
+#!/bin/sh
+#
+# Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining
+# a copy of this software and associated documentation files (the
+# "Software"), to use this Software with Cadence processor cores only and
+# not with any other processors and platforms, subject to
+# the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+# EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+# MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+# IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+# CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+# TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+# SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+
+# Shape sweep over the kernel testbenches in benchmark mode (-bench 1), no
+# test vectors are needed. The PROFILE_CSV lines of all runs are collected
+# into one table on stdout.
+#
+# Usage: sh bench_sweep.sh "<runner>" <binary prefix>
+#   runner        : "xt-run --mem_model --nosummary" for ISS, "" for x86
+#   binary prefix : $(CPU_PREFIX)$(DETECTED_CORE) of makefile_testbench_sample
+#
+# The grid is set by environment variables, defaults in brackets:
+#   BENCH_CHANNELS    [4 7 8 16 31 32 64]
+#   BENCH_SIZES       [8 16 32]           input height = width
+#   BENCH_KERNELS     [1 3 5]
+#   BENCH_STRIDES     [1 2]
+#   BENCH_ROWS        [16 31 32 64 256]   matXvec / fully connected
+#   BENCH_COLS        [16 31 32 64 256]
+#   BENCH_ELEMENTS    [256 1023 1024 4096] activations
+#   BENCH_PRECISIONS  [8x16 sym8sxasym8s sym8sxsym16s f32]
+#   BENCH_DW_SHAPES   [3x3 5x5 7x7 1x9 9x1] depthwise NHWC kernel shapes
+#   BENCH_DW_CHANNELS [31 32]             depthwise NHWC channels
+#   BENCH_FRAMES      [4]  profiled frames
+#   BENCH_WARMUP      [2]  frames run before profiling
+#   BENCH_PATHS       []   file collecting the PATH_CSV specialised/generic
+#                          counts per run, needs a library built with
+#                          PATH_COUNTERS=1
+
+RUN="$1"
+BIN="${2:-xa}"
+
+CHANNELS="${BENCH_CHANNELS:-4 7 8 16 31 32 64}"
+SIZES="${BENCH_SIZES:-8 16 32}"
+KERNELS="${BENCH_KERNELS:-1 3 5}"
+STRIDES="${BENCH_STRIDES:-1 2}"
+ROWS="${BENCH_ROWS:-16 31 32 64 256}"
+COLS="${BENCH_COLS:-16 31 32 64 256}"
+ELEMENTS="${BENCH_ELEMENTS:-256 1023 1024 4096}"
+PRECISIONS="${BENCH_PRECISIONS:-8x16 sym8sxasym8s sym8sxsym16s f32}"
+DW_SHAPES="${BENCH_DW_SHAPES:-3x3 5x5 7x7 1x9 9x1}"
+DW_CHANNELS="${BENCH_DW_CHANNELS:-31 32}"
+FRAMES="${BENCH_FRAMES:-4}"
+WARMUP="${BENCH_WARMUP:-2}"
+PATHS="${BENCH_PATHS:-}"
+
+BENCH_ARGS="-bench 1 -frames $FRAMES -warmup $WARMUP"
+
+# Run one configuration, keep only the machine readable profile lines
+run()
+{
+  bin=$1
+  shift
+  echo "$bin $*" >&2
+  out=$($RUN ./${BIN}_nn_${bin}_test $BENCH_ARGS "$@" 2>/dev/null)
+  echo "$out" | sed -n 's/^PROFILE_CSV,//p'
+  if [ -n "$PATHS" ]; then
+    echo "$out" | sed -n "s/^PATH_CSV,\(.*\)/\1,\"$bin $*\"/p" >> "$PATHS"
+  fi
+}
+
+# kernel, input, output and bias precision per precision name (matXvec order:
+# matrix, vector, output, bias)
+prec_args()
+{
+  case $1 in
+    8x16)          echo "8 16 16 16";;
+    16x16)         echo "16 16 16 16";;
+    sym8sxasym8s)  echo "-5 -4 -4 32";;
+    sym8sxsym16s)  echo "-5 -8 -8 64";;
+    f32)           echo "-1 -1 -1 -1";;
+    f16)           echo "-2 -2 -2 -2";;
+    *)             echo "";;
+  esac
+}
+
+# Pooling and activations take one data precision
+data_prec()
+{
+  case $1 in
+    8x16|16x16)    echo "16";;
+    sym8sxasym8s)  echo "-4";;
+    sym8sxsym16s)  echo "-8";;
+    f32)           echo "-1";;
+    f16)           echo "-2";;
+    *)             echo "";;
+  esac
+}
+
+out_dim()
+{
+  # $1 input, $2 kernel, $3 stride, "same" padding of kernel/2
+  echo $(( ($1 + 2 * ($2 / 2) - $2) / $3 + 1 ))
+}
+
+echo "kernel,counter,avg,peak,peak_frame,frames,metric,metric_units,bytes,bytes_per_count,result,params"
+[ -z "$PATHS" ] || echo "kernel,specialised,generic,run" > "$PATHS"
+
+for prec in $PRECISIONS; do
+  set -- $(prec_args $prec)
+  [ $# -eq 4 ] || { echo "unknown precision $prec" >&2; continue; }
+  kp=$1; ip=$2; op=$3; bp=$4
+  qargs=""
+  if [ $ip -eq -4 ] || [ $ip -eq -8 ]; then
+    qargs="-input_zero_bias 0 -out_zero_bias 0 -out_shift 0"
+  fi
+
+  for size in $SIZES; do
+  for k in $KERNELS; do
+  for s in $STRIDES; do
+    o=$(out_dim $size $k $s)
+    pad=$(( k / 2 ))
+    for ic in $CHANNELS; do
+      geo="-input_height $size -input_width $size -input_channels $ic -kernel_height $k -kernel_width $k \
+-x_stride $s -y_stride $s -x_padding $pad -y_padding $pad -out_height $o -out_width $o"
+      for oc in $CHANNELS; do
+        run conv -kernel_name conv2d_std $geo -out_channels $oc -out_data_format 0 \
+          -kernel_precision $kp -inp_precision $ip -out_precision $op -bias_precision $bp \
+          -bias_shift 0 -acc_shift -8 $qargs
+      done
+      # Depthwise followed by pointwise, one row per kernel
+      run conv -kernel_name conv2d_depth $geo -out_channels $ic -channels_multiplier 1 \
+        -inp_data_format 0 -out_data_format 0 \
+        -kernel_precision $kp -inp_precision $ip -out_precision $op -bias_precision $bp \
+        -bias_shift 0 -acc_shift -8 $qargs
+    done
+  done
+  done
+  done
+
+  for r in $ROWS; do
+    for c in $COLS; do
+      mv="-rows $r -cols1 $c -cols2 $c -row_stride1 $c -row_stride2 $c -vec_count 1 -out_stride 1 \
+-mat_precision $kp -inp_precision $ip -out_precision $op -bias_precision $bp -bias_shift 0 -acc_shift -8"
+      run matXvec $mv
+      run matXvec $mv -fc 1
+    done
+  done
+done
+
+# Depthwise NHWC shapes with a specialised kernel. Channel counts that are not
+# a multiple of 4 take the generic path, so the default channels give the
+# MACs/cycle of both paths for each shape.
+for prec in $PRECISIONS; do
+  case $prec in
+    sym8sxasym8s|sym8sxsym16s) ;;
+    *) continue;;
+  esac
+  set -- $(prec_args $prec)
+  kp=$1; ip=$2; op=$3; bp=$4
+
+  for size in $SIZES; do
+  for shape in $DW_SHAPES; do
+  for s in $STRIDES; do
+    kh=${shape%x*}
+    kw=${shape#*x}
+    oh=$(out_dim $size $kh $s)
+    ow=$(out_dim $size $kw $s)
+    for ic in $DW_CHANNELS; do
+      run conv -kernel_name conv2d_depth -input_height $size -input_width $size -input_channels $ic \
+        -kernel_height $kh -kernel_width $kw -x_stride $s -y_stride $s \
+        -x_padding $(( kw / 2 )) -y_padding $(( kh / 2 )) -out_height $oh -out_width $ow \
+        -out_channels $ic -channels_multiplier 1 -inp_data_format 0 -out_data_format 0 \
+        -kernel_precision $kp -inp_precision $ip -out_precision $op -bias_precision $bp \
+        -bias_shift 0 -acc_shift -8 -input_zero_bias 0 -out_zero_bias 0 -out_shift 0
+    done
+  done
+  done
+  done
+done
+
+for prec in $PRECISIONS; do
+  p=$(data_prec $prec)
+  [ -n "$p" ] || continue
+
+  for size in $SIZES; do
+  for k in $KERNELS; do
+  for s in $STRIDES; do
+    [ $k -gt 1 ] || continue
+    o=$(out_dim $size $k $s)
+    pad=$(( k / 2 ))
+    for ic in $CHANNELS; do
+      for pool in avgpool maxpool; do
+        run pool -kernel_name $pool -input_height $size -input_width $size -input_channels $ic \
+          -kernel_height $k -kernel_width $k -x_stride $s -y_stride $s -x_padding $pad -y_padding $pad \
+          -out_height $o -out_width $o -inp_data_format 0 -out_data_format 0 \
+          -inp_precision $p -out_precision $p
+      done
+    done
+  done
+  done
+  done
+
+  for n in $ELEMENTS; do
+    for act in sigmoid tanh relu softmax; do
+      run activation -activation $act -num_elements $n -inp_precision $p -out_precision $p
+    done
+    if [ $p -eq -4 ]; then
+      for op in elm_add elm_sub; do
+        run basic -kernel_name $op -io_length $n -inp_precision $p -out_precision $p
+      done
+    fi
+  done
+done
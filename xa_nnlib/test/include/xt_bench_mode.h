@@ -0,0 +1,37 @@
+/*******************************************************************************
+* Copyright (c) 2018-2024 Cadence Design Systems, Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining
+* a copy of this software and associated documentation files (the
+* "Software"), to use this Software with Cadence processor cores only and
+* not with any other processors and platforms, subject to
+* the following conditions:
+*
+* The above copyright notice and this permission notice shall be included
+* in all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+******************************************************************************/
+#ifndef __XT_BENCH_MODE_H__
+#define __XT_BENCH_MODE_H__
+#include "stdio.h"
+
+/* -bench 1 profiles the kernel on random inputs without input, output or
+ * reference files: selects the random data (write_file) path, disables the
+ * reference comparison and adds the warmup frames to the frame count */
+void bench_mode_config(int bench, int warmup, int *p_write_file, int *p_verify, int *p_frames);
+
+/* file_open() that returns NULL in bench mode */
+FILE* bench_file_open(int bench, char *file_path, char *file_name, char *mode, int max_file_name_length);
+
+/* fclose() that skips the NULL files of bench mode */
+void bench_file_close(FILE *fptr);
+
+#endif // __XT_BENCH_MODE_H__
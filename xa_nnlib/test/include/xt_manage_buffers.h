@@ -72,4 +72,30 @@ int deinterleave_buf1D(buf1D_t *pbuf, buf1D_t *pbuf_deinterleaved, int length);
 
 unsigned int datatype_size(int precision);
 
+/* Channel concat output standing in for the destination of the *_out_stride_*
+ * kernels: rows of [pad, row_len, pad] 8 bit elements, filled with
+ * CONCAT_GAP_FILL. *pp_slice and *p_out_stride bind the middle input and come
+ * from xa_nn_concat_get_slices. */
+#define CONCAT_GAP_FILL 0x5a
+WORD8 *create_concat_slice_buf(int rows, int row_len, int pad, WORD8 **pp_slice, int *p_out_stride);
+/* Returns 1 when the middle slice matches p_ref (rows x row_len, packed) and
+ * the gaps still hold CONCAT_GAP_FILL */
+int check_concat_slice_buf(const WORD8 *p_buf, const WORD8 *p_ref, int rows, int row_len, int pad);
+
+/* Checks of the *_epilogue_* asym8s kernels. init_epilogue_check_asym8s sets
+ * fixed residual add parameters, a clamp inside the int8 range and a tanh
+ * table in p_lut (256 bytes). epilogue_ref_asym8s computes the unfused
+ * reference lut[clamp(add(p_inp, p_residual))] over num_elm packed values
+ * with xa_nn_elm_add_asym8sxasym8s_asym8s and xa_nn_vec_lut_asym8s_asym8s,
+ * p_inp being kernel output with zero point out_zero_bias. Returns 0 on
+ * success. */
+struct _xa_nn_epilogue_asym8s_t;
+void init_epilogue_check_asym8s(struct _xa_nn_epilogue_asym8s_t *p_epilogue, WORD8 *p_lut);
+int epilogue_ref_asym8s(WORD8 *p_ref, const WORD8 *p_inp, const WORD8 *p_residual, int num_elm,
+    int out_zero_bias, const struct _xa_nn_epilogue_asym8s_t *p_epilogue);
+
+/* Size of the buffer data in bytes */
+#define BUF1D_BYTES(pbuf) ((pbuf)->length * (pbuf)->bytes_per_element)
+#define BUF2D_BYTES(pbuf) ((pbuf)->rows * (pbuf)->row_offset * (pbuf)->bytes_per_element)
+
 #endif // __XT_MANAGE_BUFFERS_H__
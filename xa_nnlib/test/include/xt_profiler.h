@@ -22,7 +22,10 @@
 #ifndef __PROFILER_H__
 #define __PROFILER_H__
 #ifndef __XTENSA__
-#undef PROFILE
+/* Host (x86 CSTUB) builds use wall clock or Linux perf counters */
+#ifdef PROFILE
+#define HOST_PROFILE
+#endif
 #endif
 
 #if defined(HW_SIM) && (1 == HW_SIM)
@@ -31,21 +34,101 @@
 #endif
 
 
+#define MAX_PROFILER_NAME_LENGTH 100
+#define MAX_PROFILER_PARAMS_LENGTH 200
+#define MAX_PROFILER_METRIC_UNITS_LENGTH 20
+
 #ifdef PROFILE
 #include <stdio.h>
 #include <string.h>
 #include <sys/times.h>
-#include <xtensa/sim.h>
 #include <inttypes.h>
 
-#define MAX_PROFILER_NAME_LENGTH 100
-#define MAX_PROFILER_PARAMS_LENGTH 200
-#define MAX_PROFILER_METRIC_UNITS_LENGTH 20
-
 #define CCOUNT_AVAILABLE
 
 #ifdef CCOUNT_AVAILABLE
 
+#ifdef HOST_PROFILE
+/* Host backend:
+ * default counter is CLOCK_MONOTONIC in ns, build with -DHOST_PERF_COUNTERS
+ * to count user space CPU cycles through perf_event_open (or instructions
+ * with -DHOST_PERF_EVENT=PERF_COUNT_HW_INSTRUCTIONS). If the perf counter
+ * can not be opened (e.g. perf_event_paranoid), the ns counter is used. */
+#include <time.h>
+
+typedef uint64_t xt_prof_count_t;
+
+#define xt_iss_profile_enable()
+#define xt_iss_profile_disable()
+#define xt_iss_client_command(client, cmd)
+#define xt_iss_switch_mode(mode)
+
+static inline xt_prof_count_t GETCLOCK_NS(void)
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (xt_prof_count_t)ts.tv_sec * 1000000000ULL + (xt_prof_count_t)ts.tv_nsec;
+}
+
+#ifdef HOST_PERF_COUNTERS
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#ifndef HOST_PERF_EVENT
+#define HOST_PERF_EVENT PERF_COUNT_HW_CPU_CYCLES
+#endif
+
+/* -2 : not opened yet, -1 : open failed, use ns */
+static int xt_prof_perf_fd = -2;
+
+static inline int xt_prof_perf_open(void)
+{
+  struct perf_event_attr attr;
+
+  if(xt_prof_perf_fd != -2)
+    return xt_prof_perf_fd;
+
+  memset(&attr, 0, sizeof(attr));
+  attr.type = PERF_TYPE_HARDWARE;
+  attr.size = sizeof(attr);
+  attr.config = HOST_PERF_EVENT;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  xt_prof_perf_fd = (int)syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+  if(xt_prof_perf_fd < 0)
+  {
+    fprintf(stderr, "xt_profiler: perf_event_open failed, counting ns\n");
+    xt_prof_perf_fd = -1;
+  }
+  return xt_prof_perf_fd;
+}
+
+static inline xt_prof_count_t GETCLOCK(void)
+{
+  uint64_t val;
+  int fd = xt_prof_perf_open();
+
+  if(fd >= 0 && read(fd, &val, sizeof(val)) == sizeof(val))
+    return (xt_prof_count_t)val;
+  return GETCLOCK_NS();
+}
+
+#define PROFILER_COUNTER_UNITS \
+  ((xt_prof_perf_open() < 0) ? "ns" : ((HOST_PERF_EVENT == PERF_COUNT_HW_INSTRUCTIONS) ? "ins" : "cyc"))
+
+#else /* HOST_PERF_COUNTERS */
+
+#define GETCLOCK() GETCLOCK_NS()
+#define PROFILER_COUNTER_UNITS "ns"
+
+#endif /* HOST_PERF_COUNTERS */
+
+#else /* HOST_PROFILE */
+#include <xtensa/sim.h>
+
+typedef uint32_t xt_prof_count_t;
+
 static unsigned long inline GETCLOCK(void)
 {
   unsigned long r;
@@ -53,6 +136,10 @@ static unsigned long inline GETCLOCK(void)
   return r;
 }
 
+#define PROFILER_COUNTER_UNITS "cyc"
+
+#endif /* HOST_PROFILE */
+
 #define get_clock(val) *val = GETCLOCK() 
 #define _START(prof) (&gProfiler[prof])->start
 #define _STOP(prof)  (&gProfiler[prof])->stop
@@ -72,6 +159,8 @@ static unsigned long inline GETCLOCK(void)
   (&gProfiler[prof])->curr = (&gProfiler[prof])->sum  = (&gProfiler[prof])->ave = (&gProfiler[prof])->peak = 0.0; \
   (&gProfiler[prof])->curr_metric = (&gProfiler[prof])->ave_metric = 0.0;                                         \
   (&gProfiler[prof])->metric_points = _metric_points;                                                             \
+  (&gProfiler[prof])->warmup = 0;                                                                                 \
+  (&gProfiler[prof])->bytes = 0;                                                                                  \
   _START(prof) = 0;                                                                                               \
   _STOP(prof) = 0;                                                                                                \
   strcpy((&gProfiler[prof])->name , _name);                                                                       \
@@ -114,32 +203,51 @@ static unsigned long inline GETCLOCK(void)
 
 
 #define XTPWR_PROFILER_PRINT( prof )                                                               \
+  if((&gProfiler[prof])->frame_cnt > 0)                                                            \
   printf( " frame %d : %10.2f cycles; Total cycles : %10.2f cycles; %6.2f %s\n",                                         \
       (&gProfiler[prof])->frame_cnt-1, (&gProfiler[prof])->curr, (&gProfiler[prof])->sum, (&gProfiler[prof])->curr_metric, \
       (&gProfiler[prof])->metric_units); \
 
+/* Frames not counted in the statistics (cache / branch predictor warm up) */
+#define XTPWR_PROFILER_WARMUP( prof, _frames ) {  \
+  (&gProfiler[prof])->warmup = (_frames);         \
+}
+
+/* Bytes read and written by one call of the kernel */
+#define XTPWR_PROFILER_BYTES( prof, _bytes ) {    \
+  (&gProfiler[prof])->bytes = (_bytes);           \
+}
+
 #define XTPWR_PROFILER_UPDATE( prof ) {                                                                             \
-  (&gProfiler[prof])->cycles = (&gProfiler[prof])->cycles - (&gProfiler[prof])->exclude_cycles;                     \
-  (&gProfiler[prof])->curr = ( (double)(&gProfiler[prof])->cycles ) ;                                               \
-  (&gProfiler[prof])->sum += (&gProfiler[prof])->curr;                                                              \
-  (&gProfiler[prof])->ave = (&gProfiler[prof])->sum / ((&gProfiler[prof])->frame_cnt+1);                            \
-  if ((&gProfiler[prof])->peak < (&gProfiler[prof])->curr)                                                          \
-  {                                                                                                                 \
-    (&gProfiler[prof])->peak = (&gProfiler[prof])->curr;                                                            \
-    (&gProfiler[prof])->peak_frame = (&gProfiler[prof])->frame_cnt;                                                 \
-  }                                                                                                                 \
-  if((&gProfiler[prof])->metric_inverted)                                                                           \
+  if((&gProfiler[prof])->warmup > 0)                                                                                \
   {                                                                                                                 \
-    (&gProfiler[prof])->curr_metric = ( (double)((&gProfiler[prof])->metric_points) / (&gProfiler[prof])->cycles ) ;\
-    (&gProfiler[prof])->ave_metric = ( (&gProfiler[prof])->metric_points / (&gProfiler[prof])->ave );               \
+    (&gProfiler[prof])->warmup--;                                                                                   \
+    (&gProfiler[prof])->cycles = (&gProfiler[prof])->exclude_cycles = 0;                                            \
   }                                                                                                                 \
   else                                                                                                              \
   {                                                                                                                 \
-    (&gProfiler[prof])->curr_metric = ( (double)(&gProfiler[prof])->cycles / (&gProfiler[prof])->metric_points ) ;  \
-    (&gProfiler[prof])->ave_metric = ((&gProfiler[prof])->ave / (&gProfiler[prof])->metric_points);                 \
+    (&gProfiler[prof])->cycles = (&gProfiler[prof])->cycles - (&gProfiler[prof])->exclude_cycles;                   \
+    (&gProfiler[prof])->curr = ( (double)(&gProfiler[prof])->cycles ) ;                                             \
+    (&gProfiler[prof])->sum += (&gProfiler[prof])->curr;                                                            \
+    (&gProfiler[prof])->ave = (&gProfiler[prof])->sum / ((&gProfiler[prof])->frame_cnt+1);                          \
+    if ((&gProfiler[prof])->peak < (&gProfiler[prof])->curr)                                                        \
+    {                                                                                                               \
+      (&gProfiler[prof])->peak = (&gProfiler[prof])->curr;                                                          \
+      (&gProfiler[prof])->peak_frame = (&gProfiler[prof])->frame_cnt;                                               \
+    }                                                                                                               \
+    if((&gProfiler[prof])->metric_inverted)                                                                         \
+    {                                                                                                               \
+      (&gProfiler[prof])->curr_metric = ( (double)((&gProfiler[prof])->metric_points) / (&gProfiler[prof])->cycles ) ;\
+      (&gProfiler[prof])->ave_metric = ( (&gProfiler[prof])->metric_points / (&gProfiler[prof])->ave );             \
+    }                                                                                                               \
+    else                                                                                                            \
+    {                                                                                                               \
+      (&gProfiler[prof])->curr_metric = ( (double)(&gProfiler[prof])->cycles / (&gProfiler[prof])->metric_points ) ;\
+      (&gProfiler[prof])->ave_metric = ((&gProfiler[prof])->ave / (&gProfiler[prof])->metric_points);               \
+    }                                                                                                               \
+    (&gProfiler[prof])->cycles = (&gProfiler[prof])->exclude_cycles = 0;                                            \
+    (&gProfiler[prof])->frame_cnt += 1;                                                                             \
   }                                                                                                                 \
-  (&gProfiler[prof])->cycles = (&gProfiler[prof])->exclude_cycles = 0;                                              \
-  (&gProfiler[prof])->frame_cnt += 1;                                                                               \
 }
 
 #define XTPWR_PROFILER_AVE_TOTAL( no_of_prof ) {                                                                    \
@@ -166,6 +274,18 @@ static unsigned long inline GETCLOCK(void)
         (&gProfiler[prof])->name, (&gProfiler[prof])->ave,                                                                                  \
         (&gProfiler[prof])->peak, (&gProfiler[prof])->peak_frame, pass_flag ? ((verify_flag) ? "pass" : "NA") : "fail", (&gProfiler[prof])->params);                    \
   }                                                                                                                                         \
+  XTPWR_PROFILER_CSV(prof, pass_flag, verify_flag)                                                                                          \
+}
+
+/* Machine readable summary, one line per kernel:
+ * PROFILE_CSV,name,counter,avg,peak,peak_frame,frames,metric,metric_units,bytes,bytes_per_count,result,"params" */
+#define XTPWR_PROFILER_CSV( prof, pass_flag, verify_flag) {                                                  \
+  printf("PROFILE_CSV,%s,%s,%.2f,%.2f,%d,%d,%.4f,%s,%u,%.4f,%s,\"%s\"\n",                                     \
+      (&gProfiler[prof])->name, PROFILER_COUNTER_UNITS, (&gProfiler[prof])->ave, (&gProfiler[prof])->peak,    \
+      (&gProfiler[prof])->peak_frame, (&gProfiler[prof])->frame_cnt, (&gProfiler[prof])->ave_metric,          \
+      (&gProfiler[prof])->metric_units, (&gProfiler[prof])->bytes,                                            \
+      ((&gProfiler[prof])->ave > 0) ? ((&gProfiler[prof])->bytes / (&gProfiler[prof])->ave) : 0.0,            \
+      pass_flag ? ((verify_flag) ? "pass" : "NA") : "fail", (&gProfiler[prof])->params);                      \
 }
 
 // TODO
@@ -188,12 +308,12 @@ typedef struct _profiler_t
   char name[MAX_PROFILER_NAME_LENGTH];
 
 #ifdef CCOUNT_AVAILABLE
-  uint32_t cycles;
-  uint32_t start;
-  uint32_t stop;
-  uint32_t exclude_cycles;
-  uint32_t exclude_start;
-  uint32_t exclude_stop;
+  xt_prof_count_t cycles;
+  xt_prof_count_t start;
+  xt_prof_count_t stop;
+  xt_prof_count_t exclude_cycles;
+  xt_prof_count_t exclude_start;
+  xt_prof_count_t exclude_stop;
 #else
   clock_t cycles;
   struct tms start;
@@ -206,6 +326,8 @@ typedef struct _profiler_t
   double curr, sum, ave, peak;
   double curr_metric, ave_metric;
   unsigned int metric_points;
+  int warmup;
+  unsigned int bytes;
 
   char params[MAX_PROFILER_PARAMS_LENGTH];
   char metric_units[MAX_PROFILER_METRIC_UNITS_LENGTH];
@@ -225,8 +347,11 @@ typedef struct _profiler_t
 #define XTPWR_PROFILER_START( prof )
 #define XTPWR_PROFILER_STOP( prof )
 #define XTPWR_PROFILER_UPDATE( prof )
+#define XTPWR_PROFILER_WARMUP( prof, _frames )
+#define XTPWR_PROFILER_BYTES( prof, _bytes )
 #define XTPWR_PROFILER_AVE_TOTAL( no_of_prof )
 #define XTPWR_PROFILER_CLOSE( prof , pass_flag, verify_flag) 
+#define XTPWR_PROFILER_CSV( prof , pass_flag, verify_flag)
 #define XTPWR_PROFILER_PRINT( prof ) 
 
 #define XTPWR_PROFILER_EXCLUDE_ON( prof )
@@ -234,6 +359,24 @@ typedef struct _profiler_t
 #define XT_ISS_SWITCH_MODE(mode)
 
 #endif /* PROFILE */
+
+/* Specialised / generic path counters of the library, one line per kernel
+ * that ran: PATH_CSV,kernel,specialised,generic. Prints nothing when the library is
+ * built without PATH_COUNTERS=1. */
+#define XTPWR_PROFILER_PATHS() {                                           \
+  xa_nn_path_counters_t _path;                                            \
+  int _kernel;                                                            \
+  for(_kernel = 0; _kernel < XA_NN_PATH_KERNELS; _kernel++)               \
+  {                                                                       \
+    if(xa_nn_get_path_counters(&_path, _kernel) == 0 &&                   \
+       (_path.specialised + _path.generic) != 0)                              \
+    {                                                                     \
+      printf("PATH_CSV,%s,%u,%u\n", _path.name,                           \
+          (unsigned)_path.specialised, (unsigned)_path.generic);              \
+    }                                                                     \
+  }                                                                       \
+}
+
 #ifdef PROF_ALLOCATE  //define in only one file
 profiler_t gProfiler[7];
 #else
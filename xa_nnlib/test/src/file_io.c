@@ -103,6 +103,9 @@ int read_buf2D_from_file(FILE *fptr_read_data, buf2D_t *ptr_buf2D, int pad_val)
 int write_buf1D_to_file(FILE *fptr_write_data, buf1D_t *ptr_buf1D) 
 {                                    
   int size;                                                                              
+  /* No file in benchmark mode */
+  if(fptr_write_data == NULL)
+    return 0;
   GET_SIZE_FROM_PRECISION(ptr_buf1D->precision, size)                                    
   if(ptr_buf1D->length != fwrite(ptr_buf1D->p, size, ptr_buf1D->length, fptr_write_data))
   {                                                                                      
@@ -115,6 +118,8 @@ int write_buf1D_to_file(FILE *fptr_write_data, buf1D_t *ptr_buf1D)
 int write_buf2D_to_file(FILE *fptr_write_data, buf2D_t *ptr_buf2D) 
 {                                                    
   int size, row;                                                                                             
+  if(fptr_write_data == NULL)
+    return 0;
   char *ptr_mat = (char *)ptr_buf2D->p;                                                                      
   GET_SIZE_FROM_PRECISION(ptr_buf2D->precision, size)                                                        
   for(row=0; row<ptr_buf2D->rows; row++)                                                                     
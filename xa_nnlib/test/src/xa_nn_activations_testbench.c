@@ -29,6 +29,7 @@
 #include "nnlib/xa_nnlib_api.h"
 #include "nnlib/xa_nnlib_standards.h"
 #include "xt_manage_buffers.h"
+#include "xt_bench_mode.h"
 #include "cmdline_parser.h"
 #include "file_io.h"
 #include "nnlib/xa_nnlib_api.h"
@@ -69,6 +70,7 @@ typedef struct _test_config_t
   int integer_bits;
   int help;
   int num_elements;
+  int outer_size;
   int relu_threshold;
   int inp_precision;
   int out_precision;
@@ -76,9 +78,14 @@ typedef struct _test_config_t
   int activation_max; // used in relu_asym8/16/8
   float activation_min_f32;
   float activation_max_f32;
+  float inp_scale;  // used in lut_* activations
+  float out_scale;
+  float lut_alpha;
   char activation[MAX_ACTIVATION_NAME_LENGTH];
   int frames;
   int write_file;
+  int bench;
+  int warmup;
   char read_inp_file_name[MAX_FILE_NAME_LENGTH];
   char read_ref_file_name[MAX_FILE_NAME_LENGTH];
   char write_inp_file_name[MAX_FILE_NAME_LENGTH];
@@ -106,6 +113,7 @@ int default_config(test_config_t *p_cfg)
     p_cfg->out_shift = -8;
     p_cfg->out_zero_bias = 0;
     p_cfg->num_elements = 32;
+    p_cfg->outer_size = 1;
     p_cfg->relu_threshold = (1<<15); // threshold=1, Q16.15
     p_cfg->inp_precision = 32;
     p_cfg->out_precision = 32;
@@ -114,9 +122,14 @@ int default_config(test_config_t *p_cfg)
     p_cfg->activation_max = 127; 
     p_cfg->activation_min_f32 = 0.0; 
     p_cfg->activation_max_f32 = 1.0; 
+    p_cfg->inp_scale = 0.0625;
+    p_cfg->out_scale = 0.0078125;
+    p_cfg->lut_alpha = 0.2;
     strcpy(p_cfg->activation,"sigmoid");
     p_cfg->frames   = 2;  
     p_cfg->write_file = 0;  
+    p_cfg->bench = 0;
+    p_cfg->warmup = 0;
     p_cfg->read_inp_file_name[0] = '\0';
     p_cfg->read_ref_file_name[0] = '\0';
     p_cfg->write_inp_file_name[0]='\0';
@@ -135,13 +148,17 @@ void show_usage(void)
 {
     printf ("Usage xt-run <binary> [Options]\n");
     printf("\t-num_elements : number of elements; Default=32\n");
+    printf("\t-outer_size : softmax_rows and log_softmax_rows only, number of rows num_elements is split into; Default=1\n");
     printf("\t-relu_threshold : threshold for relu in Q16.15; Default=32768 (=1 in Q16.15)\n");
     printf("\t-inp_precision : 16, 32, -1(single prec float),-2(half prec float), -3 (asym8u), -4 (asym8s), -7 (asym16s) or -8 (sym16s); Default=32\n");
     printf("\t-out_precision : 16, 32, -1(single prec float),-2(half prec float), -3 (asym8u), -4 (asym8s), -7 (asym16s) or -8 (sym16s); Default=32\n");
     printf("\t-integer_bits : number of integer bits in input for tanh_16_16 (0-6); Default=3\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-activation: sigmoid, tanh, relu, relu_std, relu1, relu6, leaky_relu, prelu, hard_swish, activation_min_max or softmax; Default=sigmoid\n");
+    printf("\t-activation: sigmoid, tanh, relu, relu_std, relu1, relu6, leaky_relu, prelu, hard_swish, activation_min_max, softmax, softmax_rows, log_softmax_rows (-4 only)\n");
+    printf("\t             or for -4 (asym8s) only: lut_sigmoid, lut_tanh, lut_hard_swish, lut_leaky_relu, lut_elu, lut_gelu, lut_swish; Default=sigmoid\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
+    printf("\t-bench: set to 1 to profile on random inputs, no input/output/reference files are used; Default=0\n");
+    printf("\t-warmup: frames run before the profiled frames, not included in the profile; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading input \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
     printf("\t-write_inp_file_name: Full filename for writing input \n");
@@ -168,6 +185,25 @@ void show_usage(void)
     printf("\t-out_multiplier: Multiplier value for output Default=0x40000000\n");
     printf("\t-out_shift: Shift value for output Default=0\n");
     printf("\t-out_zero_bias: Zero bias value for output Default=0\n");
+    printf("\t-inp_scale: lut_* parameter - Input quantization scale Default=0.0625\n");
+    printf("\t-out_scale: lut_* parameter - Output quantization scale Default=0.0078125\n");
+    printf("\t-lut_alpha: lut_leaky_relu and lut_elu parameter - alpha Default=0.2\n");
+}
+
+/* Returns the xa_nn_act_lut_type_t for lut_* activation names, -1 otherwise */
+int get_lut_act_type(const char *activation)
+{
+  static const char *lut_names[] = {"lut_sigmoid", "lut_tanh", "lut_hard_swish",
+    "lut_leaky_relu", "lut_elu", "lut_gelu", "lut_swish"};
+  static const int lut_types[] = {XA_NN_ACT_LUT_SIGMOID, XA_NN_ACT_LUT_TANH, XA_NN_ACT_LUT_HARD_SWISH,
+    XA_NN_ACT_LUT_LEAKY_RELU, XA_NN_ACT_LUT_ELU, XA_NN_ACT_LUT_GELU, XA_NN_ACT_LUT_SWISH};
+  int i;
+  for(i = 0; i < (int)(sizeof(lut_types)/sizeof(lut_types[0])); i++)
+  {
+    if(!strcmp(activation, lut_names[i]))
+      return lut_types[i];
+  }
+  return -1;
 }
 
 void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
@@ -201,6 +237,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-out_zero_bias",p_cfg->out_zero_bias);
     ARGTYPE_ONETIME_CONFIG("-integer_bits",p_cfg->integer_bits);
     ARGTYPE_ONETIME_CONFIG("-num_elements",p_cfg->num_elements);
+    ARGTYPE_ONETIME_CONFIG("-outer_size",p_cfg->outer_size);
     ARGTYPE_ONETIME_CONFIG("-relu_threshold",p_cfg->relu_threshold);
     ARGTYPE_ONETIME_CONFIG("-inp_precision",p_cfg->inp_precision);
     ARGTYPE_ONETIME_CONFIG("-out_precision",p_cfg->out_precision);
@@ -208,9 +245,14 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-activation_max",p_cfg->activation_max);
     ARGTYPE_ONETIME_CONFIG_F32("-activation_min_f32",p_cfg->activation_min_f32);
     ARGTYPE_ONETIME_CONFIG_F32("-activation_max_f32",p_cfg->activation_max_f32);
+    ARGTYPE_ONETIME_CONFIG_F32("-inp_scale",p_cfg->inp_scale);
+    ARGTYPE_ONETIME_CONFIG_F32("-out_scale",p_cfg->out_scale);
+    ARGTYPE_ONETIME_CONFIG_F32("-lut_alpha",p_cfg->lut_alpha);
     ARGTYPE_STRING("-activation",p_cfg->activation, MAX_ACTIVATION_NAME_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
     ARGTYPE_ONETIME_CONFIG("-write_file",p_cfg->write_file);
+    ARGTYPE_ONETIME_CONFIG("-bench",p_cfg->bench);
+    ARGTYPE_ONETIME_CONFIG("-warmup",p_cfg->warmup);
     ARGTYPE_STRING("-read_inp_file_name",p_cfg->read_inp_file_name, MAX_FILE_NAME_LENGTH);
     ARGTYPE_STRING("-read_ref_file_name",p_cfg->read_ref_file_name, MAX_FILE_NAME_LENGTH);
     ARGTYPE_STRING("-write_inp_file_name",p_cfg->write_inp_file_name, MAX_FILE_NAME_LENGTH);
@@ -383,6 +425,16 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
                 cfg.out_zero_bias, cfg.num_elements);\
       XTPWR_PROFILER_STOP(0);\
     }
+/* The table is built once before the frame loop, only the lookup is profiled */
+#define ACT_LUT_ASYM8S_FN(IPREC, OPREC) \
+    if((IPREC == p_inp->precision) && (OPREC == p_out->precision) && (lut_act_type >= 0)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_vec_lut_asym8s_asym8s ( \
+                (WORD8 *)p_out->p, (WORD8 *)p_inp->p, \
+                (WORD8 *)p_lut->p, cfg.num_elements);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+
 #define SOFTMAX_ASYM8(KERNEL, IPREC, OPREC) \
   if(!strcmp(cfg.activation,#KERNEL) && (IPREC == cfg.inp_precision) && (OPREC == p_out->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -445,6 +497,38 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define SOFTMAX_ROWS_ASYM8s(KERNEL, IPREC, OPREC, OSUFFIX, OTYPE) \
+  if(!strcmp(cfg.activation,#KERNEL) && (IPREC == cfg.inp_precision) && (OPREC == p_out->precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_asym8s_##OSUFFIX\
+                (\
+                    (OTYPE *) p_out->p,\
+                    (WORD8 *) p_inp->p,\
+                    cfg.diffmin,\
+                    cfg.input_left_shift,\
+                    cfg.input_multiplier,\
+                    cfg.outer_size,\
+                    cfg.num_elements / cfg.outer_size,\
+                    (WORD32 *)p_scratch->p\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define SOFTMAX_ROWS_SYM16s_16(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.activation,#KERNEL) && (IPREC == cfg.inp_precision) && (OPREC == p_out->precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_sym16s_16\
+                (\
+                    (WORD16 *) p_out->p,\
+                    (WORD16 *) p_inp->p,\
+                    cfg.input_left_shift,\
+                    cfg.input_multiplier,\
+                    cfg.outer_size,\
+                    cfg.num_elements / cfg.outer_size \
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #if HIFI_VFPU
 #define ACTIVATION_MIN_MAX_FN_F32(IPREC,OPREC, ACTIVATION) \
     if((IPREC == p_inp->precision) && (OPREC == p_out->precision) && !strcmp(cfg.activation,#ACTIVATION)) {\
@@ -516,7 +600,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
         printf("unsupported activation\n"); return -1;} 
 #endif
 
-#if HIFI_HP_VFPU && hifi5
+#if HIFI_VFPU
 #define ACTIVATION_FN_F16(IPREC, OPREC, ACTIVATION) \
     if((IPREC == p_inp->precision) && (OPREC == p_out->precision) && !strcmp(cfg.activation,#ACTIVATION)) {\
       XTPWR_PROFILER_START(0);\
@@ -577,10 +661,15 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else LEAKY_RELU_ASYM8S_FN(-4, -4, leaky_relu)\
     else LEAKY_RELU_ASYM16S_FN(-7, -7, leaky_relu)\
     else HSWISH_ASYM8S_FN(-4, -4, hard_swish)\
+    else ACT_LUT_ASYM8S_FN(-4, -4)\
     else SOFTMAX_ASYM8(softmax, -3, -3) \
     else SOFTMAX_ASYM8s(softmax, -4, -4) \
     else SOFTMAX_ASYM8s_16(softmax, -4, 16) \
     else SOFTMAX_SYM16s_16(softmax, -8, 16) \
+    else SOFTMAX_ROWS_ASYM8s(softmax_rows, -4, -4, asym8s, WORD8) \
+    else SOFTMAX_ROWS_ASYM8s(softmax_rows, -4, 16, 16, WORD16) \
+    else SOFTMAX_ROWS_ASYM8s(log_softmax_rows, -4, -4, asym8s, WORD8) \
+    else SOFTMAX_ROWS_SYM16s_16(softmax_rows, -8, 16) \
     else SIGMOID_ASYM8(sigmoid, -3, -3) \
     else SIGMOID_ASYM8s(sigmoid, -4, -4) \
     else SIGMOID_SYM16s(sigmoid, -8, -8) \
@@ -589,12 +678,230 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else {  printf("unsupported activation\n"); return -1;} 
 
 
+/* beta*(x - max) in Q5.26, the left shift saturates to 32 bits before the
+ * multiplier is applied as in the kernel */
+static double log_softmax_scaled_diff(int diff, int input_left_shift, int input_multiplier)
+{
+  double shifted = ldexp((double)diff, input_left_shift);
+  shifted = shifted < -2147483648.0 ? -2147483648.0 : shifted;
+  return ldexp(shifted * input_multiplier, -31 - 26);
+}
+
+/* Log-softmax of one row in double, elements below diffmin are left out of
+ * the sum and output -128 */
+static void log_softmax_row_ref(WORD8 *p_out, const WORD8 *p_in, int depth,
+    int diffmin, int input_left_shift, int input_multiplier)
+{
+  int i, max_in_row = p_in[0];
+  double sum = 0.0, ln_sum;
+
+  for(i = 1; i < depth; i++)
+    max_in_row = p_in[i] > max_in_row ? p_in[i] : max_in_row;
+  for(i = 0; i < depth; i++)
+  {
+    if(p_in[i] - max_in_row >= diffmin)
+      sum += exp(log_softmax_scaled_diff(p_in[i] - max_in_row, input_left_shift, input_multiplier));
+  }
+  ln_sum = log(sum);
+  for(i = 0; i < depth; i++)
+  {
+    long val = -128;
+    if(p_in[i] - max_in_row >= diffmin)
+    {
+      val = lround((log_softmax_scaled_diff(p_in[i] - max_in_row, input_left_shift, input_multiplier) - ln_sum) * 16.0) + 127;
+      val = val < -128 ? -128 : (val > 127 ? 127 : val);
+    }
+    p_out[i] = (WORD8)val;
+  }
+}
+
+/* Each row of the rows kernels against the single vector kernel run on that
+ * row alone. There is no single vector log-softmax, it is checked against
+ * log_softmax_row_ref to within one LSB (ln(sum) is interpolated). */
+static int check_softmax_rows(test_config_t *p_cfg, buf1D_t *p_inp, buf1D_t *p_out)
+{
+  int depth = p_cfg->num_elements / p_cfg->outer_size;
+  int row, i, err = 0, match = 1;
+  int out_bytes = (p_out->precision == 16) ? 2 : 1;
+  int is_log = !strcmp(p_cfg->activation, "log_softmax_rows");
+  int scratch_size = 0;
+  void *p_row, *p_scratch = NULL;
+
+  p_row = malloc(depth * out_bytes);
+  if(p_inp->precision == -4 && !is_log)
+  {
+    scratch_size = get_softmax_scratch_size(p_inp->precision, p_out->precision, depth);
+    p_scratch = malloc(scratch_size + 8);
+  }
+  if(p_row == NULL || (scratch_size && p_scratch == NULL))
+  {
+    free(p_row);
+    free(p_scratch);
+    return 0;
+  }
+
+  for(row = 0; row < p_cfg->outer_size && match; row++)
+  {
+    if(is_log)
+    {
+      const WORD8 *p_in = (const WORD8 *)p_inp->p + row * depth;
+      const WORD8 *p_o = (const WORD8 *)p_out->p + row * depth;
+      log_softmax_row_ref((WORD8 *)p_row, p_in, depth,
+          p_cfg->diffmin, p_cfg->input_left_shift, p_cfg->input_multiplier);
+      for(i = 0; i < depth; i++)
+      {
+        if(abs(p_o[i] - ((WORD8 *)p_row)[i]) > 1)
+        {
+          printf("log_softmax_rows row %d element %d: %d, reference %d\n", row, i, p_o[i], ((WORD8 *)p_row)[i]);
+          match = 0;
+          break;
+        }
+      }
+      continue;
+    }
+
+    if(p_inp->precision == -8)
+    {
+      err = xa_nn_vec_softmax_sym16s_16((WORD16 *)p_row, (const WORD16 *)p_inp->p + row * depth,
+          p_cfg->input_left_shift, p_cfg->input_multiplier, depth);
+    }
+    else if(p_out->precision == 16)
+    {
+      err = xa_nn_vec_softmax_asym8s_16((WORD16 *)p_row, (const WORD8 *)p_inp->p + row * depth,
+          p_cfg->diffmin, p_cfg->input_left_shift, p_cfg->input_multiplier, depth, p_scratch);
+    }
+    else
+    {
+      err = xa_nn_vec_softmax_asym8s_asym8s((WORD8 *)p_row, (const WORD8 *)p_inp->p + row * depth,
+          p_cfg->diffmin, p_cfg->input_left_shift, p_cfg->input_multiplier, depth, p_scratch);
+    }
+    if(err || memcmp(p_row, (WORD8 *)p_out->p + row * depth * out_bytes, depth * out_bytes))
+    {
+      printf("softmax_rows row %d does not match the single vector kernel\n", row);
+      match = 0;
+    }
+  }
+
+  free(p_row);
+  free(p_scratch);
+  return match;
+}
+
+/* Real multiplier to a Q31 multiplier and a left shift, as done by TFLite */
+static void quantize_multiplier(double real_multiplier, int *p_multiplier, int *p_shift)
+{
+  double q;
+  long long q_fixed;
+
+  if(real_multiplier == 0.0)
+  {
+    *p_multiplier = 0;
+    *p_shift = 0;
+    return;
+  }
+  q = frexp(real_multiplier, p_shift);
+  q_fixed = llround(q * 2147483648.0);
+  if(q_fixed == (1LL << 31))
+  {
+    q_fixed /= 2;
+    (*p_shift)++;
+  }
+  *p_multiplier = (int)q_fixed;
+}
+
+/* The lookup is checked bit exact against the table. The table is checked,
+ * over all 256 inputs, against the fixed point asym8s kernel of the same
+ * activation where there is one, to within one LSB (the table is computed
+ * in float). Sigmoid and tanh tables are rebuilt with the fixed output
+ * quantization of those kernels, 1/256 with zero point -128 and 1/128 with
+ * zero point 0. */
+static int check_act_lut(test_config_t *p_cfg, int lut_act_type, buf1D_t *p_lut, buf1D_t *p_inp, buf1D_t *p_out)
+{
+  const WORD8 *p_tbl = (const WORD8 *)p_lut->p;
+  const WORD8 *p_in = (const WORD8 *)p_inp->p;
+  const WORD8 *p_o = (const WORD8 *)p_out->p;
+  WORD8 all_inputs[256], ref_lut[256], kernel_out[256];
+  int i, err = 0, mult, shift, alpha_mult, alpha_shift;
+
+  for(i = 0; i < p_cfg->num_elements; i++)
+  {
+    if(p_o[i] != p_tbl[p_in[i] + 128])
+    {
+      printf("lut lookup element %d: %d, table entry %d\n", i, p_o[i], p_tbl[p_in[i] + 128]);
+      return 0;
+    }
+  }
+
+  for(i = 0; i < 256; i++)
+  {
+    all_inputs[i] = (WORD8)(i - 128);
+  }
+
+  if(lut_act_type == XA_NN_ACT_LUT_SIGMOID || lut_act_type == XA_NN_ACT_LUT_TANH)
+  {
+    int is_sigmoid = (lut_act_type == XA_NN_ACT_LUT_SIGMOID);
+    int radius;
+
+    err = xa_nn_vec_act_lut_init_asym8s(ref_lut, lut_act_type, p_cfg->inp_zero_bias, p_cfg->inp_scale,
+        is_sigmoid ? -128 : 0, is_sigmoid ? 1.0f / 256 : 1.0f / 128, 0.0f);
+    /* Input in Q4.27 */
+    quantize_multiplier(p_cfg->inp_scale * (double)(1 << 27), &mult, &shift);
+    radius = (int)floor(15.0 * (double)(1 << 27) / ldexp(1.0, shift));
+    if(is_sigmoid)
+    {
+      err |= xa_nn_vec_sigmoid_asym8s_asym8s(kernel_out, all_inputs, p_cfg->inp_zero_bias, radius, mult, shift, 256);
+    }
+    else
+    {
+      err |= xa_nn_vec_tanh_asym8s_asym8s(kernel_out, all_inputs, p_cfg->inp_zero_bias, radius, mult, shift, 256);
+    }
+  }
+  else if(lut_act_type == XA_NN_ACT_LUT_LEAKY_RELU)
+  {
+    memcpy(ref_lut, p_tbl, 256);
+    quantize_multiplier(p_cfg->inp_scale / p_cfg->out_scale, &mult, &shift);
+    if(p_cfg->lut_alpha == 0.0f)
+    {
+      err = xa_nn_vec_relu_asym8s_asym8s(kernel_out, all_inputs, p_cfg->inp_zero_bias, mult, shift,
+          p_cfg->out_zero_bias, -128, 127, 256);
+    }
+    else
+    {
+      quantize_multiplier(p_cfg->inp_scale * p_cfg->lut_alpha / p_cfg->out_scale, &alpha_mult, &alpha_shift);
+      err = xa_nn_vec_leaky_relu_asym8s_asym8s(kernel_out, all_inputs, p_cfg->inp_zero_bias,
+          alpha_mult, alpha_shift, mult, shift, p_cfg->out_zero_bias, 256);
+    }
+  }
+  else
+  {
+    /* No fixed point kernel to compare the table with */
+    return 1;
+  }
+
+  if(err)
+  {
+    printf("%s: reference kernel returned error\n", p_cfg->activation);
+    return 0;
+  }
+  for(i = 0; i < 256; i++)
+  {
+    if(abs(ref_lut[i] - kernel_out[i]) > 1)
+    {
+      printf("%s table entry for input %d: %d, kernel %d\n", p_cfg->activation, i - 128, ref_lut[i], kernel_out[i]);
+      return 0;
+    }
+  }
+  return 1;
+}
+
 int xa_nn_main_process(int argc, char *argv[])
 {
 
   int frame;
   int err = 0;
   int pass_count=0;
+  int frame_pass;
+  int rows_check;
   char profiler_name[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
 
@@ -602,6 +909,8 @@ int xa_nn_main_process(int argc, char *argv[])
 
   buf1D_t *p_inp;
   buf1D_t *p_inp_alpha = NULL;
+  buf1D_t *p_lut = NULL;
+  int lut_act_type = -1;
   buf1D_t *p_out;
   buf1D_t *ptr_ref;
 
@@ -632,6 +941,9 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
+  // Benchmark mode, random data is generated in place of reading the input file
+  bench_mode_config(cfg.bench, cfg.warmup, &cfg.write_file, &cfg.verify, &cfg.frames);
+
   // Update threshold for relu based on input precision
   if((cfg.inp_precision == 16) && (cfg.relu_threshold == (1<<15)))
   {
@@ -659,7 +971,7 @@ int xa_nn_main_process(int argc, char *argv[])
     sprintf(profiler_name, "%s_f16xf16", cfg.activation);
     
     // If VFPU is not supported, return
-    if(!HIFI_HP_VFPU)
+    if(!HIFI_VFPU)
     {
       printf("%s: NOT TESTED\n", profiler_name);
       return 0;
@@ -705,7 +1017,7 @@ int xa_nn_main_process(int argc, char *argv[])
     /* If write_file (generate test vectors) is enabled, random data would be generated and
        used; the input data and output data generated would be written into files. 
      */
-    fptr_inp = file_open(pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+    fptr_inp = bench_file_open(cfg.bench, pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
   }
   else
   {
@@ -716,7 +1028,7 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   // Open output file
-  fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+  fptr_out = bench_file_open(cfg.bench, pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
 
   // Open reference file if verify flag is enabled
   if(cfg.verify)
@@ -740,9 +1052,44 @@ int xa_nn_main_process(int argc, char *argv[])
       scratch_size = get_softmax_scratch_size(cfg.inp_precision, cfg.out_precision, cfg.num_elements);
       p_scratch = create_buf1D(scratch_size, 8); VALIDATE_PTR(p_scratch);
   }
+
+  if((!strcmp(cfg.activation,"softmax_rows") || !strcmp(cfg.activation,"log_softmax_rows")) && (cfg.inp_precision == -4))
+  {
+      if(cfg.outer_size <= 0 || (cfg.num_elements % cfg.outer_size))
+      {
+        printf("num_elements must be a multiple of outer_size\n");
+        return -1;
+      }
+      scratch_size = get_softmax_rows_scratch_size(cfg.inp_precision, cfg.out_precision, cfg.num_elements / cfg.outer_size);
+      p_scratch = create_buf1D(scratch_size, 8); VALIDATE_PTR(p_scratch);
+  }
+
+  rows_check = !strcmp(cfg.activation,"softmax_rows") || !strcmp(cfg.activation,"log_softmax_rows");
+
+  lut_act_type = get_lut_act_type(cfg.activation);
+  if(lut_act_type >= 0)
+  {
+    p_lut = create_buf1D(256, 8); VALIDATE_PTR(p_lut);
+    err = xa_nn_vec_act_lut_init_asym8s((WORD8 *)p_lut->p, lut_act_type,
+        cfg.inp_zero_bias, cfg.inp_scale, cfg.out_zero_bias, cfg.out_scale, cfg.lut_alpha);
+    if(err)
+    {
+      printf("%s: table init returned error (invalid parameters)\n", cfg.activation);
+      return -1;
+    }
+  }
   
   
   XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, cfg.num_elements, "cyc/point", 0);
+  if(!strcmp(cfg.activation,"prelu"))
+  {
+    XTPWR_PROFILER_BYTES(0, BUF1D_BYTES(p_inp) + BUF1D_BYTES(p_inp_alpha) + BUF1D_BYTES(p_out));
+  }
+  else
+  {
+    XTPWR_PROFILER_BYTES(0, BUF1D_BYTES(p_inp) + BUF1D_BYTES(p_out));
+  }
+  XTPWR_PROFILER_WARMUP(0, cfg.warmup);
 
   // Frame processing loop
   for(frame = 0; frame < cfg.frames; frame++)
@@ -770,22 +1117,37 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.verify)
     {
       read_buf1D_from_file(fptr_ref, ptr_ref);
-      pass_count += compare_buf1D(ptr_ref, p_out, cfg.verify, cfg.out_precision, 1);
+      frame_pass = compare_buf1D(ptr_ref, p_out, cfg.verify, cfg.out_precision, 1);
     }
     else
     {
-      pass_count += !err;
+      frame_pass = !err;
+    }
+    // Rows kernels are also checked row by row against the single vector kernels
+    if(rows_check)
+    {
+      frame_pass = frame_pass && check_softmax_rows(&cfg, p_inp, p_out);
     }
+    // Table lookups are checked against the table, the table against the fixed point kernels
+    if(lut_act_type >= 0)
+    {
+      frame_pass = frame_pass && check_act_lut(&cfg, lut_act_type, p_lut, p_inp, p_out);
+    }
+    pass_count += frame_pass;
   }
 
-  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), cfg.verify);
+  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), (cfg.verify || rows_check || (lut_act_type >= 0)));
 
-  fclose(fptr_inp);
-  fclose(fptr_out);
+  bench_file_close(fptr_inp);
+  bench_file_close(fptr_out);
 
   // Free all buffers
   free_buf1D(p_inp);
   free_buf1D(p_out);
+  if(p_lut)
+  {
+    free_buf1D(p_lut);
+  }
 
   if(cfg.verify)
   {
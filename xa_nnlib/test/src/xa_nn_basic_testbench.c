@@ -23,10 +23,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <limits.h>
 #include <xtensa/config/core-isa.h>
 #include "xa_type_def.h"
 #include "nnlib/xa_nnlib_api.h"
 #include "xt_manage_buffers.h"
+#include "xt_bench_mode.h"
 #include "cmdline_parser.h"
 #include "file_io.h"
 #include "xa_nnlib_standards.h"
@@ -74,6 +76,8 @@ typedef struct _test_config_t
 #endif
   int  io_length;
   int  vec_count;
+  int  concat_pad;
+  int  concat_rows;
   int  num_inp_dims;
   int  num_axis_dims;
   int  num_out_dims;
@@ -81,6 +85,8 @@ typedef struct _test_config_t
   int  inp_precision;
   int  out_precision;
   int  write_file;
+  int  bench;
+  int  warmup;
   int  input_shape[MAX_DIMS];
   int  input1_shape[MAX_DIMS];
   int  input2_shape[MAX_DIMS];
@@ -133,6 +139,8 @@ int default_config(test_config_t *p_cfg)
     p_cfg->output_scale = 0.5;
     p_cfg->io_length  = 1024;
     p_cfg->vec_count  = 1;
+    p_cfg->concat_pad  = 0;
+    p_cfg->concat_rows  = 1;
     p_cfg->num_inp_dims  = 4;
     p_cfg->num_axis_dims  = 1;
     p_cfg->num_out_dims  = 4;
@@ -141,6 +149,8 @@ int default_config(test_config_t *p_cfg)
     p_cfg->out_precision = -1;
     strcpy(p_cfg->kernel_name, "elm_add");
     p_cfg->write_file = 0;  
+    p_cfg->bench = 0;
+    p_cfg->warmup = 0;
     p_cfg->read_inp1_file_name[0] = '\0';
     p_cfg->read_inp2_file_name[0] = '\0';
     p_cfg->input1_numElements = 0;
@@ -191,13 +201,17 @@ void show_usage(void)
     printf("\t-inp_precision: 8, 16, -4 (asym8s) -3 (asym8u),  -1 (single prec float), -7 (asym16s), 1(bool), -8 (sym16s); Default=-1\n");
     printf("\t-out_precision: 8, 16, -4 (asym8s) -3 (asym8u),  -1 (single prec float), -7 (asym16s), 1(bool), -8 (sym16s); Default=-1\n");
     printf("\t-vec_count: number of input vectors; Default=1\n");
+    printf("\t-concat_pad: Applicable only for elm_add with asym8s, >0 (also run the out_stride kernel into the middle of a concat with concat_pad elements on each side of every output row, checked against the output); Default=0\n");
+    printf("\t-concat_rows: number of rows io_length is split into for -concat_pad; Default=1\n");
     printf("\t-frames: Positive number; Default=2\n");
 #if HIFI_VFPU
-    printf("\t-kernel_name: elm_add, elm_sub, elm_mul, elm_mul_acc, elm_div, elm_floor, elm_min, elm_max, dot_prod, elm_equal, elm_notequal, elm_greater, elm_greaterequal, elm_less, elm_lessequal, reduce_max_4D, reduce_mean_4D, elm_sine, elm_cosine, elm_logn, elm_abs, elm_ceil, elm_round, elm_neg, elm_square, elm_rsqrt, elm_sqrt, broadcast, elm_requantize, elm_dequantize, elm_quantize, memmove, memset, elm_add_broadcast_4D, elm_sub_broadcast_4D, elm_mul_broadcast_4D, elm_squared_diff_broadcast_4D; Default=""elm_add""\n");
+    printf("\t-kernel_name: elm_add, elm_sub, elm_mul, elm_mul_acc, elm_div, elm_floor, elm_min, elm_max, dot_prod, elm_equal, elm_notequal, elm_greater, elm_greaterequal, elm_less, elm_lessequal, reduce_max_4D, reduce_mean_4D, elm_sine, elm_cosine, elm_logn, elm_abs, elm_ceil, elm_round, elm_neg, elm_square, elm_rsqrt, elm_sqrt, broadcast, elm_requantize, elm_dequantize, elm_quantize, memmove, memset, elm_add_broadcast_4D, elm_sub_broadcast_4D, elm_mul_broadcast_4D, elm_div_broadcast_4D, elm_min_broadcast_4D, elm_max_broadcast_4D, elm_squared_diff_broadcast_4D, elm_equal_broadcast_4D, elm_notequal_broadcast_4D, elm_greater_broadcast_4D, elm_greaterequal_broadcast_4D, elm_less_broadcast_4D, elm_lessequal_broadcast_4D; Default=""elm_add""\n");
 #else
-    printf("\t-kernel_name: elm_add, elm_sub, elm_mul, elm_mul_acc, elm_div, elm_floor, elm_min, elm_max, dot_prod, elm_equal, elm_notequal, elm_greater, elm_greaterequal, elm_less, elm_lessequal, reduce_max_4D, reduce_mean_4D, elm_sine, elm_cosine, elm_logn, elm_abs, elm_ceil, elm_round, elm_neg, elm_square, elm_rsqrt, elm_sqrt, broadcast, elm_requantize, memmove, memset, elm_add_broadcast_4D, elm_sub_broadcast_4D, elm_mul_broadcast_4D, elm_squared_diff_broadcast_4D; Default=""elm_add""\n");
+    printf("\t-kernel_name: elm_add, elm_sub, elm_mul, elm_mul_acc, elm_div, elm_floor, elm_min, elm_max, dot_prod, elm_equal, elm_notequal, elm_greater, elm_greaterequal, elm_less, elm_lessequal, reduce_max_4D, reduce_mean_4D, elm_sine, elm_cosine, elm_logn, elm_abs, elm_ceil, elm_round, elm_neg, elm_square, elm_rsqrt, elm_sqrt, broadcast, elm_requantize, memmove, memset, elm_add_broadcast_4D, elm_sub_broadcast_4D, elm_mul_broadcast_4D, elm_div_broadcast_4D, elm_min_broadcast_4D, elm_max_broadcast_4D, elm_squared_diff_broadcast_4D, elm_equal_broadcast_4D, elm_notequal_broadcast_4D, elm_greater_broadcast_4D, elm_greaterequal_broadcast_4D, elm_less_broadcast_4D, elm_lessequal_broadcast_4D; Default=""elm_add""\n");
 #endif
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
+    printf("\t-bench: set to 1 to profile on random inputs, no input/output/reference files are used; Default=0\n");
+    printf("\t-warmup: frames run before the profiled frames, not included in the profile; Default=0\n");
     printf("\t-read_inp1_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_inp2_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
@@ -273,9 +287,13 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-inp_precision", p_cfg->inp_precision);                        
     ARGTYPE_ONETIME_CONFIG("-out_precision", p_cfg->out_precision);                        
     ARGTYPE_ONETIME_CONFIG("-vec_count", p_cfg->vec_count);                           
+    ARGTYPE_ONETIME_CONFIG("-concat_pad", p_cfg->concat_pad);
+    ARGTYPE_ONETIME_CONFIG("-concat_rows", p_cfg->concat_rows);
     ARGTYPE_ONETIME_CONFIG("-frames", p_cfg->frames);
     ARGTYPE_STRING("-kernel_name", p_cfg->kernel_name, MAX_KERNEL_NAME_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-write_file", p_cfg->write_file);
+    ARGTYPE_ONETIME_CONFIG("-bench", p_cfg->bench);
+    ARGTYPE_ONETIME_CONFIG("-warmup", p_cfg->warmup);
     ARGTYPE_STRING("-read_inp1_file_name", p_cfg->read_inp1_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-read_inp2_file_name", p_cfg->read_inp2_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-read_ref_file_name", p_cfg->read_ref_file_name, XA_MAX_CMD_LINE_LENGTH);
@@ -431,6 +449,20 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define COMPARE_F32(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_f32xf32\
+                (\
+                    (WORD8 *) p_out->p,\
+                    (FLOAT32 *) p_inp1->p,\
+                    (FLOAT32 *) p_inp2->p,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #define FLOOR_F32(KERNEL, IPREC, OPREC) \
   if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
      && (OPREC == cfg.out_precision)) {\
@@ -620,7 +652,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     XTPWR_PROFILER_STOP(0);\
   }
 
-#define SUB_BROADCAST_4D_F32(KERNEL, IPREC, OPREC) \
+#define MATH_BROADCAST_4D_F32(KERNEL, IPREC, OPREC) \
   if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
      && (OPREC == cfg.out_precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -636,6 +668,117 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define COMPARE_ASYM16S(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_asym16sxasym16s\
+                (\
+                    (WORD8 *) p_out->p,\
+                    (WORD16 *) p_inp1->p,\
+                    cfg.input1_zero_bias,\
+                    cfg.input1_left_shift,\
+                    cfg.input1_multiplier,\
+                    (WORD16 *) p_inp2->p,\
+                    cfg.input2_zero_bias,\
+                    cfg.input2_left_shift,\
+                    cfg.input2_multiplier,\
+                    cfg.left_shift,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define COMPARE_BROADCAST_4D_QUANT(KERNEL, IPREC, OPREC, INP_TYPE, INP_NAME) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_##INP_NAME##x##INP_NAME\
+                (\
+                    (WORD8 *) p_out->p,\
+                    cfg.output_shape, \
+                    (INP_TYPE *) p_inp1->p,\
+                    cfg.input1_shape, \
+                    cfg.input1_zero_bias,\
+                    cfg.input1_left_shift,\
+                    cfg.input1_multiplier,\
+                    (INP_TYPE *) p_inp2->p,\
+                    cfg.input2_shape, \
+                    cfg.input2_zero_bias,\
+                    cfg.input2_left_shift,\
+                    cfg.input2_multiplier,\
+                    cfg.left_shift\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define COMPARE_BROADCAST_4D_F32(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_f32xf32\
+                (\
+                    (WORD8 *) p_out->p,\
+                    cfg.output_shape, \
+                    (FLOAT32 *) p_inp1->p,\
+                    cfg.input1_shape, \
+                    (FLOAT32 *) p_inp2->p,\
+                    cfg.input2_shape\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define MINMAX_BROADCAST_4D(KERNEL, IPREC, OPREC, BITS) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_##BITS##x##BITS##_##BITS\
+                (\
+                    (WORD##BITS *) p_out->p,\
+                    cfg.output_shape, \
+                    (WORD##BITS *) p_inp1->p,\
+                    cfg.input1_shape, \
+                    (WORD##BITS *) p_inp2->p,\
+                    cfg.input2_shape\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define MINMAX_16(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_16x16_16\
+                (\
+                    (WORD16 *) p_out->p,\
+                    (WORD16 *) p_inp1->p,\
+                    (WORD16 *) p_inp2->p,\
+                    cfg.io_length\
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define MUL_BROADCAST_4D_SYM16S_ASYM16S(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
+     && (OPREC == cfg.out_precision)) {\
+    XTPWR_PROFILER_START(0);\
+        err = xa_nn_##KERNEL##_sym16sxsym16s_asym16s\
+                (\
+                    (WORD16 *) p_out->p,\
+                    cfg.output_shape, \
+                    cfg.output_zero_bias,\
+                    cfg.output_left_shift,\
+                    cfg.output_multiplier,\
+                    cfg.output_activation_min,\
+                    cfg.output_activation_max,\
+                    (WORD16 *) p_inp1->p,\
+                    cfg.input1_shape, \
+                    (WORD16 *) p_inp2->p,\
+                    cfg.input2_shape \
+                );\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #define SUB_ASYM8(KERNEL, IPREC, OPREC) \
   if(!strcmp(cfg.kernel_name, #KERNEL) && (IPREC == cfg.inp_precision) \
      && (OPREC == cfg.out_precision)) {\
@@ -1222,6 +1365,14 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else BASIC_FLOAT32(elm_mul, -1, -1) \
     else BASIC_FLOAT32(elm_mul_acc, -1, -1) \
     else BASIC_FLOAT32(elm_div, -1, -1) \
+    else BASIC_FLOAT32(elm_min, -1, -1) \
+    else BASIC_FLOAT32(elm_max, -1, -1) \
+    else COMPARE_F32(elm_equal, -1, -4) \
+    else COMPARE_F32(elm_notequal, -1, -4) \
+    else COMPARE_F32(elm_greater, -1, -4) \
+    else COMPARE_F32(elm_greaterequal, -1, -4) \
+    else COMPARE_F32(elm_less, -1, -4) \
+    else COMPARE_F32(elm_lessequal, -1, -4) \
     else FLOOR_F32(elm_floor, -1, -1) \
     else MUL_ASYM8(elm_mul, -3, -3) \
     else MUL_ASYM8S(elm_mul, -4, -4) \
@@ -1235,9 +1386,45 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else SUB_ASYM8S(elm_sub, -4, -4) \
     else MATH_BROADCAST_4D_ASYM8S(elm_sub_broadcast_4D, -4, -4) \
     else MATH_BROADCAST_4D_ASYM16S(elm_sub_broadcast_4D, -7, -7) \
-    else SUB_BROADCAST_4D_F32(elm_sub_broadcast_4D, -1, -1) \
+    else MATH_BROADCAST_4D_F32(elm_add_broadcast_4D, -1, -1) \
+    else MATH_BROADCAST_4D_F32(elm_sub_broadcast_4D, -1, -1) \
+    else MATH_BROADCAST_4D_F32(elm_mul_broadcast_4D, -1, -1) \
+    else MATH_BROADCAST_4D_F32(elm_div_broadcast_4D, -1, -1) \
+    else MATH_BROADCAST_4D_F32(elm_min_broadcast_4D, -1, -1) \
+    else MATH_BROADCAST_4D_F32(elm_max_broadcast_4D, -1, -1) \
+    else COMPARE_BROADCAST_4D_F32(elm_equal_broadcast_4D, -1, -4) \
+    else COMPARE_BROADCAST_4D_F32(elm_notequal_broadcast_4D, -1, -4) \
+    else COMPARE_BROADCAST_4D_F32(elm_greater_broadcast_4D, -1, -4) \
+    else COMPARE_BROADCAST_4D_F32(elm_greaterequal_broadcast_4D, -1, -4) \
+    else COMPARE_BROADCAST_4D_F32(elm_less_broadcast_4D, -1, -4) \
+    else COMPARE_BROADCAST_4D_F32(elm_lessequal_broadcast_4D, -1, -4) \
     else MATH_BROADCAST_4D_ASYM8S(elm_squared_diff_broadcast_4D, -4, -4) \
     else SQUARED_DIFF_BROADCAST_4D_SYM16S(elm_squared_diff_broadcast_4D, -8, -8) \
+    else MUL_BROADCAST_4D_SYM16S_ASYM16S(elm_mul_broadcast_4D, -8, -7) \
+    else MINMAX_BROADCAST_4D(elm_min_broadcast_4D, -4, -4, 8) \
+    else MINMAX_BROADCAST_4D(elm_max_broadcast_4D, -4, -4, 8) \
+    else MINMAX_BROADCAST_4D(elm_min_broadcast_4D, 16, 16, 16) \
+    else MINMAX_BROADCAST_4D(elm_max_broadcast_4D, 16, 16, 16) \
+    else MINMAX_16(elm_min, 16, 16) \
+    else MINMAX_16(elm_max, 16, 16) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_equal_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_notequal_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_greater_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_greaterequal_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_less_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_lessequal_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_ASYM16S(elm_equal, -7, -4) \
+    else COMPARE_ASYM16S(elm_notequal, -7, -4) \
+    else COMPARE_ASYM16S(elm_greater, -7, -4) \
+    else COMPARE_ASYM16S(elm_greaterequal, -7, -4) \
+    else COMPARE_ASYM16S(elm_less, -7, -4) \
+    else COMPARE_ASYM16S(elm_lessequal, -7, -4) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_equal_broadcast_4D, -7, -4, WORD16, asym16s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_notequal_broadcast_4D, -7, -4, WORD16, asym16s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_greater_broadcast_4D, -7, -4, WORD16, asym16s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_greaterequal_broadcast_4D, -7, -4, WORD16, asym16s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_less_broadcast_4D, -7, -4, WORD16, asym16s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_lessequal_broadcast_4D, -7, -4, WORD16, asym16s) \
     else MINMAX_8(elm_min, -4, -4)\
     else MINMAX_8(elm_max, -4, -4)\
     else MINMAX_BCAST_8(elm_min_4D_Bcast, -4, -4)\
@@ -1298,6 +1485,31 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MATH_BROADCAST_4D_ASYM16S(elm_sub_broadcast_4D, -7, -7) \
     else MATH_BROADCAST_4D_ASYM8S(elm_squared_diff_broadcast_4D, -4, -4) \
     else SQUARED_DIFF_BROADCAST_4D_SYM16S(elm_squared_diff_broadcast_4D, -8, -8) \
+    else MUL_BROADCAST_4D_SYM16S_ASYM16S(elm_mul_broadcast_4D, -8, -7) \
+    else MINMAX_BROADCAST_4D(elm_min_broadcast_4D, -4, -4, 8) \
+    else MINMAX_BROADCAST_4D(elm_max_broadcast_4D, -4, -4, 8) \
+    else MINMAX_BROADCAST_4D(elm_min_broadcast_4D, 16, 16, 16) \
+    else MINMAX_BROADCAST_4D(elm_max_broadcast_4D, 16, 16, 16) \
+    else MINMAX_16(elm_min, 16, 16) \
+    else MINMAX_16(elm_max, 16, 16) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_equal_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_notequal_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_greater_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_greaterequal_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_less_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_lessequal_broadcast_4D, -4, -4, WORD8, asym8s) \
+    else COMPARE_ASYM16S(elm_equal, -7, -4) \
+    else COMPARE_ASYM16S(elm_notequal, -7, -4) \
+    else COMPARE_ASYM16S(elm_greater, -7, -4) \
+    else COMPARE_ASYM16S(elm_greaterequal, -7, -4) \
+    else COMPARE_ASYM16S(elm_less, -7, -4) \
+    else COMPARE_ASYM16S(elm_lessequal, -7, -4) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_equal_broadcast_4D, -7, -4, WORD16, asym16s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_notequal_broadcast_4D, -7, -4, WORD16, asym16s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_greater_broadcast_4D, -7, -4, WORD16, asym16s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_greaterequal_broadcast_4D, -7, -4, WORD16, asym16s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_less_broadcast_4D, -7, -4, WORD16, asym16s) \
+    else COMPARE_BROADCAST_4D_QUANT(elm_lessequal_broadcast_4D, -7, -4, WORD16, asym16s) \
     else MINMAX_8(elm_min, -4, -4)\
     else MINMAX_8(elm_max, -4, -4)\
     else MINMAX_BCAST_8(elm_min_4D_Bcast, -4, -4)\
@@ -1329,12 +1541,296 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else {  printf("unsupported basic operation\n"); return -1;}
 #endif
 
+/* Runs xa_nn_elm_add_out_stride_asym8sxasym8s_asym8s on concat_rows rows of
+ * the inputs into the middle slice of a concat (-concat_pad) and compares it
+ * with the packed elm_add output, returns 1 when it matches and the gaps are
+ * untouched. */
+static int check_elm_add_concat_slice(test_config_t *p_cfg, buf1D_t *p_inp1, buf1D_t *p_inp2, buf1D_t *p_out)
+{
+  int row_len = p_cfg->io_length / p_cfg->concat_rows;
+  int out_stride, err, match;
+  WORD8 *p_buf, *p_slice;
+
+  p_buf = create_concat_slice_buf(p_cfg->concat_rows, row_len, p_cfg->concat_pad, &p_slice, &out_stride);
+  if(p_buf == NULL)
+  {
+    return 0;
+  }
+  err = xa_nn_elm_add_out_stride_asym8sxasym8s_asym8s(p_slice, out_stride,
+      p_cfg->output_zero_bias, p_cfg->output_left_shift, p_cfg->output_multiplier,
+      p_cfg->output_activation_min, p_cfg->output_activation_max,
+      (WORD8 *)p_inp1->p, p_cfg->input1_zero_bias, p_cfg->input1_left_shift, p_cfg->input1_multiplier,
+      (WORD8 *)p_inp2->p, p_cfg->input2_zero_bias, p_cfg->input2_left_shift, p_cfg->input2_multiplier,
+      p_cfg->left_shift, p_cfg->concat_rows, row_len);
+  match = !err && check_concat_slice_buf(p_buf, (WORD8 *)p_out->p, p_cfg->concat_rows, row_len, p_cfg->concat_pad);
+  if(!match)
+  {
+    printf("out_stride elm_add output does not match elm_add\n");
+  }
+
+  free(p_buf);
+  return match;
+}
+
+/* Runs xa_nn_elm_epilogue_asym8s on a copy of input 1, as conv output with
+ * zero bias -input1_zero_bias, with input 2 as the residual and a table
+ * that negates (out = -1 - in). The result must be the table applied to
+ * the elm_add output. A second pass without residual checks the clamp and
+ * table alone. Returns 1 when both match. */
+static int check_elm_epilogue(test_config_t *p_cfg, buf1D_t *p_inp1, buf1D_t *p_inp2, buf1D_t *p_out)
+{
+  int n = p_cfg->io_length;
+  int i, err, match = 1;
+  WORD8 lut[256];
+  WORD8 *p_buf;
+  const WORD8 *p_a = (const WORD8 *)p_inp1->p;
+  const WORD8 *p_add = (const WORD8 *)p_out->p;
+  xa_nn_epilogue_asym8s_t epilogue;
+
+  p_buf = (WORD8 *)malloc(n);
+  if(p_buf == NULL)
+  {
+    return 0;
+  }
+  for(i = 0; i < 256; i++)
+  {
+    lut[i] = (WORD8)(127 - i);
+  }
+
+  epilogue.out_activation_min = p_cfg->output_activation_min;
+  epilogue.out_activation_max = p_cfg->output_activation_max;
+  epilogue.residual_zero_bias = p_cfg->input2_zero_bias;
+  epilogue.residual_left_shift = p_cfg->input2_left_shift;
+  epilogue.residual_multiplier = p_cfg->input2_multiplier;
+  epilogue.inp1_left_shift = p_cfg->input1_left_shift;
+  epilogue.inp1_multiplier = p_cfg->input1_multiplier;
+  epilogue.left_shift = p_cfg->left_shift;
+  epilogue.out_zero_bias = p_cfg->output_zero_bias;
+  epilogue.out_left_shift = p_cfg->output_left_shift;
+  epilogue.out_multiplier = p_cfg->output_multiplier;
+  epilogue.p_lut = lut;
+
+  memcpy(p_buf, p_a, n);
+  err = xa_nn_elm_epilogue_asym8s(p_buf, n, (const WORD8 *)p_inp2->p, n, -p_cfg->input1_zero_bias, 1, n, &epilogue);
+  for(i = 0; i < n && !err; i++)
+  {
+    if(p_buf[i] != lut[p_add[i] + 128])
+      break;
+  }
+  if(err || i < n)
+  {
+    printf("epilogue with residual does not match elm_add\n");
+    match = 0;
+  }
+
+  memcpy(p_buf, p_a, n);
+  err = xa_nn_elm_epilogue_asym8s(p_buf, n, NULL, 0, -p_cfg->input1_zero_bias, 1, n, &epilogue);
+  for(i = 0; i < n && !err; i++)
+  {
+    int val = p_a[i];
+    val = val < p_cfg->output_activation_min ? p_cfg->output_activation_min : val;
+    val = val > p_cfg->output_activation_max ? p_cfg->output_activation_max : val;
+    if(p_buf[i] != lut[val + 128])
+      break;
+  }
+  if(err || i < n)
+  {
+    printf("epilogue clamp and table output is wrong\n");
+    match = 0;
+  }
+
+  free(p_buf);
+  return match;
+}
+
+/* Kernels that take output and input shapes, xa_nn_elm_*_broadcast_4D_* */
+static int is_broadcast_4D_kernel(const char *kernel_name)
+{
+  const char *p_sfx = strstr(kernel_name, "_broadcast_4D");
+  return (p_sfx != NULL) && (strcmp(p_sfx, "_broadcast_4D") == 0);
+}
+
+/* Scalar reference for the f32 and 16-bit min/max, the f32 compares and the
+ * asym16s compares, flat and broadcast_4D */
+enum { REF_MIN, REF_MAX, REF_EQUAL, REF_NOTEQUAL, REF_GREATER, REF_GREATEREQUAL, REF_LESS, REF_LESSEQUAL };
+
+static int scalar_ref_op(const char *kernel_name)
+{
+  static const char *names[] = {"elm_min", "elm_max", "elm_equal", "elm_notequal",
+    "elm_greater", "elm_greaterequal", "elm_less", "elm_lessequal"};
+  char base[MAX_KERNEL_NAME_LENGTH];
+  const char *p_sfx = strstr(kernel_name, "_broadcast_4D");
+  int i, len = p_sfx ? (int)(p_sfx - kernel_name) : (int)strlen(kernel_name);
+
+  if(p_sfx && strcmp(p_sfx, "_broadcast_4D"))
+    return -1;
+  if(len >= MAX_KERNEL_NAME_LENGTH)
+    return -1;
+  memcpy(base, kernel_name, len);
+  base[len] = 0;
+  for(i = 0; i < (int)(sizeof(names)/sizeof(names[0])); i++)
+  {
+    if(!strcmp(base, names[i]))
+      return i;
+  }
+  return -1;
+}
+
+/* Kernels checked by check_elm_scalar_ref */
+static int has_scalar_ref(test_config_t *p_cfg)
+{
+  int op = scalar_ref_op(p_cfg->kernel_name);
+  if(op < 0)
+    return 0;
+  if(op <= REF_MAX)
+    return (p_cfg->inp_precision == -1 && p_cfg->out_precision == -1) ||
+           (p_cfg->inp_precision == 16 && p_cfg->out_precision == 16);
+  return (p_cfg->inp_precision == -1 || p_cfg->inp_precision == -7) && (p_cfg->out_precision == -4);
+}
+
+/* (val * multiplier) scaled by 2^shift as MPY_BY_QUANT_MULT_ST_ONE_EXP_X2_OUT32,
+ * double_round selects the TFLITE_SINGLE_ROUNDING=0 variant */
+static int ref_mult_by_quant(int val, int multiplier, int shift, int double_round)
+{
+  long long prod = (long long)val * multiplier;
+  long long res;
+
+  if(double_round)
+  {
+    /* Saturating rounding doubling high multiply, then a symmetric rounding shift */
+    res = ((prod * 2) + (1LL << 31)) >> 32;
+    if(shift >= 0)
+    {
+      res = shift > 31 ? (res ? (res > 0 ? LLONG_MAX : LLONG_MIN) : 0) : res * (1LL << shift);
+    }
+    else
+    {
+      long long half = 1LL << (-shift - 1);
+      res = res >= 0 ? (res + half) >> -shift : -((-res + half) >> -shift);
+    }
+  }
+  else
+  {
+    /* One 64 bit shift, then an asymmetric rounding of the top half */
+    int sh = 1 + shift;
+    if(sh >= 0)
+    {
+      if(prod != 0 && (sh > 62 || llabs(prod) > (LLONG_MAX >> sh)))
+        prod = prod > 0 ? LLONG_MAX : LLONG_MIN;
+      else
+        prod = prod * (1LL << sh);
+    }
+    else
+    {
+      prod >>= -sh;
+    }
+    res = (prod >= LLONG_MAX - (1LL << 31)) ? (LLONG_MAX >> 32) : ((prod + (1LL << 31)) >> 32);
+  }
+  res = res > 2147483647LL ? 2147483647LL : (res < -2147483648LL ? -2147483648LL : res);
+  return (int)res;
+}
+
+static int ref_dequantize_asym16s(int val, int zero_bias, int left_shift, int multiplier, int shift, int double_round)
+{
+  long long v = (long long)(val + zero_bias) * (1LL << left_shift);
+  v = v > 2147483647LL ? 2147483647LL : (v < -2147483648LL ? -2147483648LL : v);
+  return ref_mult_by_quant((int)v, multiplier, shift, double_round);
+}
+
+static int ref_compare(int op, double a, double b)
+{
+  switch(op)
+  {
+    case REF_EQUAL:        return a == b;
+    case REF_NOTEQUAL:     return a != b;
+    case REF_GREATER:      return a > b;
+    case REF_GREATEREQUAL: return a >= b;
+    case REF_LESS:         return a < b;
+    default:               return a <= b;
+  }
+}
+
+/* Input offset of output index idx, size 1 dims of the input are broadcast */
+static int ref_bcast_offset(int idx, const int *p_out_shape, const int *p_inp_shape)
+{
+  int d, offset = 0, stride = 1;
+  for(d = 3; d >= 0; d--)
+  {
+    int coord = idx % p_out_shape[d];
+    idx /= p_out_shape[d];
+    if(p_inp_shape[d] != 1)
+      offset += coord * stride;
+    stride *= p_inp_shape[d];
+  }
+  return offset;
+}
+
+static int check_elm_scalar_ref(test_config_t *p_cfg, buf1D_t *p_inp1, buf1D_t *p_inp2, buf1D_t *p_out)
+{
+  int op = scalar_ref_op(p_cfg->kernel_name);
+  int bcast = is_broadcast_4D_kernel(p_cfg->kernel_name);
+  int n = bcast ? p_out->length : p_cfg->io_length;
+  int i, i1, i2;
+
+  for(i = 0; i < n; i++)
+  {
+    i1 = bcast ? ref_bcast_offset(i, p_cfg->output_shape, p_cfg->input1_shape) : i;
+    i2 = bcast ? ref_bcast_offset(i, p_cfg->output_shape, p_cfg->input2_shape) : i;
+    if(p_cfg->inp_precision == -1)
+    {
+      float a = ((FLOAT32 *)p_inp1->p)[i1], b = ((FLOAT32 *)p_inp2->p)[i2];
+      if(op <= REF_MAX)
+      {
+        float ref = (op == REF_MIN) ? (a < b ? a : b) : (a > b ? a : b);
+        if(((FLOAT32 *)p_out->p)[i] != ref)
+          break;
+      }
+      else if(((WORD8 *)p_out->p)[i] != ref_compare(op, a, b))
+        break;
+    }
+    else if(p_cfg->inp_precision == 16)
+    {
+      int a = ((WORD16 *)p_inp1->p)[i1], b = ((WORD16 *)p_inp2->p)[i2];
+      int ref = (op == REF_MIN) ? (a < b ? a : b) : (a > b ? a : b);
+      if(((WORD16 *)p_out->p)[i] != ref)
+        break;
+    }
+    else
+    {
+      int a = ((WORD16 *)p_inp1->p)[i1], b = ((WORD16 *)p_inp2->p)[i2];
+      int out = ((WORD8 *)p_out->p)[i];
+      int r, match = 0;
+      /* The rounding mode is a library build option, either one is accepted */
+      for(r = 0; r < 2 && !match; r++)
+      {
+        int da = ref_dequantize_asym16s(a, p_cfg->input1_zero_bias, p_cfg->left_shift,
+            p_cfg->input1_multiplier, p_cfg->input1_left_shift, r);
+        int db = ref_dequantize_asym16s(b, p_cfg->input2_zero_bias, p_cfg->left_shift,
+            p_cfg->input2_multiplier, p_cfg->input2_left_shift, r);
+        match = (out == ref_compare(op, da, db));
+      }
+      if(!match)
+        break;
+    }
+  }
+  if(i < n)
+  {
+    printf("%s output %d does not match the scalar reference\n", p_cfg->kernel_name, i);
+    return 0;
+  }
+  return 1;
+}
+
 int xa_nn_main_process(int argc, char *argv[])
 {
 
   int frame;
   int err = 0;
   int pass_count=0;
+  int frame_pass;
+  int slice_check;
+  int epilogue_check;
+  int ref_check;
   char profiler_name[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
 
@@ -1375,6 +1871,9 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
+  // Benchmark mode, random data is generated in place of reading the input file
+  bench_mode_config(cfg.bench, cfg.warmup, &cfg.write_file, &cfg.verify, &cfg.frames);
+
   /* Calculating input and output lengths from respective shapes for Reduce/Broadcast ops */
   int inp_length = 1, out_length = 1;
   int inp1_length = 1, inp2_length = 1;
@@ -1436,6 +1935,14 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     sprintf(profiler_name, "%s_8_8", cfg.kernel_name);
   }
+  else if(cfg.inp_precision == 16 && cfg.out_precision == 16)
+  {
+    sprintf(profiler_name, "%s_16_16", cfg.kernel_name);
+  }
+  else if(cfg.inp_precision == -8 && cfg.out_precision == -7)
+  {
+    sprintf(profiler_name, "%s_sym16s_asym16s", cfg.kernel_name);
+  }
   else if(cfg.inp_precision == 16 && cfg.out_precision == -4)
   {
     sprintf(profiler_name, "%s_16x16_asym8s", cfg.kernel_name);
@@ -1483,10 +1990,7 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     sprintf(profiler_params, "N=%d\n", out_length);
   }
-  else if( !strcmp(cfg.kernel_name, "elm_add_broadcast_4D") ||
-           !strcmp(cfg.kernel_name, "elm_sub_broadcast_4D") ||
-           !strcmp(cfg.kernel_name, "elm_mul_broadcast_4D") ||
-           !strcmp(cfg.kernel_name, "elm_squared_diff_broadcast_4D"))
+  else if( is_broadcast_4D_kernel(cfg.kernel_name) )
   {
     sprintf(profiler_params, "output_shape= %s input1_shape= %s input2_shape= %s\n", cfg.read_out_shape_str, cfg.read_inp1_shape_str, cfg.read_inp2_shape_str);
   }
@@ -1526,9 +2030,9 @@ int xa_nn_main_process(int argc, char *argv[])
       /* If write_file (generate test vectors) is enabled, random data would be generated and
         used; the input data and output data generated would be written into files. 
       */
-	    fptr_inp1 = file_open(pb_input_file_path, cfg.write_inp1_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+	    fptr_inp1 = bench_file_open(cfg.bench, pb_input_file_path, cfg.write_inp1_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
       if(!single_input_kernel)
-        fptr_inp2 = file_open(pb_input_file_path, cfg.write_inp2_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+        fptr_inp2 = bench_file_open(cfg.bench, pb_input_file_path, cfg.write_inp2_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
     }
     else
     {
@@ -1542,7 +2046,7 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   // Open output file
-	fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+  fptr_out = bench_file_open(cfg.bench, pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
 
   // Open reference file if verify flag is enabled
   if(cfg.verify)
@@ -1558,10 +2062,7 @@ int xa_nn_main_process(int argc, char *argv[])
              !strcmp(cfg.kernel_name, "elm_min_8D_Bcast")     ||
              !strcmp(cfg.kernel_name, "elm_max_8D_Bcast")     ||
              !strcmp(cfg.kernel_name, "broadcast")            ||
-             !strcmp(cfg.kernel_name, "elm_add_broadcast_4D") ||
-             !strcmp(cfg.kernel_name, "elm_sub_broadcast_4D") ||
-             !strcmp(cfg.kernel_name, "elm_mul_broadcast_4D") ||
-             !strcmp(cfg.kernel_name, "elm_squared_diff_broadcast_4D"))
+             is_broadcast_4D_kernel(cfg.kernel_name))
     {
       ptr_ref =  create_buf1D(out_length, cfg.out_precision); 
     }
@@ -1619,19 +2120,17 @@ int xa_nn_main_process(int argc, char *argv[])
   else if( !strcmp(cfg.kernel_name, "broadcast")) {
     p_inp1 = create_buf1D(inp_length, cfg.inp_precision); VALIDATE_PTR(p_inp1);
   }
-  else if( !strcmp(cfg.kernel_name, "elm_add_broadcast_4D") || 
-           !strcmp(cfg.kernel_name, "elm_sub_broadcast_4D") || 
-           !strcmp(cfg.kernel_name, "elm_mul_broadcast_4D") || 
-           !strcmp(cfg.kernel_name, "elm_squared_diff_broadcast_4D") )
+  else if( is_broadcast_4D_kernel(cfg.kernel_name) )
   {
     p_inp1 = create_buf1D(inp1_length, cfg.inp_precision); VALIDATE_PTR(p_inp1);
     p_inp2 = create_buf1D(inp2_length, cfg.inp_precision); VALIDATE_PTR(p_inp2);
   }
   else
   {
-	  if(fptr_inp1)
+	  // No input files in bench mode, the buffers are still needed for the random data
+	  if(fptr_inp1 || cfg.bench)
 		  { p_inp1 = create_buf1D(cfg.io_length * cfg.vec_count, cfg.inp_precision); VALIDATE_PTR(p_inp1); }
-	  if(fptr_inp2)
+	  if(fptr_inp2 || (cfg.bench && !single_input_kernel))
 		  { p_inp2 = create_buf1D(cfg.io_length * cfg.vec_count, cfg.inp_precision); VALIDATE_PTR(p_inp2); }
   }
   // Allocate memory for output buffers
@@ -1646,10 +2145,7 @@ int xa_nn_main_process(int argc, char *argv[])
            !strcmp(cfg.kernel_name, "elm_min_8D_Bcast")     ||
            !strcmp(cfg.kernel_name, "elm_max_8D_Bcast")     ||
            !strcmp(cfg.kernel_name, "broadcast")            ||
-           !strcmp(cfg.kernel_name, "elm_add_broadcast_4D") ||
-           !strcmp(cfg.kernel_name, "elm_sub_broadcast_4D") ||
-           !strcmp(cfg.kernel_name, "elm_mul_broadcast_4D") ||
-           !strcmp(cfg.kernel_name, "elm_squared_diff_broadcast_4D") )
+           is_broadcast_4D_kernel(cfg.kernel_name) )
   {
     p_out = create_buf1D(out_length, cfg.out_precision); VALIDATE_PTR(p_out);
   }
@@ -1718,10 +2214,7 @@ int xa_nn_main_process(int argc, char *argv[])
            !strcmp(cfg.kernel_name, "elm_min_8D_Bcast")     ||
            !strcmp(cfg.kernel_name, "elm_max_8D_Bcast")     ||
            !strcmp(cfg.kernel_name, "broadcast")            ||
-           !strcmp(cfg.kernel_name, "elm_add_broadcast_4D") ||
-           !strcmp(cfg.kernel_name, "elm_sub_broadcast_4D") ||
-           !strcmp(cfg.kernel_name, "elm_mul_broadcast_4D") ||
-           !strcmp(cfg.kernel_name, "elm_squared_diff_broadcast_4D") )
+           is_broadcast_4D_kernel(cfg.kernel_name) )
   {
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, out_length, "cyc/point", 0);
   }
@@ -1733,6 +2226,18 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, cfg.io_length * cfg.vec_count, "cyc/point", 0);
   }
+  XTPWR_PROFILER_BYTES(0, (p_inp1 ? BUF1D_BYTES(p_inp1) : 0) + (p_inp2 ? BUF1D_BYTES(p_inp2) : 0) + BUF1D_BYTES(p_out));
+  XTPWR_PROFILER_WARMUP(0, cfg.warmup);
+
+  // out_stride elm_add writing into a concat is checked against the output
+  slice_check = (cfg.concat_pad > 0) && !strcmp(cfg.kernel_name, "elm_add") &&
+    (cfg.inp_precision == -4) && (cfg.out_precision == -4) &&
+    (cfg.concat_rows > 0) && (cfg.io_length % cfg.concat_rows == 0);
+  // The conv/FC epilogue with the inputs as conv output and residual
+  epilogue_check = !strcmp(cfg.kernel_name, "elm_add") &&
+    (cfg.inp_precision == -4) && (cfg.out_precision == -4);
+  // Kernels with a scalar reference in the testbench
+  ref_check = has_scalar_ref(&cfg);
   
   // Frame processing loop
   for(frame = 0; frame < cfg.frames; frame++)
@@ -1763,18 +2268,33 @@ int xa_nn_main_process(int argc, char *argv[])
     write_buf1D_to_file(fptr_out, p_out);
 
     // If verify flag enabled, compare output against reference
+    frame_pass = 0;
     if(cfg.verify)
     {
       if(-1 != read_buf1D_from_file(fptr_ref, ptr_ref))
-        pass_count += compare_buf1D(ptr_ref, p_out, cfg.verify, cfg.out_precision, 1);
+        frame_pass = compare_buf1D(ptr_ref, p_out, cfg.verify, cfg.out_precision, 1);
     }
     else
     {
-      pass_count += !err;
+      frame_pass = !err;
+    }
+    if(slice_check)
+    {
+      frame_pass = frame_pass && check_elm_add_concat_slice(&cfg, p_inp1, p_inp2, p_out);
+    }
+    if(epilogue_check)
+    {
+      frame_pass = frame_pass && check_elm_epilogue(&cfg, p_inp1, p_inp2, p_out);
+    }
+    if(ref_check)
+    {
+      frame_pass = frame_pass && check_elm_scalar_ref(&cfg, p_inp1, p_inp2, p_out);
     }
+    pass_count += frame_pass;
   }
 
-  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), cfg.verify);
+  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), (cfg.verify || slice_check || epilogue_check || ref_check));
+  XTPWR_PROFILER_PATHS();
 
   if(fptr_inp1)
   	  fclose(fptr_inp1);
@@ -28,6 +28,7 @@
 #include "nnlib/xa_nnlib_api.h"
 #include "nnlib/xa_nnlib_cnn_api.h"
 #include "xt_manage_buffers.h"
+#include "xt_bench_mode.h"
 #include "cmdline_parser.h"
 #include "file_io.h"
 #include "xa_nnlib_standards.h"
@@ -163,6 +164,9 @@ static inline void error_code_parse(int error_code)
     case XA_NNLIB_CNN_CONFIG_FATAL_INVALID_INPUT_SHAPE:
       printf("\nInvalid input shape, Exiting\n");
       break;
+    case XA_NNLIB_CNN_CONFIG_FATAL_INVALID_TILE_HEIGHT:
+      printf("\nInvalid depthwise separable tile height, Exiting\n");
+      break;
     case XA_NNLIB_CNN_EXECUTE_FATAL_INVALID_INPUT_SHAPE:
       printf("\nInput shape mismatch during execution, Exiting\n");
       break;
@@ -196,6 +200,7 @@ typedef struct _test_config_t
   int bias_shift;
   int acc_shift;
   int out_data_format;
+  int ds_tile_height;
   int inp_precision;
   int kernel_precision;
   int out_precision;
@@ -203,6 +208,8 @@ typedef struct _test_config_t
   char kernel_name[MAX_KERNEL_NAME_LENGTH];
   int frames;
   int write_file;
+  int bench;
+  int warmup;
   char read_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
   char read_ref_file_name[XA_MAX_CMD_LINE_LENGTH];
   char write_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
@@ -232,6 +239,7 @@ int default_config(test_config_t *p_cfg)
     p_cfg->bias_shift = 7;
     p_cfg->acc_shift = -7;
     p_cfg->out_data_format = 0;
+    p_cfg->ds_tile_height = 0;
     p_cfg->inp_precision = 16;
     p_cfg->kernel_precision = 8;
     p_cfg->out_precision = 16;
@@ -239,6 +247,8 @@ int default_config(test_config_t *p_cfg)
     strcpy(p_cfg->kernel_name, "conv2d_std");
     p_cfg->frames   = 2;  
     p_cfg->write_file = 0;  
+    p_cfg->bench = 0;
+    p_cfg->warmup = 0;
     p_cfg->read_inp_file_name[0] = '\0';
     p_cfg->read_ref_file_name[0] = '\0';
     p_cfg->write_inp_file_name[0]='\0';
@@ -272,6 +282,7 @@ void show_usage(void)
     printf("\t-bias_shift: bias left shift; Default=7\n");
     printf("\t-acc_shift: accumulator left shift; Default=-7\n");
     printf("\t-out_data_format: Output data format, 0 (DWH), 1 (WHD); Default=0 (DWH)\n");
+    printf("\t-ds_tile_height: conv2d_depth output rows per fused depthwise+pointwise pass, 0 (auto), >= out_height (unfused); Default=0\n");
     printf("\t-inp_precision: 8, 16, -1(single prec float); Default=16\n");
     printf("\t-kernel_precision: 8, 16, -1(single prec float); Default=8\n");
     printf("\t-out_precision: 8, 16, -1(single prec float); Default=16\n");
@@ -279,6 +290,8 @@ void show_usage(void)
     printf("\t-frames: Positive number; Default=2\n");
     printf("\t-kernel_name: conv2d_std, conv2d_depth, conv1d_std; Default="" : conv2d_std\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
+    printf("\t-bench: set to 1 to profile on random inputs, no input/output/reference files are used; Default=0\n");
+    printf("\t-warmup: frames run before the profiled frames, not included in the profile; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - inp, kernel, bias, (kernel_point, bias_point for conv2d_depth kernel)) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
     printf("\t-write_inp_file_name: Full filename for writing inputs (order - inp, kernel, bias, (kernel_point, bias_point for conv2d_depth kernel)) \n");
@@ -317,6 +330,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-bias_shift",p_cfg->bias_shift);
     ARGTYPE_ONETIME_CONFIG("-acc_shift",p_cfg->acc_shift);
     ARGTYPE_ONETIME_CONFIG("-out_data_format",p_cfg->out_data_format);
+    ARGTYPE_ONETIME_CONFIG("-ds_tile_height",p_cfg->ds_tile_height);
     ARGTYPE_ONETIME_CONFIG("-inp_precision",p_cfg->inp_precision);
     ARGTYPE_ONETIME_CONFIG("-kernel_precision",p_cfg->kernel_precision);
     ARGTYPE_ONETIME_CONFIG("-out_precision",p_cfg->out_precision);
@@ -324,6 +338,8 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_STRING("-kernel_name",p_cfg->kernel_name, MAX_KERNEL_NAME_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
     ARGTYPE_ONETIME_CONFIG("-write_file",p_cfg->write_file);
+    ARGTYPE_ONETIME_CONFIG("-bench",p_cfg->bench);
+    ARGTYPE_ONETIME_CONFIG("-warmup",p_cfg->warmup);
     ARGTYPE_STRING("-read_inp_file_name",p_cfg->read_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-read_ref_file_name",p_cfg->read_ref_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-write_inp_file_name",p_cfg->write_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
@@ -342,7 +358,7 @@ int map_test_cfg_to_cnn_cfg(test_config_t *p_cfg, xa_nnlib_cnn_init_config_t *cn
 
     if (p_cfg && cnn_cfg)
     {
-        memset(cnn_cfg, 0, sizeof(xa_nnlib_cnn_init_config_t));
+        xa_nnlib_cnn_init_config(cnn_cfg);
 
         if      (!strcmp(p_cfg->kernel_name,"conv1d_std"))   cnn_cfg->algo = XA_NNLIB_CNN_CONV1D_STD;  
         else if (!strcmp(p_cfg->kernel_name,"conv2d_std"))   cnn_cfg->algo = XA_NNLIB_CNN_CONV2D_STD;  
@@ -361,6 +377,7 @@ int map_test_cfg_to_cnn_cfg(test_config_t *p_cfg, xa_nnlib_cnn_init_config_t *cn
         cnn_cfg->output_width    = p_cfg->out_width;
         cnn_cfg->output_channels = p_cfg->out_channels;
         cnn_cfg->output_format   = p_cfg->out_data_format;
+        cnn_cfg->ds_tile_height  = p_cfg->ds_tile_height;
         
 
         if(!strcmp(p_cfg->kernel_name,"conv1d_std"))
@@ -482,6 +499,9 @@ int xa_nn_main_process(int argc, char *argv[])
       return 0;
     }
   }
+
+  // Benchmark mode, random data is generated in place of reading the input file
+  bench_mode_config(cfg.bench, cfg.warmup, &cfg.write_file, &cfg.verify, &cfg.frames);
   map_test_cfg_to_cnn_cfg(&cfg, &cnn_cfg);
  
 
@@ -576,7 +596,7 @@ int xa_nn_main_process(int argc, char *argv[])
     /* If write_file (generate test vectors) is enabled, random data would be generated and
        used; the input data and output data generated would be written into files. 
      */
-    fptr_inp = file_open(pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+    fptr_inp = bench_file_open(cfg.bench, pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
   }
   else
   {
@@ -587,7 +607,7 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   // Open output file
-  fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+  fptr_out = bench_file_open(cfg.bench, pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
 
   // Open reference file if verify flag is enabled
   if(cfg.verify)
@@ -628,6 +648,15 @@ int xa_nn_main_process(int argc, char *argv[])
        );
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, total_MACS, "MACs/cyc", 1);
   }
+  if(!strcmp(cfg.kernel_name,"conv2d_depth"))
+  {
+    XTPWR_PROFILER_BYTES(0, BUF1D_BYTES(p_inp) + BUF2D_BYTES(p_kernel) + BUF1D_BYTES(p_bias) + BUF1D_BYTES(p_kernel_point) + BUF1D_BYTES(p_bias_point) + 2 * BUF1D_BYTES(p_dw_out) + BUF1D_BYTES(p_out));
+  }
+  else
+  {
+    XTPWR_PROFILER_BYTES(0, BUF1D_BYTES(p_inp) + BUF2D_BYTES(p_kernel) + BUF1D_BYTES(p_bias) + BUF1D_BYTES(p_out));
+  }
+  XTPWR_PROFILER_WARMUP(0, cfg.warmup);
 
   /* Initialization Loop */
   {
@@ -755,8 +784,8 @@ int xa_nn_main_process(int argc, char *argv[])
 
   XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), cfg.verify);
 
-  fclose(fptr_inp);
-  fclose(fptr_out);
+  bench_file_close(fptr_inp);
+  bench_file_close(fptr_out);
 
   // Free all buffers
   free_buf1D(p_inp);
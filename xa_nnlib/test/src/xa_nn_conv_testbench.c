@@ -27,6 +27,7 @@
 #include "xa_type_def.h"
 #include "nnlib/xa_nnlib_api.h"
 #include "xt_manage_buffers.h"
+#include "xt_bench_mode.h"
 #include "cmdline_parser.h"
 #include "file_io.h"
 #include "xa_nnlib_standards.h"
@@ -87,6 +88,8 @@ typedef struct _test_config_t
   char kernel_name[MAX_KERNEL_NAME_LENGTH];
   int frames;
   int write_file;
+  int bench;
+  int warmup;
   char read_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
   char read_ref_file_name[XA_MAX_CMD_LINE_LENGTH];
   char write_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
@@ -96,6 +99,9 @@ typedef struct _test_config_t
   int dilation_width;
   int pointwise_profile_only;
   int groups;
+  int prepacked;
+  int concat_pad;
+  int epilogue;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -136,6 +142,8 @@ int default_config(test_config_t *p_cfg)
     strcpy(p_cfg->kernel_name, "conv2d_std");
     p_cfg->frames   = 2;  
     p_cfg->write_file = 0;  
+    p_cfg->bench = 0;
+    p_cfg->warmup = 0;
     p_cfg->read_inp_file_name[0] = '\0';
     p_cfg->read_ref_file_name[0] = '\0';
     p_cfg->write_inp_file_name[0]='\0';
@@ -145,6 +153,9 @@ int default_config(test_config_t *p_cfg)
     p_cfg->dilation_width = 1;
     p_cfg->pointwise_profile_only = 0;
     p_cfg->groups = 1;
+    p_cfg->prepacked = 0;
+    p_cfg->concat_pad = 0;
+    p_cfg->epilogue = 0;
     return 0;
   }
   else
@@ -190,11 +201,17 @@ void show_usage(void)
     printf("\t-kernel_name: conv2d_std, dilated_conv2d_std, conv2d_depth, dilated_conv2d_depth, conv2d_point, conv1d_std, transpose_conv , conv2d; Default="" : conv2d_std\n");
     printf("\t-pointwise_profile_only: Applicable only when kernel_name is conv2d_depth, 0 (print conv2d depthwise and pointwise profile info), 1(print only conv2d pointwise profile info); Default=0\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
+    printf("\t-bench: set to 1 to profile on random inputs, no input/output/reference files are used; Default=0\n");
+    printf("\t-warmup: frames run before the profiled frames, not included in the profile; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable)) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
     printf("\t-write_inp_file_name: Full filename for writing inputs (order - input, kernel, bias, (pointwise kernel, pointwise bias for depth separable)) \n");
     printf("\t-write_out_file_name: Full filename for writing output \n");
     printf("\t-verify: Verify output against provided reference; 0: Disable, 1: Bitexact match; Default=1\n");
+    printf("\t-prepacked: Applicable only when kernel_name is conv2d_std, or conv2d with sym8sxasym8s, 1 (prepack the kernel and run the prepacked kernel, output is also checked bitexact against the non-prepacked kernel); Default=0\n");
+    printf("\t       conv2d with sym8sxasym8s is always checked bitexact against conv2d_std run per group\n");
+    printf("\t-concat_pad: Applicable only for conv2d_std and conv2d_depth with sym8sxasym8s and NHWC data, >0 (also run the out_stride kernels into the middle of a channel concat with concat_pad channels on each side, checked against the output); Default=0\n");
+    printf("\t-epilogue: Applicable only for conv2d_std and conv2d_depth with sym8sxasym8s and NHWC data, 0 or 1 (also run the _epilogue_ kernels with a residual add, clamp and table, checked against the output followed by xa_nn_elm_add_asym8sxasym8s_asym8s and xa_nn_vec_lut_asym8s_asym8s); Default=0\n");
 }
 
 void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
@@ -243,6 +260,8 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_STRING("-kernel_name",p_cfg->kernel_name, MAX_KERNEL_NAME_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
     ARGTYPE_ONETIME_CONFIG("-write_file",p_cfg->write_file);
+    ARGTYPE_ONETIME_CONFIG("-bench",p_cfg->bench);
+    ARGTYPE_ONETIME_CONFIG("-warmup",p_cfg->warmup);
     ARGTYPE_STRING("-read_inp_file_name",p_cfg->read_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-read_ref_file_name",p_cfg->read_ref_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-write_inp_file_name",p_cfg->write_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
@@ -251,6 +270,9 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-dilation_height",p_cfg->dilation_height);
     ARGTYPE_ONETIME_CONFIG("-dilation_width",p_cfg->dilation_width);
     ARGTYPE_ONETIME_CONFIG("-pointwise_profile_only",p_cfg->pointwise_profile_only);
+    ARGTYPE_ONETIME_CONFIG("-prepacked",p_cfg->prepacked);
+    ARGTYPE_ONETIME_CONFIG("-concat_pad",p_cfg->concat_pad);
+    ARGTYPE_ONETIME_CONFIG("-epilogue",p_cfg->epilogue);
 
     // If arg doesnt match with any of the above supported options, report option as invalid
     printf("Invalid argument: %s\n",argv[argidx]);
@@ -272,6 +294,64 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define CONV_PREPACKED_KERNEL_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_##KPREC##x##IPREC ( \
+        (WORD##OPREC *)p_out->p, (WORD##IPREC *) p_inp->p, p_prepacked, (WORD##BPREC *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.bias_shift, cfg.acc_shift, cfg.out_data_format, p_scratch_prepacked);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define CONV_PREPACKED_KERNEL_ASYM8_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_asym8uxasym8u ( \
+        (UWORD8 *)p_out->p, (UWORD8 *) p_inp->p, p_prepacked, (WORD32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.input_zero_bias, cfg.kernel_zero_bias, cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias, \
+        cfg.out_data_format, p_scratch_prepacked);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define CONV_PREPACKED_KERNEL_PC_FN(KERNEL, SUFFIX, KPREC, IPREC, OPREC, BPREC, OTYPE, ITYPE, BTYPE, ZB_IN, ZB_OUT) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_per_chan_##SUFFIX ( \
+        (OTYPE *)p_out->p, (ITYPE *) p_inp->p, p_prepacked, (BTYPE *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        ZB_IN, cfg.p_out_multiplier, cfg.p_out_shift, ZB_OUT, \
+        cfg.out_data_format, p_scratch_prepacked);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define CONV_GROUP_PREPACKED_KERNEL_SYM8S_PC_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_group_prepacked_per_chan_sym8sxasym8s ( \
+        (WORD8 *)p_out->p, (WORD8 *) p_inp->p, p_prepacked, (WORD32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width,cfg.kernel_channels,cfg.dilation_height,cfg.dilation_width,cfg.out_channels, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.input_zero_bias,cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias, \
+        cfg.out_data_format, p_scratch_prepacked);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define CONV_PREPACKED_KERNEL_F_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
+  ((KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_f32 ( \
+        (FLOAT32 *)p_out->p, (FLOAT32 *) p_inp->p, p_prepacked, (FLOAT32 *)p_bias->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.out_data_format, p_scratch_prepacked);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #define CONV_KERNEL_ASYM8_FN(KERNEL, KPREC, IPREC, OPREC, BPREC) \
   (!strcmp(cfg.kernel_name,#KERNEL) && (KPREC == p_kernel->precision) && (IPREC == p_inp->precision) && (OPREC == p_out->precision) && (BPREC == p_bias->precision)) {\
     XTPWR_PROFILER_START(0);\
@@ -641,7 +721,6 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     } \
 
 #if HIFI_VFPU
-#if HIFI_HP_VFPU && hifi5
 #define PROCESS_CONV \
     if CONV_KERNEL_FN(conv2d_std, 8, 16, 16, 16) \
     else if CONV_KERNEL_FN(conv2d_std, 8, 8, 8, 8) \
@@ -675,41 +754,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else if CONV1D_KERNEL_ASYM8_FN(conv1d_std, -3, -3, -3, 32) \
     else if CONV1D_KERNEL_F_FN(conv1d_std, -1, -1, -1, -1) \
     else {printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
-#else /* HIFI_HP_VFPU  && hifi5 */
-#define PROCESS_CONV \
-    if CONV_KERNEL_FN(conv2d_std, 8, 16, 16, 16) \
-    else if CONV_KERNEL_FN(conv2d_std, 8, 8, 8, 8) \
-    else if CONV_KERNEL_FN(conv2d_std, 16, 16, 16, 16) \
-    else if CONV_KERNEL_ASYM8_FN(conv2d_std, -3, -3, -3, 32) \
-    else if CONV_KERNEL_SYM8S_PC_FN(conv2d_std,-5,-4,-4, 32) \
-    else if CONV_KERNEL_SYM4S_PC_FN(conv2d_std,-12,-4,-4, 32) \
-    else if CONV_UN_KERNEL_SYM8S_PC_FN(conv2d,-5,-4,-4, 32) \
-    else if CONV_UN_KERNEL_SYM8SXSYM16S_PC_FN(conv2d,-5,-8,-8, 64) \
-    else if CONV_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_std,-5,-8,-8, 64) \
-    else if TRANSPOSE_CONV_KERNEL_SYM8SXASYM8S_FN(transpose_conv,-5,-4,-4, 32) \
-    else if TRANSPOSE_CONV_KERNEL_SYM8SXSYM16S_FN(transpose_conv,-5,-8,-8, 64) \
-    else if TRANSPOSE_CONV_KERNEL_F32XF32_FN(transpose_conv,-1,-1,-1,-1) \
-    else if CONV_DILATIONAL_KERNEL_SYM8S_PC_FN(dilated_conv2d_std,-5,-4,-4, 32) \
-    else if CONV_KERNEL_F_FN(conv2d_std, -1, -1, -1, -1) \
-    else if CONV_DS_KERNEL_F_FN(conv2d_depth, -1, -1, -1, -1) \
-    else if CONV_DS_KERNEL_FN(conv2d_depth,8,16,16,16) \
-    else if CONV_DS_KERNEL_FN(conv2d_depth,16,16,16,16) \
-    else if CONV_DS_KERNEL_FN(conv2d_depth,8,8,8,8) \
-    else if CONV_DS_KERNEL_ASYM8_FN(conv2d_depth,-3,-3,-3,32) \
-    else if CONV_DS_KERNEL_SYM8_PC_FN(conv2d_depth,-5,-4,-4,32) \
-    else if DILATED_CONV_DS_KERNEL_SYM8_PC_FN(dilated_conv2d_depth, -5, -4, -4, 32) \
-    else if DILATED_CONV_DEPTH_KERNEL_F_FN(dilated_conv2d_depth, -1, -1, -1, -1) \
-    else if CONV_PT_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_point,-5,-8,-8,64) \
-    else if CONV_DS_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_depth,-5,-8,-8,64) \
-    else if CONV1D_KERNEL_FN(conv1d_std, 8, 16, 16, 16) \
-    else if CONV1D_KERNEL_FN(conv1d_std, 8, 8, 8, 8) \
-    else if CONV1D_KERNEL_FN(conv1d_std, 16, 16, 16, 16) \
-    else if CONV1D_KERNEL_ASYM8_FN(conv1d_std, -3, -3, -3, 32) \
-    else if CONV1D_KERNEL_F_FN(conv1d_std, -1, -1, -1, -1) \
-    else {printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
-#endif /* HIFI_HP_VFPU  && hifi5 */
 #else /* HIFI_VFPU */
-#if HIFI_HP_VFPU && hifi5
 #define PROCESS_CONV \
     if CONV_KERNEL_FN(conv2d_std, 8, 16, 16, 16) \
     else if CONV_KERNEL_FN(conv2d_std, 8, 8, 8, 8) \
@@ -728,8 +773,6 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else if CONV_DS_KERNEL_FN(conv2d_depth,8,8,8,8) \
     else if CONV_DS_KERNEL_ASYM8_FN(conv2d_depth,-3,-3,-3,32) \
     else if CONV_DS_KERNEL_SYM8_PC_FN(conv2d_depth,-5,-4,-4,32) \
-    else if CONV_KERNEL_F16_FN(conv2d_std, -2, -2, -2, -2) \
-    else if CONV_DS_KERNEL_F16_FN(conv2d_depth, -2, -2, -2, -2) \
     else if DILATED_CONV_DS_KERNEL_SYM8_PC_FN(dilated_conv2d_depth, -5, -4, -4, 32) \
     else if CONV_PT_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_point,-5,-8,-8,64) \
     else if CONV_DS_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_depth,-5,-8,-8,64) \
@@ -738,36 +781,366 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else if CONV1D_KERNEL_FN(conv1d_std, 16, 16, 16, 16) \
     else if CONV1D_KERNEL_ASYM8_FN(conv1d_std, -3, -3, -3, 32) \
     else {printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
-#else /* HIFI_HP_VFPU && hifi5 */
-#define PROCESS_CONV \
-    if CONV_KERNEL_FN(conv2d_std, 8, 16, 16, 16) \
-    else if CONV_KERNEL_FN(conv2d_std, 8, 8, 8, 8) \
-    else if CONV_KERNEL_FN(conv2d_std, 16, 16, 16, 16) \
-    else if CONV_KERNEL_ASYM8_FN(conv2d_std, -3, -3, -3, 32) \
-    else if CONV_KERNEL_SYM8S_PC_FN(conv2d_std,-5,-4,-4, 32) \
-    else if CONV_KERNEL_SYM4S_PC_FN(conv2d_std,-12,-4,-4, 32) \
-    else if CONV_UN_KERNEL_SYM8S_PC_FN(conv2d,-5,-4,-4, 32) \
-    else if CONV_UN_KERNEL_SYM8SXSYM16S_PC_FN(conv2d,-5,-8,-8, 64) \
-    else if CONV_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_std,-5,-8,-8, 64) \
-    else if TRANSPOSE_CONV_KERNEL_SYM8SXASYM8S_FN(transpose_conv,-5,-4,-4, 32) \
-    else if TRANSPOSE_CONV_KERNEL_SYM8SXSYM16S_FN(transpose_conv,-5,-8,-8, 64) \
-    else if CONV_DILATIONAL_KERNEL_SYM8S_PC_FN(dilated_conv2d_std,-5,-4,-4, 32) \
-    else if CONV_DS_KERNEL_FN(conv2d_depth,8,16,16,16) \
-    else if CONV_DS_KERNEL_FN(conv2d_depth,16,16,16,16) \
-    else if CONV_DS_KERNEL_FN(conv2d_depth,8,8,8,8) \
-    else if CONV_DS_KERNEL_ASYM8_FN(conv2d_depth,-3,-3,-3,32) \
-    else if CONV_DS_KERNEL_SYM8_PC_FN(conv2d_depth,-5,-4,-4,32) \
-    else if DILATED_CONV_DS_KERNEL_SYM8_PC_FN(dilated_conv2d_depth, -5, -4, -4, 32) \
-    else if CONV_PT_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_point,-5,-8,-8,64) \
-    else if CONV_DS_KERNEL_SYM8SXSYM16S_PC_FN(conv2d_depth,-5,-8,-8,64) \
-    else if CONV1D_KERNEL_FN(conv1d_std, 8, 16, 16, 16) \
-    else if CONV1D_KERNEL_FN(conv1d_std, 8, 8, 8, 8) \
-    else if CONV1D_KERNEL_FN(conv1d_std, 16, 16, 16, 16) \
-    else if CONV1D_KERNEL_ASYM8_FN(conv1d_std, -3, -3, -3, 32) \
-    else {printf("[Error] [%s] convolution is not supported\n", cfg.kernel_name); return -1;}
-#endif /* HIFI_HP_VFPU && hifi5 */    
 #endif /* HIFI_VFPU */
 
+#if HIFI_VFPU
+#define PROCESS_CONV_PREPACKED \
+    if CONV_GROUP_PREPACKED_KERNEL_SYM8S_PC_FN(conv2d, -5, -4, -4, 32) \
+    else if CONV_PREPACKED_KERNEL_FN(conv2d_std_prepacked, 8, 16, 16, 16) \
+    else if CONV_PREPACKED_KERNEL_FN(conv2d_std_prepacked, 8, 8, 8, 8) \
+    else if CONV_PREPACKED_KERNEL_FN(conv2d_std_prepacked, 16, 16, 16, 16) \
+    else if CONV_PREPACKED_KERNEL_ASYM8_FN(conv2d_std_prepacked, -3, -3, -3, 32) \
+    else if CONV_PREPACKED_KERNEL_PC_FN(conv2d_std_prepacked, sym8sxasym8s, -5, -4, -4, 32, WORD8, WORD8, WORD32, cfg.input_zero_bias, cfg.out_zero_bias) \
+    else if CONV_PREPACKED_KERNEL_PC_FN(conv2d_std_prepacked, sym4sxasym8s, -12, -4, -4, 32, WORD8, WORD8, WORD32, cfg.input_zero_bias, cfg.out_zero_bias) \
+    else if CONV_PREPACKED_KERNEL_PC_FN(conv2d_std_prepacked, sym8sxsym16s, -5, -8, -8, 64, WORD16, WORD16, WORD64, 0, 0) \
+    else if CONV_PREPACKED_KERNEL_F_FN(conv2d_std_prepacked, -1, -1, -1, -1) \
+    else {printf("[Error] [%s] prepacked convolution is not supported\n", cfg.kernel_name); return -1;}
+#else /* HIFI_VFPU */
+#define PROCESS_CONV_PREPACKED \
+    if CONV_GROUP_PREPACKED_KERNEL_SYM8S_PC_FN(conv2d, -5, -4, -4, 32) \
+    else if CONV_PREPACKED_KERNEL_FN(conv2d_std_prepacked, 8, 16, 16, 16) \
+    else if CONV_PREPACKED_KERNEL_FN(conv2d_std_prepacked, 8, 8, 8, 8) \
+    else if CONV_PREPACKED_KERNEL_FN(conv2d_std_prepacked, 16, 16, 16, 16) \
+    else if CONV_PREPACKED_KERNEL_ASYM8_FN(conv2d_std_prepacked, -3, -3, -3, 32) \
+    else if CONV_PREPACKED_KERNEL_PC_FN(conv2d_std_prepacked, sym8sxasym8s, -5, -4, -4, 32, WORD8, WORD8, WORD32, cfg.input_zero_bias, cfg.out_zero_bias) \
+    else if CONV_PREPACKED_KERNEL_PC_FN(conv2d_std_prepacked, sym4sxasym8s, -12, -4, -4, 32, WORD8, WORD8, WORD32, cfg.input_zero_bias, cfg.out_zero_bias) \
+    else if CONV_PREPACKED_KERNEL_PC_FN(conv2d_std_prepacked, sym8sxsym16s, -5, -8, -8, 64, WORD16, WORD16, WORD64, 0, 0) \
+    else {printf("[Error] [%s] prepacked convolution is not supported\n", cfg.kernel_name); return -1;}
+#endif /* HIFI_VFPU */
+
+/* Reference for the prepacked sym4s kernel: there is no non-prepacked sym4s
+ * kernel, so the 4-bit weights (two per byte, lower nibble first) are
+ * unpacked here and run through the sym8sxasym8s kernel */
+static void unpack_sym4s_kernel(WORD8 *p_dst, const WORD8 *p_src, int num_weights)
+{
+  int i;
+  for(i = 0; i < num_weights; i++)
+  {
+    int nibble = (i & 1) ? ((UWORD8)p_src[i >> 1] >> 4) : (p_src[i >> 1] & 0xf);
+    p_dst[i] = (WORD8)((nibble ^ 0x8) - 0x8);
+  }
+}
+
+/* Reference for the grouped sym8sxasym8s conv2d: every group is run as a
+ * conv2d_std on its own input channels and written to its output channels */
+static int conv2d_group_ref_sym8sxasym8s(WORD8 *p_ref, const WORD8 *p_inp, const WORD8 *p_kernel, const WORD32 *p_bias, test_config_t *p_cfg)
+{
+  int groups = p_cfg->input_channels / p_cfg->kernel_channels;
+  int kernels_per_group = p_cfg->out_channels / groups;
+  int kernel_group_size = kernels_per_group * p_cfg->kernel_height * p_cfg->kernel_width * p_cfg->kernel_channels;
+  int out_group_size = p_cfg->out_height * p_cfg->out_width * kernels_per_group;
+  int g, itr, err = 0;
+  WORD8 *p_inp_group, *p_out_group;
+  void *p_scratch_group;
+
+  int scratch_size = xa_nn_conv2d_std_getsize(p_cfg->input_height, p_cfg->input_width, p_cfg->kernel_channels,
+      p_cfg->kernel_height, p_cfg->kernel_width, p_cfg->kernel_channels, p_cfg->y_stride, p_cfg->y_padding,
+      p_cfg->x_stride, p_cfg->x_padding, p_cfg->out_height, p_cfg->out_width, kernels_per_group, -4, -5,
+      1, 1, p_cfg->out_data_format);
+  if(scratch_size <= 0)
+  {
+    return -1;
+  }
+
+  p_inp_group = (WORD8 *)malloc(p_cfg->input_height * p_cfg->input_width * p_cfg->kernel_channels);
+  p_out_group = (WORD8 *)malloc(out_group_size);
+  p_scratch_group = malloc(scratch_size);
+  if(p_inp_group == NULL || p_out_group == NULL || p_scratch_group == NULL)
+  {
+    err = -1;
+  }
+
+  for(g = 0; g < groups && !err; g++)
+  {
+    for(itr = 0; itr < p_cfg->input_height * p_cfg->input_width; itr++)
+    {
+      memcpy(p_inp_group + itr * p_cfg->kernel_channels, p_inp + itr * p_cfg->input_channels + g * p_cfg->kernel_channels, p_cfg->kernel_channels);
+    }
+    err = xa_nn_conv2d_std_per_chan_sym8sxasym8s(p_out_group, p_inp_group, p_kernel + g * kernel_group_size, p_bias + g * kernels_per_group,
+        p_cfg->input_height, p_cfg->input_width, p_cfg->kernel_channels, p_cfg->kernel_height, p_cfg->kernel_width, kernels_per_group,
+        p_cfg->x_stride, p_cfg->y_stride, p_cfg->x_padding, p_cfg->y_padding, p_cfg->out_height, p_cfg->out_width,
+        p_cfg->input_zero_bias, p_cfg->p_out_multiplier + g * kernels_per_group, p_cfg->p_out_shift + g * kernels_per_group,
+        p_cfg->out_zero_bias, p_cfg->out_data_format, p_scratch_group);
+    if(p_cfg->out_data_format == 0)
+    {
+      for(itr = 0; itr < p_cfg->out_height * p_cfg->out_width; itr++)
+      {
+        memcpy(p_ref + itr * p_cfg->out_channels + g * kernels_per_group, p_out_group + itr * kernels_per_group, kernels_per_group);
+      }
+    }
+    else
+    {
+      memcpy(p_ref + g * out_group_size, p_out_group, out_group_size);
+    }
+  }
+
+  free(p_inp_group);
+  free(p_out_group);
+  free(p_scratch_group);
+  return err;
+}
+
+/* Reference for the sym8sxasym8s transpose_conv: conv2d_std with stride 1 and
+ * the spatially flipped kernel over the input with stride - 1 zero points
+ * inserted between pixels and kernel - 1 - padding zero points on the borders */
+static int transpose_conv_ref_sym8sxasym8s(WORD8 *p_ref, const WORD8 *p_inp, const WORD8 *p_kernel, const WORD32 *p_bias, test_config_t *p_cfg)
+{
+  int dil_height = p_cfg->out_height + p_cfg->kernel_height - 1;
+  int dil_width = p_cfg->out_width + p_cfg->kernel_width - 1;
+  int channels = p_cfg->input_channels;
+  int kernel_size = p_cfg->kernel_height * p_cfg->kernel_width * channels;
+  int x, y, ky, kx, oc, err = 0;
+  WORD8 *p_inp_dil, *p_kernel_flip;
+  void *p_scratch_ref;
+
+  int scratch_size = xa_nn_conv2d_std_getsize(dil_height, dil_width, channels,
+      p_cfg->kernel_height, p_cfg->kernel_width, channels, 1, 0, 1, 0,
+      p_cfg->out_height, p_cfg->out_width, p_cfg->out_channels, -4, -5, 1, 1, 0);
+  if(scratch_size <= 0)
+  {
+    return -1;
+  }
+
+  p_inp_dil = (WORD8 *)malloc(dil_height * dil_width * channels);
+  p_kernel_flip = (WORD8 *)malloc(p_cfg->out_channels * kernel_size);
+  p_scratch_ref = malloc(scratch_size);
+  if(p_inp_dil == NULL || p_kernel_flip == NULL || p_scratch_ref == NULL)
+  {
+    err = -1;
+  }
+
+  if(!err)
+  {
+    memset(p_inp_dil, (WORD8)(-p_cfg->input_zero_bias), dil_height * dil_width * channels);
+    for(y = 0; y < p_cfg->input_height; y++)
+    {
+      int dil_y = y * p_cfg->y_stride + p_cfg->kernel_height - 1 - p_cfg->y_padding;
+      for(x = 0; x < p_cfg->input_width; x++)
+      {
+        int dil_x = x * p_cfg->x_stride + p_cfg->kernel_width - 1 - p_cfg->x_padding;
+        if(dil_y >= 0 && dil_y < dil_height && dil_x >= 0 && dil_x < dil_width)
+        {
+          memcpy(p_inp_dil + (dil_y * dil_width + dil_x) * channels, p_inp + (y * p_cfg->input_width + x) * channels, channels);
+        }
+      }
+    }
+    for(oc = 0; oc < p_cfg->out_channels; oc++)
+    {
+      for(ky = 0; ky < p_cfg->kernel_height; ky++)
+      {
+        for(kx = 0; kx < p_cfg->kernel_width; kx++)
+        {
+          memcpy(p_kernel_flip + oc * kernel_size + (ky * p_cfg->kernel_width + kx) * channels,
+              p_kernel + oc * kernel_size + ((p_cfg->kernel_height - 1 - ky) * p_cfg->kernel_width + (p_cfg->kernel_width - 1 - kx)) * channels,
+              channels);
+        }
+      }
+    }
+    err = xa_nn_conv2d_std_per_chan_sym8sxasym8s(p_ref, p_inp_dil, p_kernel_flip, p_bias,
+        dil_height, dil_width, channels, p_cfg->kernel_height, p_cfg->kernel_width, p_cfg->out_channels,
+        1, 1, 0, 0, p_cfg->out_height, p_cfg->out_width,
+        p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift,
+        p_cfg->out_zero_bias, 0, p_scratch_ref);
+  }
+
+  free(p_inp_dil);
+  free(p_kernel_flip);
+  free(p_scratch_ref);
+  return err;
+}
+
+/* Runs the out_stride variants of the sym8sxasym8s conv2d_std, or of the
+ * depthwise and pointwise kernels of conv2d_depth, into the middle slice of
+ * a channel concat (-concat_pad). Each slice must match the packed output of
+ * the plain kernel and the gaps must stay untouched, returns 1 if so. */
+static int check_concat_slice_conv(test_config_t *p_cfg, buf1D_t *p_inp, buf2D_t *p_kernel, buf1D_t *p_bias,
+    buf1D_t *p_kernel_point, buf1D_t *p_bias_point, buf1D_t *p_dw_out, buf1D_t *p_out, void *p_scratch)
+{
+  int rows = p_cfg->out_height * p_cfg->out_width;
+  int dw_channels = p_cfg->input_channels * p_cfg->channels_multiplier;
+  int out_stride, err, match;
+  WORD8 *p_buf, *p_slice;
+
+  if(!strcmp(p_cfg->kernel_name, "conv2d_std"))
+  {
+    p_buf = create_concat_slice_buf(rows, p_cfg->out_channels, p_cfg->concat_pad, &p_slice, &out_stride);
+    if(p_buf == NULL)
+    {
+      return 0;
+    }
+    err = xa_nn_conv2d_std_out_stride_per_chan_sym8sxasym8s(p_slice, (WORD8 *)p_inp->p, (WORD8 *)p_kernel->p, (WORD32 *)p_bias->p,
+        p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels, p_cfg->kernel_height, p_cfg->kernel_width, p_cfg->out_channels,
+        p_cfg->x_stride, p_cfg->y_stride, p_cfg->x_padding, p_cfg->y_padding, p_cfg->out_height, p_cfg->out_width,
+        p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift, p_cfg->out_zero_bias,
+        out_stride, p_scratch);
+    match = !err && check_concat_slice_buf(p_buf, (WORD8 *)p_out->p, rows, p_cfg->out_channels, p_cfg->concat_pad);
+    free(p_buf);
+    return match;
+  }
+
+  p_buf = create_concat_slice_buf(rows, dw_channels, p_cfg->concat_pad, &p_slice, &out_stride);
+  if(p_buf == NULL)
+  {
+    return 0;
+  }
+  err = xa_nn_conv2d_depthwise_out_stride_per_chan_sym8sxasym8s(p_slice, (const WORD8 *)p_kernel->p, (const WORD8 *)p_inp->p, (const WORD32 *)p_bias->p,
+      p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels, p_cfg->kernel_height, p_cfg->kernel_width, p_cfg->channels_multiplier,
+      p_cfg->x_stride, p_cfg->y_stride, p_cfg->x_padding, p_cfg->y_padding, p_cfg->out_height, p_cfg->out_width,
+      p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift, p_cfg->out_zero_bias,
+      out_stride, p_scratch);
+  match = !err && check_concat_slice_buf(p_buf, (WORD8 *)p_dw_out->p, rows, dw_channels, p_cfg->concat_pad);
+  free(p_buf);
+
+  if(match)
+  {
+    p_buf = create_concat_slice_buf(rows, p_cfg->out_channels, p_cfg->concat_pad, &p_slice, &out_stride);
+    if(p_buf == NULL)
+    {
+      return 0;
+    }
+    err = xa_nn_conv2d_pointwise_out_stride_per_chan_sym8sxasym8s(p_slice, (WORD8 *)p_kernel_point->p, (WORD8 *)p_dw_out->p, (WORD32 *)p_bias_point->p,
+        p_cfg->out_height, p_cfg->out_width, dw_channels, p_cfg->out_channels,
+        p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift, p_cfg->out_zero_bias,
+        out_stride);
+    match = !err && check_concat_slice_buf(p_buf, (WORD8 *)p_out->p, rows, p_cfg->out_channels, p_cfg->concat_pad);
+    free(p_buf);
+  }
+  return match;
+}
+
+/* The sym8sxasym8s and sym8sxsym16s depthwise kernels take a fixed-tap path
+ * for 3x3, 5x5, 7x7, 1x9 and 9x1 with NHWC input when the pointers are
+ * aligned, input_channels is a multiple of 4 and out_height is even. Runs the
+ * depthwise kernel again into an output moved off that alignment, which takes
+ * the generic path, and returns 1 if both outputs are bit-exact. With path
+ * counters compiled in, the second call must also be counted as generic. */
+static int check_depthwise_generic(test_config_t *p_cfg, buf1D_t *p_inp, buf2D_t *p_kernel, buf1D_t *p_bias,
+    buf1D_t *p_dw_out, void *p_scratch)
+{
+  int sym16s = (p_dw_out->precision == -8);
+  int path_kernel = sym16s ? XA_NN_PATH_CONV2D_DEPTHWISE_SYM8SXSYM16S : XA_NN_PATH_CONV2D_DEPTHWISE_SYM8SXASYM8S;
+  xa_nn_path_counters_t paths_before, paths_after;
+  int have_paths, err, match;
+  char *p_buf, *p_generic;
+
+  p_buf = (char *)malloc(BUF1D_BYTES(p_dw_out) + 8);
+  if(p_buf == NULL)
+  {
+    return 0;
+  }
+  /* One element past an 8 byte boundary: never 4 byte aligned */
+  p_generic = (char *)(((size_t)p_buf + 7) & ~(size_t)7) + p_dw_out->bytes_per_element;
+
+  have_paths = (xa_nn_get_path_counters(&paths_before, path_kernel) == 0);
+  if(sym16s)
+  {
+    err = xa_nn_conv2d_depthwise_per_chan_sym8sxsym16s((WORD16 *)p_generic, (const WORD8 *)p_kernel->p, (const WORD16 *)p_inp->p, (const WORD64 *)p_bias->p,
+        p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels, p_cfg->kernel_height, p_cfg->kernel_width, p_cfg->channels_multiplier,
+        p_cfg->x_stride, p_cfg->y_stride, p_cfg->x_padding, p_cfg->y_padding, p_cfg->out_height, p_cfg->out_width, 0,
+        p_cfg->p_out_multiplier, p_cfg->p_out_shift, 0,
+        p_cfg->inp_data_format, 0, p_scratch);
+  }
+  else
+  {
+    err = xa_nn_conv2d_depthwise_per_chan_sym8sxasym8s((WORD8 *)p_generic, (const WORD8 *)p_kernel->p, (const WORD8 *)p_inp->p, (const WORD32 *)p_bias->p,
+        p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels, p_cfg->kernel_height, p_cfg->kernel_width, p_cfg->channels_multiplier,
+        p_cfg->x_stride, p_cfg->y_stride, p_cfg->x_padding, p_cfg->y_padding, p_cfg->out_height, p_cfg->out_width,
+        p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift, p_cfg->out_zero_bias,
+        p_cfg->inp_data_format, 0, p_scratch);
+  }
+  match = !err && !memcmp(p_generic, p_dw_out->p, BUF1D_BYTES(p_dw_out));
+  if(have_paths)
+  {
+    xa_nn_get_path_counters(&paths_after, path_kernel);
+    match = match && (paths_after.generic == paths_before.generic + 1);
+  }
+  free(p_buf);
+  return match;
+}
+
+/* Checks the packed output of one _epilogue_ kernel in p_epi_out against the
+ * plain kernel output p_plain followed by the unfused residual add, clamp and
+ * table, returns 1 if bit-exact. */
+static int check_epilogue_out(const WORD8 *p_epi_out, const WORD8 *p_plain, const WORD8 *p_residual, int num_elm,
+    int out_zero_bias, const xa_nn_epilogue_asym8s_t *p_epilogue)
+{
+  WORD8 *p_ref = (WORD8 *)malloc(num_elm);
+  int match;
+
+  if(p_ref == NULL)
+  {
+    return 0;
+  }
+  match = !epilogue_ref_asym8s(p_ref, p_plain, p_residual, num_elm, out_zero_bias, p_epilogue) &&
+    !memcmp(p_ref, p_epi_out, num_elm);
+  free(p_ref);
+  return match;
+}
+
+/* Runs the _epilogue_ variants of the sym8sxasym8s conv2d_std, or of the
+ * depthwise and pointwise kernels of conv2d_depth (-epilogue), with a random
+ * residual. Each output must match the plain kernel output with the epilogue
+ * applied afterwards, returns 1 if so. */
+static int check_epilogue_conv(test_config_t *p_cfg, buf1D_t *p_inp, buf2D_t *p_kernel, buf1D_t *p_bias,
+    buf1D_t *p_kernel_point, buf1D_t *p_bias_point, buf1D_t *p_dw_out, buf1D_t *p_out, void *p_scratch)
+{
+  int rows = p_cfg->out_height * p_cfg->out_width;
+  int dw_channels = p_cfg->input_channels * p_cfg->channels_multiplier;
+  int max_channels = (dw_channels > p_cfg->out_channels) ? dw_channels : p_cfg->out_channels;
+  xa_nn_epilogue_asym8s_t epilogue;
+  WORD8 lut[256];
+  buf1D_t *p_residual;
+  WORD8 *p_epi_out;
+  int err, match = 0;
+
+  p_residual = create_buf1D(rows * max_channels, ASYM8S_TYPE);
+  p_epi_out = (WORD8 *)malloc(rows * max_channels);
+  if(p_residual == NULL || p_epi_out == NULL)
+  {
+    goto done;
+  }
+  set_rand_inp_buf1D(p_residual);
+  init_epilogue_check_asym8s(&epilogue, lut);
+
+  if(!strcmp(p_cfg->kernel_name, "conv2d_std"))
+  {
+    err = xa_nn_conv2d_std_epilogue_per_chan_sym8sxasym8s(p_epi_out, (WORD8 *)p_inp->p, (WORD8 *)p_kernel->p, (WORD32 *)p_bias->p,
+        p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels, p_cfg->kernel_height, p_cfg->kernel_width, p_cfg->out_channels,
+        p_cfg->x_stride, p_cfg->y_stride, p_cfg->x_padding, p_cfg->y_padding, p_cfg->out_height, p_cfg->out_width,
+        p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift, p_cfg->out_zero_bias,
+        p_cfg->out_channels, (WORD8 *)p_residual->p, p_cfg->out_channels, &epilogue, p_scratch);
+    match = !err && check_epilogue_out(p_epi_out, (WORD8 *)p_out->p, (WORD8 *)p_residual->p, rows * p_cfg->out_channels,
+        p_cfg->out_zero_bias, &epilogue);
+    goto done;
+  }
+
+  err = xa_nn_conv2d_depthwise_epilogue_per_chan_sym8sxasym8s(p_epi_out, (const WORD8 *)p_kernel->p, (const WORD8 *)p_inp->p, (const WORD32 *)p_bias->p,
+      p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels, p_cfg->kernel_height, p_cfg->kernel_width, p_cfg->channels_multiplier,
+      p_cfg->x_stride, p_cfg->y_stride, p_cfg->x_padding, p_cfg->y_padding, p_cfg->out_height, p_cfg->out_width,
+      p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift, p_cfg->out_zero_bias,
+      dw_channels, (WORD8 *)p_residual->p, dw_channels, &epilogue, p_scratch);
+  match = !err && check_epilogue_out(p_epi_out, (WORD8 *)p_dw_out->p, (WORD8 *)p_residual->p, rows * dw_channels,
+      p_cfg->out_zero_bias, &epilogue);
+
+  if(match)
+  {
+    err = xa_nn_conv2d_pointwise_epilogue_per_chan_sym8sxasym8s(p_epi_out, (WORD8 *)p_kernel_point->p, (WORD8 *)p_dw_out->p, (WORD32 *)p_bias_point->p,
+        p_cfg->out_height, p_cfg->out_width, dw_channels, p_cfg->out_channels,
+        p_cfg->input_zero_bias, p_cfg->p_out_multiplier, p_cfg->p_out_shift, p_cfg->out_zero_bias,
+        p_cfg->out_channels, (WORD8 *)p_residual->p, p_cfg->out_channels, &epilogue);
+    match = !err && check_epilogue_out(p_epi_out, (WORD8 *)p_out->p, (WORD8 *)p_residual->p, rows * p_cfg->out_channels,
+        p_cfg->out_zero_bias, &epilogue);
+  }
+
+done:
+  free(p_epi_out);
+  if(p_residual != NULL)
+  {
+    free_buf1D(p_residual);
+  }
+  return match;
+}
+
 int xa_nn_main_process(int argc, char *argv[])
 {
 
@@ -778,6 +1151,16 @@ int xa_nn_main_process(int argc, char *argv[])
   char profiler_name_1[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
   void *p_scratch;
+  void *p_scratch_prepacked = NULL;
+  void *p_prepacked = NULL;
+  WORD8 *p_kernel_sym8 = NULL;
+  WORD8 *p_out_group = NULL;
+  WORD8 *p_out_tconv = NULL;
+  int group_check = 0;
+  int tconv_check = 0;
+  int slice_check = 0;
+  int dw_check = 0;
+  int epilogue_check = 0;
   int inp_size=0, kernel_size, out_size;
   int kernel_size_pad, input_channels_pad,kernel_channels_pad;
   int kernel_channels;
@@ -790,11 +1173,12 @@ int xa_nn_main_process(int argc, char *argv[])
 
   buf1D_t *p_inp;
   buf2D_t *p_kernel;
-  buf1D_t *p_kernel_point;
+  buf1D_t *p_kernel_point = NULL;
   buf1D_t *p_bias;
-  buf1D_t *p_bias_point;
-  buf1D_t *p_dw_out;
+  buf1D_t *p_bias_point = NULL;
+  buf1D_t *p_dw_out = NULL;
   buf1D_t *p_out;
+  buf1D_t *p_out_plain = NULL;
   buf1D_t *p_ref;
 
   FILE *fptr_inp;
@@ -822,6 +1206,9 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
+  // Benchmark mode, random data is generated in place of reading the input file
+  bench_mode_config(cfg.bench, cfg.warmup, &cfg.write_file, &cfg.verify, &cfg.frames);
+
   const char *kernel_names_supported[] = {"conv2d_std", "dilated_conv2d_std", "conv2d_depth", "dilated_conv2d_depth", "conv2d_point", "conv1d_std", "transpose_conv","conv2d"};
   int num_kernel_names = 8;
   int ker_name_itr = 0;
@@ -839,6 +1226,16 @@ int xa_nn_main_process(int argc, char *argv[])
     printf("[Error] : Invalid kernel name\n");
     return -1;
   }
+  if(cfg.prepacked && strcmp(cfg.kernel_name,"conv2d_std") && strcmp(cfg.kernel_name,"conv2d"))
+  {
+    printf("[Error] : -prepacked is supported only for conv2d_std and conv2d\n");
+    return -1;
+  }
+  if(cfg.prepacked && !strcmp(cfg.kernel_name,"conv2d") && !(cfg.kernel_precision == -5 && cfg.inp_precision == -4))
+  {
+    printf("[Error] : -prepacked conv2d is supported only for sym8sxasym8s\n");
+    return -1;
+  }
 
   if( (!strcmp(cfg.kernel_name,"conv2d_std")) || (!strcmp(cfg.kernel_name,"dilated_conv2d_std")) )
   {
@@ -1034,8 +1431,8 @@ int xa_nn_main_process(int argc, char *argv[])
     {
       strcat(profiler_name_1, profiler_params);
     }
-    // If HP_VFPU is not supported, return
-    if(!HIFI_HP_VFPU)
+    // If VFPU is not supported, return
+    if(!HIFI_VFPU)
     {
       printf("%s: NOT TESTED\n", profiler_name_0);
       return 0;
@@ -1148,7 +1545,7 @@ int xa_nn_main_process(int argc, char *argv[])
     /* If write_file (generate test vectors) is enabled, random data would be generated and
        used; the input data and output data generated would be written into files. 
      */
-    fptr_inp = file_open(pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+    fptr_inp = bench_file_open(cfg.bench, pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
   }
   else
   {
@@ -1159,7 +1556,7 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   // Open output file
-  fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+  fptr_out = bench_file_open(cfg.bench, pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
 
   // Open reference file if verify flag is enabled
   if(cfg.verify)
@@ -1273,6 +1670,23 @@ int xa_nn_main_process(int argc, char *argv[])
     XTPWR_PROFILER_OPEN(0, profiler_name_0, profiler_params, n_macs, "MACs/cyc", 1);
   }
   
+  // Bytes read and written per call, frames excluded from the profile
+  if(!strcmp(cfg.kernel_name,"conv2d_depth"))
+  {
+    XTPWR_PROFILER_BYTES(0, BUF1D_BYTES(p_inp) + BUF2D_BYTES(p_kernel) + BUF1D_BYTES(p_bias) + BUF1D_BYTES(p_dw_out));
+    XTPWR_PROFILER_BYTES(1, BUF1D_BYTES(p_dw_out) + BUF1D_BYTES(p_kernel_point) + BUF1D_BYTES(p_bias_point) + BUF1D_BYTES(p_out));
+    XTPWR_PROFILER_WARMUP(1, cfg.warmup);
+  }
+  else if(!strcmp(cfg.kernel_name,"conv2d_point"))
+  {
+    XTPWR_PROFILER_BYTES(0, BUF1D_BYTES(p_inp) + BUF1D_BYTES(p_kernel_point) + BUF1D_BYTES(p_bias_point) + BUF1D_BYTES(p_out));
+  }
+  else
+  {
+    XTPWR_PROFILER_BYTES(0, BUF1D_BYTES(p_inp) + BUF2D_BYTES(p_kernel) + BUF1D_BYTES(p_bias) + BUF1D_BYTES(p_out));
+  }
+  XTPWR_PROFILER_WARMUP(0, cfg.warmup);
+
   // Init
   WORD32 scratch_size=0;
 
@@ -1396,6 +1810,80 @@ int xa_nn_main_process(int argc, char *argv[])
     fprintf(stdout, "\nScratch size: %d bytes\n", scratch_size);
   }
 
+  // Persistent prepacked kernel and its own scratch, the non-prepacked kernel
+  // output is kept in p_out_plain for the bitexact cross check
+  if(cfg.prepacked)
+  {
+    WORD32 prepack_size, prepacked_scratch_size;
+    if(!strcmp(cfg.kernel_name,"conv2d"))
+    {
+      /* The testbench always passes a bias; the grouped prepacked kernel
+       * takes the xa_nn_conv2d_getsize scratch */
+      prepack_size = xa_nn_conv2d_group_prepack_getsize(cfg.input_channels, cfg.kernel_channels, cfg.kernel_height,
+          cfg.kernel_width, cfg.out_channels, cfg.inp_precision, cfg.kernel_precision, cfg.out_data_format, 1); PRINT_VAR(prepack_size)
+      prepacked_scratch_size = scratch_size; PRINT_VAR(prepacked_scratch_size)
+    }
+    else
+    {
+      prepack_size = xa_nn_conv2d_std_prepack_getsize(cfg.input_channels, cfg.kernel_height, cfg.kernel_width,
+          cfg.out_channels, cfg.inp_precision, cfg.kernel_precision); PRINT_VAR(prepack_size)
+      prepacked_scratch_size = xa_nn_conv2d_std_prepacked_getsize(cfg.input_height, cfg.input_width, cfg.input_channels,
+          cfg.kernel_height, cfg.kernel_width, cfg.input_channels, cfg.y_stride, cfg.y_padding, cfg.x_stride, cfg.x_padding,
+          cfg.out_height, cfg.out_width, cfg.out_channels, cfg.inp_precision, cfg.kernel_precision,
+          cfg.dilation_height, cfg.dilation_width, cfg.out_data_format); PRINT_VAR(prepacked_scratch_size)
+    }
+    if(prepack_size <= 0 || prepacked_scratch_size <= 0)
+    {
+      printf("[Error] : prepacked kernel is not supported for these precisions\n");
+      return -1;
+    }
+    p_prepacked = malloc(prepack_size);                                            VALIDATE_PTR(p_prepacked);
+    p_scratch_prepacked = malloc(prepacked_scratch_size);                          VALIDATE_PTR(p_scratch_prepacked);
+    p_out_plain = create_buf1D(out_size, cfg.out_precision);                       VALIDATE_PTR(p_out_plain);
+    if(cfg.kernel_precision == -12)
+    {
+      p_kernel_sym8 = (WORD8 *)malloc(cfg.out_channels * cfg.kernel_height * cfg.kernel_width * cfg.input_channels); VALIDATE_PTR(p_kernel_sym8);
+      scratch_size = xa_nn_conv2d_std_getsize(cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height,
+          cfg.kernel_width, cfg.input_channels, cfg.y_stride, cfg.y_padding, cfg.x_stride, cfg.x_padding,
+          cfg.out_height, cfg.out_width, cfg.out_channels, cfg.inp_precision, -5,
+          cfg.dilation_height, cfg.dilation_width, cfg.out_data_format); PRINT_VAR(scratch_size)
+      free(p_scratch);
+      p_scratch = malloc(scratch_size);                                            VALIDATE_PTR(p_scratch);
+    }
+
+    fprintf(stdout, "\nPrepacked kernel size: %d bytes, scratch size: %d bytes\n", prepack_size, prepacked_scratch_size);
+  }
+
+  // Grouped conv2d output is checked against conv2d_std run per group
+  group_check = !strcmp(cfg.kernel_name,"conv2d") && (cfg.kernel_precision == -5) && (cfg.inp_precision == -4) && (cfg.out_precision == -4);
+  if(group_check)
+  {
+    p_out_group = (WORD8 *)malloc(out_size);                                       VALIDATE_PTR(p_out_group);
+  }
+
+  // sym8sxasym8s transpose_conv output is checked against conv2d_std on the zero point inserted input
+  tconv_check = !strcmp(cfg.kernel_name,"transpose_conv") && (cfg.kernel_precision == -5) && (cfg.inp_precision == -4) && (cfg.out_precision == -4);
+  if(tconv_check)
+  {
+    p_out_tconv = (WORD8 *)malloc(out_size);                                       VALIDATE_PTR(p_out_tconv);
+  }
+
+  // out_stride kernels writing into a channel concat are checked against the output
+  slice_check = (cfg.concat_pad > 0) && !cfg.prepacked &&
+    (!strcmp(cfg.kernel_name,"conv2d_std") || !strcmp(cfg.kernel_name,"conv2d_depth")) &&
+    (cfg.kernel_precision == -5) && (cfg.inp_precision == -4) && (cfg.out_precision == -4) &&
+    (!strcmp(cfg.kernel_name,"conv2d_std") || cfg.inp_data_format == 0) && (cfg.out_data_format == 0);
+
+  // _epilogue_ kernels are checked against the output with the epilogue applied afterwards
+  epilogue_check = cfg.epilogue && !cfg.prepacked &&
+    (!strcmp(cfg.kernel_name,"conv2d_std") || !strcmp(cfg.kernel_name,"conv2d_depth")) &&
+    (cfg.kernel_precision == -5) && (cfg.inp_precision == -4) && (cfg.out_precision == -4) &&
+    (!strcmp(cfg.kernel_name,"conv2d_std") || cfg.inp_data_format == 0) && (cfg.out_data_format == 0);
+
+  // sym8s depthwise with NHWC input is checked against its generic path
+  dw_check = !strcmp(cfg.kernel_name,"conv2d_depth") && (cfg.inp_data_format == 0) && (cfg.kernel_precision == -5) &&
+    (((cfg.inp_precision == -4) && (cfg.out_precision == -4)) || ((cfg.inp_precision == -8) && (cfg.out_precision == -8)));
+
   // Frame processing loop
   for(frame = 0; frame < cfg.frames; frame++)
   {
@@ -1414,7 +1902,47 @@ int xa_nn_main_process(int argc, char *argv[])
       load_conv2d_pt_input_data(cfg.write_file, fptr_inp, p_inp, p_kernel_point, p_bias_point);
 
     // Call the cnn kernel_name specified on command line
-    PROCESS_CONV;
+    if(cfg.prepacked)
+    {
+      // Non-prepacked kernel as the reference, excluded from the profile
+      buf1D_t *p_out_tmp = p_out;
+      XTPWR_PROFILER_EXCLUDE_ON(0);
+      p_out = p_out_plain;
+      if(cfg.kernel_precision == -12)
+      {
+        unpack_sym4s_kernel(p_kernel_sym8, (WORD8 *)p_kernel->p, cfg.out_channels * cfg.kernel_height * cfg.kernel_width * cfg.input_channels);
+        err = xa_nn_conv2d_std_per_chan_sym8sxasym8s((WORD8 *)p_out->p, (WORD8 *)p_inp->p, p_kernel_sym8, (WORD32 *)p_bias->p,
+            cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, cfg.out_channels,
+            cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width,
+            cfg.input_zero_bias, cfg.p_out_multiplier, cfg.p_out_shift, cfg.out_zero_bias,
+            cfg.out_data_format, p_scratch);
+      }
+      else
+      {
+        PROCESS_CONV;
+      }
+      p_out = p_out_tmp;
+      if(!err && !strcmp(cfg.kernel_name,"conv2d"))
+      {
+        err = xa_nn_conv2d_group_prepack_kernel(p_prepacked, p_kernel->p, cfg.input_channels, cfg.kernel_channels,
+            cfg.kernel_height, cfg.kernel_width, cfg.out_channels, cfg.inp_precision, cfg.kernel_precision,
+            cfg.out_data_format, 1);
+      }
+      else if(!err)
+      {
+        err = xa_nn_conv2d_std_prepack_kernel(p_prepacked, p_kernel->p, cfg.input_channels, cfg.kernel_height,
+            cfg.kernel_width, cfg.out_channels, cfg.inp_precision, cfg.kernel_precision);
+      }
+      XTPWR_PROFILER_EXCLUDE_OFF(0);
+      if(!err)
+      {
+        PROCESS_CONV_PREPACKED;
+      }
+    }
+    else
+    {
+      PROCESS_CONV;
+    }
     if(err)
     {
       fprintf(stdout, "\nKernel returned error (invalid parameters), Performance numbers may be incorrect!\n\n");
@@ -1433,29 +1961,90 @@ int xa_nn_main_process(int argc, char *argv[])
     // Write output into file
     write_buf1D_to_file(fptr_out, p_out);
 
+    // Prepacked output must match the non-prepacked kernel bit for bit and
+    // grouped conv2d must match conv2d_std per group and transpose_conv must
+    // match conv2d_std on the zero point inserted input
+    int ref_match = 1;
+    if(cfg.prepacked)
+    {
+      ref_match = !memcmp(p_out_plain->p, p_out->p, BUF1D_BYTES(p_out));
+      if(!ref_match)
+      {
+        printf("[Error] prepacked kernel output differs from the non-prepacked kernel\n");
+      }
+    }
+    if(group_check)
+    {
+      ref_match = ref_match &&
+        !conv2d_group_ref_sym8sxasym8s(p_out_group, (WORD8 *)p_inp->p, (WORD8 *)p_kernel->p, (WORD32 *)p_bias->p, &cfg) &&
+        !memcmp(p_out_group, p_out->p, out_size);
+      if(!ref_match)
+      {
+        printf("[Error] grouped conv2d output differs from conv2d_std run per group\n");
+      }
+    }
+    if(tconv_check)
+    {
+      ref_match = ref_match &&
+        !transpose_conv_ref_sym8sxasym8s(p_out_tconv, (WORD8 *)p_inp->p, (WORD8 *)p_kernel->p, (WORD32 *)p_bias->p, &cfg) &&
+        !memcmp(p_out_tconv, p_out->p, out_size);
+      if(!ref_match)
+      {
+        printf("[Error] transpose_conv output differs from conv2d_std on the zero point inserted input\n");
+      }
+    }
+    if(slice_check)
+    {
+      ref_match = ref_match &&
+        check_concat_slice_conv(&cfg, p_inp, p_kernel, p_bias, p_kernel_point, p_bias_point, p_dw_out, p_out, p_scratch);
+      if(!ref_match)
+      {
+        printf("[Error] out_stride kernel output differs from the plain kernel\n");
+      }
+    }
+    if(dw_check)
+    {
+      ref_match = ref_match && check_depthwise_generic(&cfg, p_inp, p_kernel, p_bias, p_dw_out, p_scratch);
+      if(!ref_match)
+      {
+        printf("[Error] depthwise output differs from the generic path\n");
+      }
+    }
+    if(epilogue_check)
+    {
+      ref_match = ref_match &&
+        check_epilogue_conv(&cfg, p_inp, p_kernel, p_bias, p_kernel_point, p_bias_point, p_dw_out, p_out, p_scratch);
+      if(!ref_match)
+      {
+        printf("[Error] epilogue kernel output differs from the kernel followed by the residual add and table\n");
+      }
+    }
+
     // If verify flag enabled, compare output against reference
     if(cfg.verify)
     {
       read_buf1D_from_file(fptr_ref, p_ref);
-      pass_count += compare_buf1D(p_ref, p_out, cfg.verify, cfg.out_precision, kernel_size_pad);
+      pass_count += ref_match && compare_buf1D(p_ref, p_out, cfg.verify, cfg.out_precision, kernel_size_pad);
     }
     else
     {
-      pass_count += !err;
+      pass_count += ref_match && !err;
     }
   }
 
   if(!(!strcmp(cfg.kernel_name,"conv2d_depth") && cfg.pointwise_profile_only))
   {
-    XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), cfg.verify);
+    /* The prepacked, per group, transpose, concat slice, depthwise generic path and epilogue checks count as verification */
+    XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), (cfg.verify || cfg.prepacked || group_check || tconv_check || slice_check || dw_check || epilogue_check));
   }
   if(!strcmp(cfg.kernel_name,"conv2d_depth"))
   {
-    XTPWR_PROFILER_CLOSE(1, (pass_count == cfg.frames), cfg.verify);
+    XTPWR_PROFILER_CLOSE(1, (pass_count == cfg.frames), (cfg.verify || slice_check || dw_check || epilogue_check));
   }
+  XTPWR_PROFILER_PATHS();
 
-  fclose(fptr_inp);
-  fclose(fptr_out);
+  bench_file_close(fptr_inp);
+  bench_file_close(fptr_out);
 
   // Free all buffers
   free_buf1D(p_inp);
@@ -1492,6 +2081,15 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     free(p_scratch);
   }
+  if(cfg.prepacked)
+  {
+    free(p_prepacked);
+    free(p_scratch_prepacked);
+    free_buf1D(p_out_plain);
+    free(p_kernel_sym8);
+  }
+  free(p_out_group);
+  free(p_out_tconv);
 
   return 0;
 }
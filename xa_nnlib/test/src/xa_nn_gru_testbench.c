@@ -48,6 +48,7 @@ char pb_input_file_path[XA_MAX_FILE_PATH_LENGTH] = "";
 char pb_output_file_path[XA_MAX_FILE_PATH_LENGTH] = "";
 char pb_ref_file_path[XA_MAX_FILE_PATH_LENGTH] = "";
 char pb_prev_h_file_path[XA_MAX_FILE_PATH_LENGTH] = "";
+int num_steps = 1;
 
 #define CHECK_PTR(ptr, context) \
   if(NULL == ptr) {printf("%s: Failed\n", context); return -1;}
@@ -153,6 +154,10 @@ static inline void error_code_parse(int error_code)
     case XA_NNLIB_GRU_EXECUTE_FATAL_INSUFFICIENT_DATA:
       printf("\nInsufficient data, Exiting\n");
       break;
+    case XA_NNLIB_GRU_CONFIG_FATAL_INVALID_NUM_STEPS:
+    case XA_NNLIB_GRU_EXECUTE_FATAL_INVALID_NUM_STEPS:
+      printf("\nInvalid number of steps, Exiting\n");
+      break;
     default:
       printf("\nUnknown error condition, Exiting\n");
       break;
@@ -169,6 +174,7 @@ void show_usage(void)
   printf("--mat_prec:        \t Coefficient precision (Default=16)           \t  Must be 8 or 16\n");
   printf("--vec_prec:        \t Input precision (Default=16)                 \t  Must be 16\n");
   printf("--verify:          \t Verify output against ref output (Default=1) \t  Supported values: 0:-Disable  1:-Enable\n");
+  printf("--num_steps:       \t Frames per process call (Default=1)          \t  Values >1 use xa_nnlib_gru_process_sequence\n");
   printf("--input_file:      \t File containing input shape\n");
   printf("--filter_path:     \t Path where file containing filter are stored\n");
   printf("--output_file:     \t File to which output will be written\n");
@@ -569,6 +575,7 @@ int default_config(xa_nnlib_gru_init_config_t *config,
     config->coeff_Qformat = 15;
     config->io_Qformat = 12;
     *verify_flag=1;
+    num_steps = 1;
     input_file_name[0] = '\0';
     filter_path[0] = '\0';
     output_file_name[0] = '\0';
@@ -611,6 +618,7 @@ void parse_arguments(int argc, char** argv,
     ARGTYPE_ONETIME_CONFIG("--mat_prec",config->mat_prec);
     ARGTYPE_ONETIME_CONFIG("--vec_prec",config->vec_prec);
     ARGTYPE_ONETIME_CONFIG("--verify",*verify_flag);
+    ARGTYPE_ONETIME_CONFIG("--num_steps",num_steps);
     ARGTYPE_STRING("--input_file", input_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
     ARGTYPE_STRING("--filter_path", filter_path, XA_MAX_FILE_PATH_LENGTH);
     ARGTYPE_STRING("--output_file", output_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
@@ -736,7 +744,11 @@ int xa_nn_main_process(int argc, char *argv[])
       error_code_parse(persistent_size);
       return persistent_size;
     }
-    scratch_size = xa_nnlib_gru_get_scratch_fast(&config);   PRINT_VAR(scratch_size)
+    if(num_steps > 1)
+      scratch_size = xa_nnlib_gru_get_scratch_sequence_fast(&config, num_steps);
+    else
+      scratch_size = xa_nnlib_gru_get_scratch_fast(&config);
+    PRINT_VAR(scratch_size)
     if(scratch_size < 0)
     {
       error_code_parse(scratch_size);
@@ -868,22 +880,22 @@ int xa_nn_main_process(int argc, char *argv[])
     /* Allocate input and output buffer */
     if(config.precision == XA_NNLIB_GRU_flt32xflt32)
     {
-      input_buffer_size = input_shape.dim.vector.length * sizeof(FLOAT32);
+      input_buffer_size = num_steps * input_shape.dim.vector.length * sizeof(FLOAT32);
     }
     else
     {
-      input_buffer_size = input_shape.dim.vector.length * sizeof(vect_t);
+      input_buffer_size = num_steps * input_shape.dim.vector.length * sizeof(vect_t);
     }
     p_input   = malloc(input_buffer_size); PRINT_VAR(input_buffer_size);
     CHECK_PTR(p_input, "Allocation for p_input");
 
     if(config.precision == XA_NNLIB_GRU_flt32xflt32)
     {
-      output_buffer_size = output_shape.dim.vector.length * sizeof(FLOAT32);
+      output_buffer_size = num_steps * output_shape.dim.vector.length * sizeof(FLOAT32);
     }
     else
     {
-      output_buffer_size = output_shape.dim.vector.length * sizeof(vect_t);
+      output_buffer_size = num_steps * output_shape.dim.vector.length * sizeof(vect_t);
     }
     p_output = malloc(output_buffer_size); PRINT_VAR(output_buffer_size);
     CHECK_PTR(p_output, "Allocation for p_output");
@@ -922,25 +934,21 @@ int xa_nn_main_process(int argc, char *argv[])
 
     /* Execution Loop */
     PRINT_STR("GRU Process loop starts")
-    for(i = 0;i < N_FRAMES; i++)
+    int steps = 1;
+    int elm_size = (config.precision == XA_NNLIB_GRU_flt32xflt32) ? sizeof(FLOAT32) : sizeof(vect_t);
+    for(i = 0;i < N_FRAMES; i += steps)
     {
       xa_nnlib_shape_t output_length;
       xa_nnlib_shape_t input_length;  
+      steps = (N_FRAMES - i) < num_steps ? (N_FRAMES - i) : num_steps;
       output_length.dim.vector.length = output_shape.dim.vector.length; 
       output_length.shape_type = output_shape.shape_type; 
-      // Read input frame
-      if(config.precision == XA_NNLIB_GRU_flt32xflt32)
-      {
-        input_length.dim.vector.length  = fread(p_input, sizeof(FLOAT32), input_shape.dim.vector.length, input_file);
-      }
-      else
-      {
-        input_length.dim.vector.length  = fread(p_input, sizeof(vect_t), input_shape.dim.vector.length, input_file);
-      }
+      // Read input frames
+      input_length.dim.vector.length  = fread(p_input, elm_size, steps * input_shape.dim.vector.length, input_file);
       
       input_length.shape_type = input_shape.shape_type;
       
-      if (input_length.dim.vector.length < input_shape.dim.vector.length) 
+      if (input_length.dim.vector.length < steps * input_shape.dim.vector.length) 
       { 
         printf("File end / partial frame \n");
         break;
@@ -948,13 +956,25 @@ int xa_nn_main_process(int argc, char *argv[])
       
       XTPWR_PROFILER_START(0);
       // Process
-      err = xa_nnlib_gru_process(
-                gru_handle, 
-                p_scratch, 
-                p_input, 
-                p_output, 
-                &input_length, 
-                &output_length);
+      if(num_steps > 1)
+      {
+        err = xa_nnlib_gru_process_sequence(
+                  gru_handle, 
+                  p_scratch, 
+                  p_input, 
+                  p_output, 
+                  steps);
+      }
+      else
+      {
+        err = xa_nnlib_gru_process(
+                  gru_handle, 
+                  p_scratch, 
+                  p_input, 
+                  p_output, 
+                  &input_length, 
+                  &output_length);
+      }
       XTPWR_PROFILER_STOP(0);
 
       if(XA_NNLIB_NO_ERROR != err)
@@ -966,41 +986,33 @@ int xa_nn_main_process(int argc, char *argv[])
       PRINT_VAR(input_length.dim.vector.length);
       PRINT_VAR(output_length.dim.vector.length);  
       
-      // Write output frame
-      if(config.precision == XA_NNLIB_GRU_flt32xflt32)
-      {
-        fwrite(p_output, sizeof(FLOAT32), output_length.dim.vector.length, output_file);
-      }
-      else
-      {
-        fwrite(p_output, sizeof(vect_t), output_length.dim.vector.length, output_file);
-      }
+      // Write output frames
+      fwrite(p_output, elm_size, steps * output_length.dim.vector.length, output_file);
 
 #ifdef VERIFY
       {
+        int j;
         if(verify_flag)
         {
-          if(config.precision == XA_NNLIB_GRU_flt32xflt32)
-          {
-            fread(output_ref,sizeof(FLOAT32),output_shape.dim.vector.length,output_ref_file);
-          }
-          else
+          for(j = 0; j < steps; j++)
           {
-            fread(output_ref,sizeof(vect_t),output_shape.dim.vector.length,output_ref_file);
-          }
-          if(config.precision == XA_NNLIB_GRU_flt32xflt32)
-          {
-            if(XA_NNLIB_NO_ERROR != comparef32((FLOAT32 *)p_output, (FLOAT32 *)output_ref, output_length.dim.vector.length, 2))
+            void *p_out_frame = (char *)p_output + j * output_length.dim.vector.length * elm_size;
+
+            fread(output_ref,elm_size,output_shape.dim.vector.length,output_ref_file);
+            if(config.precision == XA_NNLIB_GRU_flt32xflt32)
             {
-              verify_pass = 0;
+              if(XA_NNLIB_NO_ERROR != comparef32((FLOAT32 *)p_out_frame, (FLOAT32 *)output_ref, output_length.dim.vector.length, 2))
+              {
+                verify_pass = 0;
+              }
             }
-          }
-          else
-          {
-            if(XA_NNLIB_NO_ERROR != compare(p_output, output_ref, output_length.dim.vector.length))
+            else
             {
-              verify_pass = 0;
-            }            
+              if(XA_NNLIB_NO_ERROR != compare((vect_t *)p_out_frame, output_ref, output_length.dim.vector.length))
+              {
+                verify_pass = 0;
+              }            
+            }
           }
         }
       }
@@ -49,6 +49,8 @@ char pb_input_file_path[XA_MAX_FILE_PATH_LENGTH] = "";
 char pb_output_file_path[XA_MAX_FILE_PATH_LENGTH] = "";
 char pb_ref_file_path[XA_MAX_FILE_PATH_LENGTH] = "";
 char pb_context_file_path[XA_MAX_FILE_PATH_LENGTH] = "";
+int gate_interleave = 0;
+int num_steps = 1;
 
 #define CHECK_PTR(ptr, context) \
   if(NULL == ptr) {printf("%s: Failed\n", context); return -1;}
@@ -151,6 +153,10 @@ static inline void error_code_parse(int error_code)
     case XA_NNLIB_LSTM_EXECUTE_FATAL_INSUFFICIENT_DATA:
       printf("\nInsufficient data, Exiting\n");
       break;
+    case XA_NNLIB_LSTM_CONFIG_FATAL_INVALID_NUM_STEPS:
+    case XA_NNLIB_LSTM_EXECUTE_FATAL_INVALID_NUM_STEPS:
+      printf("\nInvalid number of steps, Exiting\n");
+      break;
     default:
       printf("\nUnknown error condition, Exiting\n");
       break;
@@ -166,6 +172,8 @@ void show_usage(void)
   printf("--mat_prec:         \t Coefficient precision (Default=16)           \t  Must be 8 or 16\n");
   printf("--vec_prec:         \t Input precision (Default=16)                 \t  Must be 16\n");
   printf("--verify:           \t Verify output against ref output (Default=1) \t  Supported values: 0:-Disable  1:-Enable\n");
+  printf("--gate_interleave:  \t Use gate-interleaved weights (Default=0)     \t  Supported values: 0:-Disable  1:-Enable\n");
+  printf("--num_steps:        \t Frames per process call (Default=1)          \t  Values >1 use xa_nnlib_lstm_process_sequence\n");
   printf("--input_file:       \t File containing input shape\n");
   printf("--filter_path:      \t Path where file containing filter are stored\n");
   printf("--output_file:      \t File to which output will be written\n");
@@ -355,6 +363,62 @@ void *setup_weights_and_biases(xa_nnlib_lstm_weights_t *weights,
   return NULL;
 }
 
+/* Builds the gate-interleaved (f, i, c, o) copy of the per-gate weights */
+void *setup_gate_weights(xa_nnlib_lstm_gate_weights_t *gate_weights,
+    xa_nnlib_lstm_weights_t *weights,
+    int in_feats, int out_feats, int pad_flag,
+    xa_nnlib_lstm_precision_t precision)
+{
+  int pad = XA_PAD_BYTES*pad_flag;
+  int bytes = (precision == XA_NNLIB_LSTM_16bx16b) ? sizeof(coeff_t) : sizeof(coeff8_t);
+  int x_stride = (in_feats + pad) * bytes;
+  int h_stride = (out_feats + pad) * bytes;
+  char *src_x[4], *src_h[4];
+  char *w_x, *w_h;
+  int r, g;
+
+  CHECK_PTR_RETURN_NULL(gate_weights, "Allocation for gate weights");
+  CHECK_PTR_RETURN_NULL(weights, "Allocation for gate weights");
+
+  w_x = malloc(4 * out_feats * (x_stride + h_stride));
+  CHECK_PTR_RETURN_NULL(w_x, "Allocation for gate weights");
+  w_h = w_x + 4 * out_feats * x_stride;
+
+  if(precision == XA_NNLIB_LSTM_16bx16b)
+  {
+    src_x[0] = (char *)weights->weights16.w_xf; src_h[0] = (char *)weights->weights16.w_hf;
+    src_x[1] = (char *)weights->weights16.w_xi; src_h[1] = (char *)weights->weights16.w_hi;
+    src_x[2] = (char *)weights->weights16.w_xc; src_h[2] = (char *)weights->weights16.w_hc;
+    src_x[3] = (char *)weights->weights16.w_xo; src_h[3] = (char *)weights->weights16.w_ho;
+    gate_weights->weights16.w_x = (coeff_t *)w_x;
+    gate_weights->weights16.w_h = (coeff_t *)w_h;
+    FILL_SHAPE_MATRIX(gate_weights->weights16.shape_w_x, 4 * out_feats, in_feats);
+    FILL_SHAPE_MATRIX(gate_weights->weights16.shape_w_h, 4 * out_feats, out_feats);
+  }
+  else
+  {
+    src_x[0] = (char *)weights->weights8.w_xf; src_h[0] = (char *)weights->weights8.w_hf;
+    src_x[1] = (char *)weights->weights8.w_xi; src_h[1] = (char *)weights->weights8.w_hi;
+    src_x[2] = (char *)weights->weights8.w_xc; src_h[2] = (char *)weights->weights8.w_hc;
+    src_x[3] = (char *)weights->weights8.w_xo; src_h[3] = (char *)weights->weights8.w_ho;
+    gate_weights->weights8.w_x = (coeff8_t *)w_x;
+    gate_weights->weights8.w_h = (coeff8_t *)w_h;
+    FILL_SHAPE_MATRIX(gate_weights->weights8.shape_w_x, 4 * out_feats, in_feats);
+    FILL_SHAPE_MATRIX(gate_weights->weights8.shape_w_h, 4 * out_feats, out_feats);
+  }
+
+  for(r = 0; r < out_feats; r++)
+  {
+    for(g = 0; g < 4; g++)
+    {
+      memcpy(w_x + (4*r + g) * x_stride, src_x[g] + r * x_stride, x_stride);
+      memcpy(w_h + (4*r + g) * h_stride, src_h[g] + r * h_stride, h_stride);
+    }
+  }
+
+  return w_x;
+}
+
 #ifdef VERIFY
 #define ABS(A) (((A) < 0) ? -(A):(A))
 
@@ -445,6 +509,8 @@ int default_config(xa_nnlib_lstm_init_config_t *config,
     config->io_Qformat = 12;
     config->cell_Qformat = 25;
     *verify_flag=1;
+    gate_interleave = 0;
+    num_steps = 1;
     input_file_name[0] = '\0';
     filter_path[0] = '\0';
     output_file_name[0] = '\0';
@@ -492,6 +558,8 @@ void parse_arguments(int argc, char** argv,
     ARGTYPE_ONETIME_CONFIG("--mat_prec",config->mat_prec);
     ARGTYPE_ONETIME_CONFIG("--vec_prec",config->vec_prec);
     ARGTYPE_ONETIME_CONFIG("--verify",*verify_flag);
+    ARGTYPE_ONETIME_CONFIG("--gate_interleave",gate_interleave);
+    ARGTYPE_ONETIME_CONFIG("--num_steps",num_steps);
     ARGTYPE_STRING("--input_file", input_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
     ARGTYPE_STRING("--filter_path", filter_path, XA_MAX_FILE_PATH_LENGTH);
     ARGTYPE_STRING("--output_file", output_file_name, XA_MAX_FULL_FILE_NAME_LENGTH);
@@ -522,6 +590,7 @@ int xa_nn_main_process(int argc, char *argv[])
   char profiler_name[MAX_PROFILER_NAME_LENGTH];
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
   void *p_weights_biases;
+  void *p_gate_weights = NULL;
   xa_nnlib_handle_t lstm_handle;
   void *p_scratch;
   FILE *input_file;
@@ -624,7 +693,11 @@ int xa_nn_main_process(int argc, char *argv[])
       error_code_parse(persistent_size);
       return persistent_size;
     }
-    scratch_size = xa_nnlib_lstm_get_scratch_fast(&config);   PRINT_VAR(scratch_size)
+    if(num_steps > 1)
+      scratch_size = xa_nnlib_lstm_get_scratch_sequence_fast(&config, num_steps);
+    else
+      scratch_size = xa_nnlib_lstm_get_scratch_fast(&config);
+    PRINT_VAR(scratch_size)
     if(scratch_size < 0)
     {
       error_code_parse(scratch_size);
@@ -680,6 +753,28 @@ int xa_nn_main_process(int argc, char *argv[])
       error_code_parse(err);
       return err;
     }
+
+    if(gate_interleave)
+    {
+      xa_nnlib_lstm_gate_weights_t gate_weights;
+
+      p_gate_weights = setup_gate_weights(
+          &gate_weights,
+          &weights,
+          config.in_feats,
+          config.out_feats,
+          config.pad,
+          config.precision);
+
+      CHECK_PTR(p_gate_weights, "Allocation for p_gate_weights");
+
+      err=xa_nnlib_lstm_set_config(lstm_handle, XA_NNLIB_LSTM_GATE_WEIGHT, &gate_weights);
+      if(XA_NNLIB_NO_ERROR != err)
+      {
+        error_code_parse(err);
+        return err;
+      }
+    }
   }
 
 
@@ -774,11 +869,11 @@ int xa_nn_main_process(int argc, char *argv[])
     CHECK_PTR(output_cell_file, "Allocation for output_cell_file");
 
     /* Allocate input and output buffer */
-    input_buffer_size = input_shape.dim.vector.length * sizeof(vect_t);
+    input_buffer_size = num_steps * input_shape.dim.vector.length * sizeof(vect_t);
     p_input   = malloc(input_buffer_size); PRINT_VAR(input_buffer_size);
     CHECK_PTR(p_input, "Allocation for p_input");
 
-    output_buffer_size = output_shape.dim.vector.length * sizeof(vect_t);
+    output_buffer_size = num_steps * output_shape.dim.vector.length * sizeof(vect_t);
     p_output = malloc(output_buffer_size); PRINT_VAR(output_buffer_size);
     CHECK_PTR(p_output, "Allocation for p_output");
 
@@ -828,19 +923,22 @@ int xa_nn_main_process(int argc, char *argv[])
 
     xa_nnlib_shape_t output_length;
     xa_nnlib_shape_t input_length;  
+    int steps = 1;
     
     /* Execution Loop */
     PRINT_STR("LSTM Process loop starts");
-    for(i = 0;i < N_FRAMES; i++)
+    for(i = 0;i < N_FRAMES; i += steps)
     {
+      steps = (N_FRAMES - i) < num_steps ? (N_FRAMES - i) : num_steps;
+
       output_length.dim.vector.length = output_shape.dim.vector.length; 
       output_length.shape_type = output_shape.shape_type; 
       
-      // Read input frame
-      input_length.dim.vector.length  = fread(p_input, sizeof(vect_t), input_shape.dim.vector.length, input_file);
+      // Read input frames
+      input_length.dim.vector.length  = fread(p_input, sizeof(vect_t), steps * input_shape.dim.vector.length, input_file);
       input_length.shape_type = input_shape.shape_type;
 
-      if (input_length.dim.vector.length < input_shape.dim.vector.length) 
+      if (input_length.dim.vector.length < steps * input_shape.dim.vector.length) 
       { 
         printf("File end / partial frame \n");
         break;
@@ -848,13 +946,25 @@ int xa_nn_main_process(int argc, char *argv[])
 
       XTPWR_PROFILER_START(0);
       // Process
-      err = xa_nnlib_lstm_process(
-              lstm_handle, 
-              p_scratch, 
-              p_input, 
-              p_output, 
-              &input_length, 
-              &output_length);
+      if(num_steps > 1)
+      {
+        err = xa_nnlib_lstm_process_sequence(
+                lstm_handle, 
+                p_scratch, 
+                p_input, 
+                p_output, 
+                steps);
+      }
+      else
+      {
+        err = xa_nnlib_lstm_process(
+                lstm_handle, 
+                p_scratch, 
+                p_input, 
+                p_output, 
+                &input_length, 
+                &output_length);
+      }
       XTPWR_PROFILER_STOP(0);
 
       if(XA_NNLIB_NO_ERROR != err)
@@ -866,17 +976,21 @@ int xa_nn_main_process(int argc, char *argv[])
       PRINT_VAR(input_length.dim.vector.length);
       PRINT_VAR(output_length.dim.vector.length);  
 
-      // Write output frame
-      fwrite(p_output, sizeof(vect_t), output_length.dim.vector.length, output_file);
+      // Write output frames
+      fwrite(p_output, sizeof(vect_t), steps * output_length.dim.vector.length, output_file);
 
 #ifdef VERIFY
       {
+        int j;
         if(verify_flag)
         {
-          fread(output_ref,sizeof(vect_t),output_shape.dim.vector.length,output_ref_file);
-          if(XA_NNLIB_NO_ERROR != compare(p_output, output_ref, output_length.dim.vector.length))
+          for(j = 0; j < steps; j++)
           {
-            verify_pass = 0;
+            fread(output_ref,sizeof(vect_t),output_shape.dim.vector.length,output_ref_file);
+            if(XA_NNLIB_NO_ERROR != compare(p_output + j * output_length.dim.vector.length, output_ref, output_length.dim.vector.length))
+            {
+              verify_pass = 0;
+            }
           }
         }
       }
@@ -938,6 +1052,7 @@ int xa_nn_main_process(int argc, char *argv[])
 
 #ifndef CONSTANT_WEIGHTS  
   free(p_weights_biases);
+  free(p_gate_weights);
 #endif
 
   return 0;
@@ -28,6 +28,7 @@
 #include "nnlib/xa_nnlib_api.h"
 #include "nnlib/xa_nnlib_standards.h"
 #include "xt_manage_buffers.h"
+#include "xt_bench_mode.h"
 #include "cmdline_parser.h"
 #include "file_io.h"
 #include "stdbool.h"
@@ -75,6 +76,8 @@ typedef struct _test_config_t
   int membank_padding;
   int frames;
   int write_file;
+  int bench;
+  int warmup;
   char read_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
   char read_ref_file_name[XA_MAX_CMD_LINE_LENGTH];
   char write_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
@@ -82,7 +85,10 @@ typedef struct _test_config_t
   int verify;
   int batch;
   int fc;
+  int fc_batch;
   int matmul;
+  int concat_pad;
+  int epilogue;
 }test_config_t;
 
 int default_config(test_config_t *p_cfg)
@@ -115,6 +121,8 @@ int default_config(test_config_t *p_cfg)
     p_cfg->membank_padding = 1;
     p_cfg->frames   = 2;  
     p_cfg->write_file = 0;  
+    p_cfg->bench = 0;
+    p_cfg->warmup = 0;
     p_cfg->read_inp_file_name[0] = '\0';
     p_cfg->read_ref_file_name[0] = '\0';
     p_cfg->write_inp_file_name[0]='\0';
@@ -122,6 +130,9 @@ int default_config(test_config_t *p_cfg)
     p_cfg->verify = 1;
     p_cfg->batch = 0;
     p_cfg->fc = 0;
+    p_cfg->fc_batch = 0;
+    p_cfg->concat_pad = 0;
+    p_cfg->epilogue = 0;
     p_cfg->matmul = 0;
 
     return 0;
@@ -159,6 +170,8 @@ void show_usage(void)
     printf("\t-frames: Positive number; Default=2\n");
     printf("\t-activation: sigmoid, tanh; Default="" : bypass i.e. no activation for output.\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
+    printf("\t-bench: set to 1 to profile on random inputs, no input/output/reference files are used; Default=0\n");
+    printf("\t-warmup: frames run before the profiled frames, not included in the profile; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - mat1, vec1, mat2, vec2, bias) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
     printf("\t-write_inp_file_name: Full filename for writing inputs (order - mat1, vec1, mat2, vec2, bias) \n");
@@ -167,6 +180,10 @@ void show_usage(void)
     printf("\t-batch: Flag to check time batching; 0: Disable, 1: Enable; Default=0\n");
     printf("\t-matmul: Flag for matmul, only xa_nn_matmul_asym8sxasym8s_asym8s; 0: Disable, 1: Enable; Default=0\n");
     printf("\t-fc: Flag for fully connected; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t-fc_batch: Flag for batched fully connected over -vec_count inputs, only asym8s and sym8sxasym8s; 0: Disable, 1: Enable; Default=0\n");
+    printf("\t       -batch 1 and -fc_batch 1 with asym8s/sym8sxasym8s also check the output bitexact against the single vector kernel\n");
+    printf("\t-concat_pad: Applicable only for -fc_batch 1 with sym8sxasym8s, >0 (also run the out_stride kernel into the middle of a concat with concat_pad elements on each side of every output row, checked against the output); Default=0\n");
+    printf("\t-epilogue: Applicable only for -fc_batch 1 with sym8sxasym8s, 0 or 1 (also run the _epilogue_ kernel with a residual add, clamp and table, checked against the output followed by xa_nn_elm_add_asym8sxasym8s_asym8s and xa_nn_vec_lut_asym8s_asym8s); Default=0\n");
 }
 
 void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
@@ -208,6 +225,8 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-membank_padding",p_cfg->membank_padding);
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
     ARGTYPE_ONETIME_CONFIG("-write_file",p_cfg->write_file);
+    ARGTYPE_ONETIME_CONFIG("-bench",p_cfg->bench);
+    ARGTYPE_ONETIME_CONFIG("-warmup",p_cfg->warmup);
     ARGTYPE_STRING("-read_inp_file_name",p_cfg->read_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-read_ref_file_name",p_cfg->read_ref_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-write_inp_file_name",p_cfg->write_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
@@ -215,6 +234,9 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_ONETIME_CONFIG("-verify",p_cfg->verify);
     ARGTYPE_ONETIME_CONFIG("-batch",p_cfg->batch);
     ARGTYPE_ONETIME_CONFIG("-fc",p_cfg->fc);
+    ARGTYPE_ONETIME_CONFIG("-fc_batch",p_cfg->fc_batch);
+    ARGTYPE_ONETIME_CONFIG("-concat_pad",p_cfg->concat_pad);
+    ARGTYPE_ONETIME_CONFIG("-epilogue",p_cfg->epilogue);
     ARGTYPE_ONETIME_CONFIG("-matmul",p_cfg->matmul);
     
     // If arg doesnt match with any of the above supported options, report option as invalid
@@ -330,6 +352,28 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
       XTPWR_PROFILER_STOP(0);\
     }
 
+#define MAT_VEC_MUL_FC_BATCH_FN_ASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_fully_connected_batch_asym8sxasym8s_asym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+          cfg.cols1, cfg.rows, cfg.vec_count, \
+          cfg.mat1_zero_bias, cfg.inp1_zero_bias, \
+          cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+
+#define MAT_VEC_MUL_FC_BATCH_FN_SYM8SXASYM8S(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_fully_connected_batch_sym8sxasym8s_asym8s ( \
+          (WORD8 *)p_out->p, (WORD8 *) p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p, \
+          cfg.cols1, cfg.rows, cfg.vec_count, \
+          cfg.inp1_zero_bias, \
+          cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+
 #define MAT_VEC_MUL_FC_FN_SYM8SXSYM16S(MPREC, VPREC, OPREC) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
       XTPWR_PROFILER_START(0);\
@@ -413,6 +457,48 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
       XTPWR_PROFILER_STOP(0);\
     }
 
+#define MAT_VEC_MUL_FN_ASYM8S_BATCH(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      int i;\
+      WORD8 **pp_vec1; WORD8 **pp_out;\
+      pp_vec1 = (WORD8 **)malloc(sizeof(WORD8 *)*cfg.vec_count);\
+      pp_out = (WORD8 **)malloc(sizeof(WORD8 *)*cfg.vec_count);\
+      for (i=0; i<cfg.vec_count; i++){\
+        *((WORD8 **) pp_vec1 + i) =  ((WORD8 *)p_vec1->p + i*cfg.cols1);\
+        *((WORD8 **) pp_out + i) = ((WORD8 *)p_out->p + i*cfg.rows);\
+      }\
+      err = xa_nn_matXvec_batch_asym8sxasym8s_asym8s ( \
+          (WORD8 **)pp_out, (WORD8 *) p_mat1->p, (const WORD8 **)pp_vec1, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, \
+          cfg.vec_count, cfg.mat1_zero_bias, cfg.inp1_zero_bias, \
+          cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      free(pp_vec1);\
+      free(pp_out);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+
+#define MAT_VEC_MUL_FN_SYM8SXASYM8S_BATCH(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      int i;\
+      WORD8 **pp_vec1; WORD8 **pp_out;\
+      pp_vec1 = (WORD8 **)malloc(sizeof(WORD8 *)*cfg.vec_count);\
+      pp_out = (WORD8 **)malloc(sizeof(WORD8 *)*cfg.vec_count);\
+      for (i=0; i<cfg.vec_count; i++){\
+        *((WORD8 **) pp_vec1 + i) =  ((WORD8 *)p_vec1->p + i*cfg.cols1);\
+        *((WORD8 **) pp_out + i) = ((WORD8 *)p_out->p + i*cfg.rows);\
+      }\
+      err = xa_nn_matXvec_batch_sym8sxasym8s_asym8s ( \
+          (WORD8 **)pp_out, (WORD8 *) p_mat1->p, (const WORD8 **)pp_vec1, (WORD32 *)p_bias->p, \
+          cfg.rows, cfg.cols1, p_mat1->row_offset, \
+          cfg.vec_count, cfg.inp1_zero_bias, \
+          cfg.out_multiplier, cfg.out_shift, cfg.out_zero_bias);\
+      free(pp_vec1);\
+      free(pp_out);\
+      XTPWR_PROFILER_STOP(0);\
+    }
+
 #define MAT_VEC_MUL_FN_8X8_ASYM16S_BATCH(MPREC, VPREC, OPREC) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
       /*memset(p_out->p, 0xe8, p_out->length*p_out->bytes_per_element);*/ \
@@ -444,6 +530,15 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
       XTPWR_PROFILER_STOP(0);\
     }
 
+#define MAT_VEC_MUL_FN_F16(MPREC, VPREC, OPREC) \
+    if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
+      XTPWR_PROFILER_START(0);\
+      err = xa_nn_matXvec_f16xf16_f16 ( \
+          (WORD16 *)p_out->p, (WORD16 *) p_mat1->p, (WORD16 *) p_mat2->p, (WORD16 *)p_vec1->p, (WORD16 *)p_vec2->p, (WORD16 *)p_bias->p, \
+          cfg.rows, cfg.cols1, cfg.cols2, p_mat1->row_offset, p_mat2->row_offset); \
+      XTPWR_PROFILER_STOP(0);\
+    }
+
 #define MAT_VEC_MUL_FN_F32_BATCH(MPREC, VPREC, OPREC) \
     if((MPREC == p_mat1->precision) && (VPREC == p_vec1->precision) && (OPREC == p_out->precision)) {\
       XTPWR_PROFILER_START(0);\
@@ -564,6 +659,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MAT_VEC_MUL_ACTIVATION_FN_F32(-1, -1, -1, sigmoid) \
     else MAT_VEC_MUL_ACTIVATION_FN_F32(-1, -1, -1, tanh) \
     else MAT_VEC_MUL_FN_F32(-1, -1, -1) \
+    else MAT_VEC_MUL_FN_F16(-2, -2, -2) \
     else {  printf("unsupported multiplication\n"); return -1;} 
 #else
 #define PROCESS_MATXVEC \
@@ -591,7 +687,6 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
 #endif
 
 #if HIFI_VFPU 
-#if HIFI_HP_VFPU && hifi5
 #define PROCESS_MATXVEC_FC \
     MAT_VEC_MUL_FC_FN(16, 16, 16) \
     else MAT_VEC_MUL_FC_FN(8, 16, 16) \
@@ -604,33 +699,7 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MAT_VEC_MUL_FC_FN_F32(-1, -1, -1) \
     else MAT_VEC_MUL_FC_FN_F16(-2, -2, -2) \
     else {  printf("unsupported multiplication\n"); return -1;} 
-#else /* HIFI_HP_VFPU && hifi5 */
-#define PROCESS_MATXVEC_FC \
-    MAT_VEC_MUL_FC_FN(16, 16, 16) \
-    else MAT_VEC_MUL_FC_FN(8, 16, 16) \
-    else MAT_VEC_MUL_FC_FN(8, 8, 8) \
-    else MAT_VEC_MUL_FC_FN_ASYM8(-3, -3, -3) \
-    else MAT_VEC_MUL_FC_FN_ASYM8S(-4, -4, -4) \
-    else MAT_VEC_MUL_FC_FN_ASYM4S(-13, -4, -4) \
-    else MAT_VEC_MUL_FC_FN_SYM8SXASYM8S(-5, -4, -4) \
-    else MAT_VEC_MUL_FC_FN_SYM8SXSYM16S(-5, -8, -8) \
-    else MAT_VEC_MUL_FC_FN_F32(-1, -1, -1) \
-    else {  printf("unsupported multiplication\n"); return -1;} 
-#endif /* HIFI_HP_VFPU && hifi5 */
 #else /* HIFI_VFPU */
-#if HIFI_HP_VFPU && hifi5 /* HIFI_HP_VFPU && hifi5 */
-#define PROCESS_MATXVEC_FC \
-    MAT_VEC_MUL_FC_FN(16, 16, 16) \
-    else MAT_VEC_MUL_FC_FN(8, 16, 16) \
-    else MAT_VEC_MUL_FC_FN(8, 8, 8) \
-    else MAT_VEC_MUL_FC_FN_ASYM8(-3, -3, -3) \
-    else MAT_VEC_MUL_FC_FN_ASYM8S(-4, -4, -4) \
-    else MAT_VEC_MUL_FC_FN_ASYM4S(-13, -4, -4) \
-    else MAT_VEC_MUL_FC_FN_SYM8SXASYM8S(-5, -4, -4) \
-    else MAT_VEC_MUL_FC_FN_SYM8SXSYM16S(-5, -8, -8) \
-    else MAT_VEC_MUL_FC_FN_F32(-2, -2, -2) \
-    else {  printf("unsupported multiplication\n"); return -1;}
-#else/* HIFI_HP_VFPU && hifi5 */
 #define PROCESS_MATXVEC_FC \
     MAT_VEC_MUL_FC_FN(16, 16, 16) \
     else MAT_VEC_MUL_FC_FN(8, 16, 16) \
@@ -641,15 +710,21 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MAT_VEC_MUL_FC_FN_SYM8SXASYM8S(-5, -4, -4) \
     else MAT_VEC_MUL_FC_FN_SYM8SXSYM16S(-5, -8, -8) \
     else {  printf("unsupported multiplication\n"); return -1;}
-#endif/* HIFI_HP_VFPU && hifi5 */
 #endif /* HIFI_VFPU */
 
+#define PROCESS_MATXVEC_FC_BATCH \
+    MAT_VEC_MUL_FC_BATCH_FN_ASYM8S(-4, -4, -4) \
+    else MAT_VEC_MUL_FC_BATCH_FN_SYM8SXASYM8S(-5, -4, -4) \
+    else {  printf("unsupported multiplication\n"); return -1;}
+
 #if HIFI_VFPU 
 #define PROCESS_MATXVEC_BATCH \
     MAT_VEC_MUL_FN_BATCH(16, 16, 64) \
     else MAT_VEC_MUL_FN_BATCH(8, 16, 64) \
     else MAT_VEC_MUL_FN_BATCH(8, 8, 32) \
     else MAT_VEC_MUL_FN_ASYM8_BATCH(-3, -3, -3) \
+    else MAT_VEC_MUL_FN_ASYM8S_BATCH(-4, -4, -4) \
+    else MAT_VEC_MUL_FN_SYM8SXASYM8S_BATCH(-5, -4, -4) \
     else MAT_VEC_MUL_FN_8X8_ASYM16S_BATCH(-5, 8, -7) \
     else MAT_VEC_MUL_FN_F32_BATCH(-1, -1, -1) \
     else {  printf("unsupported multiplication\n"); return -1;} 
@@ -659,12 +734,13 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MAT_VEC_MUL_FN_BATCH(8, 16, 64) \
     else MAT_VEC_MUL_FN_BATCH(8, 8, 32) \
     else MAT_VEC_MUL_FN_ASYM8_BATCH(-3, -3, -3) \
+    else MAT_VEC_MUL_FN_ASYM8S_BATCH(-4, -4, -4) \
+    else MAT_VEC_MUL_FN_SYM8SXASYM8S_BATCH(-5, -4, -4) \
     else MAT_VEC_MUL_FN_8X8_ASYM16S_BATCH(-5, 8, -7) \
     else {  printf("unsupported multiplication\n"); return -1;} 
 #endif
 
 #if HIFI_VFPU
-#if HIFI_HP_VFPU && hifi5
 #define PROCESS_MATMUL \
     MATMUL_FN_ASYM8S(-4, -4, -4) \
     else MATMUL_FN_SYM8S_SYM16S(-5, -8, -8) \
@@ -681,30 +757,133 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MATMUL_FN_SYM4S_ASYM8S(-13, -4, -4) \
     else MATMUL_FN_PLAIN(8, 16, 16) \
     else MATMUL_FN_PLAIN(16, 16, 16) \
-    else MATMUL_FN_PLAIN_F32(-1, -1, -1) \
     else { printf("unsupported multiplication\n"); return -1;}
-#endif //HIFI_HP_VFPU && hifi5 end
-#else
-#if HIFI_HP_VFPU && hifi5
-#define PROCESS_MATMUL \
-    MATMUL_FN_ASYM8S(-4, -4, -4) \
-    else MATMUL_FN_SYM8S_SYM16S(-5, -8, -8) \
-    else MATMUL_FN_SYM4S_ASYM8S(-13, -4, -4) \
-    else MATMUL_FN_PLAIN(8, 16, 16) \
-    else MATMUL_FN_PLAIN(16, 16, 16) \
-    else MATMUL_FN_PLAIN_F16(-2, -2, -2) \
-    else { printf("unsupported multiplication\n"); return -1;}
-#else
-#define PROCESS_MATMUL \
-    MATMUL_FN_ASYM8S(-4, -4, -4) \
-    else MATMUL_FN_SYM8S_SYM16S(-5, -8, -8) \
-    else MATMUL_FN_SYM4S_ASYM8S(-13, -4, -4) \
-    else MATMUL_FN_PLAIN(8, 16, 16) \
-    else MATMUL_FN_PLAIN(16, 16, 16) \
-    else { printf("unsupported multiplication\n"); return -1;}
-#endif //HIFI_HP_VFPU && hifi5 end
 #endif
 
+/* Runs the single vector kernel on each of the vec_count inputs and compares
+ * its output with the batched kernel output in p_out. Used for -batch 1 and
+ * -fc_batch 1 with asym8s and sym8sxasym8s, returns 1 on a bitexact match. */
+static int check_batch_with_single_vec(test_config_t *p_cfg, buf2D_t *p_mat1, buf1D_t *p_vec1, buf1D_t *p_bias, buf1D_t *p_out)
+{
+  int i, err = 0, match = 1;
+  WORD8 *p_ref, *p_vec;
+
+  p_ref = (WORD8 *)malloc(p_cfg->rows);
+  if(p_ref == NULL)
+  {
+    printf("p_ref: allocation failed\n");
+    return 0;
+  }
+
+  for(i = 0; i < p_cfg->vec_count && match; i++)
+  {
+    p_vec = (WORD8 *)p_vec1->p + i*p_cfg->cols1;
+    if(p_cfg->fc_batch == 1 && p_mat1->precision == -4)
+    {
+      err = xa_nn_fully_connected_asym8sxasym8s_asym8s(p_ref, (WORD8 *)p_mat1->p, p_vec, (WORD32 *)p_bias->p,
+          p_cfg->cols1, p_cfg->rows, p_cfg->mat1_zero_bias, p_cfg->inp1_zero_bias,
+          p_cfg->out_multiplier, p_cfg->out_shift, p_cfg->out_zero_bias);
+    }
+    else if(p_cfg->fc_batch == 1)
+    {
+      err = xa_nn_fully_connected_sym8sxasym8s_asym8s(p_ref, (WORD8 *)p_mat1->p, p_vec, (WORD32 *)p_bias->p,
+          p_cfg->cols1, p_cfg->rows, p_cfg->inp1_zero_bias,
+          p_cfg->out_multiplier, p_cfg->out_shift, p_cfg->out_zero_bias);
+    }
+    else if(p_mat1->precision == -4)
+    {
+      err = xa_nn_matXvec_asym8sxasym8s_asym8s(p_ref, (WORD8 *)p_mat1->p, NULL, p_vec, NULL, (WORD32 *)p_bias->p,
+          p_cfg->rows, p_cfg->cols1, 0, p_mat1->row_offset, 0,
+          p_cfg->mat1_zero_bias, 0, p_cfg->inp1_zero_bias, 0,
+          p_cfg->out_multiplier, p_cfg->out_shift, p_cfg->out_zero_bias);
+    }
+    else
+    {
+      err = xa_nn_matXvec_sym8sxasym8s_asym8s(p_ref, (WORD8 *)p_mat1->p, NULL, p_vec, NULL, (WORD32 *)p_bias->p,
+          p_cfg->rows, p_cfg->cols1, 0, p_mat1->row_offset, 0,
+          p_cfg->inp1_zero_bias, 0,
+          p_cfg->out_multiplier, p_cfg->out_shift, p_cfg->out_zero_bias);
+    }
+    match = !err && !memcmp(p_ref, (WORD8 *)p_out->p + i*p_cfg->rows, p_cfg->rows);
+  }
+  if(!match)
+  {
+    printf("batch output of vector %d does not match the single vector kernel\n", i - 1);
+  }
+
+  free(p_ref);
+  return match;
+}
+
+/* Runs xa_nn_fully_connected_batch_out_stride_sym8sxasym8s_asym8s into the
+ * middle slice of a concat (-concat_pad) and compares every output row with
+ * the packed batched output in p_out, returns 1 when it matches and the gaps
+ * are untouched. */
+static int check_fc_batch_concat_slice(test_config_t *p_cfg, buf2D_t *p_mat1, buf1D_t *p_vec1, buf1D_t *p_bias, buf1D_t *p_out)
+{
+  int out_stride, err, match;
+  WORD8 *p_buf, *p_slice;
+
+  p_buf = create_concat_slice_buf(p_cfg->vec_count, p_cfg->rows, p_cfg->concat_pad, &p_slice, &out_stride);
+  if(p_buf == NULL)
+  {
+    return 0;
+  }
+  err = xa_nn_fully_connected_batch_out_stride_sym8sxasym8s_asym8s(p_slice, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p,
+      p_cfg->cols1, p_cfg->rows, p_cfg->vec_count, p_cfg->inp1_zero_bias,
+      p_cfg->out_multiplier, p_cfg->out_shift, p_cfg->out_zero_bias, out_stride);
+  match = !err && check_concat_slice_buf(p_buf, (WORD8 *)p_out->p, p_cfg->vec_count, p_cfg->rows, p_cfg->concat_pad);
+  if(!match)
+  {
+    printf("out_stride batch output does not match the batched kernel\n");
+  }
+
+  free(p_buf);
+  return match;
+}
+
+/* Runs xa_nn_fully_connected_batch_epilogue_sym8sxasym8s_asym8s with a
+ * random residual (-epilogue) and compares it with the batched output in p_out
+ * followed by the unfused residual add, clamp and table, returns 1 when it
+ * matches. */
+static int check_fc_batch_epilogue(test_config_t *p_cfg, buf2D_t *p_mat1, buf1D_t *p_vec1, buf1D_t *p_bias, buf1D_t *p_out)
+{
+  int num_elm = p_cfg->vec_count * p_cfg->rows;
+  xa_nn_epilogue_asym8s_t epilogue;
+  WORD8 lut[256];
+  buf1D_t *p_residual;
+  WORD8 *p_epi_out, *p_ref;
+  int err, match = 0;
+
+  p_residual = create_buf1D(num_elm, ASYM8S_TYPE);
+  p_epi_out = (WORD8 *)malloc(num_elm);
+  p_ref = (WORD8 *)malloc(num_elm);
+  if(p_residual != NULL && p_epi_out != NULL && p_ref != NULL)
+  {
+    set_rand_inp_buf1D(p_residual);
+    init_epilogue_check_asym8s(&epilogue, lut);
+    err = xa_nn_fully_connected_batch_epilogue_sym8sxasym8s_asym8s(p_epi_out, (WORD8 *)p_mat1->p, (WORD8 *)p_vec1->p, (WORD32 *)p_bias->p,
+        p_cfg->cols1, p_cfg->rows, p_cfg->vec_count, p_cfg->inp1_zero_bias,
+        p_cfg->out_multiplier, p_cfg->out_shift, p_cfg->out_zero_bias, p_cfg->rows,
+        (WORD8 *)p_residual->p, p_cfg->rows, &epilogue);
+    match = !err &&
+      !epilogue_ref_asym8s(p_ref, (WORD8 *)p_out->p, (WORD8 *)p_residual->p, num_elm, p_cfg->out_zero_bias, &epilogue) &&
+      !memcmp(p_ref, p_epi_out, num_elm);
+  }
+  if(!match)
+  {
+    printf("epilogue batch output does not match the batched kernel followed by the residual add and table\n");
+  }
+
+  free(p_ref);
+  free(p_epi_out);
+  if(p_residual != NULL)
+  {
+    free_buf1D(p_residual);
+  }
+  return match;
+}
+
 int xa_nn_main_process(int argc, char *argv[])
 {
 
@@ -712,6 +891,10 @@ int xa_nn_main_process(int argc, char *argv[])
   int err = 0;
   //int i;
   int pass_count=0;
+  int frame_pass;
+  int check_single_vec;
+  int slice_check;
+  int epilogue_check;
   char profiler_name[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
 
@@ -766,7 +949,10 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
-  if(cfg.fc == 1){
+  // Benchmark mode, random data is generated in place of reading the input file
+  bench_mode_config(cfg.bench, cfg.warmup, &cfg.write_file, &cfg.verify, &cfg.frames);
+
+  if(cfg.fc == 1 || cfg.fc_batch == 1){
     /* In fully connected apis, row_stride is equal to cols, thus setting
      * membank_padding to 0. */
     cfg.membank_padding = 0;
@@ -774,6 +960,13 @@ int xa_nn_main_process(int argc, char *argv[])
     cfg.row_stride2 = cfg.cols2;
   }
 
+  check_single_vec = (cfg.batch == 1 || cfg.fc_batch == 1) &&
+    (cfg.mat_precision == -4 || cfg.mat_precision == -5) && (cfg.inp_precision == -4) && (cfg.out_precision == -4);
+  slice_check = (cfg.concat_pad > 0) && (cfg.fc_batch == 1) &&
+    (cfg.mat_precision == -5) && (cfg.inp_precision == -4) && (cfg.out_precision == -4);
+  epilogue_check = cfg.epilogue && (cfg.fc_batch == 1) &&
+    (cfg.mat_precision == -5) && (cfg.inp_precision == -4) && (cfg.out_precision == -4);
+
   // Set profiler name 
   if((cfg.mat_precision == -1) && (cfg.inp_precision == -1) && (cfg.out_precision == -1))
   {
@@ -804,8 +997,8 @@ int xa_nn_main_process(int argc, char *argv[])
     else{
       sprintf(profiler_name,"matXvec%s_f16xf16_f16",(cfg.batch)? "_batch": "");
     }
-// If HP_VFPU is not supported, return
-    if(!HIFI_HP_VFPU)
+    // If VFPU is not supported, return
+    if(!HIFI_VFPU)
     {
       printf("%s: NOT TESTED\n", profiler_name);
       return 0;
@@ -825,6 +1018,9 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.fc == 1){
       sprintf(profiler_name,"fully_connected_asym8sxasym8s_asym8s");
     }
+    else if(cfg.fc_batch == 1){
+      sprintf(profiler_name,"fully_connected_batch_asym8sxasym8s_asym8s");
+    }
     else if(cfg.matmul == 1) {
       sprintf(profiler_name,"matmul_asym8sxasym8s_asym8s");
     }
@@ -849,6 +1045,9 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.fc == 1){
       sprintf(profiler_name,"fully_connected_sym8sxasym8s_asym8s");
     }
+    else if(cfg.fc_batch == 1){
+      sprintf(profiler_name,"fully_connected_batch_sym8sxasym8s_asym8s");
+    }
     else{
       sprintf(profiler_name,"matXvec%s_sym8sxasym8s_asym8s",(cfg.batch)? "_batch": "");
     }
@@ -902,7 +1101,7 @@ int xa_nn_main_process(int argc, char *argv[])
   }
   
   // Set profiler parameters
-  if(cfg.batch == 1 || cfg.matmul == 1){
+  if(cfg.batch == 1 || cfg.matmul == 1 || cfg.fc_batch == 1){
     sprintf(profiler_params, "rows=%d, cols1=%d, bias_prec=%d, vec_count=%d", 
       cfg.rows, cfg.cols1, cfg.bias_precision,cfg.vec_count);
   }
@@ -917,7 +1116,7 @@ int xa_nn_main_process(int argc, char *argv[])
     /* If write_file (generate test vectors) is enabled, random data would be generated and
        used; the input data and output data generated would be written into files. 
      */
-    fptr_inp = file_open(pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+    fptr_inp = bench_file_open(cfg.bench, pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
   }
   else
   {
@@ -928,7 +1127,7 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   // Open output file
-  fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+  fptr_out = bench_file_open(cfg.bench, pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
   
   // The total size of the output buffer (which will be greater than just rows*columns in case of out_stride kernels)
   out_buffer_size = cfg.rows*cfg.vec_count*cfg.out_stride;
@@ -972,7 +1171,7 @@ int xa_nn_main_process(int argc, char *argv[])
   if(cfg.inp_precision == cfg.out_precision && (!strcmp(cfg.activation, "sigmoid") || !strcmp(cfg.activation, "tanh"))){
     fprintf(stdout, "\nScratch size: %d bytes\n", scratch_size);
   }
-  if(cfg.batch == 1 || cfg.matmul == 1){
+  if(cfg.batch == 1 || cfg.matmul == 1 || cfg.fc_batch == 1){
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (cfg.rows * cfg.cols1 * cfg.vec_count), "MACs/cyc", 1);
   }
   else if(cfg.fc == 1){
@@ -981,6 +1180,13 @@ int xa_nn_main_process(int argc, char *argv[])
   else {
     XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, (cfg.rows * (cfg.cols1 + cfg.cols2)), "MACs/cyc", 1);
   }
+  if(cfg.batch == 1 || cfg.matmul == 1 || cfg.fc == 1 || cfg.fc_batch == 1){
+    XTPWR_PROFILER_BYTES(0, BUF2D_BYTES(p_mat1) + BUF1D_BYTES(p_vec1) + BUF1D_BYTES(p_bias) + BUF1D_BYTES(p_out));
+  }
+  else {
+    XTPWR_PROFILER_BYTES(0, BUF2D_BYTES(p_mat1) + BUF1D_BYTES(p_vec1) + BUF2D_BYTES(p_mat2) + BUF1D_BYTES(p_vec2) + BUF1D_BYTES(p_bias) + BUF1D_BYTES(p_out));
+  }
+  XTPWR_PROFILER_WARMUP(0, cfg.warmup);
 
 
   // Frame processing loop
@@ -993,6 +1199,9 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.batch == 1){
         PROCESS_MATXVEC_BATCH;
     }
+    else if(cfg.fc_batch == 1){
+        PROCESS_MATXVEC_FC_BATCH;
+    }
     else if(cfg.fc == 1){
         PROCESS_MATXVEC_FC;
     }
@@ -1021,20 +1230,34 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.verify)
     {
       read_buf1D_from_file(fptr_ref, ptr_ref);
-      pass_count += compare_buf1D(ptr_ref, p_out, cfg.verify, cfg.out_precision, 1);
+      frame_pass = compare_buf1D(ptr_ref, p_out, cfg.verify, cfg.out_precision, 1);
     }
     else
     {
-      pass_count += !err;
+      frame_pass = !err;
+    }
+    if(check_single_vec)
+    {
+      frame_pass = frame_pass && check_batch_with_single_vec(&cfg, p_mat1, p_vec1, p_bias, p_out);
+    }
+    if(slice_check)
+    {
+      frame_pass = frame_pass && check_fc_batch_concat_slice(&cfg, p_mat1, p_vec1, p_bias, p_out);
+    }
+    if(epilogue_check)
+    {
+      frame_pass = frame_pass && check_fc_batch_epilogue(&cfg, p_mat1, p_vec1, p_bias, p_out);
     }
+    pass_count += frame_pass;
   }
 
-  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), cfg.verify);
+  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), (cfg.verify || check_single_vec || slice_check || epilogue_check));
+  XTPWR_PROFILER_PATHS();
   printf("\r\n");
 
 
-  fclose(fptr_inp);
-  fclose(fptr_out);
+  bench_file_close(fptr_inp);
+  bench_file_close(fptr_out);
   // Free all buffers
   free_buf2D(p_mat1);
   free_buf2D(p_mat2);
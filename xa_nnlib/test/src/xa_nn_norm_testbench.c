@@ -27,6 +27,7 @@
 #include "xa_type_def.h"
 #include "nnlib/xa_nnlib_api.h"
 #include "xt_manage_buffers.h"
+#include "xt_bench_mode.h"
 #include "cmdline_parser.h"
 #include "file_io.h"
 #include "xa_nnlib_standards.h"
@@ -66,6 +67,8 @@ typedef struct _test_config_t
   char kernel_name[MAX_KERNEL_NAME_LENGTH];
   int frames;
   int write_file;
+  int bench;
+  int warmup;
   char read_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
   char read_ref_file_name[XA_MAX_CMD_LINE_LENGTH];
   char write_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
@@ -95,6 +98,8 @@ int default_config(test_config_t *p_cfg)
     strcpy(p_cfg->kernel_name, "l2_norm");
     p_cfg->frames   = 2;
     p_cfg->write_file = 0;
+    p_cfg->bench = 0;
+    p_cfg->warmup = 0;
     p_cfg->read_inp_file_name[0] = '\0';
     p_cfg->read_ref_file_name[0] = '\0';
     p_cfg->write_inp_file_name[0]='\0';
@@ -126,6 +131,8 @@ void show_usage(void)
     printf("\t-frames: Positive number; Default=2\n");
     printf("\t-kernel_name: l2_norm; Default=""l2_norm""\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
+    printf("\t-bench: set to 1 to profile on random inputs, no input/output/reference files are used; Default=0\n");
+    printf("\t-warmup: frames run before the profiled frames, not included in the profile; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
     printf("\t-write_inp_file_name: Full filename for writing inputs (order - inp) \n");
@@ -163,6 +170,8 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_STRING("-kernel_name",p_cfg->kernel_name, MAX_KERNEL_NAME_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
     ARGTYPE_ONETIME_CONFIG("-write_file",p_cfg->write_file);
+    ARGTYPE_ONETIME_CONFIG("-bench",p_cfg->bench);
+    ARGTYPE_ONETIME_CONFIG("-warmup",p_cfg->warmup);
     ARGTYPE_STRING("-read_inp_file_name",p_cfg->read_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-read_ref_file_name",p_cfg->read_ref_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-write_inp_file_name",p_cfg->write_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
@@ -266,6 +275,9 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
+  // Benchmark mode, random data is generated in place of reading the input file
+  bench_mode_config(cfg.bench, cfg.warmup, &cfg.write_file, &cfg.verify, &cfg.frames);
+
   if(!strcmp(cfg.kernel_name, "batch_norm_3D"))
   {
     if(cfg.io_height >= 0 && cfg.io_width >= 0 && cfg.io_channels >= 0)
@@ -326,7 +338,7 @@ int xa_nn_main_process(int argc, char *argv[])
     /* If write_file (generate test vectors) is enabled, random data would be generated and
        used; the input data and output data generated would be written into files.
      */
-    fptr_inp = file_open(pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+    fptr_inp = bench_file_open(cfg.bench, pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
   }
   else
   {
@@ -337,7 +349,7 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   // Open output file
-  fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+  fptr_out = bench_file_open(cfg.bench, pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
 
   // Open reference file if verify flag is enabled
   if(cfg.verify)
@@ -366,6 +378,8 @@ int xa_nn_main_process(int argc, char *argv[])
     num_ops = inp_size;
 
   XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, num_ops, "OPs/cyc", 1);
+  XTPWR_PROFILER_BYTES(0, BUF1D_BYTES(p_inp) + BUF1D_BYTES(p_out));
+  XTPWR_PROFILER_WARMUP(0, cfg.warmup);
 
   // Frame processing loop
   for(frame = 0; frame < cfg.frames; frame++)
@@ -406,8 +420,8 @@ int xa_nn_main_process(int argc, char *argv[])
 
   XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), cfg.verify);
 
-  fclose(fptr_inp);
-  fclose(fptr_out);
+  bench_file_close(fptr_inp);
+  bench_file_close(fptr_out);
 
   // Free all buffers
   free_buf1D(p_inp);
@@ -23,10 +23,12 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <math.h>
 #include <xtensa/config/core-isa.h>
 #include "xa_type_def.h"
 #include "nnlib/xa_nnlib_api.h"
 #include "xt_manage_buffers.h"
+#include "xt_bench_mode.h"
 #include "cmdline_parser.h"
 #include "file_io.h"
 #include "xa_nnlib_standards.h"
@@ -92,6 +94,8 @@ typedef struct _test_config_t
   char kernel_name[MAX_KERNEL_NAME_LENGTH];
   int frames;
   int write_file;
+  int bench;
+  int warmup;
   char read_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
   char read_ref_file_name[XA_MAX_CMD_LINE_LENGTH];
   char write_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
@@ -124,6 +128,8 @@ int default_config(test_config_t *p_cfg)
     strcpy(p_cfg->kernel_name, "avgpool");
     p_cfg->frames   = 2;  
     p_cfg->write_file = 0;  
+    p_cfg->bench = 0;
+    p_cfg->warmup = 0;
     p_cfg->read_inp_file_name[0] = '\0';
     p_cfg->read_ref_file_name[0] = '\0';
     p_cfg->write_inp_file_name[0]='\0';
@@ -155,11 +161,13 @@ void show_usage(void)
     printf("\t-out_width: output width; Default=16\n");
     printf("\t-acc_shift: accumulator left shift; Default=-7\n");
     printf("\t-out_data_format: data format; Default=1 (WHD)\n");
-    printf("\t-inp_precision: 8, 16, -1(single prec float); Default=16\n");
-    printf("\t-out_precision: 8, 16, -1(single prec float); Default=16\n");
+    printf("\t-inp_precision: 8, 16, -1(single prec float), -3 (asym8u), -4 (asym8s), -7 (asym16s); Default=16\n");
+    printf("\t-out_precision: 8, 16, -1(single prec float), -3 (asym8u), -4 (asym8s), -7 (asym16s); Default=16\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: avgpool, maxpool; Default=""avgpool""\n");
+    printf("\t-kernel_name: avgpool, maxpool, global_avgpool, global_maxpool (nhwc, kernel = input plane, out_height = out_width = 1); Default=""avgpool""\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
+    printf("\t-bench: set to 1 to profile on random inputs, no input/output/reference files are used; Default=0\n");
+    printf("\t-warmup: frames run before the profiled frames, not included in the profile; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
     printf("\t-write_inp_file_name: Full filename for writing inputs (order - inp) \n");
@@ -201,6 +209,8 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_STRING("-kernel_name",p_cfg->kernel_name, MAX_KERNEL_NAME_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
     ARGTYPE_ONETIME_CONFIG("-write_file",p_cfg->write_file);
+    ARGTYPE_ONETIME_CONFIG("-bench",p_cfg->bench);
+    ARGTYPE_ONETIME_CONFIG("-warmup",p_cfg->warmup);
     ARGTYPE_STRING("-read_inp_file_name",p_cfg->read_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-read_ref_file_name",p_cfg->read_ref_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-write_inp_file_name",p_cfg->write_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
@@ -271,6 +281,26 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define POOL_KERNEL_ASYM_FN(KERNEL, IPREC, OPREC, PREC, TYPE) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_##PREC( \
+        (TYPE *)p_out->p, (TYPE *)p_inp->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels, cfg.kernel_height, cfg.kernel_width, \
+        cfg.x_stride, cfg.y_stride, cfg.x_padding, cfg.y_padding, cfg.out_height, cfg.out_width, \
+        cfg.inp_data_format, cfg.out_data_format, p_scratch);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define GLOBAL_POOL_KERNEL_FN(KERNEL, IPREC, PREC, TYPE) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision)) {\
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_##PREC( \
+        (TYPE *)p_out->p, (TYPE *)p_inp->p, \
+        cfg.input_height, cfg.input_width, cfg.input_channels);\
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #if HIFI_VFPU
 #define PROCESS_POOL \
     AVGPOOL_KERNEL_FN(avgpool, 16, 16) \
@@ -281,6 +311,18 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MAXPOOL_KERNEL_F_FN(maxpool, -1, -1) \
     else POOL_KERNEL_ASYM8_FN(maxpool, -3, -3) \
     else POOL_KERNEL_ASYM8_FN(avgpool, -3, -3) \
+    else POOL_KERNEL_ASYM_FN(maxpool, -4, -4, asym8s, WORD8) \
+    else POOL_KERNEL_ASYM_FN(avgpool, -4, -4, asym8s, WORD8) \
+    else POOL_KERNEL_ASYM_FN(maxpool, -7, -7, asym16s, WORD16) \
+    else POOL_KERNEL_ASYM_FN(avgpool, -7, -7, asym16s, WORD16) \
+    else GLOBAL_POOL_KERNEL_FN(global_avgpool, 8, 8, WORD8) \
+    else GLOBAL_POOL_KERNEL_FN(global_avgpool, -4, asym8s, WORD8) \
+    else GLOBAL_POOL_KERNEL_FN(global_avgpool, 16, 16, WORD16) \
+    else GLOBAL_POOL_KERNEL_FN(global_maxpool, 8, 8, WORD8) \
+    else GLOBAL_POOL_KERNEL_FN(global_maxpool, -4, asym8s, WORD8) \
+    else GLOBAL_POOL_KERNEL_FN(global_maxpool, 16, 16, WORD16) \
+    else GLOBAL_POOL_KERNEL_FN(global_avgpool, -1, f32, FLOAT32) \
+    else GLOBAL_POOL_KERNEL_FN(global_maxpool, -1, f32, FLOAT32) \
     else {  printf("unsupported pooling operation\n"); return -1;}
 #else
 #define PROCESS_POOL \
@@ -290,15 +332,108 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else MAXPOOL_KERNEL_FN(maxpool, 16, 16) \
     else POOL_KERNEL_ASYM8_FN(maxpool, -3, -3) \
     else POOL_KERNEL_ASYM8_FN(avgpool, -3, -3) \
+    else POOL_KERNEL_ASYM_FN(maxpool, -4, -4, asym8s, WORD8) \
+    else POOL_KERNEL_ASYM_FN(avgpool, -4, -4, asym8s, WORD8) \
+    else POOL_KERNEL_ASYM_FN(maxpool, -7, -7, asym16s, WORD16) \
+    else POOL_KERNEL_ASYM_FN(avgpool, -7, -7, asym16s, WORD16) \
+    else GLOBAL_POOL_KERNEL_FN(global_avgpool, 8, 8, WORD8) \
+    else GLOBAL_POOL_KERNEL_FN(global_avgpool, -4, asym8s, WORD8) \
+    else GLOBAL_POOL_KERNEL_FN(global_avgpool, 16, 16, WORD16) \
+    else GLOBAL_POOL_KERNEL_FN(global_maxpool, 8, 8, WORD8) \
+    else GLOBAL_POOL_KERNEL_FN(global_maxpool, -4, asym8s, WORD8) \
+    else GLOBAL_POOL_KERNEL_FN(global_maxpool, 16, 16, WORD16) \
     else {  printf("unsupported pooling operation\n"); return -1;}
 #endif
 
+/* Global pooling against the windowed kernel run with the window covering
+ * the whole input plane (NHWC, one output pixel). Bit exact, except the
+ * f32 average whose summation order differs. */
+static int check_global_pool(test_config_t *p_cfg, buf1D_t *p_inp, buf1D_t *p_out)
+{
+  int is_avg = !strcmp(p_cfg->kernel_name, "global_avgpool");
+  int ih = p_cfg->input_height, iw = p_cfg->input_width, ic = p_cfg->input_channels;
+  int scratch_size, i, err = -1, match = 1;
+  void *p_scratch, *p_ref;
+
+  if(is_avg)
+    scratch_size = xa_nn_avgpool_getsize(ic, p_cfg->inp_precision, p_cfg->out_precision,
+        ih, iw, ih, iw, 1, 1, 0, 0, 1, 1, 0, 0);
+  else
+    scratch_size = xa_nn_maxpool_getsize(ic, p_cfg->inp_precision, p_cfg->out_precision,
+        ih, iw, ih, iw, 1, 1, 0, 0, 1, 1, 0, 0);
+  if(scratch_size < 0)
+  {
+    printf("%s: no windowed pool to compare with\n", p_cfg->kernel_name);
+    return 0;
+  }
+  p_scratch = malloc(scratch_size);
+  p_ref = malloc(p_out->length * p_out->bytes_per_element);
+  if((scratch_size && p_scratch == NULL) || p_ref == NULL)
+  {
+    free(p_scratch);
+    free(p_ref);
+    return 0;
+  }
+
+#define WINDOWED_POOL(KERNEL, TYPE) \
+  err = xa_nn_##KERNEL((TYPE *)p_ref, (TYPE *)p_inp->p, ih, iw, ic, ih, iw, 1, 1, 0, 0, 1, 1, 0, 0, p_scratch)
+
+  switch(p_cfg->inp_precision)
+  {
+    case 8:
+      if(is_avg) WINDOWED_POOL(avgpool_8, WORD8); else WINDOWED_POOL(maxpool_8, WORD8);
+      break;
+    case -4:
+      if(is_avg) WINDOWED_POOL(avgpool_asym8s, WORD8); else WINDOWED_POOL(maxpool_asym8s, WORD8);
+      break;
+    case 16:
+      if(is_avg) WINDOWED_POOL(avgpool_16, WORD16); else WINDOWED_POOL(maxpool_16, WORD16);
+      break;
+#if HIFI_VFPU
+    case -1:
+      if(is_avg) WINDOWED_POOL(avgpool_f32, FLOAT32); else WINDOWED_POOL(maxpool_f32, FLOAT32);
+      break;
+#endif
+  }
+#undef WINDOWED_POOL
+
+  if(err)
+  {
+    printf("%s: windowed pool returned error\n", p_cfg->kernel_name);
+    match = 0;
+  }
+  else if(p_cfg->inp_precision == -1 && is_avg)
+  {
+    for(i = 0; i < ic; i++)
+    {
+      float ref = ((FLOAT32 *)p_ref)[i], out = ((FLOAT32 *)p_out->p)[i];
+      if(fabsf(out - ref) > 1e-5f * (1.0f + fabsf(ref)))
+      {
+        printf("global_avgpool channel %d: %f, windowed %f\n", i, out, ref);
+        match = 0;
+        break;
+      }
+    }
+  }
+  else if(memcmp(p_ref, p_out->p, ic * p_out->bytes_per_element))
+  {
+    printf("%s does not match the full plane windowed pool\n", p_cfg->kernel_name);
+    match = 0;
+  }
+
+  free(p_scratch);
+  free(p_ref);
+  return match;
+}
+
 int xa_nn_main_process(int argc, char *argv[])
 {
 
   int frame;
   int err = 0;
   int pass_count=0;
+  int frame_pass;
+  int global_check;
   char profiler_name[MAX_PROFILER_NAME_LENGTH]; 
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH]; 
   void *p_scratch;
@@ -336,6 +471,11 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
+  // Benchmark mode, random data is generated in place of reading the input file
+  bench_mode_config(cfg.bench, cfg.warmup, &cfg.write_file, &cfg.verify, &cfg.frames);
+
+  global_check = !strcmp(cfg.kernel_name,"global_avgpool") || !strcmp(cfg.kernel_name,"global_maxpool");
+
   inp_size = cfg.input_height * cfg.input_width * cfg.input_channels;
   out_size = cfg.out_height * cfg.out_width * cfg.input_channels;
 
@@ -361,6 +501,16 @@ int xa_nn_main_process(int argc, char *argv[])
     sprintf(profiler_params, "_asym8");
     strcat(profiler_name, profiler_params);
   }
+  else if(cfg.inp_precision == -4)
+  {
+    sprintf(profiler_params, "_asym8s");
+    strcat(profiler_name, profiler_params);
+  }
+  else if(cfg.inp_precision == -7)
+  {
+    sprintf(profiler_params, "_asym16s");
+    strcat(profiler_name, profiler_params);
+  }
   else
   {
     sprintf(profiler_params, "_%d", 
@@ -384,7 +534,7 @@ int xa_nn_main_process(int argc, char *argv[])
     /* If write_file (generate test vectors) is enabled, random data would be generated and
        used; the input data and output data generated would be written into files. 
      */
-    fptr_inp = file_open(pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+    fptr_inp = bench_file_open(cfg.bench, pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
   }
   else
   {
@@ -395,7 +545,7 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   // Open output file
-  fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+  fptr_out = bench_file_open(cfg.bench, pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
 
   // Open reference file if verify flag is enabled
   if(cfg.verify)
@@ -408,12 +558,14 @@ int xa_nn_main_process(int argc, char *argv[])
   p_inp = create_buf1D(inp_size, cfg.inp_precision);                              VALIDATE_PTR(p_inp);
   p_out = create_buf1D(out_size, cfg.out_precision);                              VALIDATE_PTR(p_out);
 
-  if(!strcmp(cfg.kernel_name,"avgpool"))
+  if(!strcmp(cfg.kernel_name,"avgpool") || !strcmp(cfg.kernel_name,"global_avgpool"))
     num_ops = out_size * (1 + cfg.kernel_height * cfg.kernel_width);
-  else if(!strcmp(cfg.kernel_name,"maxpool"))
+  else if(!strcmp(cfg.kernel_name,"maxpool") || !strcmp(cfg.kernel_name,"global_maxpool"))
     num_ops = out_size * cfg.kernel_height * cfg.kernel_width;
 
   XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, num_ops, "OPs/cyc", 1);
+  XTPWR_PROFILER_BYTES(0, BUF1D_BYTES(p_inp) + BUF1D_BYTES(p_out));
+  XTPWR_PROFILER_WARMUP(0, cfg.warmup);
 
   // Init
   WORD32 scratch_size = 0;
@@ -488,18 +640,24 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.verify)
     {
       read_buf1D_from_file(fptr_ref, p_ref);
-      pass_count += compare_buf1D(p_ref, p_out, cfg.verify, cfg.out_precision, 1);
+      frame_pass = compare_buf1D(p_ref, p_out, cfg.verify, cfg.out_precision, 1);
     }
     else
     {
-      pass_count += !err;
+      frame_pass = !err;
+    }
+    // Global pooling is also checked against the windowed pool over the full plane
+    if(global_check)
+    {
+      frame_pass = frame_pass && check_global_pool(&cfg, p_inp, p_out);
     }
+    pass_count += frame_pass;
   }
 
-  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), cfg.verify);
+  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), (cfg.verify || global_check));
 
-  fclose(fptr_inp);
-  fclose(fptr_out);
+  bench_file_close(fptr_inp);
+  bench_file_close(fptr_out);
 
   // Free all buffers
   free_buf1D(p_inp);
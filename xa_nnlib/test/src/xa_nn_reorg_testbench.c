@@ -28,6 +28,7 @@
 #include "xa_type_def.h"
 #include "nnlib/xa_nnlib_api.h"
 #include "xt_manage_buffers.h"
+#include "xt_bench_mode.h"
 #include "cmdline_parser.h"
 #include "file_io.h"
 #include "xa_nnlib_standards.h"
@@ -110,6 +111,8 @@ typedef struct _test_config_t
   char kernel_name[MAX_KERNEL_NAME_LENGTH];
   int frames;
   int write_file;
+  int bench;
+  int warmup;
   char read_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
   char read_ref_file_name[XA_MAX_CMD_LINE_LENGTH];
   char write_inp_file_name[XA_MAX_CMD_LINE_LENGTH];
@@ -161,6 +164,8 @@ int default_config(test_config_t *p_cfg)
     strcpy(p_cfg->kernel_name, "depth_to_space");
     p_cfg->frames   = 2;
     p_cfg->write_file = 0;
+    p_cfg->bench = 0;
+    p_cfg->warmup = 0;
     p_cfg->read_inp_file_name[0] = '\0';
     p_cfg->read_ref_file_name[0] = '\0';
     p_cfg->write_inp_file_name[0]='\0';
@@ -250,11 +255,13 @@ void show_usage(void)
     printf("\t-stride_3: stride for dimention 3; Default=1\n");
     printf("\t-stride_4: stride for dimention 4; Default=1\n");
     printf("\t-axis: axis dimension for concat or split_v kernel (-num_inp_dims to num_inp_dims-1); Default=0\n");
-    printf("\t-inp_precision: 8, 16; Default=8\n");
-    printf("\t-out_precision: 8, 16; Default=8\n");
+    printf("\t-inp_precision: 8, 16, 32; Default=8\n");
+    printf("\t-out_precision: 8, 16, 32; Default=8\n");
     printf("\t-frames: Positive number; Default=2\n");
-    printf("\t-kernel_name: depth_to_space, space_to_depth, pad, batch_to_space_nd, space_to_batch_nd, strided_slice, resize_bilinear, resize_nearest_neighbour; Default=""depth_to_space""\n");
+    printf("\t-kernel_name: depth_to_space, space_to_depth, pad, batch_to_space_nd, space_to_batch_nd, strided_slice, resize_bilinear, resize_bilinear_nhwc, resize_nearest_neighbour; Default=""depth_to_space""\n");
     printf("\t-write_file: set to 1 to write input and output vectors to file; Default=0\n");
+    printf("\t-bench: set to 1 to profile on random inputs, no input/output/reference files are used; Default=0\n");
+    printf("\t-warmup: frames run before the profiled frames, not included in the profile; Default=0\n");
     printf("\t-read_inp_file_name: Full filename for reading inputs (order - inp) \n");
     printf("\t-read_ref_file_name: Full filename for reading reference output \n");
     printf("\t-write_inp_file_name: Full filename for writing inputs (order - inp) \n");
@@ -325,6 +332,8 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     ARGTYPE_STRING("-kernel_name",p_cfg->kernel_name, MAX_KERNEL_NAME_LENGTH);
     ARGTYPE_ONETIME_CONFIG("-frames",p_cfg->frames);
     ARGTYPE_ONETIME_CONFIG("-write_file",p_cfg->write_file);
+    ARGTYPE_ONETIME_CONFIG("-bench",p_cfg->bench);
+    ARGTYPE_ONETIME_CONFIG("-warmup",p_cfg->warmup);
     ARGTYPE_STRING("-read_inp_file_name",p_cfg->read_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-read_ref_file_name",p_cfg->read_ref_file_name, XA_MAX_CMD_LINE_LENGTH);
     ARGTYPE_STRING("-write_inp_file_name",p_cfg->write_inp_file_name, XA_MAX_CMD_LINE_LENGTH);
@@ -528,6 +537,46 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     XTPWR_PROFILER_STOP(0);\
   }
 
+#define RESIZE_BILINEAR_NHWC_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision) && (OPREC == p_out->precision)) { \
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_##IPREC##_##OPREC ( \
+        (WORD##OPREC *)p_out->p, \
+        (WORD##IPREC *) p_inp->p, \
+        cfg.input_batch, \
+        cfg.input_height, \
+        cfg.input_width, \
+        cfg.input_channels, \
+        cfg.out_batch, \
+        cfg.out_height, \
+        cfg.out_width, \
+        cfg.out_channels, \
+        cfg.align_corners, \
+        cfg.half_pixel_centers, \
+        p_scratch); \
+    XTPWR_PROFILER_STOP(0);\
+  }
+
+#define RESIZE_BILINEAR_NHWC_F32_FN(KERNEL, IPREC, OPREC) \
+  if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision) && (OPREC == p_out->precision)) { \
+    XTPWR_PROFILER_START(0);\
+    err = xa_nn_##KERNEL##_f32_f32 ( \
+        (FLOAT32 *)p_out->p, \
+        (FLOAT32 *) p_inp->p, \
+        cfg.input_batch, \
+        cfg.input_height, \
+        cfg.input_width, \
+        cfg.input_channels, \
+        cfg.out_batch, \
+        cfg.out_height, \
+        cfg.out_width, \
+        cfg.out_channels, \
+        cfg.align_corners, \
+        cfg.half_pixel_centers, \
+        p_scratch); \
+    XTPWR_PROFILER_STOP(0);\
+  }
+
 #define RESIZE_NEAREST_NEIGHBOUR_FN(KERNEL, IPREC, OPREC) \
   if(!strcmp(cfg.kernel_name,#KERNEL) && (IPREC == p_inp->precision) && (OPREC == p_out->precision)) { \
     float height_scale, width_scale, height_bias, width_bias; \
@@ -558,8 +607,14 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
 #if HIFI_VFPU
 #define PROCESS_REORG \
     DEPTH_SPACE_KERNEL_FN(depth_to_space, 8, 8) \
+    else DEPTH_SPACE_KERNEL_FN(depth_to_space, 16, 16) \
+    else DEPTH_SPACE_KERNEL_FN(depth_to_space, 32, 32) \
     else DEPTH_SPACE_KERNEL_FN(space_to_depth, 8, 8) \
+    else DEPTH_SPACE_KERNEL_FN(space_to_depth, 16, 16) \
+    else DEPTH_SPACE_KERNEL_FN(space_to_depth, 32, 32) \
     else BATCH_SPACE_ND_KERNEL_FN(batch_to_space_nd, 8, 8) \
+    else BATCH_SPACE_ND_KERNEL_FN(batch_to_space_nd, 16, 16) \
+    else BATCH_SPACE_ND_KERNEL_FN(batch_to_space_nd, 32, 32) \
     else SPACE_TO_BATCH_ND_KERNEL_FN(space_to_batch_nd, 8, 8) \
     else PAD_KERNEL_FN(pad, 8, 8) \
     else PAD_KERNEL_FN(pad, 16, 16) \
@@ -569,16 +624,30 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else STRIDED_SLICE_FN(strided_slice, 8, 8) \
     else TRANSPOSE_KERNEL_FN(transpose, 8, 8) \
     else TRANSPOSE_KERNEL_FN(transpose, 16, 16) \
+    else TRANSPOSE_KERNEL_FN(transpose, 32, 32) \
     else CONCAT_KERNEL_FN(concat, 8, 8) \
+    else CONCAT_KERNEL_FN(concat, 16, 16) \
+    else CONCAT_KERNEL_FN(concat, 32, 32) \
     else SPLIT_V_KERNEL_FN(split_v, 8, 8) \
+    else SPLIT_V_KERNEL_FN(split_v, 16, 16) \
+    else SPLIT_V_KERNEL_FN(split_v, 32, 32) \
     else RESIZE_BILINEAR_FN(resize_bilinear, 8, 8) \
+    else RESIZE_BILINEAR_NHWC_FN(resize_bilinear_nhwc, 8, 8) \
+    else RESIZE_BILINEAR_NHWC_FN(resize_bilinear_nhwc, 16, 16) \
+    else RESIZE_BILINEAR_NHWC_F32_FN(resize_bilinear_nhwc, -1, -1) \
     else RESIZE_NEAREST_NEIGHBOUR_FN(resize_nearest_neighbour, 8, 8) \
     else {  printf("unsupported reorg operation\n"); return -1;}
 #else
 #define PROCESS_REORG \
     DEPTH_SPACE_KERNEL_FN(depth_to_space, 8, 8) \
+    else DEPTH_SPACE_KERNEL_FN(depth_to_space, 16, 16) \
+    else DEPTH_SPACE_KERNEL_FN(depth_to_space, 32, 32) \
     else DEPTH_SPACE_KERNEL_FN(space_to_depth, 8, 8) \
+    else DEPTH_SPACE_KERNEL_FN(space_to_depth, 16, 16) \
+    else DEPTH_SPACE_KERNEL_FN(space_to_depth, 32, 32) \
     else BATCH_SPACE_ND_KERNEL_FN(batch_to_space_nd, 8, 8) \
+    else BATCH_SPACE_ND_KERNEL_FN(batch_to_space_nd, 16, 16) \
+    else BATCH_SPACE_ND_KERNEL_FN(batch_to_space_nd, 32, 32) \
     else SPACE_TO_BATCH_ND_KERNEL_FN(space_to_batch_nd, 8, 8) \
     else PAD_KERNEL_FN(pad, 8, 8) \
     else PAD_KERNEL_FN(pad, 16, 16) \
@@ -588,12 +657,257 @@ void parse_arguments(int argc, char** argv, test_config_t *p_cfg)
     else STRIDED_SLICE_FN(strided_slice, 8, 8) \
     else TRANSPOSE_KERNEL_FN(transpose, 8, 8) \
     else TRANSPOSE_KERNEL_FN(transpose, 16, 16) \
+    else TRANSPOSE_KERNEL_FN(transpose, 32, 32) \
     else CONCAT_KERNEL_FN(concat, 8, 8) \
+    else CONCAT_KERNEL_FN(concat, 16, 16) \
+    else CONCAT_KERNEL_FN(concat, 32, 32) \
     else SPLIT_V_KERNEL_FN(split_v, 8, 8) \
+    else SPLIT_V_KERNEL_FN(split_v, 16, 16) \
+    else SPLIT_V_KERNEL_FN(split_v, 32, 32) \
     else RESIZE_BILINEAR_FN(resize_bilinear, 8, 8) \
+    else RESIZE_BILINEAR_NHWC_FN(resize_bilinear_nhwc, 8, 8) \
+    else RESIZE_BILINEAR_NHWC_FN(resize_bilinear_nhwc, 16, 16) \
     else {  printf("unsupported reorg operation\n"); return -1;}
 #endif
 
+/* Runs the inverse reorg with the 8 bit kernels on a byte view of p_out
+ * (innermost dim scaled by the element size) and compares the result with
+ * p_inp. Used for transpose, concat, split_v, depth_to_space, space_to_depth
+ * and batch_to_space_nd, returns 1 on a bitexact match. */
+static int check_reorg_with_inverse(test_config_t *p_cfg, buf1D_t *p_inp, buf1D_t *p_out)
+{
+  int bytes = p_inp->bytes_per_element;
+  int inp_bytes = BUF1D_BYTES(p_inp);
+  int i, itr_d, err = 0, match;
+  WORD8 *p_ref;
+  WORD32 inp_shape[MAX_NUM_INPS_CONCAT * MAX_DIMS_FOR_CONCAT];
+  WORD32 out_shape[MAX_NUM_OUTS_SPLIT_V * MAX_DIMS_FOR_SPLIT_V];
+  const WORD32 *p_shape_ar[MAX_NUM_INPS_CONCAT];
+  WORD8 *p_buf_ar[MAX_NUM_INPS_CONCAT];
+
+  p_ref = (WORD8 *)malloc(inp_bytes);
+  if(p_ref == NULL)
+  {
+    printf("p_ref: allocation failed\n");
+    return 0;
+  }
+
+  if(!strcmp(p_cfg->kernel_name, "transpose"))
+  {
+    /* Element bytes become an extra innermost dim that stays in place */
+    WORD32 inv_perm[MAX_DIMS];
+    for(i = 0; i < p_cfg->num_inp_dims; i++)
+    {
+      inv_perm[p_cfg->permute_vec[i]] = i;
+      out_shape[i] = p_cfg->output_shape[i];
+      inp_shape[i] = p_cfg->input_shape[i];
+    }
+    inv_perm[i] = i;
+    out_shape[i] = bytes;
+    inp_shape[i] = bytes;
+    err = xa_nn_transpose_8_8(p_ref, inp_shape, (WORD8 *)p_out->p, out_shape,
+        inv_perm, p_cfg->num_inp_dims + 1, p_cfg->num_inp_dims + 1);
+  }
+  else if(!strcmp(p_cfg->kernel_name, "concat") || !strcmp(p_cfg->kernel_name, "split_v"))
+  {
+    /* concat and split_v undo each other, the parts are contiguous in the
+     * buffer that holds them */
+    int is_concat = !strcmp(p_cfg->kernel_name, "concat");
+    int num_parts = is_concat ? p_cfg->num_inputs : p_cfg->num_outputs;
+    int num_dims = is_concat ? p_cfg->num_inp_dims : p_cfg->num_out_dims;
+    int *p_parts_shape = is_concat ? p_cfg->concat_inputs_shape : p_cfg->split_v_outputs_shape;
+    int *p_whole_shape = is_concat ? p_cfg->output_shape : p_cfg->input_shape;
+    WORD8 *p_parts = is_concat ? p_ref : (WORD8 *)p_out->p;
+    int offset = 0;
+    for(i = 0; i < num_parts; i++)
+    {
+      int part_size = bytes;
+      for(itr_d = 0; itr_d < num_dims; itr_d++)
+      {
+        inp_shape[i * num_dims + itr_d] = p_parts_shape[i * num_dims + itr_d];
+        part_size *= p_parts_shape[i * num_dims + itr_d];
+      }
+      inp_shape[i * num_dims + num_dims - 1] *= bytes;
+      p_shape_ar[i] = &inp_shape[i * num_dims];
+      p_buf_ar[i] = p_parts + offset;
+      offset += part_size;
+    }
+    for(itr_d = 0; itr_d < num_dims; itr_d++)
+    {
+      out_shape[itr_d] = p_whole_shape[itr_d];
+    }
+    out_shape[num_dims - 1] *= bytes;
+    if(is_concat)
+    {
+      err = xa_nn_split_v_8_8(p_buf_ar, p_shape_ar, (WORD8 *)p_out->p, out_shape,
+          num_parts, num_dims, num_dims, p_cfg->axis);
+    }
+    else
+    {
+      err = xa_nn_concat_8_8(p_ref, out_shape, (const WORD8 **)p_buf_ar, p_shape_ar,
+          num_dims, num_parts, num_dims, p_cfg->axis);
+    }
+  }
+  else if(!strcmp(p_cfg->kernel_name, "depth_to_space"))
+  {
+    err = xa_nn_space_to_depth_8_8(p_ref, (WORD8 *)p_out->p,
+        p_cfg->out_height, p_cfg->out_width, p_cfg->out_channels * bytes, p_cfg->block_size,
+        p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels * bytes, 0, 0);
+  }
+  else if(!strcmp(p_cfg->kernel_name, "space_to_depth"))
+  {
+    err = xa_nn_depth_to_space_8_8(p_ref, (WORD8 *)p_out->p,
+        p_cfg->out_height, p_cfg->out_width, p_cfg->out_channels * bytes, p_cfg->block_size,
+        p_cfg->input_height, p_cfg->input_width, p_cfg->input_channels * bytes, 0, 0);
+  }
+  else
+  {
+    /* batch_to_space_nd with zero crops, undone by space_to_batch_nd */
+    for(itr_d = 0; itr_d < p_cfg->num_inp_dims; itr_d++)
+    {
+      inp_shape[itr_d] = p_cfg->input_shape[itr_d];
+      out_shape[itr_d] = p_cfg->output_shape[itr_d];
+    }
+    inp_shape[p_cfg->num_inp_dims - 1] *= bytes;
+    out_shape[p_cfg->num_out_dims - 1] *= bytes;
+    err = xa_nn_space_to_batch_nd_8_8(p_ref, inp_shape, (WORD8 *)p_out->p, out_shape,
+        p_cfg->block_sizes, p_cfg->crop_or_pad_sizes, p_cfg->num_inp_dims, p_cfg->num_out_dims, 0);
+  }
+
+  match = !err && !memcmp(p_ref, p_inp->p, inp_bytes);
+  if(!match)
+  {
+    printf("%s output does not match the input after the inverse reorg\n", p_cfg->kernel_name);
+  }
+
+  free(p_ref);
+  return match;
+}
+
+static WORD32 ref_resize_scale_q10(int input_size, int out_size, int align_corners)
+{
+  if(align_corners && out_size > 1)
+    return (((input_size - 1) << 10) + (out_size - 1) / 2) / (out_size - 1);
+  return ((input_size << 10) + out_size / 2) / out_size;
+}
+
+/* TFLite integer source coordinate of output index 'itr' in Q10 */
+static void ref_resize_coord_q10(int itr, int input_size, WORD32 scale_10, int half_pixel_centers,
+    WORD32 *p_scaled, int *p_lower, int *p_upper)
+{
+  WORD32 scaled = itr * scale_10 + (half_pixel_centers ? (scale_10 / 2 - (1 << 9)) : 0);
+  int lower = scaled / (1 << 10);
+  int upper = (scaled + (1 << 10) - 1) / (1 << 10);
+  lower = lower < 0 ? 0 : lower;
+  *p_scaled = scaled;
+  *p_lower = lower < input_size - 1 ? lower : input_size - 1;
+  *p_upper = upper < input_size - 1 ? upper : input_size - 1;
+}
+
+/* TFLite float source coordinate of output index 'itr' */
+static void ref_resize_coord_f32(int itr, int input_size, int out_size, int align_corners,
+    int half_pixel_centers, float *p_scaled, int *p_lower, int *p_upper)
+{
+  float scale = (align_corners && out_size > 1) ? (input_size - 1) / (float)(out_size - 1)
+                                                : input_size / (float)out_size;
+  float scaled = half_pixel_centers ? ((itr + 0.5f) * scale - 0.5f) : (itr * scale);
+  int lower = (int)floorf(scaled);
+  int upper = (int)ceilf(scaled);
+  lower = lower < 0 ? 0 : lower;
+  *p_scaled = scaled;
+  *p_lower = lower < input_size - 1 ? lower : input_size - 1;
+  *p_upper = upper < input_size - 1 ? upper : input_size - 1;
+}
+
+/* Checks resize_bilinear_nhwc against the direct four-tap bilinear formula
+ * of the TFLite reference. 16 bit rounds the Q20 sum half away from zero
+ * and must match bitexact, f32 is compared with a small tolerance as the
+ * kernel blends separably. The 8 bit rounding depends on the library's
+ * TFLITE_SINGLE_ROUNDING, so 8 bit is compared bitexact against
+ * xa_nn_resize_bilinear_8_8 instead. Returns 1 on a match. */
+static int check_resize_bilinear_nhwc(test_config_t *p_cfg, buf1D_t *p_inp, buf1D_t *p_out)
+{
+  int itr_n, itr_h, itr_w, itr_c, err = 0, match = 1;
+  int ih = p_cfg->input_height, iw = p_cfg->input_width, ch = p_cfg->input_channels;
+  int oh = p_cfg->out_height, ow = p_cfg->out_width;
+  WORD32 height_scale_10 = ref_resize_scale_q10(ih, oh, p_cfg->align_corners);
+  WORD32 width_scale_10 = ref_resize_scale_q10(iw, ow, p_cfg->align_corners);
+
+  if(p_cfg->inp_precision == 8)
+  {
+    WORD8 *p_ref = (WORD8 *)malloc(p_out->length);
+    if(p_ref == NULL)
+    {
+      printf("p_ref: allocation failed\n");
+      return 0;
+    }
+    err = xa_nn_resize_bilinear_8_8(p_ref, (WORD8 *)p_inp->p, p_cfg->input_batch, ih, iw, ch,
+        p_cfg->out_batch, oh, ow, p_cfg->out_channels, height_scale_10, width_scale_10,
+        p_cfg->half_pixel_centers ? (height_scale_10 / 2 - (1 << 9)) : 0,
+        p_cfg->half_pixel_centers ? (width_scale_10 / 2 - (1 << 9)) : 0);
+    match = !err && !memcmp(p_ref, p_out->p, p_out->length);
+    free(p_ref);
+  }
+  else
+  {
+    for(itr_n = 0; itr_n < p_cfg->out_batch && match; itr_n++)
+    {
+      for(itr_h = 0; itr_h < oh && match; itr_h++)
+      {
+        for(itr_w = 0; itr_w < ow && match; itr_w++)
+        {
+          int y0, y1, x0, x1, out_idx;
+          int base = itr_n * ih * iw * ch;
+          out_idx = ((itr_n * oh + itr_h) * ow + itr_w) * ch;
+          if(p_cfg->inp_precision == 16)
+          {
+            WORD32 in_y, in_x, dy, dx;
+            WORD16 *p_in16 = (WORD16 *)p_inp->p;
+            ref_resize_coord_q10(itr_h, ih, height_scale_10, p_cfg->half_pixel_centers, &in_y, &y0, &y1);
+            ref_resize_coord_q10(itr_w, iw, width_scale_10, p_cfg->half_pixel_centers, &in_x, &x0, &x1);
+            dy = in_y - (y0 << 10);
+            dx = in_x - (x0 << 10);
+            for(itr_c = 0; itr_c < ch; itr_c++)
+            {
+              long long out_20, out;
+              out_20 = (long long)p_in16[base + (y0 * iw + x0) * ch + itr_c] * ((1 << 10) - dy) * ((1 << 10) - dx)
+                     + (long long)p_in16[base + (y1 * iw + x0) * ch + itr_c] * dy * ((1 << 10) - dx)
+                     + (long long)p_in16[base + (y0 * iw + x1) * ch + itr_c] * ((1 << 10) - dy) * dx
+                     + (long long)p_in16[base + (y1 * iw + x1) * ch + itr_c] * dy * dx;
+              out = (out_20 + (out_20 > 0 ? (1 << 19) : -(1 << 19))) / (1 << 20);
+              out = out > 32767 ? 32767 : (out < -32768 ? -32768 : out);
+              match = match && (((WORD16 *)p_out->p)[out_idx + itr_c] == (WORD16)out);
+            }
+          }
+          else
+          {
+            float in_y, in_x, dy, dx;
+            float *p_inf = (float *)p_inp->p;
+            ref_resize_coord_f32(itr_h, ih, oh, p_cfg->align_corners, p_cfg->half_pixel_centers, &in_y, &y0, &y1);
+            ref_resize_coord_f32(itr_w, iw, ow, p_cfg->align_corners, p_cfg->half_pixel_centers, &in_x, &x0, &x1);
+            dy = in_y - y0;
+            dx = in_x - x0;
+            for(itr_c = 0; itr_c < ch; itr_c++)
+            {
+              float out = p_inf[base + (y0 * iw + x0) * ch + itr_c] * (1 - dy) * (1 - dx)
+                        + p_inf[base + (y1 * iw + x0) * ch + itr_c] * dy * (1 - dx)
+                        + p_inf[base + (y0 * iw + x1) * ch + itr_c] * (1 - dy) * dx
+                        + p_inf[base + (y1 * iw + x1) * ch + itr_c] * dy * dx;
+              match = match && (fabsf(((float *)p_out->p)[out_idx + itr_c] - out) <= 1e-5f * (1.0f + fabsf(out)));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  if(!match)
+  {
+    printf("%s output does not match the bilinear reference\n", p_cfg->kernel_name);
+  }
+  return match;
+}
+
 int xa_nn_main_process(int argc, char *argv[])
 {
 
@@ -604,6 +918,9 @@ int xa_nn_main_process(int argc, char *argv[])
   char profiler_params[MAX_PROFILER_PARAMS_LENGTH];
   int inp_size, out_size/*, pad_values_size*/;
   int num_pts=0;
+  int inverse_check;
+  int ref_check;
+  int frame_pass;
   void *p_inp_ar[MAX_NUM_INPS_CONCAT];
   int *p_inp_shape_ar[MAX_NUM_INPS_CONCAT];
   void *p_out_ar[MAX_NUM_OUTS_SPLIT_V];
@@ -618,6 +935,7 @@ int xa_nn_main_process(int argc, char *argv[])
   FILE *fptr_inp;
   FILE *fptr_out;
   FILE *fptr_ref;
+  void *p_scratch;
 
   // permute_vec, pad_values and shape pointers for transpose and pad kernel
   WORD32 *p_inp_shape, *p_out_shape, *p_pad_shape, *p_pad_values, *p_permute_vec;
@@ -643,6 +961,9 @@ int xa_nn_main_process(int argc, char *argv[])
     }
   }
 
+  // Benchmark mode, random data is generated in place of reading the input file
+  bench_mode_config(cfg.bench, cfg.warmup, &cfg.write_file, &cfg.verify, &cfg.frames);
+
   if(strcmp(cfg.kernel_name, "pad") == 0)
   {
     inp_size = 1; 
@@ -771,7 +1092,7 @@ int xa_nn_main_process(int argc, char *argv[])
       inp_size *= cfg.input_shape[itr]; 
     }
   }
-  else if(strcmp(cfg.kernel_name, "resize_bilinear") == 0 || strcmp(cfg.kernel_name, "resize_nearest_neighbour") == 0)
+  else if(strcmp(cfg.kernel_name, "resize_bilinear") == 0 || strcmp(cfg.kernel_name, "resize_bilinear_nhwc") == 0 || strcmp(cfg.kernel_name, "resize_nearest_neighbour") == 0)
   {
     inp_size = cfg.input_batch * cfg.input_height * cfg.input_width * cfg.input_channels;
     out_size = cfg.out_batch * cfg.out_height * cfg.out_width * cfg.out_channels;
@@ -845,7 +1166,7 @@ int xa_nn_main_process(int argc, char *argv[])
   {
     sprintf(profiler_params, "inputs_shape= %s output_shape= %s axis = %d\n", cfg.read_inp_shape_str, cfg.read_split_v_outs_shape_str, cfg.axis);
   }
-  else if(strcmp(cfg.kernel_name, "resize_bilinear") == 0 || strcmp(cfg.kernel_name, "resize_nearest_neighbour") == 0)
+  else if(strcmp(cfg.kernel_name, "resize_bilinear") == 0 || strcmp(cfg.kernel_name, "resize_bilinear_nhwc") == 0 || strcmp(cfg.kernel_name, "resize_nearest_neighbour") == 0)
   {
     sprintf(profiler_params, "input_batch=%d, input_height=%d, input_width=%d, input_channels=%d, out_batch=%d, out_height=%d, out_width=%d, out_channels=%d",
       cfg.input_batch, cfg.input_height, cfg.input_width, cfg.input_channels, cfg.out_batch, cfg.out_height, cfg.out_width, cfg.out_channels);
@@ -862,7 +1183,7 @@ int xa_nn_main_process(int argc, char *argv[])
     /* If write_file (generate test vectors) is enabled, random data would be generated and
        used; the input data and output data generated would be written into files.
      */
-    fptr_inp = file_open(pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+    fptr_inp = bench_file_open(cfg.bench, pb_input_file_path, cfg.write_inp_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
   }
   else
   {
@@ -873,7 +1194,7 @@ int xa_nn_main_process(int argc, char *argv[])
   }
 
   // Open output file
-  fptr_out = file_open(pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
+  fptr_out = bench_file_open(cfg.bench, pb_output_file_path, cfg.write_out_file_name, "wb", XA_MAX_CMD_LINE_LENGTH);
 
   // Open reference file if verify flag is enabled
   if(cfg.verify)
@@ -886,6 +1207,18 @@ int xa_nn_main_process(int argc, char *argv[])
   p_inp = create_buf1D(inp_size, cfg.inp_precision);                              VALIDATE_PTR(p_inp);
   p_out = create_buf1D(out_size, cfg.out_precision);                              VALIDATE_PTR(p_out);
 
+  p_scratch = NULL;
+  if(strcmp(cfg.kernel_name, "resize_bilinear_nhwc") == 0)
+  {
+    WORD32 scratch_size = xa_nn_resize_bilinear_getsize(cfg.inp_precision, cfg.input_channels, cfg.out_height, cfg.out_width);
+    if(scratch_size <= 0)
+    {
+      printf("\nInvalid resize_bilinear_nhwc parameters\n");
+      return -1;
+    }
+    p_scratch = malloc(scratch_size);                                             VALIDATE_PTR(p_scratch);
+  }
+
   if(strcmp(cfg.kernel_name, "pad") == 0)
   {
     p_inp_shape  = cfg.input_shape;
@@ -909,6 +1242,7 @@ int xa_nn_main_process(int argc, char *argv[])
      || !strcmp(cfg.kernel_name,"space_to_batch_nd")
      || !strcmp(cfg.kernel_name,"strided_slice")
      || !strcmp(cfg.kernel_name,"resize_bilinear")
+     || !strcmp(cfg.kernel_name,"resize_bilinear_nhwc")
      || !strcmp(cfg.kernel_name,"resize_nearest_neighbour")
      || !strcmp(cfg.kernel_name,"concat")
      || !strcmp(cfg.kernel_name,"split_v"))
@@ -916,7 +1250,26 @@ int xa_nn_main_process(int argc, char *argv[])
     num_pts = out_size;
   }
 
+  inverse_check = !strcmp(cfg.kernel_name,"transpose")
+     || !strcmp(cfg.kernel_name,"concat")
+     || !strcmp(cfg.kernel_name,"split_v")
+     || !strcmp(cfg.kernel_name,"depth_to_space")
+     || !strcmp(cfg.kernel_name,"space_to_depth");
+  if(!strcmp(cfg.kernel_name,"batch_to_space_nd"))
+  {
+    int itr;
+    inverse_check = 1;
+    for(itr = 0; itr < 2*(cfg.num_inp_dims-2); itr++)
+    {
+      inverse_check = inverse_check && (cfg.crop_or_pad_sizes[itr] == 0);
+    }
+  }
+
+  ref_check = !strcmp(cfg.kernel_name,"resize_bilinear_nhwc");
+
   XTPWR_PROFILER_OPEN(0, profiler_name, profiler_params, num_pts, "cyc/point", 0);
+  XTPWR_PROFILER_BYTES(0, BUF1D_BYTES(p_inp) + BUF1D_BYTES(p_out));
+  XTPWR_PROFILER_WARMUP(0, cfg.warmup);
 
   // Frame processing loop
   for(frame = 0; frame < cfg.frames; frame++)
@@ -944,22 +1297,35 @@ int xa_nn_main_process(int argc, char *argv[])
     if(cfg.verify)
     {
       read_buf1D_from_file(fptr_ref, p_ref);
-      pass_count += compare_buf1D(p_ref, p_out, cfg.verify, cfg.out_precision, 1);
+      frame_pass = compare_buf1D(p_ref, p_out, cfg.verify, cfg.out_precision, 1);
     }
     else
     {
-      pass_count += !err;
+      frame_pass = !err;
+    }
+    if(inverse_check)
+    {
+      frame_pass = frame_pass && check_reorg_with_inverse(&cfg, p_inp, p_out);
     }
+    if(ref_check)
+    {
+      frame_pass = frame_pass && check_resize_bilinear_nhwc(&cfg, p_inp, p_out);
+    }
+    pass_count += frame_pass;
   }
 
-  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), cfg.verify);
+  XTPWR_PROFILER_CLOSE(0, (pass_count == cfg.frames), (cfg.verify || inverse_check || ref_check));
 
-  fclose(fptr_inp);
-  fclose(fptr_out);
+  bench_file_close(fptr_inp);
+  bench_file_close(fptr_out);
 
   // Free all buffers
   free_buf1D(p_inp);
   free_buf1D(p_out);
+  if(p_scratch)
+  {
+    free(p_scratch);
+  }
 
   if(cfg.verify)
   {